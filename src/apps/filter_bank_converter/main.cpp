@@ -0,0 +1,83 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "options.hpp"
+#include "../matrix_convolver/init_filter_matrix.hpp"
+
+#include <libefl/basic_matrix.hpp>
+
+#include <librbbl/fft_wrapper_factory.hpp>
+#include <librbbl/filter_bank_file.hpp>
+#include <librbbl/index_sequence.hpp>
+
+#include <libvisr/constants.hpp>
+#include <libvisr/version.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+
+/**
+ * Command line utility to convert a set of impulse responses from WAV files into a binary filter bank file, which
+ * can be loaded by the matrix convolver and other renderers without parsing and, optionally, without transforming the
+ * filters.
+ */
+int main( int argc, char const * const * argv )
+{
+  using namespace visr;
+  using namespace visr::apps::filter_bank_converter;
+
+  Options cmdLineOptions;
+  std::stringstream errMsg;
+  switch( cmdLineOptions.parse( argc, argv, errMsg ) )
+  {
+  case Options::ParseResult::Failure:
+    std::cerr << "Error while parsing command line options: " << errMsg.str( ) << std::endl;
+    return EXIT_FAILURE;
+  case Options::ParseResult::Help:
+    cmdLineOptions.printDescription( std::cout );
+    return EXIT_SUCCESS;
+  case Options::ParseResult::Version:
+    std::cout << "VISR filter bank converter " << visr::version::versionString() << std::endl;
+    return EXIT_SUCCESS;
+  case Options::ParseResult::Success:
+    break; // carry on
+  }
+
+  try
+  {
+    if( cmdLineOptions.getDefaultedOption<bool>( "list-fft-libraries", false ) )
+    {
+      std::cout << "Supported FFT libraries:"
+          << rbbl::FftWrapperFactory<SampleType>::listImplementations() << std::endl;
+      return EXIT_SUCCESS;
+    }
+    std::string const filterList = cmdLineOptions.getOption<std::string>( "filters" );
+    std::string const outputFile = cmdLineOptions.getOption<std::string>( "output" );
+    std::size_t const maxFilterLength = cmdLineOptions.getDefaultedOption<std::size_t>( "max-filter-length", std::numeric_limits<std::size_t>::max() );
+    std::size_t const maxFilters = cmdLineOptions.getDefaultedOption<std::size_t>( "max-filters", std::numeric_limits<std::size_t>::max() );
+    std::string const indexOffsetString = cmdLineOptions.getDefaultedOption<std::string>( "filter-file-index-offsets", std::string() );
+    std::size_t const blockLength = cmdLineOptions.getDefaultedOption<std::size_t>( "period", 0 );
+    std::string const fftLibrary = cmdLineOptions.getDefaultedOption<std::string>( "fft-library", "default" );
+
+    rbbl::IndexSequence const indexOffsets( indexOffsetString );
+    efl::BasicMatrix<SampleType> filters( cVectorAlignmentSamples );
+    apps::matrix_convolver::initFilterMatrix( filterList, maxFilterLength, maxFilters, indexOffsets, filters );
+
+    rbbl::FilterBankFile<SampleType>::write( outputFile, filters, blockLength, fftLibrary.c_str() );
+    std::cout << "Wrote " << filters.numberOfRows() << " filters of length " << filters.numberOfColumns()
+              << " to \"" << outputFile << "\"";
+    if( blockLength > 0 )
+    {
+      std::cout << ", including the frequency-domain representation for block length " << blockLength;
+    }
+    std::cout << "." << std::endl;
+  }
+  catch( std::exception const & ex )
+  {
+    std::cerr << "Error while converting the filters: " << ex.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,40 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "options.hpp"
+
+#include <string>
+
+namespace visr
+{
+namespace apps
+{
+namespace filter_bank_converter
+{
+
+Options::Options()
+ : apputilities::Options()
+{
+  registerOption<bool>( "list-fft-libraries", "List the supported FFT implementations that can be selected using the \"--fft-library\" option." );
+
+  registerOption<std::string>( "filters", "Impulse responses, specified as comma-separated list of one or multiple WAV files." );
+  registerOption<std::string>( "filter-file-index-offsets", "Index offsets to address the impulses in the provided multichannel filter files."
+    " If specified, the number of values must match the number of filter files." );
+  registerOption<std::size_t>( "max-filter-length,l", "Length of the impulse responses, in samples."
+    " If not given, it defaults to the longest provided filter." );
+  registerOption<std::size_t>( "max-filters", "Number of filters stored in the file. If not given, it is determined from the filter files." );
+
+  registerOption<std::string>( "output,o", "The filter bank file to be written." );
+
+  registerOption<std::size_t>( "period,p", "Block length of the partitioned convolution. If given, the frequency-domain representation"
+    " of the filters for this block length is stored in addition to the impulse responses." );
+  registerOption<std::string>( "fft-library", "The FFT implementation used for the frequency-domain representation."
+    " Must match the implementation used by the renderer. Defaults to the default implementation for the platform." );
+}
+
+Options::~Options()
+{
+}
+
+} // namespace filter_bank_converter
+} // namespace apps
+} // namespace visr
@@ -0,0 +1,27 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_APPS_FILTER_BANK_CONVERTER_OPTIONS_HPP_INCLUDED
+#define VISR_APPS_FILTER_BANK_CONVERTER_OPTIONS_HPP_INCLUDED
+
+#include <libapputilities/options.hpp>
+
+namespace visr
+{
+namespace apps
+{
+namespace filter_bank_converter
+{
+
+class Options: public apputilities::Options
+{
+public:
+  Options();
+
+  ~Options();
+};
+
+} // namespace filter_bank_converter
+} // namespace apps
+} // namespace visr
+
+#endif // #ifndef VISR_APPS_FILTER_BANK_CONVERTER_OPTIONS_HPP_INCLUDED
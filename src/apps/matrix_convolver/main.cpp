@@ -7,6 +7,7 @@
 #include <libefl/initialise_library.hpp>
 
 #include <librbbl/fft_wrapper_factory.hpp>
+#include <librbbl/filter_bank_file.hpp>
 #include <librbbl/filter_routing.hpp>
 #include <librbbl/index_sequence.hpp>
 
@@ -16,6 +17,7 @@
 #include <librcl/fir_filter_matrix.hpp>
 
 #include <librrl/audio_signal_flow.hpp>
+#include <librrl/block_size_adapter.hpp>
 #include <libaudiointerfaces/audio_interface_factory.hpp>
 
 #include <libaudiointerfaces/audio_interface_factory.hpp>
@@ -23,6 +25,7 @@
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstdio>
 #include <fstream>
@@ -90,13 +93,33 @@ int main( int argc, char const * const * argv )
     std::string const filterList = cmdLineOptions.getDefaultedOption<std::string>( "filters", std::string() );
     std::string const indexOffsetString = cmdLineOptions.getDefaultedOption<std::string>( "filter-file-index-offsets", std::string( ) );
     rbbl::IndexSequence const indexOffsets( indexOffsetString );
+    std::string const filterBankName = cmdLineOptions.getDefaultedOption<std::string>( "filter-bank", std::string() );
     efl::BasicMatrix<SampleType> initialFilters( cVectorAlignmentSamples );
-    initFilterMatrix( filterList, maxFilterLengthOption, maxFilterOption, indexOffsets, initialFilters );
-
-    // The final values for the number and length of filter slots are determined by the logic of the initialisation function.
-    std::size_t const maxFilters = initialFilters.numberOfRows();
+    std::unique_ptr<rbbl::FilterBankFile<SampleType> > filterBank;
+    std::size_t maxFilters;
+    std::size_t maxFilterLength;
+    if( not filterBankName.empty() )
+    {
+      if( not filterList.empty() )
+      {
+        throw std::invalid_argument( "The options \"--filters\" and \"--filter-bank\" cannot both be given." );
+      }
+      filterBank.reset( new rbbl::FilterBankFile<SampleType>( filterBankName ) );
+      maxFilters = std::max( filterBank->numberOfFilters(),
+        maxFilterOption == std::numeric_limits<std::size_t>::max() ? 0 : maxFilterOption );
+      maxFilterLength = std::max( filterBank->filterLength(),
+        maxFilterLengthOption == std::numeric_limits<std::size_t>::max() ? 0 : maxFilterLengthOption );
+    }
+    else
+    {
+      initFilterMatrix( filterList, maxFilterLengthOption, maxFilterOption, indexOffsets, initialFilters );
+      // The final values for the number and length of filter slots are determined by the logic of the initialisation function.
+      maxFilters = initialFilters.numberOfRows();
+      maxFilterLength = initialFilters.numberOfColumns();
+    }
 
     std::size_t const periodSize = cmdLineOptions.getDefaultedOption<std::size_t>( "period", 1024 );
+    std::size_t const processingPeriod = cmdLineOptions.getDefaultedOption<std::size_t>( "processing-period", periodSize );
     SamplingFrequencyType const samplingFrequency = cmdLineOptions.getDefaultedOption<SamplingFrequencyType>( "sampling-frequency", 48000 );
 
     std::string const fftLibrary = cmdLineOptions.getDefaultedOption<std::string>( "fft-library", "default" );
@@ -110,15 +133,25 @@ int main( int argc, char const * const * argv )
       }
     }
 
-    SignalFlowContext const context{ periodSize, samplingFrequency };
+    SignalFlowContext const context{ processingPeriod, samplingFrequency };
 
     rcl::FirFilterMatrix convolver( context, "MatrixConvolver", nullptr/*instantiate as top-level flow*/, numberOfInputChannels, numberOfOutputChannels,
-                                    initialFilters.numberOfColumns(), maxFilters, maxFilterRoutings,
+                                    maxFilterLength, maxFilters, maxFilterRoutings,
                                     initialFilters, routings,
                                     rcl::FirFilterMatrix::ControlPortConfig::None /*no control inputs*/,
                                     fftLibrary.c_str() );
+    if( filterBank )
+    {
+      convolver.setFilters( *filterBank );
+      filterBank.reset(); // The filters have been copied, so the file mapping is no longer needed.
+    }
 
     rrl::AudioSignalFlow flow( convolver );
+    rrl::BlockSizeAdapter adapter( flow, periodSize );
+    if( adapter.latency() != 0 )
+    {
+      std::cout << "Latency due to the processing period: " << adapter.latency() << " samples." << std::endl;
+    }
 
     std::string specConf;
     bool const hasAudioInterfaceOptionString = cmdLineOptions.hasOption("audio-ifc-options");
@@ -153,7 +186,7 @@ int main( int argc, char const * const * argv )
       
     std::unique_ptr<visr::audiointerfaces::AudioInterface> audioInterface( audiointerfaces::AudioInterfaceFactory::create( audioBackend, baseConfig, specConf) );
       
-    audioInterface->registerCallback( &rrl::AudioSignalFlow::processFunction, &flow );
+    audioInterface->registerCallback( &rrl::BlockSizeAdapter::processFunction, &adapter );
 
     // should there be a separate start() method for the audio interface?
     audioInterface->start( );
@@ -170,7 +203,7 @@ int main( int argc, char const * const * argv )
     audioInterface->stop( );
 
     // Should there be an explicit stop() method for the sound interface?
-    audioInterface->unregisterCallback( &rrl::AudioSignalFlow::processFunction );
+    audioInterface->unregisterCallback( &rrl::BlockSizeAdapter::processFunction );
 
     efl::DenormalisedNumbers::resetDenormHandling( oldDenormNumbersState );
   }
@@ -28,13 +28,19 @@ Options::Options()
   registerOption<bool>( "list-fft-libraries", "List the supported FFT implementations that can be selected using the \"--fftLibrary\" option." );
 
   registerOption<std::size_t>( "sampling-frequency,f", "Sampling frequency [Hz]" );
-  registerOption<std::size_t>( "period,p", "Period (block length): The number of samples per audio block, also the block size of the partitioned convolution." );
+  registerOption<std::size_t>( "period,p", "Period (block length): The number of samples per audio block, also the block size of the partitioned convolution"
+    " unless \"--processing-period\" is given." );
+  registerOption<std::size_t>( "processing-period", "Block size of the partitioned convolution if it differs from the audio period."
+    " Periods that are not multiples of the processing period add a latency of up to one processing period." );
 
   registerOption<std::size_t>( "input-channels,i", "Number of input channels for audio object signal." );
   registerOption<std::size_t>( "output-channels,o", "Number of audio output channels." );
 
   registerOption<std::string>( "filters", "Initial impulse responses, specified as comma-separated list of one or multiple WAV files." );
 
+  registerOption<std::string>( "filter-bank", "Initial impulse responses, specified as a binary filter bank file (see the filter_bank_converter utility)."
+    " Cannot be combined with \"--filters\"." );
+
   registerOption<std::string>( "filter-file-index-offsets", "Index offsets to address the impulses in the provided multichannel filter files."
     " If specified, the number of values must match the number of filter files." );
 
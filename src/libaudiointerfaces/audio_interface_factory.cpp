@@ -12,6 +12,9 @@
 #ifdef VISR_AUDIOINTERFACES_PORTAUDIO_SUPPORT
 #include <libaudiointerfaces/portaudio_interface.hpp>
 #endif
+#ifdef VISR_AUDIOINTERFACES_SHARED_MEMORY_SUPPORT
+#include <libaudiointerfaces/shared_memory_interface.hpp>
+#endif
 
 namespace visr
 {
@@ -81,6 +84,10 @@ struct InstantiateAudioInterfaceFactory
 #ifdef VISR_AUDIOINTERFACES_PORTAUDIO_SUPPORT
     AudioInterfaceFactory::registerAudioInterfaceType<
         audiointerfaces::PortaudioInterface >( "PortAudio" );
+#endif
+#ifdef VISR_AUDIOINTERFACES_SHARED_MEMORY_SUPPORT
+    AudioInterfaceFactory::registerAudioInterfaceType<
+        audiointerfaces::SharedMemoryInterface >( "SharedMemory" );
 #endif
   }
 };
@@ -7,12 +7,15 @@
 
 #include <libvisr/detail/compose_message_string.hpp>
 
+#include <libefl/sample_conversions.hpp>
+
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 
 #include <portaudio.h>
 
 #include <ciso646> // should not be necessary in C++11, but MSVC is non-compliant here
+#include <cstdint>
 #include <iostream>
 #include <map>
 #include <sstream>
@@ -302,6 +305,66 @@ namespace // unnamed
       return deviceIdx;
     }
 
+  /**
+   * Convert the capture samples delivered by portaudio into the channel buffers of the signal flow.
+   * Depending on the 'interleaved' mode, the portaudio buffer is either an array of samples or an array
+   * of pointers to the channel vectors.
+   */
+  template< typename ExternalType >
+  void deinterleaveSamples( void const * input, std::vector<SampleType *> const & channels,
+                            std::size_t periodSize, bool interleaved )
+  {
+    static_assert( std::is_same<SampleType, float >::value, "At the moment, only float is allowed as sample type." );
+    std::size_t const numChannels = channels.size();
+    if( interleaved )
+    {
+      if( efl::vectorDeinterleaveSamples( static_cast<ExternalType const *>(input), channels.data(), numChannels,
+        periodSize, cVectorAlignmentSamples ) != efl::noError )
+      {
+        throw std::runtime_error( "PortaudioInterface: Error while converting the capture samples." );
+      }
+      return;
+    }
+    ExternalType const * const * const inputChannels = static_cast<ExternalType const * const *>(input);
+    for( std::size_t channelIndex( 0 ); channelIndex < numChannels; ++channelIndex )
+    {
+      if( efl::vectorDeinterleaveSamples( inputChannels[channelIndex], &channels[channelIndex], 1,
+        periodSize, cVectorAlignmentSamples ) != efl::noError )
+      {
+        throw std::runtime_error( "PortaudioInterface: Error while converting the capture samples." );
+      }
+    }
+  }
+
+  /**
+   * Convert the playback signals of the signal flow into the sample format and layout of the portaudio output buffer.
+   */
+  template< typename ExternalType >
+  void interleaveSamples( std::vector<SampleType *> const & channels, void * output,
+                          std::size_t periodSize, bool interleaved )
+  {
+    static_assert( std::is_same<SampleType, float >::value, "At the moment, only float is allowed as sample type." );
+    std::size_t const numChannels = channels.size();
+    if( interleaved )
+    {
+      if( efl::vectorInterleaveSamples( channels.data(), static_cast<ExternalType *>(output), numChannels,
+        periodSize, cVectorAlignmentSamples ) != efl::noError )
+      {
+        throw std::runtime_error( "PortaudioInterface: Error while converting the playback samples." );
+      }
+      return;
+    }
+    ExternalType * const * const outputChannels = static_cast<ExternalType * const *>(output);
+    for( std::size_t channelIndex( 0 ); channelIndex < numChannels; ++channelIndex )
+    {
+      if( efl::vectorInterleaveSamples( &channels[channelIndex], outputChannels[channelIndex], 1,
+        periodSize, cVectorAlignmentSamples ) != efl::noError )
+      {
+        throw std::runtime_error( "PortaudioInterface: Error while converting the playback samples." );
+      }
+    }
+  }
+
   } // unnamed namespace
 
   PortaudioInterface::Impl::Impl( Configuration const & baseConfig, std::string const & conf )
@@ -319,6 +382,11 @@ namespace // unnamed
     
     PortaudioInterface::Config config = parseSpecificConf(conf);
     mSampleFormat = config.mSampleFormat;
+    if( (mSampleFormat != Config::SampleFormat::signedInt16Bit) and (mSampleFormat != Config::SampleFormat::signedInt24Bit)
+      and (mSampleFormat != Config::SampleFormat::signedInt32Bit) and (mSampleFormat != Config::SampleFormat::float32Bit) )
+    {
+      throw std::invalid_argument( "PortaudioInterface: Only the sample formats signedInt16Bit, signedInt24Bit, signedInt32Bit, and float32Bit are supported." );
+    }
     mInterleaved = config.mInterleaved;
     mHostApiName = config.mHostApi;
     
@@ -538,49 +606,45 @@ namespace // unnamed
   
   void PortaudioInterface::Impl::transferPlaybackBuffers( void * output )
   {
-    static_assert( std::is_same<SampleType, float >::value, "At the moment, only float is allowed as sample type." );
-    if( (mSampleFormat != Config::SampleFormat::float32Bit ) /*or mInterleaved*/  )
+    switch( mSampleFormat )
     {
-      throw std::invalid_argument( "At the moment, the portaudio interface supports only the sample type float32 in non-interleaved mode." );
-    }
-    for( std::size_t channelIndex( 0 ); channelIndex < mNumPlaybackChannels; ++channelIndex )
-    {
-      SampleType const * inputPtr = mPlaybackSampleBuffers[channelIndex];
-      const std::size_t outStride = (mInterleaved ? mNumPlaybackChannels : 1);
-      // Note: depending in the 'interleaved' mode the portaudio buffer variables are either arrays of samples or
-      // pointer arrays to sample vectors.
-      float * outputPtr = mInterleaved ?
-      reinterpret_cast<float *>(output) + channelIndex :
-      reinterpret_cast<float * const * >(output)[channelIndex];
-      for( std::size_t sampleIdx( 0 ); sampleIdx < mPeriodSize; ++sampleIdx, ++inputPtr )
-      {
-        *outputPtr = *inputPtr;
-        outputPtr += outStride;
-      }
+    case Config::SampleFormat::signedInt16Bit:
+      interleaveSamples<std::int16_t>( mPlaybackSampleBuffers, output, mPeriodSize, mInterleaved );
+      break;
+    case Config::SampleFormat::signedInt24Bit:
+      interleaveSamples<efl::Int24>( mPlaybackSampleBuffers, output, mPeriodSize, mInterleaved );
+      break;
+    case Config::SampleFormat::signedInt32Bit:
+      interleaveSamples<std::int32_t>( mPlaybackSampleBuffers, output, mPeriodSize, mInterleaved );
+      break;
+    case Config::SampleFormat::float32Bit:
+      interleaveSamples<float>( mPlaybackSampleBuffers, output, mPeriodSize, mInterleaved );
+      break;
+    default:
+      // Rejected in the constructor.
+      throw std::logic_error( "PortaudioInterface: Unsupported sample format." );
     }
   }
   
   void PortaudioInterface::Impl::transferCaptureBuffers( void const * input )
   {
-    static_assert(std::is_same<SampleType, float >::value, "At the moment, only float is allowed as sample type.");
-    if( (mSampleFormat != Config::SampleFormat::float32Bit) /*or mInterleaved*/ )
-    {
-      throw std::invalid_argument( "At the moment, the portaudio interface supports only the sample type float32 in un-interleaved mode." );
-    }
-    for( std::size_t channelIndex( 0 ); channelIndex < mNumCaptureChannels; ++channelIndex )
+    switch( mSampleFormat )
     {
-      SampleType * outputPtr = mCaptureSampleBuffers[channelIndex];
-      const std::size_t inStride = (mInterleaved ? mNumCaptureChannels : 1);
-      // Note: depending in the 'interleaved' mode the portaudio buffer variables are either arrays of samples or
-      // pointer arrays to sample vectors.
-      float const * inputPtr = mInterleaved ?
-      reinterpret_cast<float const *>(input) + channelIndex :
-      reinterpret_cast<float const * const * >(input)[channelIndex];
-      for( std::size_t sampleIdx( 0 ); sampleIdx < mPeriodSize; ++sampleIdx, ++outputPtr )
-      {
-        *outputPtr = *inputPtr;
-        inputPtr += inStride;
-      }
+    case Config::SampleFormat::signedInt16Bit:
+      deinterleaveSamples<std::int16_t>( input, mCaptureSampleBuffers, mPeriodSize, mInterleaved );
+      break;
+    case Config::SampleFormat::signedInt24Bit:
+      deinterleaveSamples<efl::Int24>( input, mCaptureSampleBuffers, mPeriodSize, mInterleaved );
+      break;
+    case Config::SampleFormat::signedInt32Bit:
+      deinterleaveSamples<std::int32_t>( input, mCaptureSampleBuffers, mPeriodSize, mInterleaved );
+      break;
+    case Config::SampleFormat::float32Bit:
+      deinterleaveSamples<float>( input, mCaptureSampleBuffers, mPeriodSize, mInterleaved );
+      break;
+    default:
+      // Rejected in the constructor.
+      throw std::logic_error( "PortaudioInterface: Unsupported sample format." );
     }
   }
   
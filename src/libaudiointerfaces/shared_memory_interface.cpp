@@ -0,0 +1,745 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "shared_memory_interface.hpp"
+
+#include <libefl/basic_matrix.hpp>
+
+#include <libvisr/constants.hpp>
+#include <libvisr/detail/compose_message_string.hpp>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <ciso646>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace visr
+{
+namespace audiointerfaces
+{
+
+namespace // unnamed
+{
+
+std::uint32_t const cRingMagic = 0x56495352; // "VISR"
+
+std::uint32_t const cRingVersion = 1;
+
+/**
+ * Maximum time to wait for another process to finish the initialisation of a ring buffer.
+ */
+std::chrono::milliseconds const cAttachTimeout( 2000 );
+
+/**
+ * Maximum time a driven process waits for new data before checking whether it has been stopped.
+ */
+std::chrono::milliseconds const cWaitTimeout( 100 );
+
+static_assert( sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "Futex words must be plain 32-bit integers." );
+static_assert( ATOMIC_INT_LOCK_FREE == 2 and ATOMIC_LLONG_LOCK_FREE == 2,
+  "Shared-memory communication requires lock-free atomics." );
+
+/**
+ * Control block at the start of each shared-memory ring.
+ * The sample data follows at offset cDataOffset and consists of numberOfBlocks blocks, each holding numberOfChannels
+ * channel vectors of channelStride samples.
+ * The read and write counters are placed in separate cache lines to avoid false sharing between the processes.
+ */
+struct RingHeader
+{
+  /**
+   * Set to cRingMagic by the creating process after all other members have been initialised.
+   */
+  std::atomic<std::uint32_t> magic;
+  std::uint32_t version;
+  std::uint32_t numberOfChannels;
+  std::uint32_t periodSize;
+  std::uint32_t channelStride;
+  std::uint32_t numberOfBlocks;
+  std::uint32_t sampleRate;
+  /**
+   * Number of processes that have the ring mapped. The last one unlinks the shared memory object.
+   */
+  std::atomic<std::uint32_t> attachCount;
+
+  /**
+   * Total number of blocks written. Modified by the producer only.
+   */
+  alignas(64) std::atomic<std::uint64_t> writeCount;
+  /**
+   * Incremented after each write, used as futex word to wake the consumer.
+   */
+  std::atomic<std::uint32_t> dataSequence;
+
+  /**
+   * Total number of blocks read. Modified by the consumer only.
+   */
+  alignas(64) std::atomic<std::uint64_t> readCount;
+};
+
+std::size_t const cDataOffset = ((sizeof(RingHeader) + 63) / 64) * 64;
+
+std::uint32_t * futexWord( std::atomic<std::uint32_t> & word )
+{
+  return reinterpret_cast<std::uint32_t *>( &word );
+}
+
+void futexWait( std::atomic<std::uint32_t> & word, std::uint32_t expected, std::chrono::nanoseconds timeout )
+{
+  struct timespec ts;
+  ts.tv_sec = static_cast<std::time_t>( timeout.count() / 1000000000 );
+  ts.tv_nsec = static_cast<long>( timeout.count() % 1000000000 );
+  // Returns immediately if the word differs from the expected value. Spurious wakeups are handled by the caller.
+  syscall( SYS_futex, futexWord( word ), FUTEX_WAIT, expected, &ts, nullptr, 0 );
+}
+
+void futexWakeAll( std::atomic<std::uint32_t> & word )
+{
+  syscall( SYS_futex, futexWord( word ), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0 );
+}
+
+/**
+ * Return the name of the POSIX shared memory object for a ring, which must start with a slash.
+ */
+std::string sharedMemoryObjectName( std::string const & ringName )
+{
+  if( ringName.empty() )
+  {
+    throw std::invalid_argument( "SharedMemoryInterface: The ring name must not be empty." );
+  }
+  return ringName.front() == '/' ? ringName : "/" + ringName;
+}
+
+/**
+ * Single-producer/single-consumer ring buffer of audio blocks in a named POSIX shared memory object.
+ * The ring is created by whichever of the two processes opens it first; the other one attaches to it and checks that
+ * the configurations match.
+ * The clock master resets the read and write counters when it attaches to an existing ring, which might have been
+ * left behind by a crashed process. This discards any stale blocks.
+ */
+class SharedMemoryRing
+{
+public:
+  SharedMemoryRing( std::string const & name,
+                    std::size_t numberOfChannels,
+                    std::size_t periodSize,
+                    std::size_t sampleRate,
+                    std::size_t numberOfBlocks,
+                    bool clockMaster );
+
+  ~SharedMemoryRing();
+
+  SharedMemoryRing( SharedMemoryRing const & ) = delete;
+
+  SharedMemoryRing & operator=( SharedMemoryRing const & ) = delete;
+
+  /**
+   * Return the channel pointers of the next block to be written, or nullptr if the ring is full.
+   */
+  SampleType * const * writeBlock()
+  {
+    std::uint64_t const writeCount = mHeader->writeCount.load( std::memory_order_relaxed );
+    if( writeCount - mHeader->readCount.load( std::memory_order_acquire ) >= mNumberOfBlocks )
+    {
+      return nullptr;
+    }
+    return mChannelPointers.data() + (writeCount % mNumberOfBlocks) * mNumberOfChannels;
+  }
+
+  /**
+   * Publish the block obtained by writeBlock() and wake the consumer.
+   */
+  void commitWrite()
+  {
+    mHeader->writeCount.fetch_add( 1, std::memory_order_release );
+    mHeader->dataSequence.fetch_add( 1, std::memory_order_release );
+    futexWakeAll( mHeader->dataSequence );
+  }
+
+  /**
+   * Return the channel pointers of the oldest unread block, or nullptr if the ring is empty.
+   */
+  SampleType const * const * readBlock()
+  {
+    std::uint64_t const readCount = mHeader->readCount.load( std::memory_order_relaxed );
+    if( mHeader->writeCount.load( std::memory_order_acquire ) == readCount )
+    {
+      return nullptr;
+    }
+    return mChannelPointers.data() + (readCount % mNumberOfBlocks) * mNumberOfChannels;
+  }
+
+  /**
+   * Release the block obtained by readBlock() to the producer.
+   */
+  void commitRead()
+  {
+    mHeader->readCount.fetch_add( 1, std::memory_order_release );
+  }
+
+  bool hasData() const
+  {
+    return mHeader->writeCount.load( std::memory_order_acquire ) != mHeader->readCount.load( std::memory_order_relaxed );
+  }
+
+  std::uint32_t dataSequence() const
+  {
+    return mHeader->dataSequence.load( std::memory_order_acquire );
+  }
+
+  /**
+   * Block until data has been written after \p sequence has been obtained from dataSequence(), wakeUp() has been
+   * called, or the timeout has expired.
+   */
+  void waitForData( std::uint32_t sequence, std::chrono::nanoseconds timeout )
+  {
+    futexWait( mHeader->dataSequence, sequence, timeout );
+  }
+
+  void wakeUp()
+  {
+    futexWakeAll( mHeader->dataSequence );
+  }
+
+private:
+  void unmap();
+
+  std::string const mName;
+
+  void * mMemory;
+
+  std::size_t mSize;
+
+  RingHeader * mHeader;
+
+  std::size_t mNumberOfChannels;
+
+  std::size_t mNumberOfBlocks;
+
+  std::vector<SampleType *> mChannelPointers;
+};
+
+SharedMemoryRing::SharedMemoryRing( std::string const & name,
+                                    std::size_t numberOfChannels,
+                                    std::size_t periodSize,
+                                    std::size_t sampleRate,
+                                    std::size_t numberOfBlocks,
+                                    bool clockMaster )
+ : mName( sharedMemoryObjectName( name ) )
+ , mMemory( MAP_FAILED )
+ , mSize( 0 )
+ , mHeader( nullptr )
+ , mNumberOfChannels( numberOfChannels )
+ , mNumberOfBlocks( numberOfBlocks )
+{
+  std::size_t const channelStride = ((periodSize + cVectorAlignmentSamples - 1) / cVectorAlignmentSamples) * cVectorAlignmentSamples;
+  bool created = true;
+  int fd = shm_open( mName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600 );
+  if( fd >= 0 )
+  {
+    mSize = cDataOffset + numberOfBlocks * numberOfChannels * channelStride * sizeof(SampleType);
+    if( ftruncate( fd, static_cast<off_t>(mSize) ) != 0 )
+    {
+      int const err = errno;
+      close( fd );
+      shm_unlink( mName.c_str() );
+      throw std::runtime_error( detail::composeMessageString( "SharedMemoryInterface: Cannot resize ring \"", mName,
+        "\": ", std::strerror( err ) ) );
+    }
+  }
+  else if( errno == EEXIST )
+  {
+    created = false;
+    fd = shm_open( mName.c_str(), O_RDWR, 0 );
+    if( fd < 0 )
+    {
+      throw std::runtime_error( detail::composeMessageString( "SharedMemoryInterface: Cannot open ring \"", mName,
+        "\": ", std::strerror( errno ) ) );
+    }
+    // The creating process might not have set the size yet.
+    auto const deadline = std::chrono::steady_clock::now() + cAttachTimeout;
+    struct stat status;
+    while( (fstat( fd, &status ) == 0) and (static_cast<std::size_t>(status.st_size) < cDataOffset) )
+    {
+      if( std::chrono::steady_clock::now() > deadline )
+      {
+        close( fd );
+        throw std::runtime_error( detail::composeMessageString( "SharedMemoryInterface: Ring \"", mName,
+          "\" has not been initialised by the creating process." ) );
+      }
+      std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+    mSize = static_cast<std::size_t>(status.st_size);
+  }
+  else
+  {
+    throw std::runtime_error( detail::composeMessageString( "SharedMemoryInterface: Cannot create ring \"", mName,
+      "\": ", std::strerror( errno ) ) );
+  }
+  mMemory = mmap( nullptr, mSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  int const mapError = errno;
+  close( fd ); // The mapping remains valid.
+  if( mMemory == MAP_FAILED )
+  {
+    if( created )
+    {
+      shm_unlink( mName.c_str() );
+    }
+    throw std::runtime_error( detail::composeMessageString( "SharedMemoryInterface: Cannot map ring \"", mName,
+      "\": ", std::strerror( mapError ) ) );
+  }
+  mHeader = static_cast<RingHeader *>(mMemory);
+  if( created )
+  {
+    // The memory of a newly created shared memory object is zero-initialised.
+    new (mMemory) RingHeader;
+    mHeader->version = cRingVersion;
+    mHeader->numberOfChannels = static_cast<std::uint32_t>(numberOfChannels);
+    mHeader->periodSize = static_cast<std::uint32_t>(periodSize);
+    mHeader->channelStride = static_cast<std::uint32_t>(channelStride);
+    mHeader->numberOfBlocks = static_cast<std::uint32_t>(numberOfBlocks);
+    mHeader->sampleRate = static_cast<std::uint32_t>(sampleRate);
+    mHeader->attachCount.store( 0, std::memory_order_relaxed );
+    mHeader->writeCount.store( 0, std::memory_order_relaxed );
+    mHeader->dataSequence.store( 0, std::memory_order_relaxed );
+    mHeader->readCount.store( 0, std::memory_order_relaxed );
+    mHeader->magic.store( cRingMagic, std::memory_order_release );
+  }
+  else
+  {
+    auto const deadline = std::chrono::steady_clock::now() + cAttachTimeout;
+    while( mHeader->magic.load( std::memory_order_acquire ) != cRingMagic )
+    {
+      if( std::chrono::steady_clock::now() > deadline )
+      {
+        unmap();
+        throw std::runtime_error( detail::composeMessageString( "SharedMemoryInterface: \"", mName,
+          "\" is not a VISR audio ring." ) );
+      }
+      std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+    mNumberOfBlocks = mHeader->numberOfBlocks;
+    if( (mHeader->version != cRingVersion) or (mHeader->numberOfChannels != numberOfChannels)
+      or (mHeader->periodSize != periodSize) or (mHeader->sampleRate != sampleRate)
+      or (mHeader->channelStride != channelStride)
+      or (mSize < cDataOffset + mNumberOfBlocks * numberOfChannels * channelStride * sizeof(SampleType)) )
+    {
+      std::stringstream msg;
+      msg << "SharedMemoryInterface: The configuration of ring \"" << mName << "\" (" << mHeader->numberOfChannels
+          << " channels, period " << mHeader->periodSize << ", sampling frequency " << mHeader->sampleRate
+          << ") does not match the requested configuration (" << numberOfChannels << " channels, period "
+          << periodSize << ", sampling frequency " << sampleRate << ").";
+      unmap();
+      throw std::invalid_argument( msg.str() );
+    }
+    if( clockMaster )
+    {
+      // The other process does not access the ring before the clock master has started.
+      mHeader->readCount.store( 0, std::memory_order_relaxed );
+      mHeader->writeCount.store( 0, std::memory_order_release );
+    }
+  }
+  mHeader->attachCount.fetch_add( 1, std::memory_order_acq_rel );
+
+  SampleType * const data = reinterpret_cast<SampleType *>( static_cast<char *>(mMemory) + cDataOffset );
+  mChannelPointers.resize( mNumberOfBlocks * mNumberOfChannels );
+  for( std::size_t idx( 0 ); idx < mChannelPointers.size(); ++idx )
+  {
+    mChannelPointers[idx] = data + idx * channelStride;
+  }
+}
+
+SharedMemoryRing::~SharedMemoryRing()
+{
+  if( mHeader->attachCount.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+  {
+    shm_unlink( mName.c_str() );
+  }
+  unmap();
+}
+
+void SharedMemoryRing::unmap()
+{
+  if( munmap( mMemory, mSize ) != 0 ) // Also called from the destructor, must not throw.
+  {
+    std::cerr << "SharedMemoryInterface: Error while unmapping ring \"" << mName << "\"." << std::endl;
+  }
+}
+
+} // unnamed namespace
+
+/******************************************************************************/
+/* Definition of the internal implementation class SharedMemoryInterface::Impl */
+
+class SharedMemoryInterface::Impl
+{
+public:
+  explicit Impl( Configuration const & baseConfig, std::string const & config );
+
+  ~Impl();
+
+  void start();
+
+  void stop();
+
+  bool registerCallback( AudioCallback callback, void* userData );
+
+  bool unregisterCallback( AudioCallback audioCallback );
+
+  std::size_t const mNumCaptureChannels;
+  std::size_t const mNumPlaybackChannels;
+  std::size_t const mPeriodSize;
+  std::size_t const mSampleRate;
+
+  std::atomic<std::size_t> mOverruns;
+  std::atomic<std::size_t> mUnderruns;
+
+private:
+  static SharedMemoryInterface::Config parseSpecificConf( std::string const & config );
+
+  /**
+   * Processing loop of the clock master, which runs the callback at the nominal block rate.
+   */
+  void runClockMaster();
+
+  /**
+   * Processing loop of a driven process, which runs the callback whenever a capture block is available.
+   */
+  void runDriven();
+
+  void processBlock();
+
+  bool mClockMaster;
+
+  int mRealtimePriority;
+
+  std::unique_ptr<SharedMemoryRing> mCaptureRing;
+
+  std::unique_ptr<SharedMemoryRing> mPlaybackRing;
+
+  Base::AudioCallback mCallback;
+
+  void* mCallbackUserData;
+
+  /**
+   * Silent capture signals, used if there is no capture ring or the capture ring is empty.
+   */
+  efl::BasicMatrix<SampleType> mSilentCapture;
+
+  /**
+   * Playback signals that are discarded, used if there is no playback ring or the playback ring is full.
+   */
+  efl::BasicMatrix<SampleType> mDiscardedPlayback;
+
+  std::vector<SampleType const *> mSilentCapturePointers;
+
+  std::vector<SampleType *> mDiscardedPlaybackPointers;
+
+  std::atomic<bool> mRunning;
+
+  std::thread mThread;
+};
+
+SharedMemoryInterface::Impl::Impl( Configuration const & baseConfig, std::string const & conf )
+ : mNumCaptureChannels( baseConfig.numCaptureChannels() )
+ , mNumPlaybackChannels( baseConfig.numPlaybackChannels() )
+ , mPeriodSize( baseConfig.periodSize() )
+ , mSampleRate( baseConfig.sampleRate() )
+ , mOverruns( 0 )
+ , mUnderruns( 0 )
+ , mCallback( nullptr )
+ , mCallbackUserData( nullptr )
+ , mSilentCapture( mNumCaptureChannels, mPeriodSize, cVectorAlignmentSamples )
+ , mDiscardedPlayback( mNumPlaybackChannels, mPeriodSize, cVectorAlignmentSamples )
+ , mSilentCapturePointers( mNumCaptureChannels, nullptr )
+ , mDiscardedPlaybackPointers( mNumPlaybackChannels, nullptr )
+ , mRunning( false )
+{
+  SharedMemoryInterface::Config const config = parseSpecificConf( conf );
+  if( (mPeriodSize == 0) or (mSampleRate == 0) )
+  {
+    throw std::invalid_argument( "SharedMemoryInterface: The period and the sampling frequency must be nonzero." );
+  }
+  if( not config.mClockMaster and config.mCaptureRing.empty() )
+  {
+    throw std::invalid_argument( "SharedMemoryInterface: An interface that is not the clock master requires a capture ring." );
+  }
+  if( (not config.mCaptureRing.empty()) and (config.mCaptureRing == config.mPlaybackRing) )
+  {
+    throw std::invalid_argument( "SharedMemoryInterface: The capture and playback rings must be different." );
+  }
+  if( config.mRingBlocks < 2 )
+  {
+    throw std::invalid_argument( "SharedMemoryInterface: The ring size must be at least two blocks." );
+  }
+  mClockMaster = config.mClockMaster;
+  mRealtimePriority = config.mRealtimePriority;
+  if( not config.mCaptureRing.empty() )
+  {
+    mCaptureRing.reset( new SharedMemoryRing( config.mCaptureRing, mNumCaptureChannels, mPeriodSize, mSampleRate,
+      config.mRingBlocks, mClockMaster ) );
+  }
+  if( not config.mPlaybackRing.empty() )
+  {
+    mPlaybackRing.reset( new SharedMemoryRing( config.mPlaybackRing, mNumPlaybackChannels, mPeriodSize, mSampleRate,
+      config.mRingBlocks, mClockMaster ) );
+  }
+  for( std::size_t chIdx( 0 ); chIdx < mNumCaptureChannels; ++chIdx )
+  {
+    mSilentCapturePointers[chIdx] = mSilentCapture.row( chIdx );
+  }
+  for( std::size_t chIdx( 0 ); chIdx < mNumPlaybackChannels; ++chIdx )
+  {
+    mDiscardedPlaybackPointers[chIdx] = mDiscardedPlayback.row( chIdx );
+  }
+}
+
+SharedMemoryInterface::Impl::~Impl()
+{
+  stop();
+}
+
+/*static*/ SharedMemoryInterface::Config
+SharedMemoryInterface::Impl::parseSpecificConf( std::string const & config )
+{
+  std::stringstream stream( config.empty() ? "{}" : config ); // Cope with empty optional configs (the default)
+  boost::property_tree::ptree tree;
+  try
+  {
+    read_json( stream, tree );
+  }
+  catch( std::exception const & ex )
+  {
+    throw std::invalid_argument( std::string( "Error while parsing a json shared memory interface configuration string: " ) + ex.what() );
+  }
+  Config ret;
+  ret.mCaptureRing = tree.get<std::string>( "capturering", std::string() );
+  ret.mPlaybackRing = tree.get<std::string>( "playbackring", std::string() );
+  ret.mClockMaster = tree.get<bool>( "clockmaster", false );
+  ret.mRingBlocks = tree.get<std::size_t>( "ringblocks", 4 );
+  ret.mRealtimePriority = tree.get<int>( "realtimepriority", 0 );
+  return ret;
+}
+
+void SharedMemoryInterface::Impl::start()
+{
+  if( mRunning.exchange( true ) )
+  {
+    return; // Already running.
+  }
+  if( mClockMaster )
+  {
+    mThread = std::thread( &Impl::runClockMaster, this );
+  }
+  else
+  {
+    mThread = std::thread( &Impl::runDriven, this );
+  }
+  if( mRealtimePriority != 0 )
+  {
+    struct sched_param param;
+    param.sched_priority = mRealtimePriority;
+    int const res = pthread_setschedparam( mThread.native_handle(), SCHED_FIFO, &param );
+    if( res != 0 )
+    {
+      std::cerr << "SharedMemoryInterface: Setting the realtime priority failed: " << std::strerror( res ) << std::endl;
+    }
+  }
+}
+
+void SharedMemoryInterface::Impl::stop()
+{
+  if( not mRunning.exchange( false ) )
+  {
+    return;
+  }
+  if( mCaptureRing )
+  {
+    mCaptureRing->wakeUp();
+  }
+  mThread.join();
+}
+
+bool SharedMemoryInterface::Impl::registerCallback( AudioCallback callback, void* userData )
+{
+  mCallback = callback;
+  mCallbackUserData = userData;
+  return true;
+}
+
+bool SharedMemoryInterface::Impl::unregisterCallback( AudioCallback callback )
+{
+  if( mCallback == callback )
+  {
+    mCallback = nullptr;
+    mCallbackUserData = nullptr;
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+void SharedMemoryInterface::Impl::runClockMaster()
+{
+  using Clock = std::chrono::steady_clock;
+  Clock::time_point start = Clock::now();
+  std::uint64_t blockCount = 0;
+  while( mRunning.load( std::memory_order_acquire ) )
+  {
+    processBlock();
+    ++blockCount;
+    // The deadlines are computed from the total number of samples to avoid accumulating rounding errors.
+    std::uint64_t const numSamples = blockCount * mPeriodSize;
+    Clock::time_point const deadline = start + std::chrono::seconds( numSamples / mSampleRate )
+      + std::chrono::nanoseconds( (numSamples % mSampleRate) * 1000000000 / mSampleRate );
+    Clock::time_point const now = Clock::now();
+    if( now > deadline + std::chrono::nanoseconds( 4 * mPeriodSize * 1000000000 / mSampleRate ) )
+    {
+      // Fallen behind by several periods (e.g., because the process has been suspended): restart the clock.
+      start = now;
+      blockCount = 0;
+      continue;
+    }
+    std::this_thread::sleep_until( deadline );
+  }
+}
+
+void SharedMemoryInterface::Impl::runDriven()
+{
+  while( mRunning.load( std::memory_order_acquire ) )
+  {
+    std::uint32_t const sequence = mCaptureRing->dataSequence();
+    if( not mCaptureRing->hasData() )
+    {
+      mCaptureRing->waitForData( sequence, cWaitTimeout );
+      continue;
+    }
+    processBlock();
+  }
+}
+
+void SharedMemoryInterface::Impl::processBlock()
+{
+  SampleType const * const * ringCapture = mCaptureRing ? mCaptureRing->readBlock() : nullptr;
+  SampleType const * const * capture = ringCapture ? ringCapture : mSilentCapturePointers.data();
+  if( mCaptureRing and not ringCapture )
+  {
+    mUnderruns.fetch_add( 1, std::memory_order_relaxed );
+  }
+  SampleType * const * ringPlayback = mPlaybackRing ? mPlaybackRing->writeBlock() : nullptr;
+  SampleType * const * playback = ringPlayback ? ringPlayback : mDiscardedPlaybackPointers.data();
+  if( mPlaybackRing and not ringPlayback )
+  {
+    mOverruns.fetch_add( 1, std::memory_order_relaxed );
+  }
+  if( mCallback )
+  {
+    bool status = true;
+    (*mCallback)( mCallbackUserData, capture, playback, status );
+  }
+  else
+  {
+    for( std::size_t chIdx( 0 ); chIdx < mNumPlaybackChannels; ++chIdx )
+    {
+      std::fill_n( playback[chIdx], mPeriodSize, static_cast<SampleType>(0.0f) );
+    }
+  }
+  if( ringCapture )
+  {
+    mCaptureRing->commitRead();
+  }
+  if( ringPlayback )
+  {
+    mPlaybackRing->commitWrite();
+  }
+}
+
+/******************************************************************************/
+/* SharedMemoryInterface implementation                                       */
+
+SharedMemoryInterface::SharedMemoryInterface( Configuration const & baseConfig, std::string const & config )
+ : mImpl( new Impl( baseConfig, config ) )
+{
+}
+
+SharedMemoryInterface::~SharedMemoryInterface() = default;
+
+void SharedMemoryInterface::start()
+{
+  mImpl->start();
+}
+
+void SharedMemoryInterface::stop()
+{
+  mImpl->stop();
+}
+
+/*virtual*/ bool
+SharedMemoryInterface::registerCallback( AudioCallback callback, void* userData )
+{
+  return mImpl->registerCallback( callback, userData );
+}
+
+/*virtual*/ bool
+SharedMemoryInterface::unregisterCallback( AudioCallback callback )
+{
+  return mImpl->unregisterCallback( callback );
+}
+
+std::size_t SharedMemoryInterface::numberOfCaptureChannels() const
+{
+  return mImpl->mNumCaptureChannels;
+}
+
+std::size_t SharedMemoryInterface::numberOfPlaybackChannels() const
+{
+  return mImpl->mNumPlaybackChannels;
+}
+
+std::size_t SharedMemoryInterface::period() const
+{
+  return mImpl->mPeriodSize;
+}
+
+std::size_t SharedMemoryInterface::samplingFrequency() const
+{
+  return mImpl->mSampleRate;
+}
+
+std::size_t SharedMemoryInterface::numberOfOverruns() const
+{
+  return mImpl->mOverruns.load();
+}
+
+std::size_t SharedMemoryInterface::numberOfUnderruns() const
+{
+  return mImpl->mUnderruns.load();
+}
+
+} // namespace audiointerfaces
+} // namespace visr
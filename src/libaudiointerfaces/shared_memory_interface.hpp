@@ -0,0 +1,130 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBAUDIOINTERFACES_SHARED_MEMORY_INTERFACE_HPP_INCLUDED
+#define VISR_LIBAUDIOINTERFACES_SHARED_MEMORY_INTERFACE_HPP_INCLUDED
+
+#include "audio_interface.hpp"
+#include "export_symbols.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace visr
+{
+namespace audiointerfaces
+{
+
+/**
+ * Audio interface that exchanges audio blocks with other VISR processes on the same host through shared memory.
+ * The signals are transported through named, single-producer/single-consumer ring buffers of audio blocks
+ * (POSIX shared memory objects). The playback signals of one process are written into a ring that is read as
+ * the capture signals of another process, which allows to split a large signal flow over several processes and
+ * CPU cores without the overhead and the latency of an audio server.
+ * Exactly one process of a chain acts as the clock master, which runs the processing at the configured period
+ * and sampling frequency. All other processes are driven by their capture ring, i.e., they process a block as soon
+ * as it has been written by the upstream process. Waiting processes are woken using futexes.
+ * The ring buffers are never blocking on the writing side: If a ring is full, the block is dropped and counted as
+ * an overrun. If the clock master reads from a ring that contains no data, silence is used and an underrun is counted.
+ * Blocks remaining in an existing ring, e.g., after a crash of one of the processes, are discarded when the clock
+ * master is (re)started with the ring.
+ * @note This interface is available on Linux only.
+ */
+class VISR_AUDIOINTERFACES_LIBRARY_SYMBOL SharedMemoryInterface: public AudioInterface
+{
+public:
+  /**
+   * Structure to hold all configuration arguments for a SharedMemoryInterface instance.
+   * The configuration is passed as a JSON string with the optional keys "capturering", "playbackring",
+   * "clockmaster", "ringblocks", and "realtimepriority".
+   */
+  struct Config
+  {
+    /**
+     * The name of the ring buffer the capture signals are read from. If empty, the capture signals are silent.
+     */
+    std::string mCaptureRing;
+
+    /**
+     * The name of the ring buffer the playback signals are written to. If empty, the playback signals are discarded.
+     */
+    std::string mPlaybackRing;
+
+    /**
+     * Whether this process generates the clock for the chain of processes. Processes that are not the clock master
+     * must have a capture ring.
+     */
+    bool mClockMaster;
+
+    /**
+     * The capacity of the ring buffers created by this process, in periods. This determines the maximum amount of
+     * buffering (and therefore latency) between two processes. Rings created by another process keep their size.
+     */
+    std::size_t mRingBlocks;
+
+    /**
+     * If nonzero, the processing thread is run with the SCHED_FIFO policy and this priority.
+     */
+    int mRealtimePriority;
+  };
+
+  using Base = AudioInterface;
+
+  explicit SharedMemoryInterface( Configuration const & baseConfig, std::string const & config );
+
+  ~SharedMemoryInterface() override;
+
+  /* virtual */ void start() override;
+
+  /* virtual */ void stop() override;
+
+  /*virtual*/ bool registerCallback( AudioCallback callback, void* userData ) override;
+
+  /*virtual*/ bool unregisterCallback( AudioCallback audioCallback ) override;
+
+  /**
+   * Return the number of input channels to the interface.
+   */
+  /*virtual*/ std::size_t numberOfCaptureChannels() const override;
+
+  /**
+   * Return the number of output channels to the interface.
+   */
+  /*virtual*/ std::size_t numberOfPlaybackChannels() const override;
+
+  /**
+   * Return the configured period (block size).
+   */
+  /*virtual*/ std::size_t period() const override;
+
+  /**
+   * Return the configured sampling frequency (in Hz)
+   */
+  /*virtual*/ std::size_t samplingFrequency() const override;
+
+  /**
+   * Return the number of playback blocks that have been dropped because the playback ring was full.
+   */
+  std::size_t numberOfOverruns() const;
+
+  /**
+   * Return the number of capture blocks the clock master has replaced by silence because the capture ring was empty.
+   */
+  std::size_t numberOfUnderruns() const;
+
+private:
+  /**
+   * Private implementation class to avoid dependencies to the operating system headers in the public interface.
+   */
+  class Impl;
+
+  /**
+   * Private implementation object according to the "pointer to implementation" (pimpl) idiom.
+   */
+  std::unique_ptr<Impl> mImpl;
+};
+
+} // namespace audiointerfaces
+} // namespace visr
+
+#endif // #ifndef VISR_LIBAUDIOINTERFACES_SHARED_MEMORY_INTERFACE_HPP_INCLUDED
@@ -0,0 +1,165 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifdef VISR_AUDIOINTERFACES_SHARED_MEMORY_SUPPORT
+
+#include <libaudiointerfaces/shared_memory_interface.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace visr
+{
+namespace audiointerfaces
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+std::size_t const cPeriod = 64;
+std::size_t const cSamplingFrequency = 48000;
+
+/**
+ * Generates a continuous ramp on two channels, the second channel is the negated first one.
+ */
+struct RampGenerator
+{
+  explicit RampGenerator( std::size_t startValue = 0 ): mSampleCount( startValue ) {}
+
+  std::size_t mSampleCount;
+
+  static void process( void * userData, float const * const *, float * const * playback, bool & status )
+  {
+    RampGenerator & self = *static_cast<RampGenerator *>(userData);
+    for( std::size_t sampleIdx( 0 ); sampleIdx < cPeriod; ++sampleIdx, ++self.mSampleCount )
+    {
+      playback[0][sampleIdx] = static_cast<float>(self.mSampleCount);
+      playback[1][sampleIdx] = -static_cast<float>(self.mSampleCount);
+    }
+    status = true;
+  }
+};
+
+/**
+ * Checks that the received signals continue the ramp.
+ */
+struct RampChecker
+{
+  std::atomic<std::size_t> mSampleCount{ 0 };
+  std::atomic<std::size_t> mErrors{ 0 };
+
+  static void process( void * userData, float const * const * capture, float * const *, bool & status )
+  {
+    RampChecker & self = *static_cast<RampChecker *>(userData);
+    for( std::size_t sampleIdx( 0 ); sampleIdx < cPeriod; ++sampleIdx, ++self.mSampleCount )
+    {
+      float const expected = static_cast<float>(self.mSampleCount);
+      if( (capture[0][sampleIdx] != expected) or (capture[1][sampleIdx] != -expected) )
+      {
+        ++self.mErrors;
+      }
+    }
+    status = true;
+  }
+};
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( SharedMemoryInterfaceTransport )
+{
+  std::string const ringName = "visr_audiointerfaces_test_" + std::to_string( getpid() );
+  // The ring holds about 1.4 s of audio, so that a stalled receiving thread on a loaded machine does not cause
+  // overruns during the test.
+  std::size_t const ringBlocks = 1024;
+  std::size_t const numBlocks = 40;
+  std::string const masterConfig = "{ \"clockmaster\": true, \"playbackring\": \"" + ringName
+    + "\", \"ringblocks\": " + std::to_string( ringBlocks ) + " }";
+  std::string const drivenConfig = "{ \"capturering\": \"" + ringName + "\" }";
+
+  SharedMemoryInterface master( AudioInterface::Configuration( 0, 2, cSamplingFrequency, cPeriod ), masterConfig );
+  SharedMemoryInterface driven( AudioInterface::Configuration( 2, 0, cSamplingFrequency, cPeriod ), drivenConfig );
+  // Attaching to the ring with a different configuration fails.
+  BOOST_CHECK_THROW( SharedMemoryInterface( AudioInterface::Configuration( 3, 0, cSamplingFrequency, cPeriod ), drivenConfig ),
+                     std::invalid_argument );
+  // A process that is not the clock master needs a capture ring.
+  BOOST_CHECK_THROW( SharedMemoryInterface( AudioInterface::Configuration( 0, 2, cSamplingFrequency, cPeriod ), "{}" ),
+                     std::invalid_argument );
+
+  RampGenerator generator;
+  RampChecker checker;
+  BOOST_CHECK( master.registerCallback( &RampGenerator::process, &generator ) );
+  BOOST_CHECK( driven.registerCallback( &RampChecker::process, &checker ) );
+  driven.start();
+  master.start();
+  for( std::size_t waitIdx( 0 ); (waitIdx < 2000) and (checker.mSampleCount.load() < numBlocks * cPeriod); ++waitIdx )
+  {
+    std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+  }
+  master.stop();
+  // Let the driven interface consume the remaining blocks.
+  for( std::size_t waitIdx( 0 ); (waitIdx < 2000) and (checker.mSampleCount.load() != generator.mSampleCount); ++waitIdx )
+  {
+    std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+  }
+  driven.stop();
+
+  BOOST_CHECK_GE( checker.mSampleCount.load(), numBlocks * cPeriod );
+  BOOST_CHECK_EQUAL( checker.mSampleCount.load(), generator.mSampleCount );
+  BOOST_CHECK_EQUAL( checker.mErrors.load(), 0 );
+  BOOST_CHECK_EQUAL( master.numberOfOverruns(), 0 );
+  BOOST_CHECK_EQUAL( driven.numberOfUnderruns(), 0 );
+}
+
+BOOST_AUTO_TEST_CASE( SharedMemoryInterfaceStaleRing )
+{
+  std::string const ringName = "visr_audiointerfaces_stale_test_" + std::to_string( getpid() );
+  std::string const masterConfig = "{ \"clockmaster\": true, \"playbackring\": \"" + ringName + "\", \"ringblocks\": 4 }";
+  std::string const drivenConfig = "{ \"capturering\": \"" + ringName + "\", \"ringblocks\": 4 }";
+
+  SharedMemoryInterface driven( AudioInterface::Configuration( 2, 0, cSamplingFrequency, cPeriod ), drivenConfig );
+  {
+    // A clock master that fills the ring, but whose blocks are never consumed.
+    SharedMemoryInterface staleMaster( AudioInterface::Configuration( 0, 2, cSamplingFrequency, cPeriod ), masterConfig );
+    RampGenerator staleGenerator( 100000 );
+    BOOST_CHECK( staleMaster.registerCallback( &RampGenerator::process, &staleGenerator ) );
+    staleMaster.start();
+    for( std::size_t waitIdx( 0 ); (waitIdx < 2000) and (staleMaster.numberOfOverruns() == 0); ++waitIdx )
+    {
+      std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+    staleMaster.stop();
+    BOOST_REQUIRE_GT( staleMaster.numberOfOverruns(), 0 ); // The ring is full.
+  }
+  // A new clock master attaching to the existing ring discards the stale blocks.
+  SharedMemoryInterface master( AudioInterface::Configuration( 0, 2, cSamplingFrequency, cPeriod ), masterConfig );
+  RampGenerator generator;
+  RampChecker checker;
+  BOOST_CHECK( master.registerCallback( &RampGenerator::process, &generator ) );
+  BOOST_CHECK( driven.registerCallback( &RampChecker::process, &checker ) );
+  driven.start();
+  master.start();
+  for( std::size_t waitIdx( 0 ); (waitIdx < 2000) and (checker.mSampleCount.load() < 10 * cPeriod); ++waitIdx )
+  {
+    std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+  }
+  master.stop();
+  driven.stop();
+  BOOST_CHECK_GE( checker.mSampleCount.load(), 10 * cPeriod );
+  BOOST_CHECK_EQUAL( checker.mErrors.load(), 0 );
+}
+
+} // namespace test
+} // namespace audiointerfaces
+} // namespace visr
+
+#endif // #ifdef VISR_AUDIOINTERFACES_SHARED_MEMORY_SUPPORT
@@ -5,7 +5,10 @@
 #include "vector_functions.hpp"
 #include "cpu_features.hpp"
 
+#include "../reference/matrix_functions.hpp"
+#include "../reference/sample_conversions.hpp"
 #include "../reference/vector_functions.hpp"
+#include "../reference/vector_math.hpp"
 
 #include <immintrin.h>
 
@@ -31,6 +34,29 @@ static void initialiseFeatureFunctions() {
   VectorMultiplyConstantAddInplaceWrapper< std::complex<float> >::set( &intel_x86_64::vectorMultiplyConstantAddInplace<std::complex<float>, f> );
 
   VectorRampScalingWrapper< float >::set( &intel_x86_64::vectorRampScaling<float, f> );
+
+  VectorMaxMagnitudeWrapper< float >::set( &intel_x86_64::vectorMaxMagnitude<float, f> );
+
+  VectorDeinterleaveSamplesWrapper< float, float >::set( &intel_x86_64::vectorDeinterleaveSamples<float, float, f> );
+  VectorDeinterleaveSamplesWrapper< std::int16_t, float >::set( &intel_x86_64::vectorDeinterleaveSamples<std::int16_t, float, f> );
+  VectorDeinterleaveSamplesWrapper< Int24, float >::set( &intel_x86_64::vectorDeinterleaveSamples<Int24, float, f> );
+  VectorDeinterleaveSamplesWrapper< std::int32_t, float >::set( &intel_x86_64::vectorDeinterleaveSamples<std::int32_t, float, f> );
+  VectorInterleaveSamplesWrapper< float, float >::set( &intel_x86_64::vectorInterleaveSamples<float, float, f> );
+  VectorInterleaveSamplesWrapper< float, std::int16_t >::set( &intel_x86_64::vectorInterleaveSamples<float, std::int16_t, f> );
+  VectorInterleaveSamplesWrapper< float, Int24 >::set( &intel_x86_64::vectorInterleaveSamples<float, Int24, f> );
+  VectorInterleaveSamplesWrapper< float, std::int32_t >::set( &intel_x86_64::vectorInterleaveSamples<float, std::int32_t, f> );
+
+  MatrixMultiplyWrapper< float >::set( &intel_x86_64::matrixMultiply<float, f> );
+  MatrixMultiplyWrapper< double >::set( &intel_x86_64::matrixMultiply<double, f> );
+
+  VectorSinCosWrapper< float >::set( &intel_x86_64::vectorSinCos<float, f> );
+  VectorAtan2Wrapper< float >::set( &intel_x86_64::vectorAtan2<float, f> );
+  VectorExpWrapper< float >::set( &intel_x86_64::vectorExp<float, f> );
+  VectorLogWrapper< float >::set( &intel_x86_64::vectorLog<float, f> );
+  VectorDB2LinearWrapper< float >::set( &intel_x86_64::vectorDB2Linear<float, f> );
+  VectorLinear2DBWrapper< float >::set( &intel_x86_64::vectorLinear2DB<float, f> );
+  VectorSpherical2CartesianWrapper< float >::set( &intel_x86_64::vectorSpherical2Cartesian<float, f> );
+  VectorCartesian2SphericalWrapper< float >::set( &intel_x86_64::vectorCartesian2Spherical<float, f> );
 }
 
 bool initialiseLibrary( char const * processor /*= ""*/ )
@@ -93,6 +119,28 @@ bool uninitialiseLibrary()
   VectorMultiplyConstantAddInplaceWrapper< std::complex<float> >::set( &reference::vectorMultiplyConstantAddInplace<std::complex<float> > );
 
   VectorRampScalingWrapper< float >::set( &reference::vectorRampScaling<float> );
+  VectorMaxMagnitudeWrapper< float >::set( &reference::vectorMaxMagnitude<float> );
+
+  VectorDeinterleaveSamplesWrapper< float, float >::set( &reference::vectorDeinterleaveSamples<float, float> );
+  VectorDeinterleaveSamplesWrapper< std::int16_t, float >::set( &reference::vectorDeinterleaveSamples<std::int16_t, float> );
+  VectorDeinterleaveSamplesWrapper< Int24, float >::set( &reference::vectorDeinterleaveSamples<Int24, float> );
+  VectorDeinterleaveSamplesWrapper< std::int32_t, float >::set( &reference::vectorDeinterleaveSamples<std::int32_t, float> );
+  VectorInterleaveSamplesWrapper< float, float >::set( &reference::vectorInterleaveSamples<float, float> );
+  VectorInterleaveSamplesWrapper< float, std::int16_t >::set( &reference::vectorInterleaveSamples<float, std::int16_t> );
+  VectorInterleaveSamplesWrapper< float, Int24 >::set( &reference::vectorInterleaveSamples<float, Int24> );
+  VectorInterleaveSamplesWrapper< float, std::int32_t >::set( &reference::vectorInterleaveSamples<float, std::int32_t> );
+
+  MatrixMultiplyWrapper< float >::set( &reference::matrixMultiply<float> );
+  MatrixMultiplyWrapper< double >::set( &reference::matrixMultiply<double> );
+
+  VectorSinCosWrapper< float >::set( &reference::vectorSinCos<float> );
+  VectorAtan2Wrapper< float >::set( &reference::vectorAtan2<float> );
+  VectorExpWrapper< float >::set( &reference::vectorExp<float> );
+  VectorLogWrapper< float >::set( &reference::vectorLog<float> );
+  VectorDB2LinearWrapper< float >::set( &reference::vectorDB2Linear<float> );
+  VectorLinear2DBWrapper< float >::set( &reference::vectorLinear2DB<float> );
+  VectorSpherical2CartesianWrapper< float >::set( &reference::vectorSpherical2Cartesian<float> );
+  VectorCartesian2SphericalWrapper< float >::set( &reference::vectorCartesian2Spherical<float> );
   return true;
 }
 
@@ -0,0 +1,256 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "vector_functions.hpp"
+
+#include "../alignment.hpp"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <ciso646>
+
+namespace visr
+{
+namespace efl
+{
+namespace intel_x86_64
+{
+
+namespace // unnamed
+{
+
+/**
+ * Wrapper for the SIMD register type and operations for a given element type and the instruction set of the
+ * current compilation unit.
+ */
+template< typename T >
+struct Simd;
+
+#ifdef __AVX__
+template<>
+struct Simd<float>
+{
+  using Vector = __m256;
+  static constexpr std::size_t width = 8;
+  static Vector zero() { return _mm256_setzero_ps(); }
+  static Vector broadcast( float const * val ) { return _mm256_broadcast_ss( val ); }
+  static Vector load( float const * ptr ) { return _mm256_loadu_ps( ptr ); }
+  static void store( float * ptr, Vector val ) { _mm256_storeu_ps( ptr, val ); }
+#ifdef __AVX2__
+  static Vector multiplyAdd( Vector a, Vector b, Vector acc ) { return _mm256_fmadd_ps( a, b, acc ); }
+#else
+  static Vector multiplyAdd( Vector a, Vector b, Vector acc ) { return _mm256_add_ps( _mm256_mul_ps( a, b ), acc ); }
+#endif
+};
+
+template<>
+struct Simd<double>
+{
+  using Vector = __m256d;
+  static constexpr std::size_t width = 4;
+  static Vector zero() { return _mm256_setzero_pd(); }
+  static Vector broadcast( double const * val ) { return _mm256_broadcast_sd( val ); }
+  static Vector load( double const * ptr ) { return _mm256_loadu_pd( ptr ); }
+  static void store( double * ptr, Vector val ) { _mm256_storeu_pd( ptr, val ); }
+#ifdef __AVX2__
+  static Vector multiplyAdd( Vector a, Vector b, Vector acc ) { return _mm256_fmadd_pd( a, b, acc ); }
+#else
+  static Vector multiplyAdd( Vector a, Vector b, Vector acc ) { return _mm256_add_pd( _mm256_mul_pd( a, b ), acc ); }
+#endif
+};
+#else // __AVX__
+template<>
+struct Simd<float>
+{
+  using Vector = __m128;
+  static constexpr std::size_t width = 4;
+  static Vector zero() { return _mm_setzero_ps(); }
+  static Vector broadcast( float const * val ) { return _mm_set1_ps( *val ); }
+  static Vector load( float const * ptr ) { return _mm_loadu_ps( ptr ); }
+  static void store( float * ptr, Vector val ) { _mm_storeu_ps( ptr, val ); }
+  static Vector multiplyAdd( Vector a, Vector b, Vector acc ) { return _mm_add_ps( _mm_mul_ps( a, b ), acc ); }
+};
+
+template<>
+struct Simd<double>
+{
+  using Vector = __m128d;
+  static constexpr std::size_t width = 2;
+  static Vector zero() { return _mm_setzero_pd(); }
+  static Vector broadcast( double const * val ) { return _mm_set1_pd( *val ); }
+  static Vector load( double const * ptr ) { return _mm_loadu_pd( ptr ); }
+  static void store( double * ptr, Vector val ) { _mm_storeu_pd( ptr, val ); }
+  static Vector multiplyAdd( Vector a, Vector b, Vector acc ) { return _mm_add_pd( _mm_mul_pd( a, b ), acc ); }
+};
+#endif // __AVX__
+
+/**
+ * Number of rows of op1 (the inner dimension) processed per cache block.
+ */
+static constexpr std::size_t cInnerBlockSize = 128;
+
+/**
+ * Number of result columns processed per cache block.
+ * Together with cInnerBlockSize, this keeps the currently used part of op2 in the second-level cache.
+ */
+static constexpr std::size_t cColumnBlockSize = 256;
+
+/**
+ * Number of result rows computed by one register tile.
+ */
+static constexpr std::size_t cTileRows = 4;
+
+/**
+ * Compute a tile of \p Rows x \p Vectors SIMD registers of the result, holding the accumulators in registers.
+ * @param accumulate Whether to add to the existing result (for all but the first inner block).
+ */
+template< typename T, std::size_t Rows, std::size_t Vectors >
+inline void multiplyTile( T const * op1, std::size_t op1RowStride,
+                          T const * op2, std::size_t op2RowStride,
+                          T * res, std::size_t resRowStride,
+                          std::size_t innerLength, bool accumulate )
+{
+  using S = Simd<T>;
+  typename S::Vector acc[Rows][Vectors];
+  for( std::size_t rowIdx( 0 ); rowIdx < Rows; ++rowIdx )
+  {
+    for( std::size_t vecIdx( 0 ); vecIdx < Vectors; ++vecIdx )
+    {
+      acc[rowIdx][vecIdx] = accumulate ? S::load( res + rowIdx * resRowStride + vecIdx * S::width ) : S::zero();
+    }
+  }
+  for( std::size_t runIdx( 0 ); runIdx < innerLength; ++runIdx )
+  {
+    typename S::Vector op2Val[Vectors];
+    for( std::size_t vecIdx( 0 ); vecIdx < Vectors; ++vecIdx )
+    {
+      op2Val[vecIdx] = S::load( op2 + runIdx * op2RowStride + vecIdx * S::width );
+    }
+    for( std::size_t rowIdx( 0 ); rowIdx < Rows; ++rowIdx )
+    {
+      typename S::Vector const op1Val = S::broadcast( op1 + rowIdx * op1RowStride + runIdx );
+      for( std::size_t vecIdx( 0 ); vecIdx < Vectors; ++vecIdx )
+      {
+        acc[rowIdx][vecIdx] = S::multiplyAdd( op1Val, op2Val[vecIdx], acc[rowIdx][vecIdx] );
+      }
+    }
+  }
+  for( std::size_t rowIdx( 0 ); rowIdx < Rows; ++rowIdx )
+  {
+    for( std::size_t vecIdx( 0 ); vecIdx < Vectors; ++vecIdx )
+    {
+      S::store( res + rowIdx * resRowStride + vecIdx * S::width, acc[rowIdx][vecIdx] );
+    }
+  }
+}
+
+/**
+ * Compute the columns of a row block of the result within a column block.
+ * Uses tiles of two and one SIMD registers per row, and scalar operations for the remaining columns.
+ */
+template< typename T, std::size_t Rows >
+inline void multiplyRowBlock( T const * op1, std::size_t op1RowStride,
+                              T const * op2, std::size_t op2RowStride,
+                              T * res, std::size_t resRowStride,
+                              std::size_t numColumns, std::size_t innerLength, bool accumulate )
+{
+  std::size_t const width = Simd<T>::width;
+  std::size_t colIdx( 0 );
+  for( ; colIdx + 2 * width <= numColumns; colIdx += 2 * width )
+  {
+    multiplyTile<T, Rows, 2>( op1, op1RowStride, op2 + colIdx, op2RowStride, res + colIdx, resRowStride,
+                              innerLength, accumulate );
+  }
+  for( ; colIdx + width <= numColumns; colIdx += width )
+  {
+    multiplyTile<T, Rows, 1>( op1, op1RowStride, op2 + colIdx, op2RowStride, res + colIdx, resRowStride,
+                              innerLength, accumulate );
+  }
+  for( ; colIdx < numColumns; ++colIdx )
+  {
+    for( std::size_t rowIdx( 0 ); rowIdx < Rows; ++rowIdx )
+    {
+      T val = accumulate ? res[rowIdx * resRowStride + colIdx] : static_cast<T>(0.0);
+      for( std::size_t runIdx( 0 ); runIdx < innerLength; ++runIdx )
+      {
+        val += op1[rowIdx * op1RowStride + runIdx] * op2[runIdx * op2RowStride + colIdx];
+      }
+      res[rowIdx * resRowStride + colIdx] = val;
+    }
+  }
+}
+
+template< typename T >
+ErrorCode multiply( T const * op1, T const * op2, T * res,
+                    std::size_t numResultRows, std::size_t numResultColumns, std::size_t numOp1Columns,
+                    std::size_t op1RowStride, std::size_t op2RowStride, std::size_t resRowStride,
+                    std::size_t alignment )
+{
+  if( not checkAlignment( op1, alignment ) ) return alignmentError;
+  if( not checkAlignment( op2, alignment ) ) return alignmentError;
+  if( not checkAlignment( res, alignment ) ) return alignmentError;
+  if( numOp1Columns == 0 )
+  {
+    for( std::size_t rowIdx( 0 ); rowIdx < numResultRows; ++rowIdx )
+    {
+      std::fill( res + rowIdx * resRowStride, res + rowIdx * resRowStride + numResultColumns, static_cast<T>(0.0) );
+    }
+    return noError;
+  }
+  for( std::size_t colStart( 0 ); colStart < numResultColumns; colStart += cColumnBlockSize )
+  {
+    std::size_t const numColumns = std::min( cColumnBlockSize, numResultColumns - colStart );
+    for( std::size_t innerStart( 0 ); innerStart < numOp1Columns; innerStart += cInnerBlockSize )
+    {
+      std::size_t const innerLength = std::min( cInnerBlockSize, numOp1Columns - innerStart );
+      bool const accumulate = innerStart > 0;
+      T const * const op1Block = op1 + innerStart;
+      T const * const op2Block = op2 + innerStart * op2RowStride + colStart;
+      T * const resBlock = res + colStart;
+      std::size_t rowIdx( 0 );
+      for( ; rowIdx + cTileRows <= numResultRows; rowIdx += cTileRows )
+      {
+        multiplyRowBlock<T, cTileRows>( op1Block + rowIdx * op1RowStride, op1RowStride, op2Block, op2RowStride,
+                                        resBlock + rowIdx * resRowStride, resRowStride,
+                                        numColumns, innerLength, accumulate );
+      }
+      for( ; rowIdx < numResultRows; ++rowIdx )
+      {
+        multiplyRowBlock<T, 1>( op1Block + rowIdx * op1RowStride, op1RowStride, op2Block, op2RowStride,
+                                resBlock + rowIdx * resRowStride, resRowStride,
+                                numColumns, innerLength, accumulate );
+      }
+    }
+  }
+  return noError;
+}
+
+} // unnamed namespace
+
+// Doxygen fails to find the corresponding declarations, therefore we
+// exclude the definitions here.
+/// @cond NEVER
+
+template<>
+ErrorCode matrixMultiply<float, Feature::VISR_SIMD_FEATURE>( float const * op1, float const * op2, float * res,
+  std::size_t numResultRows, std::size_t numResultColumns, std::size_t numOp1Columns,
+  std::size_t op1RowStride, std::size_t op2RowStride, std::size_t resRowStride, std::size_t alignment )
+{
+  return multiply( op1, op2, res, numResultRows, numResultColumns, numOp1Columns,
+                   op1RowStride, op2RowStride, resRowStride, alignment );
+}
+
+template<>
+ErrorCode matrixMultiply<double, Feature::VISR_SIMD_FEATURE>( double const * op1, double const * op2, double * res,
+  std::size_t numResultRows, std::size_t numResultColumns, std::size_t numOp1Columns,
+  std::size_t op1RowStride, std::size_t op2RowStride, std::size_t resRowStride, std::size_t alignment )
+{
+  return multiply( op1, op2, res, numResultRows, numResultColumns, numOp1Columns,
+                   op1RowStride, op2RowStride, resRowStride, alignment );
+}
+
+/// @endcond NEVER
+
+} // namespace intel_x86_64
+} // namespace efl
+} // namespace visr
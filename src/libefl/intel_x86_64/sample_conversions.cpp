@@ -0,0 +1,328 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "vector_functions.hpp"
+
+#include "../alignment.hpp"
+#include "../reference/sample_conversions_impl.hpp"
+
+#include <immintrin.h>
+
+#include <ciso646>
+#include <cstdint>
+#include <cstring>
+
+namespace visr
+{
+namespace efl
+{
+namespace intel_x86_64
+{
+
+namespace // unnamed
+{
+
+/**
+ * Load four consecutive samples of an external format and return them as normalised float values.
+ */
+inline __m128 loadNormalised( float const * src )
+{
+  return _mm_loadu_ps( src );
+}
+
+inline __m128 loadNormalised( std::int16_t const * src )
+{
+  __m128i const val = _mm_cvtepi16_epi32( _mm_loadl_epi64( reinterpret_cast<__m128i const *>(src) ) );
+  return _mm_mul_ps( _mm_cvtepi32_ps( val ), _mm_set1_ps( 1.0f / 32768.0f ) );
+}
+
+inline __m128 loadNormalised( Int24 const * src )
+{
+  // Load exactly 12 bytes to avoid reading beyond the end of the buffer.
+  std::int32_t tail;
+  std::memcpy( &tail, reinterpret_cast<char const *>(src) + 8, sizeof(tail) );
+  __m128i val = _mm_insert_epi32( _mm_loadl_epi64( reinterpret_cast<__m128i const *>(src) ), tail, 2 );
+  // Move each sample into the upper three bytes of a 32-bit lane, which performs the sign extension.
+  val = _mm_shuffle_epi8( val, _mm_setr_epi8( -1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11 ) );
+  return _mm_mul_ps( _mm_cvtepi32_ps( val ), _mm_set1_ps( 1.0f / 2147483648.0f ) );
+}
+
+inline __m128 loadNormalised( std::int32_t const * src )
+{
+  __m128i const val = _mm_loadu_si128( reinterpret_cast<__m128i const *>(src) );
+  return _mm_mul_ps( _mm_cvtepi32_ps( val ), _mm_set1_ps( 1.0f / 2147483648.0f ) );
+}
+
+/**
+ * Scale, saturate and round four normalised values to the integer range of an external sample type.
+ * Uses the same limits as the reference implementation.
+ */
+template< typename SampleType >
+inline __m128i quantise( __m128 val )
+{
+  using Format = reference::SampleFormat<SampleType>;
+  __m128 const scaled = _mm_mul_ps( val, _mm_set1_ps( Format::cScale ) );
+  __m128 const clipped = _mm_min_ps( _mm_max_ps( scaled, _mm_set1_ps( Format::cMinimum ) ),
+    _mm_set1_ps( Format::cMaximum ) );
+  return _mm_cvtps_epi32( clipped ); // Rounds to nearest in the default rounding mode.
+}
+
+/**
+ * Store four normalised float values as consecutive samples of an external format.
+ */
+inline void storeNormalised( __m128 val, float * dest )
+{
+  _mm_storeu_ps( dest, val );
+}
+
+inline void storeNormalised( __m128 val, std::int16_t * dest )
+{
+  __m128i const quantised = quantise<std::int16_t>( val );
+  _mm_storel_epi64( reinterpret_cast<__m128i *>(dest), _mm_packs_epi32( quantised, quantised ) );
+}
+
+inline void storeNormalised( __m128 val, Int24 * dest )
+{
+  __m128i const packed = _mm_shuffle_epi8( quantise<Int24>( val ),
+    _mm_setr_epi8( 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1 ) );
+  // Store exactly 12 bytes to avoid writing beyond the end of the buffer.
+  _mm_storel_epi64( reinterpret_cast<__m128i *>(dest), packed );
+  std::int32_t const tail = _mm_extract_epi32( packed, 2 );
+  std::memcpy( reinterpret_cast<char *>(dest) + 8, &tail, sizeof(tail) );
+}
+
+inline void storeNormalised( __m128 val, std::int32_t * dest )
+{
+  _mm_storeu_si128( reinterpret_cast<__m128i *>(dest), quantise<std::int32_t>( val ) );
+}
+
+#ifdef __AVX__
+/**
+ * Transpose the 4x4 blocks in both 128-bit lanes of four AVX registers.
+ */
+inline void transposeLanes( __m256 & row0, __m256 & row1, __m256 & row2, __m256 & row3 )
+{
+  __m256 const tmp0 = _mm256_unpacklo_ps( row0, row1 );
+  __m256 const tmp1 = _mm256_unpacklo_ps( row2, row3 );
+  __m256 const tmp2 = _mm256_unpackhi_ps( row0, row1 );
+  __m256 const tmp3 = _mm256_unpackhi_ps( row2, row3 );
+  row0 = _mm256_shuffle_ps( tmp0, tmp1, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+  row1 = _mm256_shuffle_ps( tmp0, tmp1, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+  row2 = _mm256_shuffle_ps( tmp2, tmp3, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+  row3 = _mm256_shuffle_ps( tmp2, tmp3, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+}
+
+inline __m256 combine( __m128 low, __m128 high )
+{
+  return _mm256_insertf128_ps( _mm256_castps128_ps256( low ), high, 1 );
+}
+#endif
+
+/**
+ * Deinterleaving kernel. Groups of four channels are processed as 4x4 blocks (4x8 with AVX) that are
+ * converted and transposed in registers. The remaining channels and frames use the scalar conversion.
+ */
+template< typename InputType >
+ErrorCode deinterleave( InputType const * src,
+                        float * const * dest,
+                        std::size_t numberOfChannels,
+                        std::size_t numberOfFrames,
+                        std::size_t alignment )
+{
+  using Format = reference::SampleFormat<InputType>;
+  for( std::size_t chIdx( 0 ); chIdx < numberOfChannels; ++chIdx )
+  {
+    if( not checkAlignment( dest[chIdx], alignment ) ) return alignmentError;
+  }
+  std::size_t const frameStride = numberOfChannels;
+  std::size_t chIdx = 0;
+  for( ; chIdx + 4 <= numberOfChannels; chIdx += 4 )
+  {
+    float * const out0 = dest[chIdx];
+    float * const out1 = dest[chIdx + 1];
+    float * const out2 = dest[chIdx + 2];
+    float * const out3 = dest[chIdx + 3];
+    InputType const * const in = src + chIdx;
+    std::size_t frameIdx = 0;
+#ifdef __AVX__
+    for( ; frameIdx + 8 <= numberOfFrames; frameIdx += 8 )
+    {
+      InputType const * const framePtr = in + frameIdx * frameStride;
+      __m256 row0 = combine( loadNormalised( framePtr ), loadNormalised( framePtr + 4 * frameStride ) );
+      __m256 row1 = combine( loadNormalised( framePtr + frameStride ), loadNormalised( framePtr + 5 * frameStride ) );
+      __m256 row2 = combine( loadNormalised( framePtr + 2 * frameStride ), loadNormalised( framePtr + 6 * frameStride ) );
+      __m256 row3 = combine( loadNormalised( framePtr + 3 * frameStride ), loadNormalised( framePtr + 7 * frameStride ) );
+      transposeLanes( row0, row1, row2, row3 );
+      _mm256_storeu_ps( out0 + frameIdx, row0 );
+      _mm256_storeu_ps( out1 + frameIdx, row1 );
+      _mm256_storeu_ps( out2 + frameIdx, row2 );
+      _mm256_storeu_ps( out3 + frameIdx, row3 );
+    }
+#endif
+    for( ; frameIdx + 4 <= numberOfFrames; frameIdx += 4 )
+    {
+      InputType const * const framePtr = in + frameIdx * frameStride;
+      __m128 row0 = loadNormalised( framePtr );
+      __m128 row1 = loadNormalised( framePtr + frameStride );
+      __m128 row2 = loadNormalised( framePtr + 2 * frameStride );
+      __m128 row3 = loadNormalised( framePtr + 3 * frameStride );
+      _MM_TRANSPOSE4_PS( row0, row1, row2, row3 );
+      _mm_storeu_ps( out0 + frameIdx, row0 );
+      _mm_storeu_ps( out1 + frameIdx, row1 );
+      _mm_storeu_ps( out2 + frameIdx, row2 );
+      _mm_storeu_ps( out3 + frameIdx, row3 );
+    }
+    for( ; frameIdx < numberOfFrames; ++frameIdx )
+    {
+      InputType const * const framePtr = in + frameIdx * frameStride;
+      out0[frameIdx] = Format::toFloat( framePtr[0] );
+      out1[frameIdx] = Format::toFloat( framePtr[1] );
+      out2[frameIdx] = Format::toFloat( framePtr[2] );
+      out3[frameIdx] = Format::toFloat( framePtr[3] );
+    }
+  }
+  if( numberOfChannels == 1 )
+  {
+    // Non-interleaved buffers: plain vectorised conversion.
+    float * const out = dest[0];
+    std::size_t frameIdx = 0;
+    for( ; frameIdx + 4 <= numberOfFrames; frameIdx += 4 )
+    {
+      _mm_storeu_ps( out + frameIdx, loadNormalised( src + frameIdx ) );
+    }
+    for( ; frameIdx < numberOfFrames; ++frameIdx )
+    {
+      out[frameIdx] = Format::toFloat( src[frameIdx] );
+    }
+    return noError;
+  }
+  for( ; chIdx < numberOfChannels; ++chIdx )
+  {
+    float * const out = dest[chIdx];
+    InputType const * in = src + chIdx;
+    for( std::size_t frameIdx( 0 ); frameIdx < numberOfFrames; ++frameIdx, in += frameStride )
+    {
+      out[frameIdx] = Format::toFloat( *in );
+    }
+  }
+  return noError;
+}
+
+/**
+ * Interleaving kernel, the inverse operation of deinterleave().
+ */
+template< typename OutputType >
+ErrorCode interleave( float const * const * src,
+                      OutputType * dest,
+                      std::size_t numberOfChannels,
+                      std::size_t numberOfFrames,
+                      std::size_t alignment )
+{
+  using Format = reference::SampleFormat<OutputType>;
+  for( std::size_t chIdx( 0 ); chIdx < numberOfChannels; ++chIdx )
+  {
+    if( not checkAlignment( src[chIdx], alignment ) ) return alignmentError;
+  }
+  std::size_t const frameStride = numberOfChannels;
+  std::size_t chIdx = 0;
+  for( ; chIdx + 4 <= numberOfChannels; chIdx += 4 )
+  {
+    float const * const in0 = src[chIdx];
+    float const * const in1 = src[chIdx + 1];
+    float const * const in2 = src[chIdx + 2];
+    float const * const in3 = src[chIdx + 3];
+    OutputType * const out = dest + chIdx;
+    std::size_t frameIdx = 0;
+#ifdef __AVX__
+    for( ; frameIdx + 8 <= numberOfFrames; frameIdx += 8 )
+    {
+      __m256 row0 = _mm256_loadu_ps( in0 + frameIdx );
+      __m256 row1 = _mm256_loadu_ps( in1 + frameIdx );
+      __m256 row2 = _mm256_loadu_ps( in2 + frameIdx );
+      __m256 row3 = _mm256_loadu_ps( in3 + frameIdx );
+      transposeLanes( row0, row1, row2, row3 );
+      OutputType * const framePtr = out + frameIdx * frameStride;
+      storeNormalised( _mm256_castps256_ps128( row0 ), framePtr );
+      storeNormalised( _mm256_castps256_ps128( row1 ), framePtr + frameStride );
+      storeNormalised( _mm256_castps256_ps128( row2 ), framePtr + 2 * frameStride );
+      storeNormalised( _mm256_castps256_ps128( row3 ), framePtr + 3 * frameStride );
+      storeNormalised( _mm256_extractf128_ps( row0, 1 ), framePtr + 4 * frameStride );
+      storeNormalised( _mm256_extractf128_ps( row1, 1 ), framePtr + 5 * frameStride );
+      storeNormalised( _mm256_extractf128_ps( row2, 1 ), framePtr + 6 * frameStride );
+      storeNormalised( _mm256_extractf128_ps( row3, 1 ), framePtr + 7 * frameStride );
+    }
+#endif
+    for( ; frameIdx + 4 <= numberOfFrames; frameIdx += 4 )
+    {
+      __m128 row0 = _mm_loadu_ps( in0 + frameIdx );
+      __m128 row1 = _mm_loadu_ps( in1 + frameIdx );
+      __m128 row2 = _mm_loadu_ps( in2 + frameIdx );
+      __m128 row3 = _mm_loadu_ps( in3 + frameIdx );
+      _MM_TRANSPOSE4_PS( row0, row1, row2, row3 );
+      OutputType * const framePtr = out + frameIdx * frameStride;
+      storeNormalised( row0, framePtr );
+      storeNormalised( row1, framePtr + frameStride );
+      storeNormalised( row2, framePtr + 2 * frameStride );
+      storeNormalised( row3, framePtr + 3 * frameStride );
+    }
+    for( ; frameIdx < numberOfFrames; ++frameIdx )
+    {
+      OutputType * const framePtr = out + frameIdx * frameStride;
+      framePtr[0] = Format::fromFloat( in0[frameIdx] );
+      framePtr[1] = Format::fromFloat( in1[frameIdx] );
+      framePtr[2] = Format::fromFloat( in2[frameIdx] );
+      framePtr[3] = Format::fromFloat( in3[frameIdx] );
+    }
+  }
+  if( numberOfChannels == 1 )
+  {
+    float const * const in = src[0];
+    std::size_t frameIdx = 0;
+    for( ; frameIdx + 4 <= numberOfFrames; frameIdx += 4 )
+    {
+      storeNormalised( _mm_loadu_ps( in + frameIdx ), dest + frameIdx );
+    }
+    for( ; frameIdx < numberOfFrames; ++frameIdx )
+    {
+      dest[frameIdx] = Format::fromFloat( in[frameIdx] );
+    }
+    return noError;
+  }
+  for( ; chIdx < numberOfChannels; ++chIdx )
+  {
+    float const * const in = src[chIdx];
+    OutputType * out = dest + chIdx;
+    for( std::size_t frameIdx( 0 ); frameIdx < numberOfFrames; ++frameIdx, out += frameStride )
+    {
+      *out = Format::fromFloat( in[frameIdx] );
+    }
+  }
+  return noError;
+}
+
+} // unnamed namespace
+
+// Prevent Doxygen from trying to parse these explicit specialisations.
+/// @cond NEVER
+#define VISR_EFL_INTEL_SPECIALISE_SAMPLE_CONVERSIONS( TYPE ) \
+template<> \
+ErrorCode vectorDeinterleaveSamples< TYPE, float, Feature::VISR_SIMD_FEATURE >( TYPE const * src, \
+  float * const * dest, std::size_t numberOfChannels, std::size_t numberOfFrames, std::size_t alignment ) \
+{ \
+  return deinterleave( src, dest, numberOfChannels, numberOfFrames, alignment ); \
+} \
+template<> \
+ErrorCode vectorInterleaveSamples< float, TYPE, Feature::VISR_SIMD_FEATURE >( float const * const * src, \
+  TYPE * dest, std::size_t numberOfChannels, std::size_t numberOfFrames, std::size_t alignment ) \
+{ \
+  return interleave( src, dest, numberOfChannels, numberOfFrames, alignment ); \
+}
+
+VISR_EFL_INTEL_SPECIALISE_SAMPLE_CONVERSIONS( float )
+VISR_EFL_INTEL_SPECIALISE_SAMPLE_CONVERSIONS( std::int16_t )
+VISR_EFL_INTEL_SPECIALISE_SAMPLE_CONVERSIONS( Int24 )
+VISR_EFL_INTEL_SPECIALISE_SAMPLE_CONVERSIONS( std::int32_t )
+/// @endcond NEVER
+
+} // namespace intel_x86_64
+} // namespace efl
+} // namespace visr
@@ -3,7 +3,10 @@
 #ifndef VISR_LIBEFL_INTEL_X86_64_VECTOR_FUNCTIONS_HPP_INCLUDED
 #define VISR_LIBEFL_INTEL_X86_64_VECTOR_FUNCTIONS_HPP_INCLUDED
 
+#include "../matrix_functions.hpp"
+#include "../sample_conversions.hpp"
 #include "../vector_functions.hpp"
+#include "../vector_math.hpp"
 
 #include <complex>
 
@@ -150,6 +153,103 @@ vectorRampScaling( T const * input,
   bool accumulate /*= false*/,
   std::size_t alignmentElements /*= 0*/ );
 
+/**
+ * Compute the maximum magnitude (absolute value) of a vector.
+ * @param input The vector to be evaluated.
+ * @param [out] result The maximum absolute value of all elements, 0 for an empty vector.
+ * @param numberOfElements The number of elements in \p input.
+ * @param alignmentElements Minimum alignment of \p input, measured in multiples of the element size.
+ */
+template<typename T, Feature f>
+VISR_EFL_LIBRARY_SYMBOL ErrorCode
+vectorMaxMagnitude( T const * input,
+  T & result,
+  std::size_t numberOfElements,
+  std::size_t alignmentElements /*= 0*/ );
+
+/**
+ * Convert interleaved audio samples into a set of float channel buffers.
+ * @see efl::vectorDeinterleaveSamples()
+ */
+template<typename InputType, typename OutputType, Feature f>
+VISR_EFL_LIBRARY_SYMBOL ErrorCode
+vectorDeinterleaveSamples( InputType const * src,
+  OutputType * const * dest,
+  std::size_t numberOfChannels,
+  std::size_t numberOfFrames,
+  std::size_t alignment /*= 0*/ );
+
+/**
+ * Convert a set of float channel buffers into interleaved audio samples.
+ * @see efl::vectorInterleaveSamples()
+ */
+template<typename InputType, typename OutputType, Feature f>
+VISR_EFL_LIBRARY_SYMBOL ErrorCode
+vectorInterleaveSamples( InputType const * const * src,
+  OutputType * dest,
+  std::size_t numberOfChannels,
+  std::size_t numberOfFrames,
+  std::size_t alignment /*= 0*/ );
+
+/**
+ * Multiply two dense row-major matrices using a cache-blocked, register-tiled kernel.
+ * @see efl::matrixMultiply()
+ */
+template<typename T, Feature f>
+VISR_EFL_LIBRARY_SYMBOL ErrorCode
+matrixMultiply( T const * op1,
+  T const * op2,
+  T * res,
+  std::size_t numResultRows,
+  std::size_t numResultColumns,
+  std::size_t numOp1Columns,
+  std::size_t op1RowStride,
+  std::size_t op2RowStride,
+  std::size_t resRowStride,
+  std::size_t alignment /*= 0*/ );
+
+/**
+ * Vectorised polynomial approximations of the array math functions, implemented for single precision only.
+ * @see vector_math.hpp
+ */
+//@{
+template<typename T, Feature f>
+VISR_EFL_LIBRARY_SYMBOL ErrorCode
+vectorSinCos( T const * const angles, T * const sinResult, T * const cosResult,
+  std::size_t numElements, std::size_t alignment /*= 0*/ );
+
+template<typename T, Feature f>
+VISR_EFL_LIBRARY_SYMBOL ErrorCode
+vectorAtan2( T const * const y, T const * const x, T * const result,
+  std::size_t numElements, std::size_t alignment /*= 0*/ );
+
+template<typename T, Feature f>
+VISR_EFL_LIBRARY_SYMBOL ErrorCode
+vectorExp( T const * const src, T * const dest, std::size_t numElements, std::size_t alignment /*= 0*/ );
+
+template<typename T, Feature f>
+VISR_EFL_LIBRARY_SYMBOL ErrorCode
+vectorLog( T const * const src, T * const dest, std::size_t numElements, std::size_t alignment /*= 0*/ );
+
+template<typename T, Feature f>
+VISR_EFL_LIBRARY_SYMBOL ErrorCode
+vectorDB2Linear( T const * const src, T * const dest, std::size_t numElements, std::size_t alignment /*= 0*/ );
+
+template<typename T, Feature f>
+VISR_EFL_LIBRARY_SYMBOL ErrorCode
+vectorLinear2DB( T const * const src, T * const dest, std::size_t numElements, std::size_t alignment /*= 0*/ );
+
+template<typename T, Feature f>
+VISR_EFL_LIBRARY_SYMBOL ErrorCode
+vectorSpherical2Cartesian( T const * const az, T const * const el, T const * const radius,
+  T * const x, T * const y, T * const z, std::size_t numElements, std::size_t alignment /*= 0*/ );
+
+template<typename T, Feature f>
+VISR_EFL_LIBRARY_SYMBOL ErrorCode
+vectorCartesian2Spherical( T const * const x, T const * const y, T const * const z,
+  T * const az, T * const el, T * const radius, std::size_t numElements, std::size_t alignment /*= 0*/ );
+//@}
+
 } // namespace intel_x86_64
 } // namespace efl
 } // namespace visr
@@ -0,0 +1,389 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "vector_functions.hpp"
+
+#include "../alignment.hpp"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <ciso646>
+#include <cstdint>
+#include <limits>
+
+namespace visr
+{
+namespace efl
+{
+namespace intel_x86_64
+{
+
+namespace // unnamed
+{
+
+/**
+ * Wrapper for the single-precision SIMD register type and the operations needed by the polynomial approximations.
+ * The 256-bit variant requires AVX2 for the integer operations on the exponent bits, therefore the AVX feature
+ * level uses the (VEX-encoded) 128-bit variant.
+ */
+struct Simd
+{
+#ifdef __AVX2__
+  using Vector = __m256;
+  using IntVector = __m256i;
+  static constexpr std::size_t width = 8;
+  static Vector constant( float val ) { return _mm256_set1_ps( val ); }
+  static IntVector intConstant( std::int32_t val ) { return _mm256_set1_epi32( val ); }
+  static Vector load( float const * ptr ) { return _mm256_loadu_ps( ptr ); }
+  static void store( float * ptr, Vector val ) { _mm256_storeu_ps( ptr, val ); }
+  static Vector add( Vector a, Vector b ) { return _mm256_add_ps( a, b ); }
+  static Vector sub( Vector a, Vector b ) { return _mm256_sub_ps( a, b ); }
+  static Vector mul( Vector a, Vector b ) { return _mm256_mul_ps( a, b ); }
+  static Vector div( Vector a, Vector b ) { return _mm256_div_ps( a, b ); }
+  static Vector multiplyAdd( Vector a, Vector b, Vector c ) { return _mm256_fmadd_ps( a, b, c ); }
+  static Vector sqrt( Vector a ) { return _mm256_sqrt_ps( a ); }
+  static Vector min( Vector a, Vector b ) { return _mm256_min_ps( a, b ); }
+  static Vector max( Vector a, Vector b ) { return _mm256_max_ps( a, b ); }
+  static Vector floor( Vector a ) { return _mm256_floor_ps( a ); }
+  static Vector bitAnd( Vector a, Vector b ) { return _mm256_and_ps( a, b ); }
+  static Vector bitOr( Vector a, Vector b ) { return _mm256_or_ps( a, b ); }
+  static Vector bitXor( Vector a, Vector b ) { return _mm256_xor_ps( a, b ); }
+  /** Compute (not a) and b. */
+  static Vector bitAndNot( Vector a, Vector b ) { return _mm256_andnot_ps( a, b ); }
+  static Vector less( Vector a, Vector b ) { return _mm256_cmp_ps( a, b, _CMP_LT_OQ ); }
+  static Vector equal( Vector a, Vector b ) { return _mm256_cmp_ps( a, b, _CMP_EQ_OQ ); }
+  /** Select \p b where \p mask is set and \p a otherwise. */
+  static Vector select( Vector a, Vector b, Vector mask ) { return _mm256_blendv_ps( a, b, mask ); }
+  static IntVector truncate( Vector a ) { return _mm256_cvttps_epi32( a ); }
+  static Vector toFloat( IntVector a ) { return _mm256_cvtepi32_ps( a ); }
+  static IntVector asInt( Vector a ) { return _mm256_castps_si256( a ); }
+  static Vector asFloat( IntVector a ) { return _mm256_castsi256_ps( a ); }
+  static IntVector intAdd( IntVector a, IntVector b ) { return _mm256_add_epi32( a, b ); }
+  static IntVector intSub( IntVector a, IntVector b ) { return _mm256_sub_epi32( a, b ); }
+  static IntVector intAnd( IntVector a, IntVector b ) { return _mm256_and_si256( a, b ); }
+  static IntVector intAndNot( IntVector a, IntVector b ) { return _mm256_andnot_si256( a, b ); }
+  static IntVector intEqual( IntVector a, IntVector b ) { return _mm256_cmpeq_epi32( a, b ); }
+  template< int shift > static IntVector shiftLeft( IntVector a ) { return _mm256_slli_epi32( a, shift ); }
+  template< int shift > static IntVector shiftRight( IntVector a ) { return _mm256_srli_epi32( a, shift ); }
+#else // __AVX2__
+  using Vector = __m128;
+  using IntVector = __m128i;
+  static constexpr std::size_t width = 4;
+  static Vector constant( float val ) { return _mm_set1_ps( val ); }
+  static IntVector intConstant( std::int32_t val ) { return _mm_set1_epi32( val ); }
+  static Vector load( float const * ptr ) { return _mm_loadu_ps( ptr ); }
+  static void store( float * ptr, Vector val ) { _mm_storeu_ps( ptr, val ); }
+  static Vector add( Vector a, Vector b ) { return _mm_add_ps( a, b ); }
+  static Vector sub( Vector a, Vector b ) { return _mm_sub_ps( a, b ); }
+  static Vector mul( Vector a, Vector b ) { return _mm_mul_ps( a, b ); }
+  static Vector div( Vector a, Vector b ) { return _mm_div_ps( a, b ); }
+  static Vector multiplyAdd( Vector a, Vector b, Vector c ) { return _mm_add_ps( _mm_mul_ps( a, b ), c ); }
+  static Vector sqrt( Vector a ) { return _mm_sqrt_ps( a ); }
+  static Vector min( Vector a, Vector b ) { return _mm_min_ps( a, b ); }
+  static Vector max( Vector a, Vector b ) { return _mm_max_ps( a, b ); }
+  static Vector floor( Vector a ) { return _mm_floor_ps( a ); }
+  static Vector bitAnd( Vector a, Vector b ) { return _mm_and_ps( a, b ); }
+  static Vector bitOr( Vector a, Vector b ) { return _mm_or_ps( a, b ); }
+  static Vector bitXor( Vector a, Vector b ) { return _mm_xor_ps( a, b ); }
+  static Vector bitAndNot( Vector a, Vector b ) { return _mm_andnot_ps( a, b ); }
+  static Vector less( Vector a, Vector b ) { return _mm_cmplt_ps( a, b ); }
+  static Vector equal( Vector a, Vector b ) { return _mm_cmpeq_ps( a, b ); }
+  static Vector select( Vector a, Vector b, Vector mask ) { return _mm_blendv_ps( a, b, mask ); }
+  static IntVector truncate( Vector a ) { return _mm_cvttps_epi32( a ); }
+  static Vector toFloat( IntVector a ) { return _mm_cvtepi32_ps( a ); }
+  static IntVector asInt( Vector a ) { return _mm_castps_si128( a ); }
+  static Vector asFloat( IntVector a ) { return _mm_castsi128_ps( a ); }
+  static IntVector intAdd( IntVector a, IntVector b ) { return _mm_add_epi32( a, b ); }
+  static IntVector intSub( IntVector a, IntVector b ) { return _mm_sub_epi32( a, b ); }
+  static IntVector intAnd( IntVector a, IntVector b ) { return _mm_and_si128( a, b ); }
+  static IntVector intAndNot( IntVector a, IntVector b ) { return _mm_andnot_si128( a, b ); }
+  static IntVector intEqual( IntVector a, IntVector b ) { return _mm_cmpeq_epi32( a, b ); }
+  template< int shift > static IntVector shiftLeft( IntVector a ) { return _mm_slli_epi32( a, shift ); }
+  template< int shift > static IntVector shiftRight( IntVector a ) { return _mm_srli_epi32( a, shift ); }
+#endif // __AVX2__
+  static Vector signMask() { return asFloat( intConstant( static_cast<std::int32_t>(0x80000000u) ) ); }
+};
+
+using S = Simd;
+using V = Simd::Vector;
+using IV = Simd::IntVector;
+
+// The polynomial approximations follow the single-precision functions of the Cephes math library (S. L. Moshier).
+
+/**
+ * Sine and cosine of the same argument.
+ * The argument is reduced to [-pi/4,pi/4] by subtracting the nearest multiple of pi/2, using a three-part
+ * representation of pi/4 to retain the accuracy for moderately large arguments.
+ */
+inline void sinCos( V x, V & sinVal, V & cosVal )
+{
+  V const signBitSin = S::bitAnd( x, S::signMask() );
+  x = S::bitAndNot( S::signMask(), x );
+  // Octant index, rounded up to an even number.
+  IV octant = S::truncate( S::mul( x, S::constant( 1.27323954473516f ) ) ); // 4/pi
+  octant = S::intAnd( S::intAdd( octant, S::intConstant( 1 ) ), S::intConstant( ~1 ) );
+  V const y = S::toFloat( octant );
+  V const swapSignBitSin = S::asFloat( S::shiftLeft<29>( S::intAnd( octant, S::intConstant( 4 ) ) ) );
+  V const polyMask = S::asFloat( S::intEqual( S::intAnd( octant, S::intConstant( 2 ) ), S::intConstant( 0 ) ) );
+  V const signBitCos = S::asFloat( S::shiftLeft<29>( S::intAndNot( S::intSub( octant, S::intConstant( 2 ) ),
+                                                                  S::intConstant( 4 ) ) ) );
+  x = S::multiplyAdd( y, S::constant( -0.78515625f ), x );
+  x = S::multiplyAdd( y, S::constant( -2.4187564849853515625e-4f ), x );
+  x = S::multiplyAdd( y, S::constant( -3.77489497744594108e-8f ), x );
+  V const z = S::mul( x, x );
+
+  V cosPoly = S::constant( 2.443315711809948e-5f );
+  cosPoly = S::multiplyAdd( cosPoly, z, S::constant( -1.388731625493765e-3f ) );
+  cosPoly = S::multiplyAdd( cosPoly, z, S::constant( 4.166664568298827e-2f ) );
+  cosPoly = S::mul( S::mul( cosPoly, z ), z );
+  cosPoly = S::multiplyAdd( z, S::constant( -0.5f ), cosPoly );
+  cosPoly = S::add( cosPoly, S::constant( 1.0f ) );
+
+  V sinPoly = S::constant( -1.9515295891e-4f );
+  sinPoly = S::multiplyAdd( sinPoly, z, S::constant( 8.3321608736e-3f ) );
+  sinPoly = S::multiplyAdd( sinPoly, z, S::constant( -1.6666654611e-1f ) );
+  sinPoly = S::multiplyAdd( S::mul( sinPoly, z ), x, x );
+
+  sinVal = S::bitXor( S::select( cosPoly, sinPoly, polyMask ), S::bitXor( signBitSin, swapSignBitSin ) );
+  cosVal = S::bitXor( S::select( sinPoly, cosPoly, polyMask ), signBitCos );
+}
+
+/**
+ * Four-quadrant arctangent.
+ * The arctangent is evaluated for the ratio of the smaller and the larger magnitude of the arguments, which lies
+ * in [0,1], and mapped to the correct octant afterwards.
+ */
+inline V atan2( V y, V x )
+{
+  V const absX = S::bitAndNot( S::signMask(), x );
+  V const absY = S::bitAndNot( S::signMask(), y );
+  V const smaller = S::min( absX, absY );
+  V const larger = S::max( absX, absY );
+  V const zero = S::constant( 0.0f );
+  // Avoid 0/0 at the origin.
+  V const ratio = S::select( S::div( smaller, larger ), zero, S::equal( larger, zero ) );
+  // Reduce the argument range further using atan(r) = pi/4 + atan((r-1)/(r+1)).
+  V const reduceMask = S::less( S::constant( 0.4142135623730950f ), ratio ); // tan(pi/8)
+  V const t = S::select( ratio,
+                         S::div( S::sub( ratio, S::constant( 1.0f ) ), S::add( ratio, S::constant( 1.0f ) ) ),
+                         reduceMask );
+  V const offset = S::bitAnd( reduceMask, S::constant( 0.78539816339744830962f ) );
+  V const z = S::mul( t, t );
+  V poly = S::constant( 8.05374449538e-2f );
+  poly = S::multiplyAdd( poly, z, S::constant( -1.38776856032e-1f ) );
+  poly = S::multiplyAdd( poly, z, S::constant( 1.99777106478e-1f ) );
+  poly = S::multiplyAdd( poly, z, S::constant( -3.33329491539e-1f ) );
+  V angle = S::add( offset, S::multiplyAdd( S::mul( poly, z ), t, t ) );
+  angle = S::select( angle, S::sub( S::constant( 1.57079632679489661923f ), angle ), S::less( absX, absY ) );
+  angle = S::select( angle, S::sub( S::constant( 3.14159265358979323846f ), angle ), S::less( x, zero ) );
+  return S::bitXor( angle, S::bitAnd( y, S::signMask() ) );
+}
+
+/**
+ * Natural exponential function.
+ * Computes exp(x) = 2^n * exp(r) with n = round(x/ln(2)) and |r| <= ln(2)/2.
+ */
+inline V exp( V x )
+{
+  V const underflowMask = S::less( x, S::constant( -87.3365447505531f ) ); // ln(FLT_MIN)
+  x = S::min( x, S::constant( 88.3762626647949f ) );
+  x = S::max( x, S::constant( -87.3365447505531f ) );
+  V const n = S::floor( S::multiplyAdd( x, S::constant( 1.44269504088896341f ), S::constant( 0.5f ) ) );
+  // Subtract n*ln(2) in two parts for extended precision.
+  x = S::multiplyAdd( n, S::constant( -0.693359375f ), x );
+  x = S::multiplyAdd( n, S::constant( 2.12194440e-4f ), x );
+  V const z = S::mul( x, x );
+  V poly = S::constant( 1.9875691500e-4f );
+  poly = S::multiplyAdd( poly, x, S::constant( 1.3981999507e-3f ) );
+  poly = S::multiplyAdd( poly, x, S::constant( 8.3334519073e-3f ) );
+  poly = S::multiplyAdd( poly, x, S::constant( 4.1665795894e-2f ) );
+  poly = S::multiplyAdd( poly, x, S::constant( 1.6666665459e-1f ) );
+  poly = S::multiplyAdd( poly, x, S::constant( 5.0000001201e-1f ) );
+  poly = S::add( S::multiplyAdd( poly, z, x ), S::constant( 1.0f ) );
+  V const scale = S::asFloat( S::shiftLeft<23>( S::intAdd( S::truncate( n ), S::intConstant( 127 ) ) ) );
+  return S::bitAndNot( underflowMask, S::mul( poly, scale ) );
+}
+
+/**
+ * Natural logarithm.
+ * Splits the argument into exponent e and mantissa m in [sqrt(1/2),sqrt(2)) and computes e*ln(2) + log(m).
+ */
+inline V log( V x )
+{
+  V const zero = S::constant( 0.0f );
+  V const zeroMask = S::equal( x, zero );
+  V const invalidMask = S::less( x, zero );
+  x = S::max( x, S::asFloat( S::intConstant( 0x00800000 ) ) ); // Smallest normalised number.
+  IV const biasedExponent = S::shiftRight<23>( S::asInt( x ) );
+  // Mantissa in [0.5,1)
+  x = S::bitOr( S::bitAnd( x, S::asFloat( S::intConstant( ~0x7f800000 ) ) ), S::constant( 0.5f ) );
+  V e = S::add( S::toFloat( S::intSub( biasedExponent, S::intConstant( 0x7f ) ) ), S::constant( 1.0f ) );
+  V const smallMask = S::less( x, S::constant( 0.707106781186547524f ) );
+  V const tmp = S::bitAnd( x, smallMask );
+  x = S::sub( x, S::constant( 1.0f ) );
+  e = S::sub( e, S::bitAnd( S::constant( 1.0f ), smallMask ) );
+  x = S::add( x, tmp );
+  V const z = S::mul( x, x );
+  V poly = S::constant( 7.0376836292e-2f );
+  poly = S::multiplyAdd( poly, x, S::constant( -1.1514610310e-1f ) );
+  poly = S::multiplyAdd( poly, x, S::constant( 1.1676998740e-1f ) );
+  poly = S::multiplyAdd( poly, x, S::constant( -1.2420140846e-1f ) );
+  poly = S::multiplyAdd( poly, x, S::constant( 1.4249322787e-1f ) );
+  poly = S::multiplyAdd( poly, x, S::constant( -1.6668057665e-1f ) );
+  poly = S::multiplyAdd( poly, x, S::constant( 2.0000714765e-1f ) );
+  poly = S::multiplyAdd( poly, x, S::constant( -2.4999993993e-1f ) );
+  poly = S::multiplyAdd( poly, x, S::constant( 3.3333331174e-1f ) );
+  V y = S::mul( S::mul( poly, x ), z );
+  y = S::multiplyAdd( e, S::constant( -2.12194440e-4f ), y );
+  y = S::multiplyAdd( z, S::constant( -0.5f ), y );
+  V res = S::add( x, y );
+  res = S::multiplyAdd( e, S::constant( 0.693359375f ), res );
+  res = S::select( res, S::constant( -std::numeric_limits<float>::infinity() ), zeroMask );
+  return S::select( res, S::constant( std::numeric_limits<float>::quiet_NaN() ), invalidMask );
+}
+
+/**
+ * Apply a vector operation with \p NumIn input and \p NumOut output arrays to all elements.
+ * The remaining elements that do not fill a complete SIMD register are processed via a zero-padded temporary
+ * buffer, such that all elements are computed by the same approximation.
+ */
+template< std::size_t NumIn, std::size_t NumOut, typename Operation >
+ErrorCode apply( float const * const (&inputs)[NumIn], float * const (&outputs)[NumOut],
+                 std::size_t numElements, std::size_t alignment, Operation op )
+{
+  for( float const * in : inputs )
+  {
+    if( not checkAlignment( in, alignment ) ) return alignmentError;
+  }
+  for( float * out : outputs )
+  {
+    if( not checkAlignment( out, alignment ) ) return alignmentError;
+  }
+  V in[NumIn];
+  V out[NumOut];
+  std::size_t idx( 0 );
+  for( ; idx + S::width <= numElements; idx += S::width )
+  {
+    for( std::size_t argIdx( 0 ); argIdx < NumIn; ++argIdx )
+    {
+      in[argIdx] = S::load( inputs[argIdx] + idx );
+    }
+    op( in, out );
+    for( std::size_t argIdx( 0 ); argIdx < NumOut; ++argIdx )
+    {
+      S::store( outputs[argIdx] + idx, out[argIdx] );
+    }
+  }
+  std::size_t const remainder = numElements - idx;
+  if( remainder > 0 )
+  {
+    float buffer[S::width];
+    for( std::size_t argIdx( 0 ); argIdx < NumIn; ++argIdx )
+    {
+      std::fill( buffer, buffer + S::width, 0.0f );
+      std::copy( inputs[argIdx] + idx, inputs[argIdx] + numElements, buffer );
+      in[argIdx] = S::load( buffer );
+    }
+    op( in, out );
+    for( std::size_t argIdx( 0 ); argIdx < NumOut; ++argIdx )
+    {
+      S::store( buffer, out[argIdx] );
+      std::copy( buffer, buffer + remainder, outputs[argIdx] + idx );
+    }
+  }
+  return noError;
+}
+
+} // unnamed namespace
+
+// Doxygen fails to find the corresponding declarations, therefore we
+// exclude the definitions here.
+/// @cond NEVER
+
+template<>
+ErrorCode vectorSinCos<float, Feature::VISR_SIMD_FEATURE>( float const * const angles,
+  float * const sinResult, float * const cosResult, std::size_t numElements, std::size_t alignment )
+{
+  return apply<1, 2>( { angles }, { sinResult, cosResult }, numElements, alignment,
+    []( V const * in, V * out ) { sinCos( in[0], out[0], out[1] ); } );
+}
+
+template<>
+ErrorCode vectorAtan2<float, Feature::VISR_SIMD_FEATURE>( float const * const y, float const * const x,
+  float * const result, std::size_t numElements, std::size_t alignment )
+{
+  return apply<2, 1>( { y, x }, { result }, numElements, alignment,
+    []( V const * in, V * out ) { out[0] = atan2( in[0], in[1] ); } );
+}
+
+template<>
+ErrorCode vectorExp<float, Feature::VISR_SIMD_FEATURE>( float const * const src, float * const dest,
+  std::size_t numElements, std::size_t alignment )
+{
+  return apply<1, 1>( { src }, { dest }, numElements, alignment,
+    []( V const * in, V * out ) { out[0] = exp( in[0] ); } );
+}
+
+template<>
+ErrorCode vectorLog<float, Feature::VISR_SIMD_FEATURE>( float const * const src, float * const dest,
+  std::size_t numElements, std::size_t alignment )
+{
+  return apply<1, 1>( { src }, { dest }, numElements, alignment,
+    []( V const * in, V * out ) { out[0] = log( in[0] ); } );
+}
+
+template<>
+ErrorCode vectorDB2Linear<float, Feature::VISR_SIMD_FEATURE>( float const * const src, float * const dest,
+  std::size_t numElements, std::size_t alignment )
+{
+  return apply<1, 1>( { src }, { dest }, numElements, alignment,
+    []( V const * in, V * out ) { out[0] = exp( S::mul( in[0], S::constant( 0.115129254649702284f ) ) ); } ); // ln(10)/20
+}
+
+template<>
+ErrorCode vectorLinear2DB<float, Feature::VISR_SIMD_FEATURE>( float const * const src, float * const dest,
+  std::size_t numElements, std::size_t alignment )
+{
+  return apply<1, 1>( { src }, { dest }, numElements, alignment,
+    []( V const * in, V * out ) { out[0] = S::mul( log( in[0] ), S::constant( 8.68588963806503655f ) ); } ); // 20/ln(10)
+}
+
+template<>
+ErrorCode vectorSpherical2Cartesian<float, Feature::VISR_SIMD_FEATURE>( float const * const az,
+  float const * const el, float const * const radius, float * const x, float * const y, float * const z,
+  std::size_t numElements, std::size_t alignment )
+{
+  return apply<3, 3>( { az, el, radius }, { x, y, z }, numElements, alignment,
+    []( V const * in, V * out )
+    {
+      V sinAz, cosAz, sinEl, cosEl;
+      sinCos( in[0], sinAz, cosAz );
+      sinCos( in[1], sinEl, cosEl );
+      V const horizontalRadius = S::mul( cosEl, in[2] );
+      out[0] = S::mul( cosAz, horizontalRadius );
+      out[1] = S::mul( sinAz, horizontalRadius );
+      out[2] = S::mul( sinEl, in[2] );
+    } );
+}
+
+template<>
+ErrorCode vectorCartesian2Spherical<float, Feature::VISR_SIMD_FEATURE>( float const * const x,
+  float const * const y, float const * const z, float * const az, float * const el, float * const radius,
+  std::size_t numElements, std::size_t alignment )
+{
+  return apply<3, 3>( { x, y, z }, { az, el, radius }, numElements, alignment,
+    []( V const * in, V * out )
+    {
+      V const horizontalSquare = S::multiplyAdd( in[0], in[0], S::mul( in[1], in[1] ) );
+      V const horizontalRadius = S::sqrt( horizontalSquare );
+      out[0] = atan2( in[1], in[0] );
+      out[1] = atan2( in[2], horizontalRadius );
+      out[2] = S::sqrt( S::multiplyAdd( in[2], in[2], horizontalSquare ) );
+    } );
+}
+
+/// @endcond NEVER
+
+} // namespace intel_x86_64
+} // namespace efl
+} // namespace visr
@@ -0,0 +1,91 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "vector_functions.hpp"
+
+#include "../alignment.hpp"
+
+#include <immintrin.h>
+
+#include <ciso646>
+
+namespace visr
+{
+namespace efl
+{
+namespace intel_x86_64
+{
+
+template<>
+ErrorCode
+vectorMaxMagnitude< float, Feature::VISR_SIMD_FEATURE >(
+  float const * input,
+  float & result,
+  std::size_t numberOfElements,
+  std::size_t alignmentElements /*= 0*/ )
+{
+#ifndef NDEBUG
+  if( not checkAlignment( input, alignmentElements ) ) return alignmentError;
+#endif
+  std::size_t count = numberOfElements;
+  // Clearing the sign bit yields the absolute value.
+  __m128 const signMask = _mm_set1_ps( -0.0f );
+  __m128 maxVal = _mm_setzero_ps();
+#ifdef __AVX__
+  {
+    __m256 const signMask256 = _mm256_set1_ps( -0.0f );
+    __m256 maxVal256 = _mm256_setzero_ps();
+    if( alignmentElements >= 8 )
+    {
+      while( count >= 8 )
+      {
+        count -= 8;
+        maxVal256 = _mm256_max_ps( maxVal256, _mm256_andnot_ps( signMask256, _mm256_load_ps( input ) ) );
+        input += 8;
+      }
+    }
+    else
+    {
+      while( count >= 8 )
+      {
+        count -= 8;
+        maxVal256 = _mm256_max_ps( maxVal256, _mm256_andnot_ps( signMask256, _mm256_loadu_ps( input ) ) );
+        input += 8;
+      }
+    }
+    maxVal = _mm_max_ps( _mm256_castps256_ps128( maxVal256 ), _mm256_extractf128_ps( maxVal256, 1 ) );
+  }
+#endif
+  if( alignmentElements >= 4 )
+  {
+    while( count >= 4 )
+    {
+      count -= 4;
+      maxVal = _mm_max_ps( maxVal, _mm_andnot_ps( signMask, _mm_load_ps( input ) ) );
+      input += 4;
+    }
+  }
+  else
+  {
+    while( count >= 4 )
+    {
+      count -= 4;
+      maxVal = _mm_max_ps( maxVal, _mm_andnot_ps( signMask, _mm_loadu_ps( input ) ) );
+      input += 4;
+    }
+  }
+  while( count > 0 )
+  {
+    --count;
+    maxVal = _mm_max_ss( maxVal, _mm_andnot_ps( signMask, _mm_load_ss( input ) ) );
+    ++input;
+  }
+  // Horizontal maximum of the four partial results.
+  maxVal = _mm_max_ps( maxVal, _mm_movehl_ps( maxVal, maxVal ) );
+  maxVal = _mm_max_ss( maxVal, _mm_shuffle_ps( maxVal, maxVal, 0x55 ) );
+  _mm_store_ss( &result, maxVal );
+  return efl::noError;
+}
+
+} // namespace intel_x86_64
+} // namespace efl
+} // namespace visr
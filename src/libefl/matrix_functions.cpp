@@ -4,6 +4,8 @@
 
 #include "alignment.hpp"
 
+#include "reference/matrix_functions.hpp"
+
 #include <complex>
 
 #include <algorithm>
@@ -15,6 +17,9 @@ namespace visr
 namespace efl
 {
 
+// Define the function pointers of the matrix multiplication and initialise them with the reference implementations.
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(MatrixMultiplyWrapper<float>::sPtr) MatrixMultiplyWrapper<float>::sPtr{ reference::matrixMultiply<float> };
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(MatrixMultiplyWrapper<double>::sPtr) MatrixMultiplyWrapper<double>::sPtr{ reference::matrixMultiply<double> };
 
 template< typename T>
 ErrorCode product( T const * op1,
@@ -31,6 +36,11 @@ ErrorCode product( T const * op1,
 		   std::size_t resColumnStride )
 	       
 {
+  if( (op1ColumnStride == 1) and (op2ColumnStride == 1) and (resColumnStride == 1) )
+  {
+    return matrixMultiply( op1, op2, res, numResultRows, numResultColumns, numOp1Columns,
+                           op1RowStride, op2RowStride, resRowStride );
+  }
   // TODO: Alignment checking
   for( std::size_t rowIdx(0); rowIdx < numResultRows; ++rowIdx )
   {
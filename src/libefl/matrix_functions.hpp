@@ -5,6 +5,7 @@
 
 #include "error_codes.hpp"
 #include "export_symbols.hpp"
+#include "function_wrapper.hpp"
 
 #include <cstddef>
 
@@ -13,6 +14,46 @@ namespace visr
 namespace efl
 {
 
+VISR_EFL_CREATE_FUNCTION_WRAPPER_TEMPLATE( MatrixMultiplyWrapper, T, ErrorCode, T const *, T const *, T *, std::size_t, std::size_t, std::size_t, std::size_t, std::size_t, std::size_t, std::size_t );
+
+/**
+ * Multiply two dense matrices stored in row-major order, i.e., with consecutive elements within each row.
+ * Computes \p res = \p op1 * \p op2, where \p op1 is a \p numResultRows x \p numOp1Columns matrix and \p op2 is
+ * a \p numOp1Columns x \p numResultColumns matrix.
+ * A typical use is the mixing of a block of multichannel audio, where \p op1 is the gain matrix and the rows of
+ * \p op2 and \p res are the input and output channels, respectively.
+ * @tparam T The element type, float and double are supported.
+ * @param op1 Base pointer of the left operand.
+ * @param op2 Base pointer of the right operand.
+ * @param[out] res Base pointer of the result matrix. Must not overlap with the operands.
+ * @param numResultRows The number of rows of the result and of \p op1.
+ * @param numResultColumns The number of columns of the result and of \p op2.
+ * @param numOp1Columns The number of columns of \p op1, which is also the number of rows of \p op2.
+ * @param op1RowStride Distance between consecutive rows of \p op1, in number of elements.
+ * @param op2RowStride Distance between consecutive rows of \p op2, in number of elements.
+ * @param resRowStride Distance between consecutive rows of \p res, in number of elements.
+ * @param alignment Assured alignment of the base pointers, measured in elements.
+ */
+template< typename T >
+ErrorCode matrixMultiply( T const * op1,
+                          T const * op2,
+                          T * res,
+                          std::size_t numResultRows,
+                          std::size_t numResultColumns,
+                          std::size_t numOp1Columns,
+                          std::size_t op1RowStride,
+                          std::size_t op2RowStride,
+                          std::size_t resRowStride,
+                          std::size_t alignment = 0 )
+{
+  return MatrixMultiplyWrapper<T>::call( op1, op2, res, numResultRows, numResultColumns, numOp1Columns,
+                                         op1RowStride, op2RowStride, resRowStride, alignment );
+}
+
+/**
+ * Multiply two matrices with arbitrary row and column strides.
+ * If all column strides are one, the operation is performed by matrixMultiply().
+ */
 template< typename T> VISR_EFL_LIBRARY_SYMBOL
 ErrorCode product( T const * op1,
                    T const * op2,
@@ -0,0 +1,67 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "matrix_functions.hpp"
+
+#include "../alignment.hpp"
+
+#include <algorithm>
+#include <ciso646>
+
+namespace visr
+{
+namespace efl
+{
+namespace reference
+{
+
+template< typename T >
+ErrorCode matrixMultiply( T const * op1,
+                          T const * op2,
+                          T * res,
+                          std::size_t numResultRows,
+                          std::size_t numResultColumns,
+                          std::size_t numOp1Columns,
+                          std::size_t op1RowStride,
+                          std::size_t op2RowStride,
+                          std::size_t resRowStride,
+                          std::size_t alignment /*= 0*/ )
+{
+  if( not checkAlignment( op1, alignment ) ) return alignmentError;
+  if( not checkAlignment( op2, alignment ) ) return alignmentError;
+  if( not checkAlignment( res, alignment ) ) return alignmentError;
+  // Process the result in column blocks that fit into the first-level cache, and accumulate the rows of op2 scaled by
+  // the elements of op1. The innermost loop operates on consecutive elements and can be vectorised by the compiler.
+  std::size_t const columnBlockSize = 256;
+  for( std::size_t blockStart( 0 ); blockStart < numResultColumns; blockStart += columnBlockSize )
+  {
+    std::size_t const blockLength = std::min( columnBlockSize, numResultColumns - blockStart );
+    for( std::size_t rowIdx( 0 ); rowIdx < numResultRows; ++rowIdx )
+    {
+      T * const resRow = res + rowIdx * resRowStride + blockStart;
+      std::fill( resRow, resRow + blockLength, static_cast<T>(0.0) );
+      T const * const op1Row = op1 + rowIdx * op1RowStride;
+      for( std::size_t runIdx( 0 ); runIdx < numOp1Columns; ++runIdx )
+      {
+        T const factor = op1Row[runIdx];
+        T const * const op2Row = op2 + runIdx * op2RowStride + blockStart;
+        for( std::size_t colIdx( 0 ); colIdx < blockLength; ++colIdx )
+        {
+          resRow[colIdx] += factor * op2Row[colIdx];
+        }
+      }
+    }
+  }
+  return noError;
+}
+
+// Explicit instantiations
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode matrixMultiply<float>( float const *, float const *, float *, std::size_t, std::size_t, std::size_t,
+                                 std::size_t, std::size_t, std::size_t, std::size_t );
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode matrixMultiply<double>( double const *, double const *, double *, std::size_t, std::size_t, std::size_t,
+                                  std::size_t, std::size_t, std::size_t, std::size_t );
+
+} // namespace reference
+} // namespace efl
+} // namespace visr
@@ -0,0 +1,40 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBEFL_REFERENCE_MATRIX_FUNCTIONS_HPP_INCLUDED
+#define VISR_LIBEFL_REFERENCE_MATRIX_FUNCTIONS_HPP_INCLUDED
+
+#include "../error_codes.hpp"
+#include "../export_symbols.hpp"
+#include "../matrix_functions.hpp"
+
+#include <cstddef>
+
+namespace visr
+{
+namespace efl
+{
+namespace reference
+{
+
+/**
+ * Portable implementation of efl::matrixMultiply().
+ * Instantiated for element types float and double.
+ */
+template< typename T >
+VISR_EFL_LIBRARY_SYMBOL
+ErrorCode matrixMultiply( T const * op1,
+                          T const * op2,
+                          T * res,
+                          std::size_t numResultRows,
+                          std::size_t numResultColumns,
+                          std::size_t numOp1Columns,
+                          std::size_t op1RowStride,
+                          std::size_t op2RowStride,
+                          std::size_t resRowStride,
+                          std::size_t alignment = 0 );
+
+} // namespace reference
+} // namespace efl
+} // namespace visr
+
+#endif // VISR_LIBEFL_REFERENCE_MATRIX_FUNCTIONS_HPP_INCLUDED
@@ -0,0 +1,26 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "../sample_conversions.hpp"
+#include "sample_conversions_impl.hpp"
+
+#include <boost/preprocessor/seq/for_each.hpp>
+
+namespace visr
+{
+namespace efl
+{
+
+namespace reference
+{
+
+// Prevent Doxygen from trying to parse these explicit instantiations.
+/// @cond NEVER
+#define EXPLICITLY_INSTANTIATE_SAMPLE_CONVERSIONS( R, DATA, TYPE ) \
+template ErrorCode vectorDeinterleaveSamples<TYPE, float>( TYPE const *, float * const *, std::size_t, std::size_t, std::size_t ); \
+template ErrorCode vectorInterleaveSamples<float, TYPE>( float const * const *, TYPE *, std::size_t, std::size_t, std::size_t );
+BOOST_PP_SEQ_FOR_EACH( EXPLICITLY_INSTANTIATE_SAMPLE_CONVERSIONS, _, VISR_EFL_SAMPLE_CONVERSION_EXTERNAL_TYPES )
+/// @endcond NEVER
+
+} // namespace reference
+} // namespace efl
+} // namespace visr
@@ -0,0 +1,37 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBEFL_REFERENCE_SAMPLE_CONVERSIONS_HPP_INCLUDED
+#define VISR_LIBEFL_REFERENCE_SAMPLE_CONVERSIONS_HPP_INCLUDED
+
+#include "../export_symbols.hpp"
+#include "../sample_conversions.hpp"
+
+namespace visr
+{
+namespace efl
+{
+
+namespace reference
+{
+
+template< typename InputType, typename OutputType >
+VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorDeinterleaveSamples( InputType const * src,
+                                     OutputType * const * dest,
+                                     std::size_t numberOfChannels,
+                                     std::size_t numberOfFrames,
+                                     std::size_t alignment = 0 );
+
+template< typename InputType, typename OutputType >
+VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorInterleaveSamples( InputType const * const * src,
+                                   OutputType * dest,
+                                   std::size_t numberOfChannels,
+                                   std::size_t numberOfFrames,
+                                   std::size_t alignment = 0 );
+
+} // namespace reference
+} // namespace efl
+} // namespace visr
+
+#endif // VISR_LIBEFL_REFERENCE_SAMPLE_CONVERSIONS_HPP_INCLUDED
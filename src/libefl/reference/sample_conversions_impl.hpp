@@ -0,0 +1,152 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBEFL_REFERENCE_SAMPLE_CONVERSIONS_IMPL_HPP_INCLUDED
+#define VISR_LIBEFL_REFERENCE_SAMPLE_CONVERSIONS_IMPL_HPP_INCLUDED
+
+/**
+ * @file reference/sample_conversions_impl.hpp
+ * Provide templated implementations of the reference audio sample
+ * conversion functions.
+ * This file is is not normally included in user code, but in the .cpp files
+ * that provide explicit template instantiations, and in optimised implementations
+ * that use the scalar conversions for the remaining elements.
+ */
+
+#include "sample_conversions.hpp"
+
+#include "../alignment.hpp"
+
+#include <algorithm>
+#include <ciso646>
+#include <cmath>
+#include <cstdint>
+
+namespace visr
+{
+namespace efl
+{
+
+namespace reference
+{
+
+namespace // unnamed
+{
+
+/**
+ * Traits template describing the normalisation of an external sample type.
+ * The floating-point variant is used without scaling or saturation.
+ */
+template< typename SampleType >
+struct SampleFormat
+{
+  static float toFloat( SampleType val ) { return static_cast<float>(val); }
+
+  static SampleType fromFloat( float val ) { return static_cast<SampleType>(val); }
+};
+
+/**
+ * Common implementation of the integer sample formats.
+ * The saturation limits are given as float values, because the upper limit of 32-bit integers
+ * is not representable in single precision. Optimised implementations use the same limits to
+ * produce identical results.
+ */
+template< typename IntegerType, std::int32_t bits >
+struct IntegerSampleFormat
+{
+  static constexpr float cScale = static_cast<float>( std::int64_t( 1 ) << (bits - 1) );
+
+  static constexpr float cMinimum = -cScale;
+
+  /**
+   * The largest float value that does not exceed the maximum integer value.
+   */
+  static constexpr float cMaximum = bits > 24 ? cScale - static_cast<float>( std::int64_t( 1 ) << (bits - 25) ) : cScale - 1.0f;
+
+  static std::int32_t quantise( float val )
+  {
+    return static_cast<std::int32_t>( std::lrint( std::min( std::max( val * cScale, float( cMinimum ) ), float( cMaximum ) ) ) );
+  }
+};
+
+template<>
+struct SampleFormat<std::int16_t>: public IntegerSampleFormat<std::int16_t, 16>
+{
+  static float toFloat( std::int16_t val ) { return static_cast<float>(val) * (1.0f / cScale); }
+
+  static std::int16_t fromFloat( float val ) { return static_cast<std::int16_t>( quantise( val ) ); }
+};
+
+template<>
+struct SampleFormat<std::int32_t>: public IntegerSampleFormat<std::int32_t, 32>
+{
+  static float toFloat( std::int32_t val ) { return static_cast<float>(val) * (1.0f / cScale); }
+
+  static std::int32_t fromFloat( float val ) { return quantise( val ); }
+};
+
+template<>
+struct SampleFormat<Int24>: public IntegerSampleFormat<Int24, 24>
+{
+  static float toFloat( Int24 val )
+  {
+    // Assemble the value in the upper three bytes to obtain the sign extension for free.
+    std::uint32_t const raw = (static_cast<std::uint32_t>(val.bytes[0]) << 8)
+      | (static_cast<std::uint32_t>(val.bytes[1]) << 16) | (static_cast<std::uint32_t>(val.bytes[2]) << 24);
+    return static_cast<float>( static_cast<std::int32_t>(raw) ) * (1.0f / (256.0f * cScale));
+  }
+
+  static Int24 fromFloat( float val )
+  {
+    std::uint32_t const raw = static_cast<std::uint32_t>( quantise( val ) );
+    return Int24{ { static_cast<std::uint8_t>(raw), static_cast<std::uint8_t>(raw >> 8),
+      static_cast<std::uint8_t>(raw >> 16) } };
+  }
+};
+
+} // unnamed namespace
+
+template< typename InputType, typename OutputType >
+ErrorCode vectorDeinterleaveSamples( InputType const * src,
+                                     OutputType * const * dest,
+                                     std::size_t numberOfChannels,
+                                     std::size_t numberOfFrames,
+                                     std::size_t alignment /*= 0*/ )
+{
+  for( std::size_t chIdx( 0 ); chIdx < numberOfChannels; ++chIdx )
+  {
+    if( not checkAlignment( dest[chIdx], alignment ) ) return alignmentError;
+    InputType const * inputPtr = src + chIdx;
+    OutputType * const outputPtr = dest[chIdx];
+    for( std::size_t frameIdx( 0 ); frameIdx < numberOfFrames; ++frameIdx, inputPtr += numberOfChannels )
+    {
+      outputPtr[frameIdx] = static_cast<OutputType>( SampleFormat<InputType>::toFloat( *inputPtr ) );
+    }
+  }
+  return noError;
+}
+
+template< typename InputType, typename OutputType >
+ErrorCode vectorInterleaveSamples( InputType const * const * src,
+                                   OutputType * dest,
+                                   std::size_t numberOfChannels,
+                                   std::size_t numberOfFrames,
+                                   std::size_t alignment /*= 0*/ )
+{
+  for( std::size_t chIdx( 0 ); chIdx < numberOfChannels; ++chIdx )
+  {
+    if( not checkAlignment( src[chIdx], alignment ) ) return alignmentError;
+    InputType const * const inputPtr = src[chIdx];
+    OutputType * outputPtr = dest + chIdx;
+    for( std::size_t frameIdx( 0 ); frameIdx < numberOfFrames; ++frameIdx, outputPtr += numberOfChannels )
+    {
+      *outputPtr = SampleFormat<OutputType>::fromFloat( static_cast<float>( inputPtr[frameIdx] ) );
+    }
+  }
+  return noError;
+}
+
+} // namespace reference
+} // namespace efl
+} // namespace visr
+
+#endif // VISR_LIBEFL_REFERENCE_SAMPLE_CONVERSIONS_IMPL_HPP_INCLUDED
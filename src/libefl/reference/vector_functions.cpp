@@ -166,6 +166,9 @@ template VISR_EFL_LIBRARY_SYMBOL ErrorCode vectorRampScaling(double const *, dou
 template VISR_EFL_LIBRARY_SYMBOL ErrorCode vectorRampScaling(std::complex<float> const *, std::complex<float> const *, std::complex<float> *, std::complex<float>, std::complex<float>, std::size_t, bool, std::size_t);
 template VISR_EFL_LIBRARY_SYMBOL ErrorCode vectorRampScaling(std::complex<double> const *, std::complex<double> const *, std::complex<double> *, std::complex<double>, std::complex<double>, std::size_t, bool, std::size_t);
 
+template VISR_EFL_LIBRARY_SYMBOL ErrorCode vectorMaxMagnitude( float const *, float &, std::size_t, std::size_t );
+template VISR_EFL_LIBRARY_SYMBOL ErrorCode vectorMaxMagnitude( double const *, double &, std::size_t, std::size_t );
+
 } // namespace reference
 } // namespace efl
 } // namespace visr
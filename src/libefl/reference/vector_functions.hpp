@@ -251,6 +251,20 @@ efl::ErrorCode vectorRampScaling(T const * input,
   bool accumulate /*= false*/,
   std::size_t alignmentElements /*= 0*/);
 
+/**
+ * Compute the maximum magnitude (absolute value) of a vector.
+ * @param input The vector to be evaluated.
+ * @param [out] result The maximum absolute value of all elements, 0 for an empty vector.
+ * @param numberOfElements The number of elements in \p input.
+ * @param alignmentElements Minimum alignment of \p input, measured in multiples of the element size.
+ */
+template<typename T>
+VISR_EFL_LIBRARY_SYMBOL
+efl::ErrorCode vectorMaxMagnitude( T const * input,
+  T & result,
+  std::size_t numberOfElements,
+  std::size_t alignmentElements /*= 0*/);
+
 } // namespace reference
 } // namespace efl
 } // namespace visr
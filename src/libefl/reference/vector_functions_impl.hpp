@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <ciso646> // should not be necessary for c++11, but MSVC needs it somehow
+#include <cmath>
 #include <functional>
 
 namespace visr
@@ -396,6 +397,23 @@ ErrorCode vectorRampScaling(T const * input,
   return efl::noError;
 }
 
+template<typename T>
+ErrorCode vectorMaxMagnitude( T const * input,
+  T & result,
+  std::size_t numberOfElements,
+  std::size_t alignmentElements /*= 0*/ )
+{
+  if( not checkAlignment( input, alignmentElements ) ) return alignmentError;
+  T maxVal = static_cast<T>(0);
+  for( std::size_t elIdx(0); elIdx < numberOfElements; ++elIdx, ++input )
+  {
+    T const absVal = std::abs( *input );
+    maxVal = absVal > maxVal ? absVal : maxVal;
+  }
+  result = maxVal;
+  return efl::noError;
+}
+
 } // namespace reference
 } // namespace efl
 } // namespace visr
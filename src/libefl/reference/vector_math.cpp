@@ -0,0 +1,218 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "vector_math.hpp"
+
+#include "../alignment.hpp"
+
+#include <ciso646>
+#include <cmath>
+
+namespace visr
+{
+namespace efl
+{
+namespace reference
+{
+
+template< typename T >
+ErrorCode vectorSinCos( T const * const angles,
+                        T * const sinResult,
+                        T * const cosResult,
+                        std::size_t numElements,
+                        std::size_t alignment /*= 0*/ )
+{
+  if( not checkAlignment( angles, alignment ) ) return alignmentError;
+  if( not checkAlignment( sinResult, alignment ) ) return alignmentError;
+  if( not checkAlignment( cosResult, alignment ) ) return alignmentError;
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    T const angle = angles[idx];
+    sinResult[idx] = std::sin( angle );
+    cosResult[idx] = std::cos( angle );
+  }
+  return noError;
+}
+
+template< typename T >
+ErrorCode vectorAtan2( T const * const y,
+                       T const * const x,
+                       T * const result,
+                       std::size_t numElements,
+                       std::size_t alignment /*= 0*/ )
+{
+  if( not checkAlignment( y, alignment ) ) return alignmentError;
+  if( not checkAlignment( x, alignment ) ) return alignmentError;
+  if( not checkAlignment( result, alignment ) ) return alignmentError;
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    result[idx] = std::atan2( y[idx], x[idx] );
+  }
+  return noError;
+}
+
+template< typename T >
+ErrorCode vectorExp( T const * const src,
+                     T * const dest,
+                     std::size_t numElements,
+                     std::size_t alignment /*= 0*/ )
+{
+  if( not checkAlignment( src, alignment ) ) return alignmentError;
+  if( not checkAlignment( dest, alignment ) ) return alignmentError;
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    dest[idx] = std::exp( src[idx] );
+  }
+  return noError;
+}
+
+template< typename T >
+ErrorCode vectorLog( T const * const src,
+                     T * const dest,
+                     std::size_t numElements,
+                     std::size_t alignment /*= 0*/ )
+{
+  if( not checkAlignment( src, alignment ) ) return alignmentError;
+  if( not checkAlignment( dest, alignment ) ) return alignmentError;
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    dest[idx] = std::log( src[idx] );
+  }
+  return noError;
+}
+
+template< typename T >
+ErrorCode vectorDB2Linear( T const * const src,
+                           T * const dest,
+                           std::size_t numElements,
+                           std::size_t alignment /*= 0*/ )
+{
+  if( not checkAlignment( src, alignment ) ) return alignmentError;
+  if( not checkAlignment( dest, alignment ) ) return alignmentError;
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    dest[idx] = std::pow( static_cast<T>(10.0), static_cast<T>(0.05)*src[idx] );
+  }
+  return noError;
+}
+
+template< typename T >
+ErrorCode vectorLinear2DB( T const * const src,
+                           T * const dest,
+                           std::size_t numElements,
+                           std::size_t alignment /*= 0*/ )
+{
+  if( not checkAlignment( src, alignment ) ) return alignmentError;
+  if( not checkAlignment( dest, alignment ) ) return alignmentError;
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    dest[idx] = static_cast<T>(20.0)*std::log10( src[idx] );
+  }
+  return noError;
+}
+
+template< typename T >
+ErrorCode vectorSpherical2Cartesian( T const * const az,
+                                     T const * const el,
+                                     T const * const radius,
+                                     T * const x,
+                                     T * const y,
+                                     T * const z,
+                                     std::size_t numElements,
+                                     std::size_t alignment /*= 0*/ )
+{
+  if( not checkAlignment( az, alignment ) ) return alignmentError;
+  if( not checkAlignment( el, alignment ) ) return alignmentError;
+  if( not checkAlignment( radius, alignment ) ) return alignmentError;
+  if( not checkAlignment( x, alignment ) ) return alignmentError;
+  if( not checkAlignment( y, alignment ) ) return alignmentError;
+  if( not checkAlignment( z, alignment ) ) return alignmentError;
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    T const horizontalRadius = std::cos( el[idx] ) * radius[idx];
+    T const zVal = std::sin( el[idx] ) * radius[idx];
+    T const azVal = az[idx];
+    // Assign the outputs after all inputs of this element have been read to permit in-place operation.
+    x[idx] = std::cos( azVal ) * horizontalRadius;
+    y[idx] = std::sin( azVal ) * horizontalRadius;
+    z[idx] = zVal;
+  }
+  return noError;
+}
+
+template< typename T >
+ErrorCode vectorCartesian2Spherical( T const * const x,
+                                     T const * const y,
+                                     T const * const z,
+                                     T * const az,
+                                     T * const el,
+                                     T * const radius,
+                                     std::size_t numElements,
+                                     std::size_t alignment /*= 0*/ )
+{
+  if( not checkAlignment( x, alignment ) ) return alignmentError;
+  if( not checkAlignment( y, alignment ) ) return alignmentError;
+  if( not checkAlignment( z, alignment ) ) return alignmentError;
+  if( not checkAlignment( az, alignment ) ) return alignmentError;
+  if( not checkAlignment( el, alignment ) ) return alignmentError;
+  if( not checkAlignment( radius, alignment ) ) return alignmentError;
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    T const xVal = x[idx];
+    T const yVal = y[idx];
+    T const zVal = z[idx];
+    T const horizontalRadius = std::sqrt( xVal*xVal + yVal*yVal );
+    az[idx] = std::atan2( yVal, xVal );
+    el[idx] = std::atan2( zVal, horizontalRadius );
+    radius[idx] = std::sqrt( horizontalRadius*horizontalRadius + zVal*zVal );
+  }
+  return noError;
+}
+
+// Explicit instantiations
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorSinCos<float>( float const * const, float * const, float * const, std::size_t, std::size_t );
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorSinCos<double>( double const * const, double * const, double * const, std::size_t, std::size_t );
+
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorAtan2<float>( float const * const, float const * const, float * const, std::size_t, std::size_t );
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorAtan2<double>( double const * const, double const * const, double * const, std::size_t, std::size_t );
+
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorExp<float>( float const * const, float * const, std::size_t, std::size_t );
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorExp<double>( double const * const, double * const, std::size_t, std::size_t );
+
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorLog<float>( float const * const, float * const, std::size_t, std::size_t );
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorLog<double>( double const * const, double * const, std::size_t, std::size_t );
+
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorDB2Linear<float>( float const * const, float * const, std::size_t, std::size_t );
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorDB2Linear<double>( double const * const, double * const, std::size_t, std::size_t );
+
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorLinear2DB<float>( float const * const, float * const, std::size_t, std::size_t );
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorLinear2DB<double>( double const * const, double * const, std::size_t, std::size_t );
+
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorSpherical2Cartesian<float>( float const * const, float const * const, float const * const,
+                                            float * const, float * const, float * const, std::size_t, std::size_t );
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorSpherical2Cartesian<double>( double const * const, double const * const, double const * const,
+                                             double * const, double * const, double * const, std::size_t, std::size_t );
+
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorCartesian2Spherical<float>( float const * const, float const * const, float const * const,
+                                            float * const, float * const, float * const, std::size_t, std::size_t );
+template VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorCartesian2Spherical<double>( double const * const, double const * const, double const * const,
+                                             double * const, double * const, double * const, std::size_t, std::size_t );
+
+} // namespace reference
+} // namespace efl
+} // namespace visr
@@ -0,0 +1,95 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBEFL_REFERENCE_VECTOR_MATH_HPP_INCLUDED
+#define VISR_LIBEFL_REFERENCE_VECTOR_MATH_HPP_INCLUDED
+
+#include "../error_codes.hpp"
+#include "../export_symbols.hpp"
+#include "../vector_math.hpp"
+
+#include <cstddef>
+
+namespace visr
+{
+namespace efl
+{
+namespace reference
+{
+
+/**
+ * Portable implementations of the array functions in vector_math.hpp, based on the C++ standard library.
+ * Instantiated for element types float and double.
+ */
+//@{
+template< typename T >
+VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorSinCos( T const * const angles,
+                        T * const sinResult,
+                        T * const cosResult,
+                        std::size_t numElements,
+                        std::size_t alignment = 0 );
+
+template< typename T >
+VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorAtan2( T const * const y,
+                       T const * const x,
+                       T * const result,
+                       std::size_t numElements,
+                       std::size_t alignment = 0 );
+
+template< typename T >
+VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorExp( T const * const src,
+                     T * const dest,
+                     std::size_t numElements,
+                     std::size_t alignment = 0 );
+
+template< typename T >
+VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorLog( T const * const src,
+                     T * const dest,
+                     std::size_t numElements,
+                     std::size_t alignment = 0 );
+
+template< typename T >
+VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorDB2Linear( T const * const src,
+                           T * const dest,
+                           std::size_t numElements,
+                           std::size_t alignment = 0 );
+
+template< typename T >
+VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorLinear2DB( T const * const src,
+                           T * const dest,
+                           std::size_t numElements,
+                           std::size_t alignment = 0 );
+
+template< typename T >
+VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorSpherical2Cartesian( T const * const az,
+                                     T const * const el,
+                                     T const * const radius,
+                                     T * const x,
+                                     T * const y,
+                                     T * const z,
+                                     std::size_t numElements,
+                                     std::size_t alignment = 0 );
+
+template< typename T >
+VISR_EFL_LIBRARY_SYMBOL
+ErrorCode vectorCartesian2Spherical( T const * const x,
+                                     T const * const y,
+                                     T const * const z,
+                                     T * const az,
+                                     T * const el,
+                                     T * const radius,
+                                     std::size_t numElements,
+                                     std::size_t alignment = 0 );
+//@}
+
+} // namespace reference
+} // namespace efl
+} // namespace visr
+
+#endif // VISR_LIBEFL_REFERENCE_VECTOR_MATH_HPP_INCLUDED
@@ -0,0 +1,24 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "sample_conversions.hpp"
+#include "reference/sample_conversions.hpp"
+
+#include <boost/preprocessor/seq/for_each.hpp>
+
+namespace visr
+{
+namespace efl
+{
+
+/**
+ * Define the function pointers of the sample conversion functions for a given external sample type
+ * and initialise them with the reference implementations.
+ */
+#define REGISTER_SAMPLE_CONVERSION_FUNCTIONS( R, DATA, TYPE ) \
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorDeinterleaveSamplesWrapper<TYPE, float>::sPtr) VectorDeinterleaveSamplesWrapper<TYPE, float>::sPtr{ reference::vectorDeinterleaveSamples<TYPE, float> }; \
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorInterleaveSamplesWrapper<float, TYPE>::sPtr) VectorInterleaveSamplesWrapper<float, TYPE>::sPtr{ reference::vectorInterleaveSamples<float, TYPE> };
+
+BOOST_PP_SEQ_FOR_EACH( REGISTER_SAMPLE_CONVERSION_FUNCTIONS, _, VISR_EFL_SAMPLE_CONVERSION_EXTERNAL_TYPES )
+
+} // namespace efl
+} // namespace visr
@@ -0,0 +1,100 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBEFL_SAMPLE_CONVERSIONS_HPP_INCLUDED
+#define VISR_LIBEFL_SAMPLE_CONVERSIONS_HPP_INCLUDED
+
+#include "error_codes.hpp"
+#include "export_symbols.hpp"
+#include "function_wrapper.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace visr
+{
+namespace efl
+{
+
+/**
+ * @name Audio sample conversions
+ * Functions to convert audio samples between the external sample formats used by sound cards and the
+ * floating-point format used in the signal flows, combined with the transformation between interleaved
+ * and planar (one buffer per channel) layouts.
+ * In contrast to vectorConvert(), the integer formats are normalised to their full scale, i.e., the range
+ * [-1.0, 1.0) corresponds to the complete range of the integer type. Conversions to integer types round
+ * to the nearest value and saturate at the limits of the integer type.
+ */
+//@{
+
+/**
+ * Packed signed 24-bit integer sample, stored as three bytes in little-endian order.
+ * This corresponds to the 24-bit format of most audio interfaces.
+ */
+struct VISR_EFL_LIBRARY_SYMBOL Int24
+{
+  std::uint8_t bytes[3];
+};
+
+static_assert( sizeof(Int24) == 3, "Int24 must not contain padding bytes." );
+
+/**
+ * List of the external sample types supported by the sample conversion functions.
+ * The internal (planar) sample type is always float.
+ * @note The type list is in a format usable by boost::preprocessor, which is used to automatically
+ * generated the function dispatchers and reference implementations.
+ */
+#define VISR_EFL_SAMPLE_CONVERSION_EXTERNAL_TYPES (int16_t)(Int24)(int32_t)(float)
+
+VISR_EFL_CREATE_FUNCTION_WRAPPER_TEMPLATE_TWO_TYPES( VectorDeinterleaveSamplesWrapper, T1, T2, ErrorCode, T1 const *, T2 * const *, std::size_t, std::size_t, std::size_t );
+
+/**
+ * Convert an interleaved buffer of audio samples into a set of channel buffers.
+ * @tparam InputType The external sample type, one of VISR_EFL_SAMPLE_CONVERSION_EXTERNAL_TYPES.
+ * @tparam OutputType The internal sample type, only float is supported.
+ * @param src The interleaved input, consisting of \p numberOfFrames frames of \p numberOfChannels samples each.
+ * A non-interleaved channel buffer is converted by passing \p numberOfChannels = 1.
+ * @param dest Array of \p numberOfChannels channel buffers, each holding at least \p numberOfFrames samples.
+ * @param numberOfChannels The number of channels.
+ * @param numberOfFrames The number of samples per channel.
+ * @param alignment The minimum alignment of the channel buffers, measured in number of elements.
+ */
+template< typename InputType, typename OutputType >
+ErrorCode vectorDeinterleaveSamples( InputType const * src,
+                                     OutputType * const * dest,
+                                     std::size_t numberOfChannels,
+                                     std::size_t numberOfFrames,
+                                     std::size_t alignment = 0 )
+{
+  return VectorDeinterleaveSamplesWrapper< InputType, OutputType >::call(
+    src, dest, numberOfChannels, numberOfFrames, alignment );
+}
+
+VISR_EFL_CREATE_FUNCTION_WRAPPER_TEMPLATE_TWO_TYPES( VectorInterleaveSamplesWrapper, T1, T2, ErrorCode, T1 const * const *, T2 *, std::size_t, std::size_t, std::size_t );
+
+/**
+ * Convert a set of channel buffers into an interleaved buffer of audio samples.
+ * @tparam InputType The internal sample type, only float is supported.
+ * @tparam OutputType The external sample type, one of VISR_EFL_SAMPLE_CONVERSION_EXTERNAL_TYPES.
+ * @param src Array of \p numberOfChannels channel buffers, each holding at least \p numberOfFrames samples.
+ * @param dest The interleaved output, must hold \p numberOfFrames frames of \p numberOfChannels samples each.
+ * A non-interleaved channel buffer is written by passing \p numberOfChannels = 1.
+ * @param numberOfChannels The number of channels.
+ * @param numberOfFrames The number of samples per channel.
+ * @param alignment The minimum alignment of the channel buffers, measured in number of elements.
+ */
+template< typename InputType, typename OutputType >
+ErrorCode vectorInterleaveSamples( InputType const * const * src,
+                                   OutputType * dest,
+                                   std::size_t numberOfChannels,
+                                   std::size_t numberOfFrames,
+                                   std::size_t alignment = 0 )
+{
+  return VectorInterleaveSamplesWrapper< InputType, OutputType >::call(
+    src, dest, numberOfChannels, numberOfFrames, alignment );
+}
+//@}
+
+} // namespace efl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBEFL_SAMPLE_CONVERSIONS_HPP_INCLUDED
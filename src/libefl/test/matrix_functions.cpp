@@ -0,0 +1,115 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <libefl/initialise_library.hpp>
+#include <libefl/matrix_functions.hpp>
+
+#include <libefl/reference/matrix_functions.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace visr
+{
+namespace efl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+/**
+ * Compare the optimised and the reference matrix multiplication against a straightforward triple loop,
+ * for dimensions that exercise the register tiles, the remainder loops, and the cache blocking.
+ */
+template< typename T >
+void checkMatrixMultiply( std::size_t numRows, std::size_t numColumns, std::size_t numInner, T tolerance )
+{
+  std::size_t const padding = 3; // Use row strides different from the row lengths.
+  std::size_t const op1Stride = numInner + padding;
+  std::size_t const op2Stride = numColumns + padding;
+  std::size_t const resStride = numColumns + padding;
+  std::mt19937 gen( 17 );
+  std::uniform_real_distribution<T> dist( -1.0, 1.0 );
+  std::vector<T> op1( numRows * op1Stride );
+  std::vector<T> op2( numInner * op2Stride );
+  std::generate( op1.begin(), op1.end(), [&]() { return dist( gen ); } );
+  std::generate( op2.begin(), op2.end(), [&]() { return dist( gen ); } );
+
+  std::vector<T> expected( numRows * resStride, static_cast<T>(0.0) );
+  for( std::size_t rowIdx( 0 ); rowIdx < numRows; ++rowIdx )
+  {
+    for( std::size_t colIdx( 0 ); colIdx < numColumns; ++colIdx )
+    {
+      T val = static_cast<T>(0.0);
+      for( std::size_t runIdx( 0 ); runIdx < numInner; ++runIdx )
+      {
+        val += op1[rowIdx * op1Stride + runIdx] * op2[runIdx * op2Stride + colIdx];
+      }
+      expected[rowIdx * resStride + colIdx] = val;
+    }
+  }
+
+  // Initialise the result with values that must be overwritten.
+  std::vector<T> result( numRows * resStride, static_cast<T>(100.0) );
+  std::vector<T> referenceResult( numRows * resStride, static_cast<T>(100.0) );
+  BOOST_CHECK( matrixMultiply( op1.data(), op2.data(), result.data(), numRows, numColumns, numInner,
+                               op1Stride, op2Stride, resStride ) == noError );
+  BOOST_CHECK( reference::matrixMultiply( op1.data(), op2.data(), referenceResult.data(), numRows, numColumns, numInner,
+                                          op1Stride, op2Stride, resStride ) == noError );
+  T maxError = static_cast<T>(0.0);
+  T maxReferenceError = static_cast<T>(0.0);
+  for( std::size_t rowIdx( 0 ); rowIdx < numRows; ++rowIdx )
+  {
+    for( std::size_t colIdx( 0 ); colIdx < numColumns; ++colIdx )
+    {
+      std::size_t const idx = rowIdx * resStride + colIdx;
+      maxError = std::max( maxError, std::abs( result[idx] - expected[idx] ) );
+      maxReferenceError = std::max( maxReferenceError, std::abs( referenceResult[idx] - expected[idx] ) );
+    }
+  }
+  BOOST_CHECK_LE( maxError, tolerance );
+  BOOST_CHECK_LE( maxReferenceError, tolerance );
+
+  // The transposed product using the strided interface must give the same result.
+  std::vector<T> transposed( numColumns * numRows );
+  BOOST_CHECK( product( op2.data(), op1.data(), transposed.data(), numColumns, numRows, numInner,
+                        1, op2Stride, 1, op1Stride, 1, numColumns ) == noError );
+  T maxTransposedError = static_cast<T>(0.0);
+  for( std::size_t rowIdx( 0 ); rowIdx < numRows; ++rowIdx )
+  {
+    for( std::size_t colIdx( 0 ); colIdx < numColumns; ++colIdx )
+    {
+      maxTransposedError = std::max( maxTransposedError,
+        std::abs( transposed[colIdx + rowIdx * numColumns] - expected[rowIdx * resStride + colIdx] ) );
+    }
+  }
+  BOOST_CHECK_LE( maxTransposedError, tolerance );
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( MatrixMultiply )
+{
+  efl::initialiseLibrary();
+  for( std::size_t numRows : { 1, 4, 7, 22 } )
+  {
+    for( std::size_t numColumns : { 1, 3, 8, 37, 300 } )
+    {
+      for( std::size_t numInner : { 0, 1, 5, 150 } )
+      {
+        checkMatrixMultiply<float>( numRows, numColumns, numInner, 1.0e-4f );
+        checkMatrixMultiply<double>( numRows, numColumns, numInner, 1.0e-12 );
+      }
+    }
+  }
+}
+
+} // namespace test
+} // namespace efl
+} // namespace visr
@@ -0,0 +1,168 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <libefl/initialise_library.hpp>
+#include <libefl/sample_conversions.hpp>
+
+#include <libefl/reference/sample_conversions.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace visr
+{
+namespace efl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+std::int32_t int24Value( Int24 val )
+{
+  std::int32_t const raw = val.bytes[0] | (val.bytes[1] << 8) | (val.bytes[2] << 16);
+  return raw >= (1 << 23) ? raw - (1 << 24) : raw;
+}
+
+bool sameSample( Int24 lhs, Int24 rhs ) { return int24Value( lhs ) == int24Value( rhs ); }
+
+template< typename T >
+bool sameSample( T lhs, T rhs ) { return lhs == rhs; }
+
+/**
+ * Check the roundtrip float -> interleaved external format -> float for the optimised implementation
+ * against the reference implementation, for channel and frame numbers that exercise the block and the remainder loops.
+ */
+template< typename ExternalType >
+void checkRoundtrip( std::size_t numberOfChannels, std::size_t numberOfFrames, float tolerance )
+{
+  std::mt19937 gen( 23 );
+  // Exceed the full scale to test the saturation.
+  std::uniform_real_distribution<float> dist( -1.1f, 1.1f );
+  std::vector<std::vector<float> > input( numberOfChannels, std::vector<float>( numberOfFrames ) );
+  std::vector<std::vector<float> > output( numberOfChannels, std::vector<float>( numberOfFrames ) );
+  std::vector<std::vector<float> > refOutput( numberOfChannels, std::vector<float>( numberOfFrames ) );
+  std::vector<float const *> inputPtrs;
+  std::vector<float *> outputPtrs;
+  std::vector<float *> refOutputPtrs;
+  for( std::size_t chIdx( 0 ); chIdx < numberOfChannels; ++chIdx )
+  {
+    for( float & val : input[chIdx] ) { val = dist( gen ); }
+    inputPtrs.push_back( input[chIdx].data() );
+    outputPtrs.push_back( output[chIdx].data() );
+    refOutputPtrs.push_back( refOutput[chIdx].data() );
+  }
+  std::vector<ExternalType> interleaved( numberOfChannels * numberOfFrames );
+  std::vector<ExternalType> refInterleaved( numberOfChannels * numberOfFrames );
+
+  BOOST_CHECK( vectorInterleaveSamples( inputPtrs.data(), interleaved.data(), numberOfChannels, numberOfFrames ) == noError );
+  BOOST_CHECK( reference::vectorInterleaveSamples( inputPtrs.data(), refInterleaved.data(), numberOfChannels, numberOfFrames ) == noError );
+  std::size_t mismatches = 0;
+  for( std::size_t idx( 0 ); idx < interleaved.size(); ++idx )
+  {
+    mismatches += sameSample( interleaved[idx], refInterleaved[idx] ) ? 0 : 1;
+  }
+  BOOST_CHECK_EQUAL( mismatches, 0 );
+
+  BOOST_CHECK( vectorDeinterleaveSamples( interleaved.data(), outputPtrs.data(), numberOfChannels, numberOfFrames ) == noError );
+  BOOST_CHECK( reference::vectorDeinterleaveSamples( interleaved.data(), refOutputPtrs.data(), numberOfChannels, numberOfFrames ) == noError );
+  for( std::size_t chIdx( 0 ); chIdx < numberOfChannels; ++chIdx )
+  {
+    float maxDiff = 0.0f;
+    for( std::size_t frameIdx( 0 ); frameIdx < numberOfFrames; ++frameIdx )
+    {
+      BOOST_CHECK_EQUAL( output[chIdx][frameIdx], refOutput[chIdx][frameIdx] );
+      float const expected = std::max( -1.0f, std::min( input[chIdx][frameIdx], 1.0f ) );
+      maxDiff = std::max( maxDiff, std::abs( output[chIdx][frameIdx] - expected ) );
+    }
+    BOOST_CHECK_LE( maxDiff, tolerance );
+  }
+}
+
+template< typename ExternalType >
+void checkRoundtripConfigurations( float tolerance )
+{
+  for( std::size_t numberOfChannels : { 1, 2, 4, 7, 12 } )
+  {
+    for( std::size_t numberOfFrames : { 1, 5, 64, 67 } )
+    {
+      checkRoundtrip<ExternalType>( numberOfChannels, numberOfFrames, tolerance );
+    }
+  }
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( SampleConversionFullScale )
+{
+  efl::initialiseLibrary();
+  std::int16_t const int16Input[] = { -32768, 0, 16384, 32767 };
+  float output[4];
+  float * outputPtr = output;
+  BOOST_CHECK( vectorDeinterleaveSamples( int16Input, &outputPtr, 1, 4 ) == noError );
+  BOOST_CHECK_EQUAL( output[0], -1.0f );
+  BOOST_CHECK_EQUAL( output[1], 0.0f );
+  BOOST_CHECK_EQUAL( output[2], 0.5f );
+
+  Int24 const int24Input[] = { { { 0x00, 0x00, 0x80 } }, { { 0x00, 0x00, 0x40 } }, { { 0xff, 0xff, 0xff } }, { { 0, 0, 0 } } };
+  BOOST_CHECK( vectorDeinterleaveSamples( int24Input, &outputPtr, 1, 4 ) == noError );
+  BOOST_CHECK_EQUAL( output[0], -1.0f );
+  BOOST_CHECK_EQUAL( output[1], 0.5f );
+  BOOST_CHECK_EQUAL( output[2], -1.0f / 8388608.0f );
+
+  float const floatInput[] = { 1.5f, -2.0f, 0.25f, -0.25f };
+  float const * floatInputPtr = floatInput;
+  std::int16_t int16Output[4];
+  BOOST_CHECK( vectorInterleaveSamples( &floatInputPtr, int16Output, 1, 4 ) == noError );
+  BOOST_CHECK_EQUAL( int16Output[0], 32767 );
+  BOOST_CHECK_EQUAL( int16Output[1], -32768 );
+  BOOST_CHECK_EQUAL( int16Output[2], 8192 );
+  BOOST_CHECK_EQUAL( int16Output[3], -8192 );
+  std::int32_t int32Output[4];
+  BOOST_CHECK( vectorInterleaveSamples( &floatInputPtr, int32Output, 1, 4 ) == noError );
+  BOOST_CHECK_GT( int32Output[0], 2147483000 );
+  BOOST_CHECK_EQUAL( int32Output[1], -2147483647 - 1 );
+}
+
+BOOST_AUTO_TEST_CASE( SampleConversionInt16 )
+{
+  efl::initialiseLibrary();
+  checkRoundtripConfigurations<std::int16_t>( 1.0f / 32768.0f );
+}
+
+BOOST_AUTO_TEST_CASE( SampleConversionInt24 )
+{
+  efl::initialiseLibrary();
+  checkRoundtripConfigurations<Int24>( 1.0f / 8388608.0f );
+}
+
+BOOST_AUTO_TEST_CASE( SampleConversionInt32 )
+{
+  efl::initialiseLibrary();
+  checkRoundtripConfigurations<std::int32_t>( 1.0e-7f );
+}
+
+BOOST_AUTO_TEST_CASE( SampleConversionFloat )
+{
+  efl::initialiseLibrary();
+  // Float samples are transposed without scaling or saturation, so the saturation check does not apply.
+  std::vector<float> const left = { 1.5f, 0.5f, -0.25f, -3.0f, 0.125f };
+  std::vector<float> const right = { -1.5f, 2.5f, 0.75f, 1.0f, -0.0625f };
+  float const * channels[] = { left.data(), right.data() };
+  std::vector<float> interleaved( 10 );
+  BOOST_CHECK( vectorInterleaveSamples( channels, interleaved.data(), 2, 5 ) == noError );
+  for( std::size_t frameIdx( 0 ); frameIdx < 5; ++frameIdx )
+  {
+    BOOST_CHECK_EQUAL( interleaved[2 * frameIdx], left[frameIdx] );
+    BOOST_CHECK_EQUAL( interleaved[2 * frameIdx + 1], right[frameIdx] );
+  }
+}
+
+} // namespace test
+} // namespace efl
+} // namespace visr
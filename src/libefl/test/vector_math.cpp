@@ -0,0 +1,182 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <libefl/initialise_library.hpp>
+#include <libefl/vector_math.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <ciso646>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace visr
+{
+namespace efl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+/**
+ * Create an equidistant grid of \p numElements values from \p start to \p end.
+ * The odd number of elements used in the tests exercises the processing of incomplete SIMD vectors.
+ */
+std::vector<float> grid( double start, double end, std::size_t numElements )
+{
+  std::vector<float> res( numElements );
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    res[idx] = static_cast<float>( start + (end - start) * static_cast<double>(idx) / static_cast<double>(numElements - 1) );
+  }
+  return res;
+}
+
+double relativeError( double val, double expected )
+{
+  return std::abs( val - expected ) / std::max( std::abs( expected ), std::numeric_limits<double>::min() );
+}
+
+} // unnamed namespace
+
+/**
+ * Check the (possibly vectorised) float implementations against double-precision standard library functions
+ * for the error bounds documented in vector_math.hpp.
+ */
+BOOST_AUTO_TEST_CASE( VectorMathErrorBounds )
+{
+  efl::initialiseLibrary();
+  std::size_t const numElements = 20001;
+
+  std::vector<float> const angles = grid( -100.0, 100.0, numElements );
+  std::vector<float> sinResult( numElements );
+  std::vector<float> cosResult( numElements );
+  BOOST_CHECK( vectorSinCos( angles.data(), sinResult.data(), cosResult.data(), numElements ) == noError );
+  double maxSinCosError = 0.0;
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    maxSinCosError = std::max( maxSinCosError, std::abs( sinResult[idx] - std::sin( static_cast<double>(angles[idx]) ) ) );
+    maxSinCosError = std::max( maxSinCosError, std::abs( cosResult[idx] - std::cos( static_cast<double>(angles[idx]) ) ) );
+  }
+  BOOST_CHECK_LE( maxSinCosError, 1.5e-7 );
+
+  // Points on circles with different radii, including the axes.
+  std::vector<float> const circleAngles = grid( -3.14159265358979, 3.14159265358979, numElements );
+  std::vector<float> y( numElements );
+  std::vector<float> x( numElements );
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    double const radius = static_cast<double>( idx % 7 + 1 ) * 0.75;
+    y[idx] = static_cast<float>( radius * std::sin( static_cast<double>(circleAngles[idx]) ) );
+    x[idx] = static_cast<float>( radius * std::cos( static_cast<double>(circleAngles[idx]) ) );
+  }
+  std::vector<float> atanResult( numElements );
+  BOOST_CHECK( vectorAtan2( y.data(), x.data(), atanResult.data(), numElements ) == noError );
+  double maxAtanError = 0.0;
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    maxAtanError = std::max( maxAtanError, std::abs( atanResult[idx]
+      - std::atan2( static_cast<double>(y[idx]), static_cast<double>(x[idx]) ) ) );
+  }
+  BOOST_CHECK_LE( maxAtanError, 3.0e-7 );
+
+  std::vector<float> const expArgs = grid( -87.0, 87.0, numElements );
+  std::vector<float> expResult( numElements );
+  BOOST_CHECK( vectorExp( expArgs.data(), expResult.data(), numElements ) == noError );
+  double maxExpError = 0.0;
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    maxExpError = std::max( maxExpError, relativeError( expResult[idx], std::exp( static_cast<double>(expArgs[idx]) ) ) );
+  }
+  BOOST_CHECK_LE( maxExpError, 1.5e-7 );
+
+  std::vector<float> logArgs = grid( 0.5, 2.0, numElements );
+  std::vector<float> const wideLogArgs = grid( 1.0e-30, 1.0e30, numElements );
+  logArgs.insert( logArgs.end(), wideLogArgs.begin(), wideLogArgs.end() );
+  std::vector<float> logResult( logArgs.size() );
+  BOOST_CHECK( vectorLog( logArgs.data(), logResult.data(), logArgs.size() ) == noError );
+  double maxLogError = 0.0;
+  for( std::size_t idx( 0 ); idx < logArgs.size(); ++idx )
+  {
+    double const expected = std::log( static_cast<double>(logArgs[idx]) );
+    double const error = idx < numElements ? std::abs( logResult[idx] - expected ) : relativeError( logResult[idx], expected );
+    maxLogError = std::max( maxLogError, error );
+  }
+  BOOST_CHECK_LE( maxLogError, 1.0e-7 );
+
+  std::vector<float> const levels = grid( -200.0, 200.0, numElements );
+  std::vector<float> linear( numElements );
+  BOOST_CHECK( vectorDB2Linear( levels.data(), linear.data(), numElements ) == noError );
+  std::vector<float> levelsRoundTrip( numElements );
+  BOOST_CHECK( vectorLinear2DB( linear.data(), levelsRoundTrip.data(), numElements ) == noError );
+  double maxLinearError = 0.0;
+  double maxLevelError = 0.0;
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    maxLinearError = std::max( maxLinearError,
+      relativeError( linear[idx], std::pow( 10.0, 0.05 * static_cast<double>(levels[idx]) ) ) );
+    maxLevelError = std::max( maxLevelError,
+      std::abs( levelsRoundTrip[idx] - 20.0 * std::log10( static_cast<double>(linear[idx]) ) ) );
+  }
+  BOOST_CHECK_LE( maxLinearError, 1.5e-6 );
+  BOOST_CHECK_LE( maxLevelError, 2.0e-5 );
+
+  // Special values
+  std::vector<float> const specialArgs{ 0.0f, -1.0f, 1.0f, -100.0f };
+  std::vector<float> specialResult( specialArgs.size() );
+  BOOST_CHECK( vectorLog( specialArgs.data(), specialResult.data(), 3 ) == noError );
+  BOOST_CHECK( std::isinf( specialResult[0] ) and (specialResult[0] < 0.0f) );
+  BOOST_CHECK( std::isnan( specialResult[1] ) );
+  BOOST_CHECK_EQUAL( specialResult[2], 0.0f );
+  BOOST_CHECK( vectorExp( specialArgs.data(), specialResult.data(), specialArgs.size() ) == noError );
+  BOOST_CHECK_EQUAL( specialResult[0], 1.0f );
+  BOOST_CHECK_EQUAL( specialResult[3], 0.0f );
+}
+
+/**
+ * Convert positions from spherical to cartesian coordinates and back, and compare with the scalar functions.
+ */
+BOOST_AUTO_TEST_CASE( VectorMathCoordinateConversions )
+{
+  efl::initialiseLibrary();
+  std::size_t const numElements = 1003;
+  std::vector<float> const az = grid( -3.1, 3.1, numElements );
+  std::vector<float> el = grid( -1.5, 1.5, numElements );
+  std::reverse( el.begin(), el.end() );
+  std::vector<float> const radius = grid( 0.5, 4.0, numElements );
+  std::vector<float> x( numElements );
+  std::vector<float> y( numElements );
+  std::vector<float> z( numElements );
+  BOOST_CHECK( vectorSpherical2Cartesian( az.data(), el.data(), radius.data(), x.data(), y.data(), z.data(),
+                                          numElements ) == noError );
+  std::vector<float> azResult( numElements );
+  std::vector<float> elResult( numElements );
+  std::vector<float> radiusResult( numElements );
+  BOOST_CHECK( vectorCartesian2Spherical( x.data(), y.data(), z.data(), azResult.data(), elResult.data(),
+                                          radiusResult.data(), numElements ) == noError );
+  for( std::size_t idx( 0 ); idx < numElements; ++idx )
+  {
+    double const horizontalRadius = std::cos( static_cast<double>(el[idx]) ) * radius[idx];
+    BOOST_CHECK_SMALL( x[idx] - std::cos( static_cast<double>(az[idx]) ) * horizontalRadius, 4.0e-6 );
+    BOOST_CHECK_SMALL( y[idx] - std::sin( static_cast<double>(az[idx]) ) * horizontalRadius, 4.0e-6 );
+    BOOST_CHECK_SMALL( z[idx] - std::sin( static_cast<double>(el[idx]) ) * radius[idx], 4.0e-6 );
+    BOOST_CHECK_SMALL( azResult[idx] - az[idx], 5.0e-5f );
+    BOOST_CHECK_SMALL( elResult[idx] - el[idx], 5.0e-6f );
+    BOOST_CHECK_SMALL( radiusResult[idx] - radius[idx], 4.0e-6f );
+  }
+  // The origin maps to zero angles.
+  float const zero = 0.0f;
+  float res[3];
+  BOOST_CHECK( vectorCartesian2Spherical( &zero, &zero, &zero, res, res + 1, res + 2, 1 ) == noError );
+  BOOST_CHECK_EQUAL( res[0], 0.0f );
+  BOOST_CHECK_EQUAL( res[1], 0.0f );
+  BOOST_CHECK_EQUAL( res[2], 0.0f );
+}
+
+} // namespace test
+} // namespace efl
+} // namespace visr
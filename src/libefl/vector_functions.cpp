@@ -57,5 +57,10 @@ BOOST_PP_SEQ_FOR_EACH_PRODUCT( EXPLICIT_WRAPPER_INSTANTIATION, (ALL_NUMERIC_VECT
 
 BOOST_PP_SEQ_FOR_EACH_PRODUCT( EXPLICIT_WRAPPER_INSTANTIATION, ((Copy))(ADDITIONAL_COPY_DATATYPES))
 
+/**
+ * Vector functions that are defined only for real-valued floating-point types.
+ */
+BOOST_PP_SEQ_FOR_EACH_PRODUCT( EXPLICIT_WRAPPER_INSTANTIATION, ((MaxMagnitude))((float)(double)))
+
 } // namespace efl
 } // namespace visr
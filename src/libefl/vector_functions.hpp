@@ -367,6 +367,25 @@ efl::ErrorCode vectorRampScaling( T const * input,
    baseGain, rampGain, numberOfElements, accumulate, alignmentElements );
 }
 
+VISR_EFL_CREATE_FUNCTION_WRAPPER_TEMPLATE( VectorMaxMagnitudeWrapper, T, ErrorCode, T const *, T &, std::size_t, std::size_t );
+
+/**
+ * Compute the maximum magnitude (absolute value) of a vector, e.g., to check whether an audio signal is silent.
+ * Instantiated for element types float and double.
+ * @param input The vector to be evaluated.
+ * @param [out] result The maximum absolute value of all elements, 0 for an empty vector.
+ * @param numberOfElements The number of elements in \p input.
+ * @param alignmentElements Minimum alignment of \p input, measured in multiples of the element size.
+ */
+template<typename T>
+efl::ErrorCode vectorMaxMagnitude( T const * input,
+  T & result,
+  std::size_t numberOfElements,
+  std::size_t alignmentElements = 0 )
+{
+  return VectorMaxMagnitudeWrapper<T>::call( input, result, numberOfElements, alignmentElements );
+}
+
 // ===============================================================================================================
 // Implementation details: Define the function templates for each API function.
 
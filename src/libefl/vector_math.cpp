@@ -0,0 +1,38 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "vector_math.hpp"
+
+#include "reference/vector_math.hpp"
+
+namespace visr
+{
+namespace efl
+{
+
+// Define the function pointers of the array math functions and initialise them with the reference implementations.
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorSinCosWrapper<float>::sPtr) VectorSinCosWrapper<float>::sPtr{ reference::vectorSinCos<float> };
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorSinCosWrapper<double>::sPtr) VectorSinCosWrapper<double>::sPtr{ reference::vectorSinCos<double> };
+
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorAtan2Wrapper<float>::sPtr) VectorAtan2Wrapper<float>::sPtr{ reference::vectorAtan2<float> };
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorAtan2Wrapper<double>::sPtr) VectorAtan2Wrapper<double>::sPtr{ reference::vectorAtan2<double> };
+
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorExpWrapper<float>::sPtr) VectorExpWrapper<float>::sPtr{ reference::vectorExp<float> };
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorExpWrapper<double>::sPtr) VectorExpWrapper<double>::sPtr{ reference::vectorExp<double> };
+
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorLogWrapper<float>::sPtr) VectorLogWrapper<float>::sPtr{ reference::vectorLog<float> };
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorLogWrapper<double>::sPtr) VectorLogWrapper<double>::sPtr{ reference::vectorLog<double> };
+
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorDB2LinearWrapper<float>::sPtr) VectorDB2LinearWrapper<float>::sPtr{ reference::vectorDB2Linear<float> };
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorDB2LinearWrapper<double>::sPtr) VectorDB2LinearWrapper<double>::sPtr{ reference::vectorDB2Linear<double> };
+
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorLinear2DBWrapper<float>::sPtr) VectorLinear2DBWrapper<float>::sPtr{ reference::vectorLinear2DB<float> };
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorLinear2DBWrapper<double>::sPtr) VectorLinear2DBWrapper<double>::sPtr{ reference::vectorLinear2DB<double> };
+
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorSpherical2CartesianWrapper<float>::sPtr) VectorSpherical2CartesianWrapper<float>::sPtr{ reference::vectorSpherical2Cartesian<float> };
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorSpherical2CartesianWrapper<double>::sPtr) VectorSpherical2CartesianWrapper<double>::sPtr{ reference::vectorSpherical2Cartesian<double> };
+
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorCartesian2SphericalWrapper<float>::sPtr) VectorCartesian2SphericalWrapper<float>::sPtr{ reference::vectorCartesian2Spherical<float> };
+template<> VISR_EFL_LIBRARY_SYMBOL decltype(VectorCartesian2SphericalWrapper<double>::sPtr) VectorCartesian2SphericalWrapper<double>::sPtr{ reference::vectorCartesian2Spherical<double> };
+
+} // namespace efl
+} // namespace visr
@@ -0,0 +1,213 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+/**
+ * @file vector_math.hpp
+ * Elementwise transcendental functions and coordinate and level conversions on arrays.
+ * These are the array counterparts of the scalar functions in cartesian_spherical_conversion.hpp and
+ * db_linear_conversion.hpp, intended for computations that are performed for many objects, loudspeakers, or
+ * filter sections at once.
+ *
+ * The portable implementation uses the functions of the C++ standard library.
+ * On x86_64, the single-precision functions are replaced by vectorised polynomial approximations when
+ * efl::initialiseLibrary() is called. Within the documented argument ranges, the maximum errors of these
+ * approximations are:
+ * - vectorSinCos(): absolute error 1.5e-7 for |x| <= 100.
+ * - vectorAtan2(): absolute error 3e-7 rad (about one unit in the last place at pi).
+ * - vectorExp(): relative error 1.5e-7 for |x| <= 87. Arguments above 88.37 yield infinity, arguments
+ *   below -87.33 yield zero.
+ * - vectorLog(): absolute error 1e-7 for arguments in [0.5, 2], relative error 1e-7 otherwise. Zero yields
+ *   -infinity, negative arguments yield NaN, and denormal arguments are treated as the smallest normalised number.
+ * - vectorDB2Linear(): relative error 1.5e-6 for levels within +/- 200 dB. This is dominated by the rounding of
+ *   the scaled argument and decreases proportionally for smaller levels.
+ * - vectorLinear2DB(): absolute error 2e-5 dB for levels within +/- 200 dB.
+ * The composite coordinate conversions inherit the errors of the sine, cosine, and arctangent functions.
+ * Infinite and NaN arguments are not supported by the approximations, and the sign of a zero x argument of
+ * vectorAtan2() is ignored.
+ */
+
+#ifndef VISR_LIBEFL_VECTOR_MATH_HPP_INCLUDED
+#define VISR_LIBEFL_VECTOR_MATH_HPP_INCLUDED
+
+#include "error_codes.hpp"
+#include "export_symbols.hpp"
+#include "function_wrapper.hpp"
+
+#include <cstddef>
+
+namespace visr
+{
+namespace efl
+{
+
+VISR_EFL_CREATE_FUNCTION_WRAPPER_TEMPLATE( VectorSinCosWrapper, T, ErrorCode, T const *, T *, T *, std::size_t, std::size_t );
+
+/**
+ * Compute the sine and the cosine of an array of angles.
+ * @tparam T The element type, float and double are supported.
+ * @param angles The input angles, in radian.
+ * @param[out] sinResult Array to hold the sine values.
+ * @param[out] cosResult Array to hold the cosine values.
+ * @param numElements The number of elements to be computed.
+ * @param alignment Assured alignment of all vector arguments (measured in elements).
+ */
+template< typename T >
+ErrorCode vectorSinCos( T const * const angles,
+                        T * const sinResult,
+                        T * const cosResult,
+                        std::size_t numElements,
+                        std::size_t alignment = 0 )
+{
+  return VectorSinCosWrapper<T>::call( angles, sinResult, cosResult, numElements, alignment );
+}
+
+VISR_EFL_CREATE_FUNCTION_WRAPPER_TEMPLATE( VectorAtan2Wrapper, T, ErrorCode, T const *, T const *, T *, std::size_t, std::size_t );
+
+/**
+ * Compute the four-quadrant arctangent of y/x elementwise.
+ * @param y The array of ordinates.
+ * @param x The array of abscissas.
+ * @param[out] result The angles in radian, in the range [-pi,pi].
+ * @param numElements The number of elements to be computed.
+ * @param alignment Assured alignment of all vector arguments (measured in elements).
+ */
+template< typename T >
+ErrorCode vectorAtan2( T const * const y,
+                       T const * const x,
+                       T * const result,
+                       std::size_t numElements,
+                       std::size_t alignment = 0 )
+{
+  return VectorAtan2Wrapper<T>::call( y, x, result, numElements, alignment );
+}
+
+VISR_EFL_CREATE_FUNCTION_WRAPPER_TEMPLATE( VectorExpWrapper, T, ErrorCode, T const *, T *, std::size_t, std::size_t );
+
+/**
+ * Compute the natural exponential function elementwise.
+ * @param src The input array.
+ * @param[out] dest The result array, may be identical to \p src.
+ * @param numElements The number of elements to be computed.
+ * @param alignment Assured alignment of all vector arguments (measured in elements).
+ */
+template< typename T >
+ErrorCode vectorExp( T const * const src,
+                     T * const dest,
+                     std::size_t numElements,
+                     std::size_t alignment = 0 )
+{
+  return VectorExpWrapper<T>::call( src, dest, numElements, alignment );
+}
+
+VISR_EFL_CREATE_FUNCTION_WRAPPER_TEMPLATE( VectorLogWrapper, T, ErrorCode, T const *, T *, std::size_t, std::size_t );
+
+/**
+ * Compute the natural logarithm elementwise.
+ * @param src The input array.
+ * @param[out] dest The result array, may be identical to \p src.
+ * @param numElements The number of elements to be computed.
+ * @param alignment Assured alignment of all vector arguments (measured in elements).
+ */
+template< typename T >
+ErrorCode vectorLog( T const * const src,
+                     T * const dest,
+                     std::size_t numElements,
+                     std::size_t alignment = 0 )
+{
+  return VectorLogWrapper<T>::call( src, dest, numElements, alignment );
+}
+
+VISR_EFL_CREATE_FUNCTION_WRAPPER_TEMPLATE( VectorDB2LinearWrapper, T, ErrorCode, T const *, T *, std::size_t, std::size_t );
+
+/**
+ * Convert an array of levels in dB to linear scale factors, i.e., the array version of efl::dB2linear().
+ * @param src The levels in dB.
+ * @param[out] dest The linear scale factors, may be identical to \p src.
+ * @param numElements The number of elements to be computed.
+ * @param alignment Assured alignment of all vector arguments (measured in elements).
+ */
+template< typename T >
+ErrorCode vectorDB2Linear( T const * const src,
+                           T * const dest,
+                           std::size_t numElements,
+                           std::size_t alignment = 0 )
+{
+  return VectorDB2LinearWrapper<T>::call( src, dest, numElements, alignment );
+}
+
+VISR_EFL_CREATE_FUNCTION_WRAPPER_TEMPLATE( VectorLinear2DBWrapper, T, ErrorCode, T const *, T *, std::size_t, std::size_t );
+
+/**
+ * Convert an array of linear scale factors to levels in dB, i.e., the array version of efl::linear2dB().
+ * @param src The linear scale factors.
+ * @param[out] dest The levels in dB, may be identical to \p src.
+ * @param numElements The number of elements to be computed.
+ * @param alignment Assured alignment of all vector arguments (measured in elements).
+ */
+template< typename T >
+ErrorCode vectorLinear2DB( T const * const src,
+                           T * const dest,
+                           std::size_t numElements,
+                           std::size_t alignment = 0 )
+{
+  return VectorLinear2DBWrapper<T>::call( src, dest, numElements, alignment );
+}
+
+VISR_EFL_CREATE_FUNCTION_WRAPPER_TEMPLATE( VectorSpherical2CartesianWrapper, T, ErrorCode, T const *, T const *, T const *, T *, T *, T *, std::size_t, std::size_t );
+
+/**
+ * Convert an array of positions from spherical to cartesian coordinates, i.e., the array version of
+ * efl::spherical2cartesian().
+ * @param az The azimuth angles in radian.
+ * @param el The elevation angles (wrt to the horizontal x-y plane) in radian.
+ * @param radius The radial coordinates.
+ * @param[out] x The resulting x coordinates.
+ * @param[out] y The resulting y coordinates.
+ * @param[out] z The resulting z coordinates.
+ * @param numElements The number of positions to be converted.
+ * @param alignment Assured alignment of all vector arguments (measured in elements).
+ */
+template< typename T >
+ErrorCode vectorSpherical2Cartesian( T const * const az,
+                                     T const * const el,
+                                     T const * const radius,
+                                     T * const x,
+                                     T * const y,
+                                     T * const z,
+                                     std::size_t numElements,
+                                     std::size_t alignment = 0 )
+{
+  return VectorSpherical2CartesianWrapper<T>::call( az, el, radius, x, y, z, numElements, alignment );
+}
+
+VISR_EFL_CREATE_FUNCTION_WRAPPER_TEMPLATE( VectorCartesian2SphericalWrapper, T, ErrorCode, T const *, T const *, T const *, T *, T *, T *, std::size_t, std::size_t );
+
+/**
+ * Convert an array of positions from cartesian to spherical coordinates, i.e., the array version of
+ * efl::cartesian2spherical().
+ * In contrast to the scalar function, the origin is mapped to zero azimuth and elevation.
+ * @param x The x coordinates.
+ * @param y The y coordinates.
+ * @param z The z coordinates.
+ * @param[out] az The resulting azimuth angles in radian.
+ * @param[out] el The resulting elevation angles (wrt to the horizontal x-y plane) in radian.
+ * @param[out] radius The resulting radial coordinates.
+ * @param numElements The number of positions to be converted.
+ * @param alignment Assured alignment of all vector arguments (measured in elements).
+ */
+template< typename T >
+ErrorCode vectorCartesian2Spherical( T const * const x,
+                                     T const * const y,
+                                     T const * const z,
+                                     T * const az,
+                                     T * const el,
+                                     T * const radius,
+                                     std::size_t numElements,
+                                     std::size_t alignment = 0 )
+{
+  return VectorCartesian2SphericalWrapper<T>::call( x, y, z, az, el, radius, numElements, alignment );
+}
+
+} // namespace efl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBEFL_VECTOR_MATH_HPP_INCLUDED
@@ -0,0 +1,119 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "binary_record.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace visr
+{
+namespace objectmodel
+{
+
+BinaryRecordWriter::BinaryRecordWriter( std::string & message )
+ : mMessage( message )
+{
+}
+
+void BinaryRecordWriter::writeUint8( std::uint8_t val )
+{
+  mMessage.push_back( static_cast<char>( val ) );
+}
+
+void BinaryRecordWriter::writeUint16( std::uint16_t val )
+{
+  writeUint8( static_cast<std::uint8_t>( val & 0xFF ) );
+  writeUint8( static_cast<std::uint8_t>( val >> 8 ) );
+}
+
+void BinaryRecordWriter::writeUint32( std::uint32_t val )
+{
+  writeUint16( static_cast<std::uint16_t>( val & 0xFFFF ) );
+  writeUint16( static_cast<std::uint16_t>( val >> 16 ) );
+}
+
+void BinaryRecordWriter::writeFloat( float val )
+{
+  static_assert( sizeof(float) == sizeof(std::uint32_t), "Binary records require 32-bit IEEE floats." );
+  std::uint32_t intVal;
+  std::memcpy( &intVal, &val, sizeof(float) );
+  writeUint32( intVal );
+}
+
+void BinaryRecordWriter::writeBytes( char const * data, std::size_t numBytes )
+{
+  mMessage.append( data, numBytes );
+}
+
+std::size_t BinaryRecordWriter::position() const
+{
+  return mMessage.size();
+}
+
+void BinaryRecordWriter::patchUint32( std::size_t pos, std::uint32_t val )
+{
+  if( pos + 4 > mMessage.size() )
+  {
+    throw std::out_of_range( "BinaryRecordWriter::patchUint32(): Position exceeds the message size." );
+  }
+  for( std::size_t byteIdx( 0 ); byteIdx < 4; ++byteIdx, val >>= 8 )
+  {
+    mMessage[pos+byteIdx] = static_cast<char>( val & 0xFF );
+  }
+}
+
+BinaryRecordReader::BinaryRecordReader( char const * data, std::size_t numBytes )
+ : mPos( data )
+ , mEnd( data + numBytes )
+{
+}
+
+std::uint8_t BinaryRecordReader::readUint8()
+{
+  return static_cast<std::uint8_t>( *require( 1 ) );
+}
+
+std::uint16_t BinaryRecordReader::readUint16()
+{
+  unsigned char const * const ptr = reinterpret_cast<unsigned char const *>( require( 2 ) );
+  return static_cast<std::uint16_t>( ptr[0] | (ptr[1] << 8) );
+}
+
+std::uint32_t BinaryRecordReader::readUint32()
+{
+  unsigned char const * const ptr = reinterpret_cast<unsigned char const *>( require( 4 ) );
+  return static_cast<std::uint32_t>( ptr[0] ) | (static_cast<std::uint32_t>( ptr[1] ) << 8)
+    | (static_cast<std::uint32_t>( ptr[2] ) << 16) | (static_cast<std::uint32_t>( ptr[3] ) << 24);
+}
+
+float BinaryRecordReader::readFloat()
+{
+  std::uint32_t const intVal = readUint32();
+  float val;
+  std::memcpy( &val, &intVal, sizeof(float) );
+  return val;
+}
+
+char const * BinaryRecordReader::readBytes( std::size_t numBytes )
+{
+  return require( numBytes );
+}
+
+void BinaryRecordReader::skip( std::size_t numBytes )
+{
+  require( numBytes );
+}
+
+char const * BinaryRecordReader::require( std::size_t numBytes )
+{
+  if( numBytes > remaining() )
+  {
+    throw std::invalid_argument( "BinaryRecordReader: Unexpected end of binary message." );
+  }
+  char const * const res = mPos;
+  mPos += numBytes;
+  return res;
+}
+
+} // namespace objectmodel
+} // namespace visr
@@ -0,0 +1,113 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_OBJECTMODEL_BINARY_RECORD_HPP_INCLUDED
+#define VISR_OBJECTMODEL_BINARY_RECORD_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace visr
+{
+namespace objectmodel
+{
+
+/**
+ * Helper class to append fixed-size binary fields to a message.
+ * All multi-byte values are written in little-endian byte order, independent of the platform.
+ */
+class VISR_OBJECTMODEL_LIBRARY_SYMBOL BinaryRecordWriter
+{
+public:
+  /**
+   * Constructor.
+   * @param message The message to which the fields are appended. It is not cleared.
+   */
+  explicit BinaryRecordWriter( std::string & message );
+
+  void writeUint8( std::uint8_t val );
+
+  void writeUint16( std::uint16_t val );
+
+  void writeUint32( std::uint32_t val );
+
+  void writeFloat( float val );
+
+  /**
+   * Append a raw byte sequence.
+   */
+  void writeBytes( char const * data, std::size_t numBytes );
+
+  /**
+   * Return the current size of the message, e.g., to patch a size field later on.
+   */
+  std::size_t position() const;
+
+  /**
+   * Overwrite a previously written 32-bit field at the byte position \p pos.
+   * @throw std::out_of_range If the field exceeds the current message size.
+   */
+  void patchUint32( std::size_t pos, std::uint32_t val );
+
+private:
+  std::string & mMessage;
+};
+
+/**
+ * Helper class to read fixed-size binary fields from a message with bounds checking.
+ * @see BinaryRecordWriter
+ */
+class VISR_OBJECTMODEL_LIBRARY_SYMBOL BinaryRecordReader
+{
+public:
+  /**
+   * Constructor.
+   * @param data Start of the binary data.
+   * @param numBytes Size of the binary data in bytes.
+   */
+  explicit BinaryRecordReader( char const * data, std::size_t numBytes );
+
+  /**
+   * Read functions for the supported field types.
+   * @throw std::invalid_argument If the message does not contain enough data.
+   */
+  //@{
+  std::uint8_t readUint8();
+
+  std::uint16_t readUint16();
+
+  std::uint32_t readUint32();
+
+  float readFloat();
+  //@}
+
+  /**
+   * Return a pointer to the next \p numBytes bytes and advance the read position.
+   * @throw std::invalid_argument If the message does not contain enough data.
+   */
+  char const * readBytes( std::size_t numBytes );
+
+  /**
+   * Advance the read position by \p numBytes.
+   * @throw std::invalid_argument If the message does not contain enough data.
+   */
+  void skip( std::size_t numBytes );
+
+  /**
+   * Return the number of bytes that have not been read.
+   */
+  std::size_t remaining() const { return static_cast<std::size_t>(mEnd - mPos); }
+
+private:
+  char const * require( std::size_t numBytes );
+
+  char const * mPos;
+  char const * const mEnd;
+};
+
+} // namespace objectmodel
+} // namespace visr
+
+#endif // VISR_OBJECTMODEL_BINARY_RECORD_HPP_INCLUDED
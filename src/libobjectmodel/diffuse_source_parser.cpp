@@ -2,6 +2,7 @@
 
 #include "diffuse_source_parser.hpp"
 
+#include "binary_record.hpp"
 #include "diffuse_source.hpp"
 
 #include <boost/property_tree/ptree.hpp>
@@ -35,5 +36,24 @@ parse( boost::property_tree::ptree const & tree, Object & obj ) const
   // Nothing else to be done.
 }
 
+/*virtual*/ bool DiffuseSourceParser::hasBinaryEncoding() const
+{
+  return true;
+}
+
+/*virtual*/ void DiffuseSourceParser::
+parseBinary( BinaryRecordReader & reader, Object & obj ) const
+{
+  ObjectParser::parseBinary( reader, obj );
+  // Nothing extra to be performed.
+}
+
+/*virtual*/ void DiffuseSourceParser::
+writeBinary( Object const & obj, BinaryRecordWriter & writer ) const
+{
+  ObjectParser::writeBinary( obj, writer );
+  // Nothing else to be done.
+}
+
 } // namespace objectmodel
 } // namespace visr
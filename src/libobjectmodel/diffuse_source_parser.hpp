@@ -21,6 +21,12 @@ public:
   virtual void parse( boost::property_tree::ptree const & tree, Object & src ) const;
 
   virtual void write( Object const & obj, boost::property_tree::ptree & tree ) const;
+
+  virtual bool hasBinaryEncoding() const;
+
+  virtual void parseBinary( BinaryRecordReader & reader, Object & obj ) const;
+
+  virtual void writeBinary( Object const & obj, BinaryRecordWriter & writer ) const;
 };
 
 } // namespace objectmodel
@@ -2,6 +2,7 @@
 
 #include "hoa_source_parser.hpp"
 
+#include "binary_record.hpp"
 #include "hoa_source.hpp"
 
 #include <boost/property_tree/ptree.hpp>
@@ -47,5 +48,31 @@ write( Object const & obj, boost::property_tree::ptree & tree ) const
   tree.put<HoaSource::Order>( "order", hoaObj.order() );
 }
 
+/*virtual*/ bool HoaSourceParser::hasBinaryEncoding() const
+{
+  return true;
+}
+
+/*virtual*/ void HoaSourceParser::
+parseBinary( BinaryRecordReader & reader, Object & obj ) const
+{
+  ObjectParser::parseBinary( reader, obj );
+  HoaSource & hoaSrc = dynamic_cast<HoaSource&>(obj);
+  HoaSource::Order const order = reader.readUint32();
+  if( (order + 1) * (order + 1) != hoaSrc.numberOfChannels() )
+  {
+    throw std::invalid_argument( "Number of channel signals differs from the value expected for thus HOA order." );
+  }
+  hoaSrc.setOrder( order );
+}
+
+/*virtual*/ void HoaSourceParser::
+writeBinary( Object const & obj, BinaryRecordWriter & writer ) const
+{
+  ObjectParser::writeBinary( obj, writer );
+  HoaSource const & hoaObj = dynamic_cast<HoaSource const&>(obj);
+  writer.writeUint32( hoaObj.order() );
+}
+
 } // namespace objectmodel
 } // namespace visr
@@ -0,0 +1,368 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "json_tree_parser.hpp"
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <ciso646>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace visr
+{
+namespace objectmodel
+{
+
+namespace // unnamed
+{
+
+/**
+ * Recursive-descent JSON parser writing directly into a property tree.
+ */
+class JsonTreeParser
+{
+public:
+  JsonTreeParser( char const * begin, char const * end )
+   : mBegin( begin )
+   , mPos( begin )
+   , mEnd( end )
+  {
+  }
+
+  void parseDocument( boost::property_tree::ptree & tree )
+  {
+    skipWhitespace();
+    char const next = peek();
+    if( next == '{' )
+    {
+      parseObject( tree, 0 );
+    }
+    else if( next == '[' )
+    {
+      parseArray( tree, 0 );
+    }
+    else
+    {
+      error( "Expected a JSON object or array" );
+    }
+    skipWhitespace();
+    if( mPos != mEnd )
+    {
+      error( "Unexpected content after the end of the JSON document" );
+    }
+  }
+
+private:
+  /**
+   * Limit for nested objects and arrays to bound the recursion depth for malformed or malicious input.
+   */
+  static constexpr std::size_t cMaxNestingDepth = 128;
+
+  [[noreturn]] void error( char const * message ) const
+  {
+    std::stringstream msg;
+    msg << "JSON parse error at position " << (mPos - mBegin) << ": " << message << ".";
+    throw std::invalid_argument( msg.str() );
+  }
+
+  char peek() const
+  {
+    return mPos < mEnd ? *mPos : '\0';
+  }
+
+  void skipWhitespace()
+  {
+    while( (mPos < mEnd) and ((*mPos == ' ') or (*mPos == '\t') or (*mPos == '\n') or (*mPos == '\r')) )
+    {
+      ++mPos;
+    }
+  }
+
+  void expect( char c )
+  {
+    if( peek() != c )
+    {
+      std::string const msg = std::string( "Expected '" ) + c + "'";
+      error( msg.c_str() );
+    }
+    ++mPos;
+  }
+
+  void parseValue( boost::property_tree::ptree & tree, std::size_t depth )
+  {
+    switch( peek() )
+    {
+    case '{':
+      parseObject( tree, depth + 1 );
+      break;
+    case '[':
+      parseArray( tree, depth + 1 );
+      break;
+    case '"':
+      parseString( tree.data() );
+      break;
+    case 't':
+      parseLiteral( "true", tree.data() );
+      break;
+    case 'f':
+      parseLiteral( "false", tree.data() );
+      break;
+    case 'n':
+      parseLiteral( "null", tree.data() );
+      break;
+    default:
+      parseNumber( tree.data() );
+    }
+  }
+
+  void parseObject( boost::property_tree::ptree & tree, std::size_t depth )
+  {
+    if( depth > cMaxNestingDepth )
+    {
+      error( "Maximum nesting depth exceeded" );
+    }
+    expect( '{' );
+    skipWhitespace();
+    if( peek() == '}' )
+    {
+      ++mPos;
+      return;
+    }
+    std::string key;
+    for( ;; )
+    {
+      skipWhitespace();
+      parseString( key );
+      skipWhitespace();
+      expect( ':' );
+      skipWhitespace();
+      auto const childIt = tree.push_back( boost::property_tree::ptree::value_type( key, boost::property_tree::ptree() ) );
+      parseValue( childIt->second, depth );
+      skipWhitespace();
+      if( peek() == ',' )
+      {
+        ++mPos;
+        continue;
+      }
+      expect( '}' );
+      return;
+    }
+  }
+
+  void parseArray( boost::property_tree::ptree & tree, std::size_t depth )
+  {
+    if( depth > cMaxNestingDepth )
+    {
+      error( "Maximum nesting depth exceeded" );
+    }
+    expect( '[' );
+    skipWhitespace();
+    if( peek() == ']' )
+    {
+      ++mPos;
+      return;
+    }
+    for( ;; )
+    {
+      skipWhitespace();
+      auto const childIt = tree.push_back( boost::property_tree::ptree::value_type( std::string(), boost::property_tree::ptree() ) );
+      parseValue( childIt->second, depth );
+      skipWhitespace();
+      if( peek() == ',' )
+      {
+        ++mPos;
+        continue;
+      }
+      expect( ']' );
+      return;
+    }
+  }
+
+  void parseLiteral( char const * literal, std::string & result )
+  {
+    char const * run = literal;
+    for( ; *run != '\0'; ++run, ++mPos )
+    {
+      if( peek() != *run )
+      {
+        error( "Invalid literal" );
+      }
+    }
+    result.assign( literal, run );
+  }
+
+  void parseNumber( std::string & result )
+  {
+    char const * const start = mPos;
+    if( peek() == '-' )
+    {
+      ++mPos;
+    }
+    if( not consumeDigits() )
+    {
+      error( "Invalid value" );
+    }
+    if( peek() == '.' )
+    {
+      ++mPos;
+      if( not consumeDigits() )
+      {
+        error( "Invalid number: Missing digits after the decimal point" );
+      }
+    }
+    if( (peek() == 'e') or (peek() == 'E') )
+    {
+      ++mPos;
+      if( (peek() == '+') or (peek() == '-') )
+      {
+        ++mPos;
+      }
+      if( not consumeDigits() )
+      {
+        error( "Invalid number: Missing exponent digits" );
+      }
+    }
+    result.assign( start, mPos );
+  }
+
+  bool consumeDigits()
+  {
+    char const * const start = mPos;
+    while( (mPos < mEnd) and (*mPos >= '0') and (*mPos <= '9') )
+    {
+      ++mPos;
+    }
+    return mPos != start;
+  }
+
+  void parseString( std::string & result )
+  {
+    expect( '"' );
+    result.clear();
+    for( ;; )
+    {
+      // Copy unescaped sequences in one go.
+      char const * const start = mPos;
+      while( (mPos < mEnd) and (*mPos != '"') and (*mPos != '\\') )
+      {
+        if( static_cast<unsigned char>(*mPos) < 0x20 )
+        {
+          error( "Control character in string" );
+        }
+        ++mPos;
+      }
+      result.append( start, mPos );
+      if( mPos == mEnd )
+      {
+        error( "Unterminated string" );
+      }
+      if( *mPos == '"' )
+      {
+        ++mPos;
+        return;
+      }
+      ++mPos; // Skip the backslash
+      char const escaped = peek();
+      ++mPos;
+      switch( escaped )
+      {
+      case '"': result.push_back( '"' ); break;
+      case '\\': result.push_back( '\\' ); break;
+      case '/': result.push_back( '/' ); break;
+      case 'b': result.push_back( '\b' ); break;
+      case 'f': result.push_back( '\f' ); break;
+      case 'n': result.push_back( '\n' ); break;
+      case 'r': result.push_back( '\r' ); break;
+      case 't': result.push_back( '\t' ); break;
+      case 'u': appendUtf8( parseCodepoint(), result ); break;
+      default:
+        error( "Invalid escape sequence" );
+      }
+    }
+  }
+
+  unsigned long parseHex4()
+  {
+    unsigned long val = 0;
+    for( std::size_t idx( 0 ); idx < 4; ++idx, ++mPos )
+    {
+      char const c = peek();
+      val <<= 4;
+      if( (c >= '0') and (c <= '9') ) { val |= static_cast<unsigned long>(c - '0'); }
+      else if( (c >= 'a') and (c <= 'f') ) { val |= static_cast<unsigned long>(c - 'a' + 10); }
+      else if( (c >= 'A') and (c <= 'F') ) { val |= static_cast<unsigned long>(c - 'A' + 10); }
+      else
+      {
+        error( "Invalid unicode escape sequence" );
+      }
+    }
+    return val;
+  }
+
+  unsigned long parseCodepoint()
+  {
+    unsigned long const first = parseHex4();
+    if( (first >= 0xD800) and (first < 0xDC00) )
+    {
+      // High surrogate, must be followed by a low surrogate.
+      if( (peek() != '\\') or (mPos + 1 >= mEnd) or (mPos[1] != 'u') )
+      {
+        error( "Unpaired surrogate in unicode escape sequence" );
+      }
+      mPos += 2;
+      unsigned long const second = parseHex4();
+      if( (second < 0xDC00) or (second >= 0xE000) )
+      {
+        error( "Invalid low surrogate in unicode escape sequence" );
+      }
+      return 0x10000 + ((first - 0xD800) << 10) + (second - 0xDC00);
+    }
+    return first;
+  }
+
+  static void appendUtf8( unsigned long codepoint, std::string & result )
+  {
+    if( codepoint < 0x80 )
+    {
+      result.push_back( static_cast<char>( codepoint ) );
+    }
+    else if( codepoint < 0x800 )
+    {
+      result.push_back( static_cast<char>( 0xC0 | (codepoint >> 6) ) );
+      result.push_back( static_cast<char>( 0x80 | (codepoint & 0x3F) ) );
+    }
+    else if( codepoint < 0x10000 )
+    {
+      result.push_back( static_cast<char>( 0xE0 | (codepoint >> 12) ) );
+      result.push_back( static_cast<char>( 0x80 | ((codepoint >> 6) & 0x3F) ) );
+      result.push_back( static_cast<char>( 0x80 | (codepoint & 0x3F) ) );
+    }
+    else
+    {
+      result.push_back( static_cast<char>( 0xF0 | (codepoint >> 18) ) );
+      result.push_back( static_cast<char>( 0x80 | ((codepoint >> 12) & 0x3F) ) );
+      result.push_back( static_cast<char>( 0x80 | ((codepoint >> 6) & 0x3F) ) );
+      result.push_back( static_cast<char>( 0x80 | (codepoint & 0x3F) ) );
+    }
+  }
+
+  char const * const mBegin;
+  char const * mPos;
+  char const * const mEnd;
+};
+
+constexpr std::size_t JsonTreeParser::cMaxNestingDepth;
+
+} // unnamed namespace
+
+void parseJsonTree( char const * message, std::size_t length, boost::property_tree::ptree & tree )
+{
+  boost::property_tree::ptree result;
+  JsonTreeParser parser( message, message + length );
+  parser.parseDocument( result );
+  tree.swap( result );
+}
+
+} // namespace objectmodel
+} // namespace visr
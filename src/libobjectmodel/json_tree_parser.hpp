@@ -0,0 +1,34 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_OBJECTMODEL_JSON_TREE_PARSER_HPP_INCLUDED
+#define VISR_OBJECTMODEL_JSON_TREE_PARSER_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+
+#include <boost/property_tree/ptree_fwd.hpp>
+
+#include <cstddef>
+
+namespace visr
+{
+namespace objectmodel
+{
+
+/**
+ * Parse a JSON document held in memory into a property tree.
+ * This is a single-pass, non-backtracking replacement for boost::property_tree::read_json() that operates directly
+ * on a character buffer instead of a stream, and produces the same tree layout: All values are stored as strings
+ * (numbers in their literal representation, literals as "true", "false", and "null"), and array elements are
+ * stored as children with empty keys.
+ * @param message Pointer to the start of the JSON text, which does not need to be zero-terminated.
+ * @param length Number of characters of the JSON text.
+ * @param[out] tree The resulting property tree. Existing content is discarded.
+ * @throw std::invalid_argument If the text is not a valid JSON document, i.e., a single object or array.
+ */
+VISR_OBJECTMODEL_LIBRARY_SYMBOL void parseJsonTree( char const * message, std::size_t length,
+                                                    boost::property_tree::ptree & tree );
+
+} // namespace objectmodel
+} // namespace visr
+
+#endif // VISR_OBJECTMODEL_JSON_TREE_PARSER_HPP_INCLUDED
@@ -1,14 +1,18 @@
 /* Copyright Institute of Sound and Vibration Research - All rights reserved */
 
 #include "object_parser.hpp"
+
+#include "binary_record.hpp"
 #include "object_type.hpp"
 
 #include <librbbl/index_sequence.hpp>
 
 #include <boost/property_tree/ptree.hpp>
 
+#include <cstdint>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 
 namespace visr
 {
@@ -79,5 +83,63 @@ ObjectParser::~ObjectParser() = default;
   }
 }
 
+/*virtual*/ bool ObjectParser::hasBinaryEncoding() const
+{
+  return false;
+}
+
+/*virtual*/ void ObjectParser
+::parseBinary( BinaryRecordReader & reader, Object & obj ) const
+{
+  obj.setGroupId( reader.readUint32() );
+  obj.setLevel( reader.readFloat() );
+  obj.setPriority( reader.readUint8() );
+  std::size_t const numChannels = reader.readUint16();
+  obj.resetNumberOfChannels( numChannels );
+  for( std::size_t idx( 0 ); idx < numChannels; ++idx )
+  {
+    obj.setChannelIndex( idx, reader.readUint32() );
+  }
+  std::size_t const numEqs = reader.readUint16();
+  rbbl::ParametricIirCoefficientList<Object::Coordinate> eqCoeffs;
+  eqCoeffs.resize( numEqs );
+  for( std::size_t idx( 0 ); idx < numEqs; ++idx )
+  {
+    std::uint8_t const typeId = reader.readUint8();
+    if( typeId > static_cast<std::uint8_t>(rbbl::ParametricIirCoefficientBase::Type::allpass) )
+    {
+      throw std::invalid_argument( "ObjectParser::parseBinary(): Invalid EQ type." );
+    }
+    eqCoeffs[idx].setType( static_cast<rbbl::ParametricIirCoefficientBase::Type>( typeId ) );
+    eqCoeffs[idx].setFrequency( reader.readFloat() );
+    eqCoeffs[idx].setQuality( reader.readFloat() );
+    eqCoeffs[idx].setGain( reader.readFloat() );
+  }
+  obj.setEqCoefficients( eqCoeffs );
+}
+
+/*virtual*/ void ObjectParser
+::writeBinary( Object const & obj, BinaryRecordWriter & writer ) const
+{
+  writer.writeUint32( obj.groupId() );
+  writer.writeFloat( obj.level() );
+  writer.writeUint8( obj.priority() );
+  std::size_t const numChannels( obj.numberOfChannels() );
+  writer.writeUint16( static_cast<std::uint16_t>( numChannels ) );
+  for( std::size_t chIdx( 0 ); chIdx < numChannels; ++chIdx )
+  {
+    writer.writeUint32( obj.channelIndex( chIdx ) );
+  }
+  rbbl::ParametricIirCoefficientList<Object::Coordinate> const & eqCoeffs = obj.eqCoefficients();
+  writer.writeUint16( static_cast<std::uint16_t>( eqCoeffs.size() ) );
+  for( std::size_t idx( 0 ); idx < eqCoeffs.size(); ++idx )
+  {
+    writer.writeUint8( static_cast<std::uint8_t>( eqCoeffs[idx].type() ) );
+    writer.writeFloat( eqCoeffs[idx].frequency() );
+    writer.writeFloat( eqCoeffs[idx].quality() );
+    writer.writeFloat( eqCoeffs[idx].gain() );
+  }
+}
+
 } // namespace objectmodel
 } // namespace visr
@@ -13,6 +13,9 @@ namespace visr
 {
 namespace objectmodel
 {
+// Forward declarations
+class BinaryRecordReader;
+class BinaryRecordWriter;
 
 /**
  * @todo revise class hierarchy (does it make sense to let the base of the parser object
@@ -51,6 +54,37 @@ public:
    * Nonetheless, it has an implementation which is called by derived classes.
    */
   virtual void write( Object const & obj, boost::property_tree::ptree & tree ) const = 0;
+
+  /**
+   * Support for the binary object vector encoding (see ObjectVectorBinaryParser).
+   */
+  //@{
+  /**
+   * Query whether the parser supports the binary encoding, i.e., implements parseBinary() and writeBinary()
+   * for all data members of the object type.
+   * Objects of types without binary support are embedded as JSON text into binary messages.
+   * The default implementation returns false.
+   */
+  virtual bool hasBinaryEncoding() const;
+
+  /**
+   * Parse the type-specific payload of a binary object record.
+   * The base implementation parses the data members common to all object types, derived classes must call
+   * the implementation of their base class before parsing their own fields.
+   * @param reader Reader positioned at the start of the payload.
+   * @param[out] obj The object to which the parsed values are set.
+   * @throw std::invalid_argument If the payload is truncated or contains invalid values.
+   */
+  virtual void parseBinary( BinaryRecordReader & reader, Object & obj ) const;
+
+  /**
+   * Write the payload of a binary object record.
+   * The base implementation writes the data members common to all object types.
+   * @param obj The audio object to be serialised.
+   * @param writer The writer to which the fields are appended.
+   */
+  virtual void writeBinary( Object const & obj, BinaryRecordWriter & writer ) const;
+  //@}
 protected:
 
 private:
@@ -0,0 +1,171 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "object_vector_binary_parser.hpp"
+
+#include "binary_record.hpp"
+#include "json_tree_parser.hpp"
+#include "object_factory.hpp"
+#include "object_parser.hpp"
+#include "object_type.hpp"
+#include "object_vector.hpp"
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <ciso646>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+namespace visr
+{
+namespace objectmodel
+{
+
+namespace // unnamed
+{
+
+char const cMagic[] = { 'V', 'S', 'R', 'O' };
+
+enum class PayloadEncoding: std::uint8_t
+{
+  Binary = 0,
+  Json = 1
+};
+
+} // unnamed namespace
+
+constexpr std::uint16_t ObjectVectorBinaryParser::cFormatVersion;
+
+/*static*/ bool ObjectVectorBinaryParser::isBinaryMessage( char const * message, std::size_t length )
+{
+  return (length >= sizeof(cMagic)) and (std::memcmp( message, cMagic, sizeof(cMagic) ) == 0);
+}
+
+/*static*/ void ObjectVectorBinaryParser::
+fillObjectVector( char const * message, std::size_t length, ObjectVector & res )
+{
+  ObjectVector newVec;
+  updateObjectVector( message, length, newVec );
+  newVec.swap( res );
+}
+
+/*static*/ void ObjectVectorBinaryParser::
+fillObjectVector( std::string const & message, ObjectVector & res )
+{
+  fillObjectVector( message.data(), message.size(), res );
+}
+
+/*static*/ void ObjectVectorBinaryParser::
+updateObjectVector( char const * message, std::size_t length, ObjectVector & res )
+{
+  if( not isBinaryMessage( message, length ) )
+  {
+    throw std::invalid_argument( "ObjectVectorBinaryParser: Message does not start with the binary format identifier." );
+  }
+  BinaryRecordReader reader( message, length );
+  reader.skip( sizeof(cMagic) );
+  std::uint16_t const version = reader.readUint16();
+  if( version != cFormatVersion )
+  {
+    std::stringstream msg;
+    msg << "ObjectVectorBinaryParser: Unsupported format version " << version << ".";
+    throw std::invalid_argument( msg.str() );
+  }
+  reader.skip( 2 ); // reserved flags
+  std::size_t const numObjects = reader.readUint32();
+  for( std::size_t objIdx( 0 ); objIdx < numObjects; ++objIdx )
+  {
+    ObjectTypeId const objTypeId = static_cast<ObjectTypeId>( reader.readUint8() );
+    PayloadEncoding const encoding = static_cast<PayloadEncoding>( reader.readUint8() );
+    reader.skip( 2 ); // reserved
+    ObjectId const objId = reader.readUint32();
+    std::size_t const payloadSize = reader.readUint32();
+    char const * const payload = reader.readBytes( payloadSize );
+
+    try
+    {
+      // Throws if the type is not registered.
+      ObjectParser const & objParser = ObjectFactory::parser( objTypeId );
+
+      ObjectVector::iterator findIt = res.find( objId );
+      bool const found = findIt != res.end();
+      // As in the JSON parser, modifications are performed on a copy to retain the original object if parsing fails.
+      std::unique_ptr< Object > newObj( (found and (findIt->type() == objTypeId))
+                                        ? findIt->clone()
+                                        : ObjectFactory::create( objTypeId, objId ) );
+      switch( encoding )
+      {
+      case PayloadEncoding::Binary:
+      {
+        BinaryRecordReader payloadReader( payload, payloadSize );
+        objParser.parseBinary( payloadReader, *newObj );
+        break;
+      }
+      case PayloadEncoding::Json:
+      {
+        boost::property_tree::ptree tree;
+        parseJsonTree( payload, payloadSize, tree );
+        objParser.parse( tree, *newObj );
+        break;
+      }
+      default:
+        throw std::invalid_argument( "Unknown payload encoding." );
+      }
+      res.insert( std::move( newObj ) );
+    }
+    catch( std::exception const & ex )
+    {
+      std::stringstream msg;
+      msg << "ObjectVectorBinaryParser: Error while decoding object " << objId << ": " << ex.what();
+      throw std::invalid_argument( msg.str() );
+    }
+  }
+}
+
+/*static*/ void ObjectVectorBinaryParser::
+updateObjectVector( std::string const & message, ObjectVector & res )
+{
+  updateObjectVector( message.data(), message.size(), res );
+}
+
+/*static*/ void ObjectVectorBinaryParser::
+encodeObjectVector( ObjectVector const & objects, std::string & message )
+{
+  message.clear();
+  BinaryRecordWriter writer( message );
+  writer.writeBytes( cMagic, sizeof(cMagic) );
+  writer.writeUint16( cFormatVersion );
+  writer.writeUint16( 0 ); // reserved flags
+  writer.writeUint32( static_cast<std::uint32_t>( objects.size() ) );
+  for( Object const & obj : objects )
+  {
+    ObjectParser const & objParser = ObjectFactory::parser( obj.type() );
+    bool const binary = objParser.hasBinaryEncoding();
+    writer.writeUint8( static_cast<std::uint8_t>( obj.type() ) );
+    writer.writeUint8( static_cast<std::uint8_t>( binary ? PayloadEncoding::Binary : PayloadEncoding::Json ) );
+    writer.writeUint16( 0 ); // reserved
+    writer.writeUint32( obj.id() );
+    std::size_t const sizePos = writer.position();
+    writer.writeUint32( 0 ); // Payload size, written after the payload.
+    std::size_t const payloadStart = writer.position();
+    if( binary )
+    {
+      objParser.writeBinary( obj, writer );
+    }
+    else
+    {
+      boost::property_tree::ptree objTree;
+      objParser.write( obj, objTree );
+      std::stringstream jsonStream;
+      boost::property_tree::write_json( jsonStream, objTree, false /*no pretty printing */ );
+      std::string const json = jsonStream.str();
+      writer.writeBytes( json.data(), json.size() );
+    }
+    writer.patchUint32( sizePos, static_cast<std::uint32_t>( writer.position() - payloadStart ) );
+  }
+}
+
+} // namespace objectmodel
+} // namespace visr
@@ -0,0 +1,85 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_OBJECTMODEL_OBJECT_VECTOR_BINARY_PARSER_HPP_INCLUDED
+#define VISR_OBJECTMODEL_OBJECT_VECTOR_BINARY_PARSER_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace visr
+{
+namespace objectmodel
+{
+// forward declaration
+class ObjectVector;
+
+/**
+ * Encoder and decoder for a compact binary representation of object vectors, as an alternative to the JSON
+ * messages handled by ObjectVectorParser.
+ * A binary message consists of a header followed by one record per object. All fields are little-endian.
+ * Header (12 bytes):
+ * - Magic number "VSRO" (4 bytes)
+ * - Format version (uint16), currently 1
+ * - Reserved flags (uint16), must be 0
+ * - Number of object records (uint32)
+ *
+ * Object record:
+ * - Object type id (uint8)
+ * - Payload encoding (uint8): 0 for the fixed binary layout defined by ObjectParser::writeBinary() of
+ *   the object type, 1 for the JSON representation of the object (used for types without binary support)
+ * - Reserved (uint16), must be 0
+ * - Object id (uint32)
+ * - Payload size in bytes (uint32)
+ * - Payload
+ *
+ * Decoders skip payload bytes beyond the fields they know, which allows later versions to append fields to
+ * object types.
+ */
+class VISR_OBJECTMODEL_LIBRARY_SYMBOL ObjectVectorBinaryParser
+{
+public:
+  /**
+   * The format version written by this implementation.
+   */
+  static constexpr std::uint16_t cFormatVersion = 1;
+
+  /**
+   * Check whether a message starts with the magic number of the binary format.
+   * This can be used to distinguish binary from JSON messages.
+   */
+  static bool isBinaryMessage( char const * message, std::size_t length );
+
+  /**
+   * Replace the content of an object vector with the objects contained in a binary message.
+   * Provides strong exception safety.
+   * @throw std::invalid_argument If the message is malformed.
+   */
+  static void fillObjectVector( char const * message, std::size_t length, ObjectVector & res );
+
+  static void fillObjectVector( std::string const & message, ObjectVector & res );
+
+  /**
+   * Update an object vector with the objects contained in a binary message. Existing objects with matching ids
+   * are replaced, other existing objects are retained.
+   * @throw std::invalid_argument If the message is malformed. In this case, objects preceding the erroneous
+   * record might have been updated already.
+   */
+  static void updateObjectVector( char const * message, std::size_t length, ObjectVector & res );
+
+  static void updateObjectVector( std::string const & message, ObjectVector & res );
+
+  /**
+   * Encode an object vector into a binary message.
+   * @param objects The object vector to be encoded.
+   * @param [out] message The resulting message. Previous content is replaced.
+   */
+  static void encodeObjectVector( ObjectVector const & objects, std::string & message );
+};
+
+} // namespace objectmodel
+} // namespace visr
+
+#endif // #ifndef VISR_OBJECTMODEL_OBJECT_VECTOR_BINARY_PARSER_HPP_INCLUDED
@@ -2,6 +2,7 @@
 
 #include "object_vector_parser.hpp"
 
+#include "json_tree_parser.hpp"
 #include "object_factory.hpp"
 #include "object_parser.hpp"
 #include "object_type.hpp"
@@ -12,6 +13,8 @@
 #include <boost/property_tree/json_parser.hpp>
 
 #include <ciso646>
+#include <cstring>
+#include <iterator>
 #include <memory>
 #include <ostream>
 #include <sstream>
@@ -50,12 +53,18 @@ fillObjectVector( char const * message, ObjectVector & res )
 /*static*/ void ObjectVectorParser::
 updateObjectVector( std::string const & message, ObjectVector & res )
 {
-  std::istringstream streamObj( message );
-  updateObjectVector( streamObj, res );
+  updateObjectVector( message.c_str(), message.size(), res );
 }
 
 /*static*/ void ObjectVectorParser::
 updateObjectVector( std::basic_istream<char> & message, ObjectVector & res )
+{
+  std::string const content{ std::istreambuf_iterator<char>( message ), std::istreambuf_iterator<char>() };
+  updateObjectVector( content, res );
+}
+
+/*static*/ void ObjectVectorParser::
+updateObjectVector( char const * message, std::size_t length, ObjectVector & res )
 {
   using ptree = boost::property_tree::ptree;
 
@@ -63,7 +72,7 @@ updateObjectVector( std::basic_istream<char> & message, ObjectVector & res )
   try
   {
     // TODO: Should we restrict ourselved to JSON at this level (or should we move the decision up one level?)
-    read_json( message, propTree );
+    parseJsonTree( message, length, propTree );
   }
   catch( std::exception const & ex )
   {
@@ -86,7 +95,7 @@ updateObjectVector( std::basic_istream<char> & message, ObjectVector & res )
 /*static*/ void ObjectVectorParser::
 updateObjectVector( char const * message, ObjectVector & res )
 {
-  updateObjectVector( std::string( message ), res );
+  updateObjectVector( message, std::strlen( message ), res );
 }
 
 /*static*/void ObjectVectorParser::
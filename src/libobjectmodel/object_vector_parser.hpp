@@ -7,6 +7,7 @@
 
 #include <boost/property_tree/ptree_fwd.hpp>
 
+#include <cstddef>
 #include <iosfwd>
 #include <memory>
 #include <string>
@@ -32,6 +33,16 @@ public:
 
   static void updateObjectVector( char const * message, ObjectVector & res );
 
+  /**
+   * Update an object vector from a JSON message held in a character buffer.
+   * Parsing operates directly on the buffer, i.e., without copying it into a stream.
+   * @param message Pointer to the JSON message, which does not need to be zero-terminated.
+   * @param length Length of the message in characters.
+   * @param [in,out] res The object vector to be updated.
+   * @throw std::invalid_argument If the message is not valid JSON or does not describe valid audio objects.
+   */
+  static void updateObjectVector( char const * message, std::size_t length, ObjectVector & res );
+
   static void encodeObjectVector( ObjectVector const & objects,
                                   std::basic_ostream<char> & message );
 private:
@@ -2,6 +2,7 @@
 
 #include "plane_wave_parser.hpp"
 
+#include "binary_record.hpp"
 #include "plane_wave.hpp"
 
 #include <boost/property_tree/ptree.hpp>
@@ -46,5 +47,30 @@ write( Object const & obj, boost::property_tree::ptree & tree ) const
   tree.put<Object::Coordinate>( "direction.refdist", pwObj.referenceDistance( ) );
 }
 
+/*virtual*/ bool PlaneWaveParser::hasBinaryEncoding() const
+{
+  return true;
+}
+
+/*virtual*/ void PlaneWaveParser::
+parseBinary( BinaryRecordReader & reader, Object & obj ) const
+{
+  ObjectParser::parseBinary( reader, obj );
+  PlaneWave & pwSrc = dynamic_cast<PlaneWave&>(obj);
+  pwSrc.setIncidenceAzimuth( reader.readFloat() );
+  pwSrc.setIncidenceElevation( reader.readFloat() );
+  pwSrc.setReferenceDistance( reader.readFloat() );
+}
+
+/*virtual*/ void PlaneWaveParser::
+writeBinary( Object const & obj, BinaryRecordWriter & writer ) const
+{
+  ObjectParser::writeBinary( obj, writer );
+  PlaneWave const & pwObj = dynamic_cast<PlaneWave const&>(obj);
+  writer.writeFloat( pwObj.incidenceAzimuth() );
+  writer.writeFloat( pwObj.incidenceElevation() );
+  writer.writeFloat( pwObj.referenceDistance() );
+}
+
 } // namespace objectmodel
 } // namespace visr
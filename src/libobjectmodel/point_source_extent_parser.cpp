@@ -2,6 +2,7 @@
 
 #include "point_source_extent_parser.hpp"
 
+#include "binary_record.hpp"
 #include "point_source_with_diffuseness_parser.hpp"
 #include "point_source_extent.hpp"
 
@@ -47,5 +48,30 @@ write( Object const & obj, boost::property_tree::ptree & tree ) const
   tree.put<PointSource::Coordinate>( "depth", pseObj.depth() );
 }
 
+/*virtual*/ bool PointSourceExtentParser::hasBinaryEncoding() const
+{
+  return true;
+}
+
+/*virtual*/ void PointSourceExtentParser::
+parseBinary( BinaryRecordReader & reader, Object & obj ) const
+{
+  PointSourceWithDiffusenessParser::parseBinary( reader, obj );
+  PointSourceExtent & extentPointSrc = dynamic_cast<PointSourceExtent&>(obj);
+  extentPointSrc.setWidth( reader.readFloat() );
+  extentPointSrc.setHeight( reader.readFloat() );
+  extentPointSrc.setDepth( reader.readFloat() );
+}
+
+/*virtual*/ void PointSourceExtentParser::
+writeBinary( Object const & obj, BinaryRecordWriter & writer ) const
+{
+  PointSourceWithDiffusenessParser::writeBinary( obj, writer );
+  PointSourceExtent const & pseObj = dynamic_cast<PointSourceExtent const&>(obj);
+  writer.writeFloat( pseObj.width() );
+  writer.writeFloat( pseObj.height() );
+  writer.writeFloat( pseObj.depth() );
+}
+
 } // namespace objectmodel
 } // namespace visr
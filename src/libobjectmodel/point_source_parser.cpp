@@ -2,6 +2,7 @@
 
 #include "point_source_parser.hpp"
 
+#include "binary_record.hpp"
 #include "point_source.hpp"
 
 #include <libefl/cartesian_spherical_conversion.hpp>
@@ -108,5 +109,32 @@ PointSourceParser::parsePosition( boost::property_tree::ptree const & posTree,
   }
 }
 
+/*virtual*/ bool PointSourceParser::hasBinaryEncoding() const
+{
+  return true;
+}
+
+/*virtual*/ void PointSourceParser::
+parseBinary( BinaryRecordReader & reader, Object & obj ) const
+{
+  ObjectParser::parseBinary( reader, obj );
+  PointSource & pointSrc = dynamic_cast<PointSource&>(obj);
+  pointSrc.setX( reader.readFloat() );
+  pointSrc.setY( reader.readFloat() );
+  pointSrc.setZ( reader.readFloat() );
+  pointSrc.setChannelLock( reader.readFloat() );
+}
+
+/*virtual*/ void PointSourceParser::
+writeBinary( Object const & obj, BinaryRecordWriter & writer ) const
+{
+  ObjectParser::writeBinary( obj, writer );
+  PointSource const & psObj = dynamic_cast<PointSource const&>(obj);
+  writer.writeFloat( psObj.x() );
+  writer.writeFloat( psObj.y() );
+  writer.writeFloat( psObj.z() );
+  writer.writeFloat( psObj.channelLockDistance() );
+}
+
 } // namespace objectmodel
 } // namespace visr
@@ -24,6 +24,12 @@ public:
 
   virtual void write( Object const & obj, boost::property_tree::ptree & tree ) const;
 
+  virtual bool hasBinaryEncoding() const;
+
+  virtual void parseBinary( BinaryRecordReader & reader, Object & obj ) const;
+
+  virtual void writeBinary( Object const & obj, BinaryRecordWriter & writer ) const;
+
 protected:
   /**
    * Parse the content of a "position" node.
@@ -2,6 +2,7 @@
 
 #include "point_source_with_diffuseness_parser.hpp"
 
+#include "binary_record.hpp"
 #include "point_source_parser.hpp"
 #include "point_source_with_diffuseness.hpp"
 
@@ -43,5 +44,26 @@ write( Object const & obj, boost::property_tree::ptree & tree ) const
   tree.put<PointSource::Coordinate>( "diffuseness", pswdObj.diffuseness() );
 }
 
+/*virtual*/ bool PointSourceWithDiffusenessParser::hasBinaryEncoding() const
+{
+  return true;
+}
+
+/*virtual*/ void PointSourceWithDiffusenessParser::
+parseBinary( BinaryRecordReader & reader, Object & obj ) const
+{
+  PointSourceParser::parseBinary( reader, obj );
+  PointSourceWithDiffuseness & diffusePointSrc = dynamic_cast<PointSourceWithDiffuseness&>(obj);
+  diffusePointSrc.setDiffuseness( reader.readFloat() );
+}
+
+/*virtual*/ void PointSourceWithDiffusenessParser::
+writeBinary( Object const & obj, BinaryRecordWriter & writer ) const
+{
+  PointSourceParser::writeBinary( obj, writer );
+  PointSourceWithDiffuseness const & pswdObj = dynamic_cast<PointSourceWithDiffuseness const&>(obj);
+  writer.writeFloat( pswdObj.diffuseness() );
+}
+
 } // namespace objectmodel
 } // namespace visr
@@ -194,5 +194,10 @@ write( Object const & obj, boost::property_tree::ptree & tree ) const
   tree.put_child( "room", roomTree );
 }
 
+/*virtual*/ bool PointSourceWithReverbParser::hasBinaryEncoding() const
+{
+  return false;
+}
+
 } // namespace objectmodel
 } // namespace visr
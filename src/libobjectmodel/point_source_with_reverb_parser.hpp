@@ -24,6 +24,12 @@ public:
   virtual void parse( boost::property_tree::ptree const & tree, Object & src ) const;
 
   virtual void write( Object const & obj, boost::property_tree::ptree & tree ) const;
+
+  /**
+   * The reverb parameters are not supported by the binary encoding, thus objects of this type are
+   * embedded as JSON text into binary messages.
+   */
+  virtual bool hasBinaryEncoding() const;
 };
 
 } // namespace objectmodel
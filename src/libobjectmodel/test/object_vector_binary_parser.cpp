@@ -0,0 +1,189 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <libobjectmodel/hoa_source.hpp>
+#include <libobjectmodel/json_tree_parser.hpp>
+#include <libobjectmodel/object.hpp>
+#include <libobjectmodel/object_vector.hpp>
+#include <libobjectmodel/object_vector_binary_parser.hpp>
+#include <libobjectmodel/object_vector_parser.hpp>
+#include <libobjectmodel/plane_wave.hpp>
+#include <libobjectmodel/point_source.hpp>
+#include <libobjectmodel/point_source_extent.hpp>
+
+#include <librbbl/parametric_iir_coefficient.hpp>
+
+#include <boost/filesystem/path.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <ciso646>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace visr
+{
+namespace objectmodel
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+std::string loadReverbObjectMessage()
+{
+  boost::filesystem::path const jsonFileName = boost::filesystem::path( CMAKE_CURRENT_SOURCE_DIR ) / boost::filesystem::path( "/data/point_source_with_reverb_1.json" );
+  std::ifstream jsonFileStr( jsonFileName.string().c_str() );
+  std::stringstream msgStr;
+  msgStr << jsonFileStr.rdbuf();
+  return msgStr.str();
+}
+
+void createTestScene( ObjectVector & scene )
+{
+  PointSource ps( 3 );
+  ps.setX( 1.25f );
+  ps.setY( -0.5f );
+  ps.setZ( 0.125f );
+  ps.setLevel( 0.75f );
+  ps.setGroupId( 2 );
+  ps.setPriority( 4 );
+  ps.resetNumberOfChannels( 1 );
+  ps.setChannelIndex( 0, 7 );
+  ps.setChannelLock( 5.0f );
+  rbbl::ParametricIirCoefficientList<Object::Coordinate> const eq{
+    rbbl::ParametricIirCoefficient<Object::Coordinate>( rbbl::ParametricIirCoefficientBase::Type::peak, 1000.0f, 0.7f, -3.0f ) };
+  ps.setEqCoefficients( eq );
+  scene.insert( ps );
+
+  PlaneWave pw( 5 );
+  pw.setIncidenceAzimuth( 30.0f );
+  pw.setIncidenceElevation( -10.0f );
+  pw.setReferenceDistance( 2.0f );
+  pw.resetNumberOfChannels( 1 );
+  pw.setChannelIndex( 0, 1 );
+  scene.insert( pw );
+
+  HoaSource hoa( 9 );
+  hoa.resetNumberOfChannels( 4 );
+  for( std::size_t chIdx( 0 ); chIdx < 4; ++chIdx )
+  {
+    hoa.setChannelIndex( chIdx, static_cast<Object::ChannelIndex>( 10 + chIdx ) );
+  }
+  hoa.setOrder( 1 );
+  scene.insert( hoa );
+
+  PointSourceExtent ext( 11 );
+  ext.setX( 0.0f );
+  ext.setY( 1.0f );
+  ext.setZ( 0.0f );
+  ext.setDiffuseness( 0.25f );
+  ext.setWidth( 15.0f );
+  ext.setHeight( 5.0f );
+  ext.setDepth( 0.5f );
+  ext.resetNumberOfChannels( 1 );
+  ext.setChannelIndex( 0, 2 );
+  scene.insert( ext );
+}
+
+std::string encodeJson( ObjectVector const & scene )
+{
+  std::stringstream str;
+  ObjectVectorParser::encodeObjectVector( scene, str );
+  return str.str();
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( BinaryObjectVectorRoundTrip )
+{
+  ObjectVector scene;
+  createTestScene( scene );
+  // Objects without binary support are embedded as JSON.
+  ObjectVectorParser::updateObjectVector( loadReverbObjectMessage(), scene );
+  BOOST_CHECK_EQUAL( scene.size(), 5u );
+
+  std::string binaryMsg;
+  ObjectVectorBinaryParser::encodeObjectVector( scene, binaryMsg );
+  BOOST_CHECK( ObjectVectorBinaryParser::isBinaryMessage( binaryMsg.data(), binaryMsg.size() ) );
+
+  ObjectVector decoded;
+  BOOST_CHECK_NO_THROW( ObjectVectorBinaryParser::fillObjectVector( binaryMsg, decoded ) );
+  BOOST_CHECK_EQUAL( decoded.size(), scene.size() );
+
+  PointSource const & ps = dynamic_cast<PointSource const &>( decoded.at( 3 ) );
+  BOOST_CHECK_EQUAL( ps.x(), 1.25f );
+  BOOST_CHECK_EQUAL( ps.channelIndex( 0 ), 7u );
+  BOOST_CHECK_EQUAL( ps.eqCoefficients().size(), 1u );
+  BOOST_CHECK_EQUAL( ps.eqCoefficients()[0].gain(), -3.0f );
+
+  // All data members must be preserved.
+  BOOST_CHECK_EQUAL( encodeJson( decoded ), encodeJson( scene ) );
+}
+
+BOOST_AUTO_TEST_CASE( BinaryObjectVectorUpdate )
+{
+  ObjectVector scene;
+  createTestScene( scene );
+  std::string binaryMsg;
+  ObjectVectorBinaryParser::encodeObjectVector( scene, binaryMsg );
+
+  ObjectVector target;
+  PointSource other( 42 );
+  target.insert( other );
+  ObjectVectorBinaryParser::updateObjectVector( binaryMsg, target );
+  BOOST_CHECK_EQUAL( target.size(), scene.size() + 1 );
+}
+
+BOOST_AUTO_TEST_CASE( BinaryObjectVectorMalformed )
+{
+  ObjectVector scene;
+  createTestScene( scene );
+  std::string binaryMsg;
+  ObjectVectorBinaryParser::encodeObjectVector( scene, binaryMsg );
+
+  ObjectVector decoded;
+  std::string const truncated = binaryMsg.substr( 0, binaryMsg.size() - 3 );
+  BOOST_CHECK_THROW( ObjectVectorBinaryParser::fillObjectVector( truncated, decoded ), std::invalid_argument );
+  BOOST_CHECK_EQUAL( decoded.size(), 0u ); // Strong exception safety.
+
+  std::string wrongVersion = binaryMsg;
+  wrongVersion[4] = 17;
+  BOOST_CHECK_THROW( ObjectVectorBinaryParser::fillObjectVector( wrongVersion, decoded ), std::invalid_argument );
+
+  std::string const json = encodeJson( scene );
+  BOOST_CHECK( not ObjectVectorBinaryParser::isBinaryMessage( json.data(), json.size() ) );
+}
+
+BOOST_AUTO_TEST_CASE( JsonTreeParserMatchesReadJson )
+{
+  std::string const reverbMsg = loadReverbObjectMessage();
+  std::string const msgs[] = { reverbMsg,
+    "{ \"a\": [1, -2.5e3, true, false, null, {}], \"b\": \"esc\\\"aped\\n\\u00e9\\ud83d\\ude00\", \"c\": { \"d\": [] } }",
+    "[ { \"x\": 0.125 }, \"str\" ]" };
+  for( std::string const & msg : msgs )
+  {
+    boost::property_tree::ptree reference;
+    std::stringstream msgStream( msg );
+    boost::property_tree::read_json( msgStream, reference );
+    boost::property_tree::ptree result;
+    BOOST_CHECK_NO_THROW( parseJsonTree( msg.data(), msg.size(), result ) );
+    BOOST_CHECK( result == reference );
+  }
+
+  std::string const invalid[] = { "{ \"a\": 1, }", "{ \"a\" 1 }", "[ 01x ]", "{ \"a\": \"unterminated }", "{} trailing" };
+  for( std::string const & msg : invalid )
+  {
+    boost::property_tree::ptree result;
+    BOOST_CHECK_THROW( parseJsonTree( msg.data(), msg.size(), result ), std::invalid_argument );
+  }
+}
+
+} // namespace test
+} // namespace objectmodel
+} // namespace visr
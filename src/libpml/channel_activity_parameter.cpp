@@ -0,0 +1,50 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "channel_activity_parameter.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace visr
+{
+namespace pml
+{
+
+ChannelActivityParameter::ChannelActivityParameter( std::size_t numberOfChannels /*= 0*/, bool initialState /*= true*/ )
+ : mActive( numberOfChannels, initialState ? 1 : 0 )
+{
+}
+
+ChannelActivityParameter::ChannelActivityParameter( ParameterConfigBase const & config )
+ : ChannelActivityParameter( dynamic_cast<VectorParameterConfig const &>(config) )
+{
+}
+
+ChannelActivityParameter::ChannelActivityParameter( VectorParameterConfig const & config )
+ : ChannelActivityParameter( config.numberOfElements(), true )
+{
+}
+
+ChannelActivityParameter::~ChannelActivityParameter() = default;
+
+void ChannelActivityParameter::setActive( std::size_t channelIdx, bool state )
+{
+  if( channelIdx >= mActive.size() )
+  {
+    throw std::out_of_range( "ChannelActivityParameter::setActive(): Channel index exceeds the number of channels." );
+  }
+  mActive[channelIdx] = state ? 1 : 0;
+}
+
+void ChannelActivityParameter::fill( bool state )
+{
+  std::fill( mActive.begin(), mActive.end(), state ? 1 : 0 );
+}
+
+std::size_t ChannelActivityParameter::numberOfActiveChannels() const
+{
+  return static_cast<std::size_t>(std::count_if( mActive.begin(), mActive.end(), []( std::uint8_t val ){ return val != 0; } ));
+}
+
+} // namespace pml
+} // namespace visr
@@ -0,0 +1,79 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_PML_CHANNEL_ACTIVITY_PARAMETER_HPP_INCLUDED
+#define VISR_PML_CHANNEL_ACTIVITY_PARAMETER_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+#include "vector_parameter_config.hpp"
+
+#include <libvisr/parameter_type.hpp>
+#include <libvisr/typed_parameter_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace visr
+{
+namespace pml
+{
+
+static constexpr const char * sChannelActivityParameterName = "ChannelActivity";
+
+/**
+ * Parameter type to describe which channels of a multichannel signal carry a signal and need to be processed.
+ * Processing components with an activity input skip the computations for inactive channels and output silence
+ * for them.
+ * The parameter is configured with a VectorParameterConfig holding the number of channels.
+ * A default-constructed parameter marks all channels as active.
+ */
+class VISR_PML_LIBRARY_SYMBOL ChannelActivityParameter: public TypedParameterBase<ChannelActivityParameter, VectorParameterConfig, detail::compileTimeHashFNV1(sChannelActivityParameterName) >
+{
+public:
+  /**
+   * Constructor.
+   * @param numberOfChannels The number of channels described by the parameter.
+   * @param initialState The activity state all channels are initialised to.
+   */
+  explicit ChannelActivityParameter( std::size_t numberOfChannels = 0, bool initialState = true );
+
+  explicit ChannelActivityParameter( ParameterConfigBase const & config );
+
+  explicit ChannelActivityParameter( VectorParameterConfig const & config );
+
+  virtual ~ChannelActivityParameter() override;
+
+  std::size_t size() const { return mActive.size(); }
+
+  /**
+   * Return whether a channel is active. No range check is performed.
+   */
+  bool active( std::size_t channelIdx ) const { return mActive[channelIdx] != 0; }
+
+  /**
+   * Set the activity state of a channel.
+   * @throw std::out_of_range If \p channelIdx exceeds the number of channels.
+   */
+  void setActive( std::size_t channelIdx, bool state );
+
+  /**
+   * Set all channels to the same activity state.
+   */
+  void fill( bool state );
+
+  std::size_t numberOfActiveChannels() const;
+
+private:
+  /**
+   * Activity flags, one per channel.
+   * std::uint8_t is used instead of bool to enable plain element access.
+   */
+  std::vector<std::uint8_t> mActive;
+};
+
+} // namespace pml
+} // namespace visr
+
+DEFINE_PARAMETER_TYPE( visr::pml::ChannelActivityParameter, visr::pml::ChannelActivityParameter::staticType(), visr::pml::VectorParameterConfig )
+
+#endif // VISR_PML_CHANNEL_ACTIVITY_PARAMETER_HPP_INCLUDED
@@ -154,6 +154,22 @@ void DoubleBufferingProtocol::InputBase::resetChanged()
   mChanged = false;
 }
 
+bool DoubleBufferingProtocol::InputBase::supportsParameterExtraction() const
+{
+  return true;
+}
+
+bool DoubleBufferingProtocol::InputBase::extractParameter( ParameterBase & value )
+{
+  if( not mChanged )
+  {
+    return false;
+  }
+  value.assign( data() );
+  mChanged = false;
+  return true;
+}
+
 void DoubleBufferingProtocol::InputBase::setProtocolInstance( CommunicationProtocolBase * protocol )
 {
   DoubleBufferingProtocol * dbProtocol = dynamic_cast<DoubleBufferingProtocol*>( protocol );
@@ -191,6 +207,17 @@ void DoubleBufferingProtocol::OutputBase::swapBuffers( bool copyValue /*= false*
   mProtocol->swapBuffers( copyValue );
 }
 
+bool DoubleBufferingProtocol::OutputBase::supportsParameterInjection() const
+{
+  return true;
+}
+
+void DoubleBufferingProtocol::OutputBase::injectParameter( std::unique_ptr<ParameterBase> & value )
+{
+  mProtocol->frontData().assign( *value );
+  mProtocol->swapBuffers( false );
+}
+
 void DoubleBufferingProtocol::OutputBase::setProtocolInstance( CommunicationProtocolBase * protocol )
 {
   DoubleBufferingProtocol * mp = dynamic_cast<DoubleBufferingProtocol*>(protocol);
@@ -153,6 +153,14 @@ public:
 
   DoubleBufferingProtocol const * getProtocol() const override { return mProtocol; }
 
+  bool supportsParameterExtraction() const override;
+
+  /**
+   * Assign the current value to \p value if it has changed, and reset the 'changed' flag.
+   * @return false if the value has not changed since the last call to resetChanged().
+   */
+  bool extractParameter( ParameterBase & value ) override;
+
   void setProtocolInstance( DoubleBufferingProtocol * protocol );
 
 private:
@@ -205,6 +213,14 @@ public:
 
   DoubleBufferingProtocol const * getProtocol() const override { return mProtocol; }
 
+  bool supportsParameterInjection() const override;
+
+  /**
+   * Assign an externally provided value to the output buffer and make it available to the receiving ports.
+   * \p value is not modified.
+   */
+  void injectParameter( std::unique_ptr<ParameterBase> & value ) override;
+
   /**
    * Make the current parameter available to the receiving ports.
    * @param copyValue Whether the parameter value is copied to the new output buffer. Otherwise the output
@@ -7,6 +7,7 @@
 #include "shared_data_protocol.hpp"
 
 #include "biquad_parameter.hpp"
+#include "channel_activity_parameter.hpp"
 #include "filter_routing_parameter.hpp"
 #include "indexed_value_parameter.hpp"
 #include "matrix_parameter.hpp"
@@ -35,6 +36,7 @@ void initialiseParameterLibrary()
   static ParameterRegistrar<
     BiquadParameterMatrix<float>,
     BiquadParameterMatrix<double>,
+    ChannelActivityParameter,
     FilterRoutingParameter,
     FilterRoutingListParameter,
     IndexedVectorDoubleType,
@@ -153,8 +153,34 @@ void MessageQueueProtocol::InputBase::setProtocolInstance( CommunicationProtocol
 ///////////////////////////////////////////////////////////////////////////////
 // OutputBase
 
+bool MessageQueueProtocol::InputBase::supportsParameterExtraction() const
+{
+  return true;
+}
+
+bool MessageQueueProtocol::InputBase::extractParameter( ParameterBase & value )
+{
+  if( mProtocol->empty() )
+  {
+    return false;
+  }
+  value.assign( mProtocol->nextElement() );
+  mProtocol->popNextElement();
+  return true;
+}
+
 MessageQueueProtocol::OutputBase::~OutputBase() = default;
 
+bool MessageQueueProtocol::OutputBase::supportsParameterInjection() const
+{
+  return true;
+}
+
+void MessageQueueProtocol::OutputBase::injectParameter( std::unique_ptr<ParameterBase> & value )
+{
+  mProtocol->enqueue( value );
+}
+
 void MessageQueueProtocol::OutputBase::setProtocolInstance( CommunicationProtocolBase * protocol )
 {
   MessageQueueProtocol * mp = dynamic_cast<MessageQueueProtocol*>(protocol);
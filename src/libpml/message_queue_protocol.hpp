@@ -129,6 +129,14 @@ public:
 
   MessageQueueProtocol const * getProtocol() const override { return mProtocol; }
 
+  bool supportsParameterExtraction() const override;
+
+  /**
+   * Assign the oldest message to \p value and remove it from the queue.
+   * @return false if the queue is empty.
+   */
+  bool extractParameter( ParameterBase & value ) override;
+
   bool empty() const
   {
     return mProtocol->empty();
@@ -201,6 +209,13 @@ public:
 
   MessageQueueProtocol const * getProtocol() const override { return mProtocol; }
 
+  bool supportsParameterInjection() const override;
+
+  /**
+   * Append an externally provided message to the queue. Takes over the ownership of \p value.
+   */
+  void injectParameter( std::unique_ptr<ParameterBase> & value ) override;
+
   bool empty() const
   {
     return mProtocol->empty();
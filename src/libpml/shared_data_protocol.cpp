@@ -106,6 +106,17 @@ bool SharedDataProtocol::disconnectOutput( CommunicationProtocolBase::Output* po
  */
 SharedDataProtocol::InputBase::~InputBase() = default;
 
+bool SharedDataProtocol::InputBase::supportsParameterExtraction() const
+{
+  return true;
+}
+
+bool SharedDataProtocol::InputBase::extractParameter( ParameterBase & value )
+{
+  value.assign( mProtocol->data() );
+  return true;
+}
+
 void SharedDataProtocol::InputBase::setProtocolInstance( CommunicationProtocolBase * protocol )
 {
   SharedDataProtocol * dbp = dynamic_cast<SharedDataProtocol*>(protocol);
@@ -122,6 +133,16 @@ void SharedDataProtocol::InputBase::setProtocolInstance( CommunicationProtocolBa
 
 SharedDataProtocol::OutputBase::~OutputBase() = default;
 
+bool SharedDataProtocol::OutputBase::supportsParameterInjection() const
+{
+  return true;
+}
+
+void SharedDataProtocol::OutputBase::injectParameter( std::unique_ptr<ParameterBase> & value )
+{
+  mProtocol->data().assign( *value );
+}
+
 void SharedDataProtocol::OutputBase::setProtocolInstance( CommunicationProtocolBase * protocol )
 {
   SharedDataProtocol * dbp = dynamic_cast<SharedDataProtocol*>(protocol);
@@ -99,6 +99,14 @@ public:
 
   SharedDataProtocol const * getProtocol() const override { return mProtocol; }
 
+  bool supportsParameterExtraction() const override;
+
+  /**
+   * Assign the shared parameter to \p value. Because the protocol does not track changes, this happens in every call.
+   * @return Always true.
+   */
+  bool extractParameter( ParameterBase & value ) override;
+
   ParameterBase const & data() const
   {
     return mProtocol->data();
@@ -145,6 +153,13 @@ public:
 
   SharedDataProtocol const * getProtocol() const override { return mProtocol; }
 
+  bool supportsParameterInjection() const override;
+
+  /**
+   * Assign an externally provided value to the shared parameter. \p value is not modified.
+   */
+  void injectParameter( std::unique_ptr<ParameterBase> & value ) override;
+
   ParameterBase & data()
   {
     return mProtocol->data();
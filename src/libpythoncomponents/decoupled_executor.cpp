@@ -0,0 +1,335 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "decoupled_executor.hpp"
+
+#include <libpythonsupport/gil_ensure_guard.hpp>
+
+#include <libvisr/detail/compose_message_string.hpp>
+#include <libvisr/parameter_base.hpp>
+#include <libvisr/parameter_factory.hpp>
+#include <libvisr/polymorphic_parameter_input.hpp>
+#include <libvisr/polymorphic_parameter_output.hpp>
+
+#include <libvisr/impl/component_implementation.hpp>
+#include <libvisr/impl/parameter_port_base_implementation.hpp>
+
+#include <libpml/message_queue_protocol.hpp>
+
+#include <librrl/audio_signal_flow.hpp>
+
+#include <pybind11/pybind11.h>
+
+#include <chrono>
+#include <ciso646>
+#include <stdexcept>
+#include <string>
+
+namespace visr
+{
+namespace pythoncomponents
+{
+
+DecoupledExecutor::InputChannel::InputChannel( std::unique_ptr<PolymorphicParameterInput> && inputPort,
+                                               bool queuedProtocol )
+ : port( std::move( inputPort ) )
+ , endpoint( nullptr )
+ , queued( queuedProtocol )
+ , pending( cQueueLength )
+ , free( cQueueLength )
+{
+  for( std::size_t idx( 0 ); idx < cQueueLength; ++idx )
+  {
+    pool.push_back( ParameterFactory::create( port->parameterType(), port->parameterConfig() ) );
+    free.push( pool.back().get() );
+  }
+}
+
+// The parameter objects are owned by the pool, so there is nothing to clean up in the queues.
+DecoupledExecutor::InputChannel::~InputChannel() = default;
+
+DecoupledExecutor::OutputChannel::OutputChannel( std::unique_ptr<PolymorphicParameterOutput> && outputPort,
+                                                 bool queuedProtocol )
+ : port( std::move( outputPort ) )
+ , endpoint( nullptr )
+ , queued( queuedProtocol )
+ , pending( cQueueLength )
+ // Objects in the recycle queue have passed the pending queue, so twice the capacity makes an overflow unlikely.
+ , recycled( 2 * cQueueLength )
+{
+}
+
+DecoupledExecutor::OutputChannel::~OutputChannel()
+{
+  Item item;
+  while( pending.pop( item ) )
+  {
+    delete item.value;
+  }
+  ParameterBase * param;
+  while( recycled.pop( param ) )
+  {
+    delete param;
+  }
+  delete held.value;
+  delete stalled.value;
+}
+
+DecoupledExecutor::DecoupledExecutor( SignalFlowContext const & context,
+                                      char const * name,
+                                      CompositeComponent * parent,
+                                      Component & component,
+                                      std::size_t latency )
+ : AtomicComponent( context, name, parent )
+ , mLatency( latency )
+ , mBlockCounter( 0 )
+ , mRequestedBlocks( 0 )
+ , mRunning( false )
+{
+#ifdef VISR_DISABLE_THREADS
+  throw std::invalid_argument( "DecoupledExecutor: Decoupled execution is not supported because threads are disabled." );
+#else
+  if( latency < 1 )
+  {
+    throw std::invalid_argument( "DecoupledExecutor: The latency must be at least one block." );
+  }
+  impl::ComponentImplementation & compImpl = component.implementation();
+  if( not component.isTopLevel() )
+  {
+    throw std::invalid_argument( detail::composeMessageString( "DecoupledExecutor: The component \"",
+      compImpl.name(), "\" must be a top-level component." ) );
+  }
+  if( not compImpl.audioPorts().empty() )
+  {
+    throw std::invalid_argument( detail::composeMessageString( "DecoupledExecutor: The component \"",
+      compImpl.name(), "\" must not have audio ports." ) );
+  }
+  for( auto parameterPort : compImpl.parameterPorts() )
+  {
+    char const * portName = parameterPort->name();
+    auto const parameterType = parameterPort->parameterType();
+    auto const protocolType = parameterPort->protocolType();
+    ParameterConfigBase const & paramConfig = parameterPort->parameterConfig();
+    bool const queued = protocolType == pml::MessageQueueProtocol::staticType();
+    if( parameterPort->direction() == PortBase::Direction::Input )
+    {
+      std::unique_ptr<PolymorphicParameterInput> port( new PolymorphicParameterInput( portName, *this,
+        parameterType, protocolType, paramConfig ) );
+      if( not port->protocolInput().supportsParameterExtraction() )
+      {
+        throw std::invalid_argument( detail::composeMessageString( "DecoupledExecutor: The protocol of parameter port \"",
+          portName, "\" does not support decoupled execution." ) );
+      }
+      mInputs.emplace_back( new InputChannel( std::move( port ), queued ) );
+    }
+    else
+    {
+      std::unique_ptr<PolymorphicParameterOutput> port( new PolymorphicParameterOutput( portName, *this,
+        parameterType, protocolType, paramConfig ) );
+      if( not port->protocolOutput().supportsParameterInjection() )
+      {
+        throw std::invalid_argument( detail::composeMessageString( "DecoupledExecutor: The protocol of parameter port \"",
+          portName, "\" does not support decoupled execution." ) );
+      }
+      mOutputs.emplace_back( new OutputChannel( std::move( port ), queued ) );
+    }
+  }
+
+  mFlow.reset( new rrl::AudioSignalFlow( component ) );
+  // The decoupled flow is accessed exclusively by the helper thread.
+  mFlow->setParameterExchangeLocking( false );
+  for( auto & input : mInputs )
+  {
+    input->endpoint = &(mFlow->externalParameterReceivePort( input->port->implementation().name() ));
+  }
+  for( auto & output : mOutputs )
+  {
+    output->endpoint = &(mFlow->externalParameterSendPort( output->port->implementation().name() ));
+  }
+
+  mRunning.store( true );
+  mHelperThread = std::thread( &DecoupledExecutor::runHelper, this );
+#endif // VISR_DISABLE_THREADS
+}
+
+DecoupledExecutor::~DecoupledExecutor()
+{
+  stop();
+}
+
+void DecoupledExecutor::stop()
+{
+#ifndef VISR_DISABLE_THREADS
+  if( not mHelperThread.joinable() )
+  {
+    return;
+  }
+  mRunning.store( false );
+  {
+    std::lock_guard<std::mutex> lock( mWakeupMutex );
+    mWakeup.notify_one();
+  }
+  if( PyGILState_Check() )
+  {
+    pybind11::gil_scoped_release release;
+    mHelperThread.join();
+  }
+  else
+  {
+    mHelperThread.join();
+  }
+#endif
+}
+
+void DecoupledExecutor::process()
+{
+  std::size_t const block = mBlockCounter;
+  for( auto & input : mInputs )
+  {
+    ParameterBase * param;
+    while( input->free.pop( param ) )
+    {
+      if( not input->port->protocolInput().extractParameter( *param ) )
+      {
+        input->free.push( param );
+        break;
+      }
+      // Cannot fail because the queue can hold all objects of the pool.
+      input->pending.push( Item{ block, param } );
+      if( not input->queued )
+      {
+        break; // Non-queued protocols provide at most one new value per block.
+      }
+    }
+  }
+  for( auto & output : mOutputs )
+  {
+    for( ;; )
+    {
+      if( (output->held.value == nullptr) and not output->pending.pop( output->held ) )
+      {
+        break;
+      }
+      if( output->held.block + mLatency > block )
+      {
+        break;
+      }
+      std::unique_ptr<ParameterBase> value( output->held.value );
+      output->held.value = nullptr;
+      output->port->protocolOutput().injectParameter( value );
+      if( value )
+      {
+        // Return the object to the helper thread. Deallocate here only if the recycle queue is full.
+        if( output->recycled.push( value.get() ) )
+        {
+          value.release();
+        }
+      }
+    }
+  }
+  mBlockCounter = block + 1;
+  mRequestedBlocks.store( mBlockCounter, std::memory_order_release );
+#ifndef VISR_DISABLE_THREADS
+  // Notifying without holding the mutex avoids blocking the audio thread. A wakeup that is lost because the helper
+  // thread is just about to wait is caught by the timeout of the wait.
+  mWakeup.notify_one();
+#endif
+}
+
+void DecoupledExecutor::runHelper()
+{
+#ifndef VISR_DISABLE_THREADS
+  std::size_t processedBlocks = 0;
+  while( mRunning.load() )
+  {
+    {
+      std::unique_lock<std::mutex> lock( mWakeupMutex );
+      mWakeup.wait_for( lock, std::chrono::milliseconds( 10 ), [this, processedBlocks]()
+      {
+        return (not mRunning.load()) or (mRequestedBlocks.load( std::memory_order_acquire ) > processedBlocks);
+      } );
+    }
+    if( mRequestedBlocks.load( std::memory_order_acquire ) <= processedBlocks )
+    {
+      continue;
+    }
+    pythonsupport::GilEnsureGuard guard;
+    // Catch up with all blocks requested so far, so that the executed component sees the same number of process()
+    // calls as the enclosing flow.
+    while( mRunning.load() and (processedBlocks < mRequestedBlocks.load( std::memory_order_acquire )) )
+    {
+      try
+      {
+        processHelperBlock( processedBlocks );
+      }
+      catch( std::exception const & ex )
+      {
+        status( StatusMessage::Warning, "Error during decoupled execution: ", ex.what() );
+      }
+      ++processedBlocks;
+    }
+  }
+#endif
+}
+
+void DecoupledExecutor::processHelperBlock( std::size_t block )
+{
+  for( auto & input : mInputs )
+  {
+    for( ;; )
+    {
+      if( (input->held.value == nullptr) and not input->pending.pop( input->held ) )
+      {
+        break;
+      }
+      if( input->held.block > block )
+      {
+        break;
+      }
+      std::unique_ptr<ParameterBase> value( input->held.value->clone() );
+      input->endpoint->injectParameter( value );
+      input->free.push( input->held.value );
+      input->held.value = nullptr;
+    }
+  }
+
+  mFlow->process( nullptr, nullptr );
+
+  for( auto & output : mOutputs )
+  {
+    if( (output->stalled.value != nullptr) and output->pending.push( output->stalled ) )
+    {
+      output->stalled.value = nullptr;
+    }
+    // A stalled item blocks further transfers to maintain the order.
+    while( output->stalled.value == nullptr )
+    {
+      ParameterBase * param = nullptr;
+      if( not output->recycled.pop( param ) )
+      {
+        param = ParameterFactory::create( output->port->parameterType(), output->port->parameterConfig() ).release();
+      }
+      std::unique_ptr<ParameterBase> value( param );
+      if( not output->endpoint->extractParameter( *value ) )
+      {
+        if( not output->recycled.push( value.get() ) )
+        {
+          break; // Deletes the object.
+        }
+        value.release();
+        break;
+      }
+      Item const item{ block, value.release() };
+      if( not output->pending.push( item ) )
+      {
+        output->stalled = item;
+      }
+      if( not output->queued )
+      {
+        break;
+      }
+    }
+  }
+}
+
+} // namespace pythoncomponents
+} // namespace visr
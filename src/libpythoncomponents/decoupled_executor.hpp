@@ -0,0 +1,176 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBPYTHONCOMPONENTS_DECOUPLED_EXECUTOR_HPP_INCLUDED
+#define VISR_LIBPYTHONCOMPONENTS_DECOUPLED_EXECUTOR_HPP_INCLUDED
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/communication_protocol_base.hpp>
+
+#include <librbbl/lock_free_queue.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#ifndef VISR_DISABLE_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace visr
+{
+// Forward declarations
+class ParameterBase;
+class PolymorphicParameterInput;
+class PolymorphicParameterOutput;
+
+namespace rrl
+{
+class AudioSignalFlow;
+}
+
+namespace pythoncomponents
+{
+
+/**
+ * Internal component that executes a parameter-only component on a separate, non-realtime thread.
+ * The executed component is instantiated as a top-level component and runs in its own signal flow. This object
+ * provides parameter ports mirroring those of the executed component and exchanges the parameter values with the
+ * helper thread through lock-free queues. Therefore the process() method, which is called in the audio thread,
+ * neither blocks nor interacts with the Python interpreter.
+ * Parameters received in block \p n are processed by the helper thread, and the results are passed to the outputs
+ * in block <tt>n+latency</tt>, or later if the helper thread has not finished by then.
+ */
+class DecoupledExecutor: public AtomicComponent
+{
+public:
+  /**
+   * Constructor.
+   * @param context Configuration parameter containing information as period length and sampling frequency.
+   * @param name The name of the component. Must be unique within the containing AudioSignalFlow.
+   * @param parent Pointer to the containing component.
+   * @param component The component to be executed. Must be a top-level component without audio ports, and all its
+   * parameter ports must use communication protocols that support parameter extraction and injection.
+   * @param latency The delay between receiving input parameters and passing on the results, in blocks. Must be at least 1.
+   * @throw std::invalid_argument If \p component or \p latency violate the requirements.
+   * @throw std::invalid_argument If VISR is built without thread support.
+   */
+  explicit DecoupledExecutor( SignalFlowContext const & context,
+                              char const * name,
+                              CompositeComponent * parent,
+                              Component & component,
+                              std::size_t latency );
+
+  /**
+   * Destructor. Stops the helper thread if this has not been done before.
+   */
+  ~DecoupledExecutor() override;
+
+  void process() override;
+
+  /**
+   * Stop and join the helper thread.
+   * If the calling thread holds the Python global interpreter lock, it is released while waiting for the helper
+   * thread, which might need it to finish the current iteration.
+   */
+  void stop();
+
+  /**
+   * The number of parameters that can be pending per port and direction.
+   */
+  static constexpr std::size_t cQueueLength = 64;
+
+private:
+  /**
+   * A parameter object tagged with the block in which it has been received.
+   */
+  struct Item
+  {
+    std::size_t block = 0;
+    ParameterBase * value = nullptr;
+  };
+
+  /**
+   * Transfer of parameters from an input of this component to the executed component.
+   * The parameter objects are preallocated and circulate between the audio and the helper thread.
+   */
+  struct InputChannel
+  {
+    explicit InputChannel( std::unique_ptr<PolymorphicParameterInput> && inputPort, bool queuedProtocol );
+
+    ~InputChannel();
+
+    std::unique_ptr<PolymorphicParameterInput> port;
+    CommunicationProtocolBase::Output * endpoint; ///< The corresponding top-level input of the decoupled flow.
+    bool const queued;
+    rbbl::LockFreeQueue<Item> pending;
+    rbbl::LockFreeQueue<ParameterBase *> free;
+    std::vector<std::unique_ptr<ParameterBase> > pool;
+    Item held; ///< Helper thread: Item popped from the queue, but not due yet.
+  };
+
+  /**
+   * Transfer of parameters from the executed component to an output of this component.
+   * Parameter objects are allocated by the helper thread and returned by the audio thread if the protocol does not
+   * take them over.
+   */
+  struct OutputChannel
+  {
+    explicit OutputChannel( std::unique_ptr<PolymorphicParameterOutput> && outputPort, bool queuedProtocol );
+
+    ~OutputChannel();
+
+    std::unique_ptr<PolymorphicParameterOutput> port;
+    CommunicationProtocolBase::Input * endpoint; ///< The corresponding top-level output of the decoupled flow.
+    bool const queued;
+    rbbl::LockFreeQueue<Item> pending;
+    rbbl::LockFreeQueue<ParameterBase *> recycled;
+    Item held; ///< Audio thread: Item popped from the queue, but not due yet.
+    Item stalled; ///< Helper thread: Item that could not be queued because the queue was full.
+  };
+
+  /**
+   * Main loop of the helper thread.
+   */
+  void runHelper();
+
+  /**
+   * Execute one block of the decoupled signal flow. Called from the helper thread.
+   */
+  void processHelperBlock( std::size_t block );
+
+  std::size_t const mLatency;
+
+  std::unique_ptr<rrl::AudioSignalFlow> mFlow;
+
+  std::vector<std::unique_ptr<InputChannel> > mInputs;
+
+  std::vector<std::unique_ptr<OutputChannel> > mOutputs;
+
+  /**
+   * Audio thread: Index of the current block.
+   */
+  std::size_t mBlockCounter;
+
+  /**
+   * Number of blocks for which the helper thread has been triggered.
+   */
+  std::atomic<std::size_t> mRequestedBlocks;
+
+  std::atomic<bool> mRunning;
+
+#ifndef VISR_DISABLE_THREADS
+  std::mutex mWakeupMutex;
+
+  std::condition_variable mWakeup;
+
+  std::thread mHelperThread;
+#endif
+};
+
+} // namespace pythoncomponents
+} // namespace visr
+
+#endif // #ifndef VISR_LIBPYTHONCOMPONENTS_DECOUPLED_EXECUTOR_HPP_INCLUDED
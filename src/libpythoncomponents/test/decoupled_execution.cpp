@@ -0,0 +1,146 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <libpythoncomponents/wrapper.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/parameter_input.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <librrl/audio_signal_flow.hpp>
+
+#include <libpml/empty_parameter_config.hpp>
+#include <libpml/initialise_parameter_library.hpp>
+#include <libpml/message_queue_protocol.hpp>
+#include <libpml/string_parameter.hpp>
+
+#include <libpythonsupport/initialisation_guard.hpp>
+
+#include <boost/filesystem/path.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <ciso646>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace visr
+{
+namespace pythoncomponents
+{
+namespace test
+{
+
+#ifndef VISR_DISABLE_THREADS
+
+namespace // unnamed
+{
+
+/**
+ * Records the received messages together with the index of the block in which they arrived.
+ */
+class MessageSink: public AtomicComponent
+{
+public:
+  MessageSink( SignalFlowContext const & context, char const * name, CompositeComponent * parent )
+   : AtomicComponent( context, name, parent )
+   , mInput( "in", *this, pml::EmptyParameterConfig() )
+   , mBlock( 0 )
+  {
+  }
+
+  void process() override
+  {
+    while( not mInput.empty() )
+    {
+      mMessages.push_back( mInput.front().str() );
+      mArrivalBlocks.push_back( mBlock );
+      mInput.pop();
+    }
+    ++mBlock;
+  }
+
+  std::vector<std::string> const & messages() const { return mMessages; }
+
+  std::vector<std::size_t> const & arrivalBlocks() const { return mArrivalBlocks; }
+private:
+  ParameterInput<pml::MessageQueueProtocol, pml::StringParameter > mInput;
+  std::vector<std::string> mMessages;
+  std::vector<std::size_t> mArrivalBlocks;
+  std::size_t mBlock;
+};
+
+class DecoupledTestFlow: public CompositeComponent
+{
+public:
+  DecoupledTestFlow( SignalFlowContext const & context, std::size_t latency )
+   : CompositeComponent( context, "", nullptr )
+   , mEcho( context, "Echo", this, "parameterAtoms", "MessageEcho", "", "{'prefix':'echo:'}",
+            (boost::filesystem::path( CMAKE_CURRENT_SOURCE_DIR ) / "python").string().c_str(),
+            Wrapper::ExecutionMode::Decoupled, latency )
+   , mSink( context, "Sink", this )
+   , mInput( "in", *this, pml::EmptyParameterConfig() )
+  {
+    parameterConnection( mInput, mEcho.parameterPort( "in" ) );
+    parameterConnection( mEcho.parameterPort( "out" ), mSink.parameterPort( "in" ) );
+  }
+
+  MessageSink const & sink() const { return mSink; }
+private:
+  Wrapper mEcho;
+  MessageSink mSink;
+  ParameterInput<pml::MessageQueueProtocol, pml::StringParameter > mInput;
+};
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( DecoupledExecutionMessages )
+{
+  pml::initialiseParameterLibrary();
+  pythonsupport::InitialisationGuard::initialise();
+
+  std::size_t const latency = 3;
+  std::size_t const numMessages = 5;
+  SignalFlowContext const ctxt( 64, 48000 );
+  DecoupledTestFlow comp( ctxt, latency );
+  rrl::AudioSignalFlow flow( comp );
+
+  for( std::size_t msgIdx( 0 ); msgIdx < numMessages; ++msgIdx )
+  {
+    BOOST_CHECK( flow.injectParameter( "in", pml::StringParameter( std::to_string( msgIdx ) ) ) );
+  }
+  // Messages injected before the first block are received by the decoupled component in block 0.
+  for( std::size_t iter( 0 ); (iter < 1000) and (comp.sink().messages().size() < numMessages); ++iter )
+  {
+    flow.process( nullptr, nullptr );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+  }
+  BOOST_REQUIRE_EQUAL( comp.sink().messages().size(), numMessages );
+  for( std::size_t msgIdx( 0 ); msgIdx < numMessages; ++msgIdx )
+  {
+    BOOST_CHECK_EQUAL( comp.sink().messages()[msgIdx], "echo:" + std::to_string( msgIdx ) );
+    // The results are never passed on before the configured latency.
+    BOOST_CHECK_GE( comp.sink().arrivalBlocks()[msgIdx], latency );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( DecoupledExecutionRejectsAudioPorts )
+{
+  pml::initialiseParameterLibrary();
+  pythonsupport::InitialisationGuard::initialise();
+
+  SignalFlowContext const ctxt( 64, 48000 );
+  boost::filesystem::path const modulePath = boost::filesystem::path( CMAKE_CURRENT_SOURCE_DIR ) / "python";
+  BOOST_CHECK_THROW( Wrapper( ctxt, "PythonAtom", nullptr, "pythonAtoms", "PythonAdder", "3,", "{'width':5}",
+                              modulePath.string().c_str(), Wrapper::ExecutionMode::Decoupled ),
+                     std::invalid_argument );
+}
+
+#endif // #ifndef VISR_DISABLE_THREADS
+
+} // namespace test
+} // namespace pythoncomponents
+} // namespace visr
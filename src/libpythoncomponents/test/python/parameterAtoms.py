@@ -0,0 +1,34 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (C) 2017-2018 Andreas Franck
+# Copyright (C) 2017-2018 ISVR, University of Southampton
+
+"""
+Parameter-only atomic components implemented in Python, used in the unit tests
+of the decoupled execution mode.
+"""
+
+import visr
+
+import pml
+
+
+class MessageEcho( visr.AtomicComponent ):
+    """ Forward all received string messages with a prefix prepended. """
+    def __init__( self, context, name, parent, prefix ):
+        super(MessageEcho,self).__init__( context, name, parent )
+        self.prefix = prefix
+        self.input = visr.ParameterInput( "in", self,
+                                          pml.StringParameter.staticType,
+                                          pml.MessageQueueProtocol.staticType,
+                                          pml.EmptyParameterConfig() )
+        self.output = visr.ParameterOutput( "out", self,
+                                            pml.StringParameter.staticType,
+                                            pml.MessageQueueProtocol.staticType,
+                                            pml.EmptyParameterConfig() )
+    def process( self ):
+        inProtocol = self.input.protocol
+        while not inProtocol.empty():
+            msg = inProtocol.front().str
+            self.output.protocol.enqueue( pml.StringParameter( self.prefix + msg ) )
+            inProtocol.pop()
@@ -2,6 +2,8 @@
 
 #include "wrapper.hpp"
 
+#include "decoupled_executor.hpp"
+
 #include <libpythonsupport/gil_ensure_guard.hpp>
 #include <libpythonsupport/load_module.hpp>
 
@@ -53,7 +55,9 @@ public:
                  char const * componentClassName,
                  char const * positionalArguments,
                  char const * keywordArguments,
-                 char const * moduleSearchPath = nullptr );
+                 char const * moduleSearchPath,
+                 ExecutionMode executionMode,
+                 std::size_t decoupledLatency );
 private:
   /**
   * A vector holding an arbitrary number of input ports
@@ -82,6 +86,12 @@ private:
   pybind11::object mComponentWrapper;
 
   Component * mComponent;
+
+  /**
+   * Component running the Python component on a separate thread, only used in ExecutionMode::Decoupled.
+   * Declared after the Python objects, so that the helper thread is stopped before they are destroyed.
+   */
+  std::unique_ptr<DecoupledExecutor> mExecutor;
 };
 
 Wrapper::Wrapper( SignalFlowContext const & context,
@@ -91,10 +101,13 @@ Wrapper::Wrapper( SignalFlowContext const & context,
                               char const * componentClassName,
                               char const * positionalArguments,
                               char const * keywordArguments,
-                              char const * moduleSearchPath /*= nullptr*/ )
+                              char const * moduleSearchPath /*= nullptr*/,
+                              ExecutionMode executionMode /*= ExecutionMode::Synchronous*/,
+                              std::size_t decoupledLatency /*= 1*/ )
   : CompositeComponent( context, (std::string(name)+std::string("_wrapper")).c_str(), parent )
   , mImpl( new Impl( context, name, this, moduleName, componentClassName,
-                    positionalArguments, keywordArguments, moduleSearchPath ) )
+                    positionalArguments, keywordArguments, moduleSearchPath,
+                    executionMode, decoupledLatency ) )
 {}
 
 
@@ -105,8 +118,11 @@ Wrapper::Impl::Impl( SignalFlowContext const & context,
                            char const * componentClassName,
                            char const * positionalArguments,
                            char const * keywordArguments,
-                           char const * moduleSearchPath)
+                           char const * moduleSearchPath,
+                           ExecutionMode executionMode,
+                           std::size_t decoupledLatency )
 {
+  bool const decoupled = executionMode == ExecutionMode::Decoupled;
   // Ensure that we have a thread state for the current thread.
   pythonsupport::GilEnsureGuard guard;
 
@@ -170,8 +186,9 @@ Wrapper::Impl::Impl( SignalFlowContext const & context,
 
   try
   {
+    // In decoupled mode, the Python component runs in a separate signal flow and is therefore a top-level component.
     mComponentWrapper = mComponentClass( context, name,
-                                         static_cast<CompositeComponent*>(parent),
+                                         decoupled ? nullptr : static_cast<CompositeComponent*>(parent),
                                          *keywordList,
                                          **keywordDict );
   }
@@ -189,7 +206,23 @@ Wrapper::Impl::Impl( SignalFlowContext const & context,
 
     throw std::runtime_error( detail::composeMessageString("Wrapper: Error casting the Python object of component \"", name, "\" to the C++ base type. Reason: ",ex.what() ) );
   }
-  impl::ComponentImplementation & compImpl = mComponent->implementation();
+  if( decoupled )
+  {
+    // The executor provides ports matching those of the Python component, which are connected instead.
+    try
+    {
+      mExecutor.reset( new DecoupledExecutor( context, name, parent, *mComponent, decoupledLatency ) );
+    }
+    catch( std::exception const & )
+    {
+      // Release the Python objects while the GIL is held, because the data members are destroyed after the guard.
+      mComponentWrapper = py::object();
+      mComponentClass = py::object();
+      mModule = py::object();
+      throw;
+    }
+  }
+  impl::ComponentImplementation & compImpl = decoupled ? mExecutor->implementation() : mComponent->implementation();
   // Collect the audio ports of the contained components, create matching external ports on the outside of 'this;
   // composite component, and connect them. This additional set of connections will be removed by the 'flattening' phase, leaving only an additional level in the full names.
   for( auto audioPort : compImpl.audioPorts() )
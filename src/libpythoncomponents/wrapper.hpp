@@ -7,6 +7,7 @@
 
 #include <libvisr/composite_component.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -31,6 +32,17 @@ namespace pythoncomponents
 class VISR_PYTHONCOMPONENTS_LIBRARY_SYMBOL Wrapper: public CompositeComponent
 {
 public:
+  /**
+   * Enumeration to select how the Python component is executed.
+   */
+  enum class ExecutionMode
+  {
+    Synchronous, ///< The Python component is part of the enclosing signal flow and executed in the audio thread.
+    Decoupled    ///< The Python component is executed on a separate, non-realtime thread. Requires a component
+                 ///< without audio ports. The audio thread does not access the Python interpreter in this mode,
+                 ///< but the parameter outputs are delayed by a configurable number of blocks.
+  };
+
 
   /**
    * Constructor, creates a Wrapper object.
@@ -46,6 +58,12 @@ public:
    * This list must not include the \p context, \p name, and \p parent arguments which are provided automatically.
    * @param keywordArguments Optional, comma-separated key-value pairs of the form "key:value" to provide keyword arguments to the Python component.
    * @param moduleSearchPath Optional, comma-separated list of directories to search for the module named by the \p moduleName option (in addition to the default search path).
+   * @param executionMode Optional, whether the Python component is executed in the audio thread (default) or decoupled on a separate thread.
+   * @param decoupledLatency Optional, the number of blocks between receiving parameters and passing on the results
+   * in ExecutionMode::Decoupled, must be at least 1. Results that are not ready in time are passed on in the first
+   * block after they become available. Ignored in synchronous mode.
+   * @throw std::invalid_argument If the ExecutionMode::Decoupled is requested for a component with audio ports, or
+   * with parameter protocols that do not support parameter injection and extraction.
    */
   explicit Wrapper( SignalFlowContext const & context,
                           char const * name,
@@ -54,7 +72,9 @@ public:
                           char const * componentClassName,
                           char const * positionalArguments = "",
                           char const * keywordArguments = "",
-                          char const * moduleSearchPath = "");
+                          char const * moduleSearchPath = "",
+                          ExecutionMode executionMode = ExecutionMode::Synchronous,
+                          std::size_t decoupledLatency = 1 );
 
   /**
    * Destructor.
@@ -3,7 +3,9 @@
 #include "core_convolver_uniform.hpp"
 
 #include <librbbl/fft_wrapper_factory.hpp>
+#include <librbbl/filter_bank_file.hpp>
 
+#include <algorithm>
 #include <complex>
 
 namespace visr
@@ -33,11 +35,14 @@ CoreConvolverUniform( std::size_t numberOfInputs,
  , mInputBuffers( numberOfInputs, mDftSize, alignment )
  , mInputFDL( numberOfInputs, mDftRepresentationSizePadded * mNumberOfFilterPartitions, mComplexAlignment )
  , mFdlCycleOffset( 0 )
+ , mSilentInputBlocks( numberOfInputs, 0 )
  , mTimeDomainTransformBuffer( mDftSize, mAlignment )
  , mFilterPartitionsFrequencyDomain( maxFilterEntries, mDftRepresentationSizePadded * mNumberOfFilterPartitions, mComplexAlignment )
+ , mFilterPartitionCounts( maxFilterEntries, 0 )
  , mFrequencyDomainAccumulator( mDftRepresentationSizePadded, mComplexAlignment )
  // Note: the FFT wrapper expects the alignmnent as number complex elements, whereas alignmnet is given as a
  //  multiple of the real-valued sampe size.
+ , mFftImplementation( fftImplementation )
  , mFftRepresentation( FftWrapperFactory<SampleType>::create( fftImplementation, mDftSize, alignment/2 ) )
  , mFilterScalingFactor( calculateFilterScalingFactor() )
 {
@@ -49,13 +54,27 @@ CoreConvolverUniform<SampleType>::~CoreConvolverUniform() = default;
 
 template< typename SampleType >
 void CoreConvolverUniform<SampleType>::
-processInputs( SampleType const * const input, std::size_t channelStride, std::size_t alignment )
+processInputs( SampleType const * const input, std::size_t channelStride, std::size_t alignment,
+               bool const * silentInputs /*= nullptr*/ )
 {
   mInputBuffers.write( input, channelStride, numberOfInputs(), blockLength(), alignment );
   advanceFDL();
   for( std::size_t chIdx( 0 ); chIdx < mNumberOfInputs; ++chIdx )
   {
-    mFftRepresentation->forwardTransform( mInputBuffers.getReadPointer( chIdx, mDftSize ), getFdlBlock( chIdx, 0 ) );
+    std::size_t & silentBlocks = mSilentInputBlocks[chIdx];
+    silentBlocks = (silentInputs and silentInputs[chIdx]) ? std::min( silentBlocks + 1, mNumberOfFilterPartitions + 1 ) : 0;
+    // Each transformed block spans the current and the previous input block, so it is zero only if both are silent.
+    if( silentBlocks >= 2 )
+    {
+      if( efl::vectorZero( getFdlBlock( chIdx, 0 ), mDftRepresentationSizePadded, mComplexAlignment ) != efl::noError )
+      {
+        throw std::runtime_error( "CoreConvolverUniform::processInputs(): Clearing of a delay line block failed." );
+      }
+    }
+    else
+    {
+      mFftRepresentation->forwardTransform( mInputBuffers.getReadPointer( chIdx, mDftSize ), getFdlBlock( chIdx, 0 ) );
+    }
   }
 }
 
@@ -63,15 +82,27 @@ template< typename SampleType >
 void CoreConvolverUniform<SampleType>::processFilter( std::size_t inputIndex, std::size_t filterIndex, 
                                                       SampleType gain, FrequencyDomainType * result, bool addFlag )
 {
-  if( efl::vectorMultiply( getFdlBlock( inputIndex, 0 ),
-    getFdFilterPartition( filterIndex, 0 ),
+  // The most recent blocks of the delay line are zero if the input has been silent, so the corresponding
+  // partitions do not contribute to the result. Likewise, the trailing zero partitions of the filter are skipped.
+  std::size_t const zeroBlocks = mSilentInputBlocks[inputIndex] > 0 ? mSilentInputBlocks[inputIndex] - 1 : 0;
+  std::size_t const numPartitions = mFilterPartitionCounts[filterIndex];
+  if( zeroBlocks >= numPartitions )
+  {
+    if( (not addFlag) and (efl::vectorZero( result, mDftRepresentationSizePadded, mComplexAlignment ) != efl::noError) )
+    {
+      throw std::runtime_error( "CoreConvolverUniform::processOutput(): Frequency-domain block convolution failed." );
+    }
+    return;
+  }
+  if( efl::vectorMultiply( getFdlBlock( inputIndex, zeroBlocks ),
+    getFdFilterPartition( filterIndex, zeroBlocks ),
     mFrequencyDomainAccumulator.data(),
     mDftRepresentationSizePadded, // slightly more operations, but likely faster due to better use of vectorized operations.
     mComplexAlignment ) != efl::noError )
   {
     throw std::runtime_error( "CoreConvolverUniform::processOutput(): Frequency-domain block convolution failed." );
   }
-  for( std::size_t blockIndex( 1 ); blockIndex < mNumberOfFilterPartitions; ++blockIndex )
+  for( std::size_t blockIndex( zeroBlocks + 1 ); blockIndex < numPartitions; ++blockIndex )
   {
     if( efl::vectorMultiplyAddInplace( getFdlBlock( inputIndex, blockIndex ),
       getFdFilterPartition( filterIndex, blockIndex ),
@@ -188,6 +219,7 @@ template< typename SampleType>
 void CoreConvolverUniform<SampleType>::clearFilters()
 {
   mFilterPartitionsFrequencyDomain.zeroFill();
+  std::fill( mFilterPartitionCounts.begin(), mFilterPartitionCounts.end(), 0 );
 }
 
 template< typename SampleType >
@@ -216,6 +248,54 @@ void CoreConvolverUniform<SampleType>::initFilters( efl::BasicMatrix<SampleType>
     {
       throw std::runtime_error( "CoreConvolverUniform::initFilters( ): Zeroing the excess filters failed." );
     }
+    mFilterPartitionCounts[filterIdx] = 0;
+  }
+}
+
+template< typename SampleType >
+void CoreConvolverUniform<SampleType>::initFilters( FilterBankFile<SampleType> const & filterBank )
+{
+  if( filterBank.numberOfFilters() > maxNumberOfFilterEntries() )
+  {
+    throw std::invalid_argument( "CoreConvolverUniform::initFilters( ): The filter bank exceeds the maximum number of filter entries." );
+  }
+  if( filterBank.filterLength() > maxFilterLength() )
+  {
+    throw std::invalid_argument( "CoreConvolverUniform::initFilters( ): The filter bank exceeds the maximum filter length." );
+  }
+  clearFilters();
+  std::size_t const numFilters = filterBank.numberOfFilters();
+  bool const useFrequencyDomainData = filterBank.hasFrequencyDomainData()
+    and (filterBank.blockLength() == blockLength())
+    and (filterBank.fftImplementation() == fftLibrary())
+    and (filterBank.filterScalingFactor() == static_cast<double>( filterScalingFactor() ))
+    and (filterBank.numberOfPartitions() <= numberOfFilterPartitions());
+  if( not useFrequencyDomainData )
+  {
+    for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+    {
+      setImpulseResponse( filterBank.filter( filterIdx ), filterBank.filterLength(), filterIdx,
+                          filterBank.alignmentElements() );
+    }
+    return;
+  }
+  // Copy the partitions individually, because the padding between partitions might differ. Partitions not contained
+  // in the file remain zero.
+  std::size_t const dftRepresentationSize = calculateDftRepresentationSize( blockLength() );
+  std::size_t const fileAlignment = filterBank.alignmentElements() / 2; // Alignment in complex elements.
+  for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+  {
+    FrequencyDomainType const * const source = filterBank.frequencyDomainFilter( filterIdx );
+    for( std::size_t partitionIdx( 0 ); partitionIdx < filterBank.numberOfPartitions(); ++partitionIdx )
+    {
+      if( efl::vectorCopy( source + partitionIdx * filterBank.partitionStride(),
+                           getFdFilterPartition( filterIdx, partitionIdx ),
+                           dftRepresentationSize, std::min( fileAlignment, mComplexAlignment ) ) != efl::noError )
+      {
+        throw std::runtime_error( "CoreConvolverUniform::initFilters( ): Copying the filter partitions failed." );
+      }
+    }
+    updateFilterPartitionCount( filterIdx );
   }
 }
 
@@ -258,6 +338,7 @@ setImpulseResponse( SampleType const * ir, std::size_t filterLength, std::size_t
   transformImpulseResponse( ir, filterLength,
                             mFilterPartitionsFrequencyDomain.row( filterIdx ),
                             std::min( mAlignment, alignment ) );
+  updateFilterPartitionCount( filterIdx );
 }
 
 template< typename SampleType >
@@ -270,6 +351,27 @@ void CoreConvolverUniform<SampleType>::setFilter( FrequencyDomainType const * tr
   efl::vectorCopy( transformedFilter, mFilterPartitionsFrequencyDomain.row( filterIdx ),
                    mFilterPartitionsFrequencyDomain.numberOfColumns(),
                    std::min( alignment, mComplexAlignment ) );
+  updateFilterPartitionCount( filterIdx );
+}
+
+template< typename SampleType >
+void CoreConvolverUniform<SampleType>::updateFilterPartitionCount( std::size_t filterIdx )
+{
+  // The transform of an all-zero block is exactly zero, so a comparison with zero is sufficient.
+  FrequencyDomainType const zero( static_cast<SampleType>(0.0) );
+  std::size_t const dftRepresentationSize = calculateDftRepresentationSize( blockLength() ); // Padding is not evaluated.
+  std::size_t numPartitions = mNumberOfFilterPartitions;
+  while( numPartitions > 0 )
+  {
+    FrequencyDomainType const * const partition = getFdFilterPartition( filterIdx, numPartitions - 1 );
+    if( std::any_of( partition, partition + dftRepresentationSize,
+                     [zero]( FrequencyDomainType const & val ) { return val != zero; } ) )
+    {
+      break;
+    }
+    --numPartitions;
+  }
+  mFilterPartitionCounts[filterIdx] = numPartitions;
 }
 
 // explicit instantiations
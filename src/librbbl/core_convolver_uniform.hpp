@@ -16,12 +16,16 @@
 #include <initializer_list>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace visr
 {
 namespace rbbl
 {
+// Forward declaration
+template< typename SampleType >
+class FilterBankFile;
 
 /**
  * Base class for MIMO convolution using a uniformly partioned fast convolution algorithm.
@@ -91,6 +95,17 @@ public:
 
   std::size_t numberOfFilterPartitions() const { return mNumberOfFilterPartitions; }
 
+  /**
+   * Return the number of partitions of the filter \p filterIdx up to (and including) the last nonzero partition.
+   * Only these partitions are evaluated in processFilter(), so short filters in a convolver sized for long filters
+   * do not incur the cost of the maximum filter length.
+   */
+  std::size_t filterPartitionCount( std::size_t filterIdx ) const
+  {
+    assert( filterIdx < mFilterPartitionCounts.size() );
+    return mFilterPartitionCounts[filterIdx];
+  }
+
   /**
    * Return the size of the frequency-domain filter representation (in complex elements )
    */
@@ -100,6 +115,22 @@ public:
 
   std::size_t maxFilterLength() const { return mMaxFilterLength; }
 
+  /**
+   * The name of the FFT implementation as passed to the constructor.
+   */
+  std::string const & fftImplementation() const { return mFftImplementation; }
+
+  /**
+   * The name of the FFT library in use, with aliases such as "default" resolved.
+   */
+  char const * fftLibrary() const { return mFftRepresentation->name(); }
+
+  /**
+   * The factor applied to the impulse responses before the forward transform to compensate for the normalisation
+   * of the FFT library.
+   */
+  SampleType filterScalingFactor() const { return mFilterScalingFactor; }
+
   /**
   * Manipulation of the contained filter representation.
   */
@@ -120,9 +151,41 @@ public:
    */
   void initFilters( efl::BasicMatrix<SampleType> const & newFilters );
 
+  /**
+   * Load a new set of filters from a filter bank file, resetting all prior loaded filters.
+   * If the file contains a frequency-domain representation that has been computed for the block length, the FFT
+   * library and the filter scaling of this object, it is copied directly. Otherwise the impulse responses are
+   * transformed.
+   * @param filterBank The opened filter bank file.
+   * @throw std::invalid_argument If the number of filters exceeds the maximum admissible number of filters.
+   * @throw std::invalid_argumeent If the length of the filters exceeds the maximum admissible length,
+   */
+  void initFilters( FilterBankFile<SampleType> const & filterBank );
+
   void setImpulseResponse( SampleType const * ir, std::size_t filterLength, std::size_t filterIdx, std::size_t alignment = 0 );
 
-  void processInputs( SampleType const * const input, std::size_t channelStride, std::size_t alignment );
+  /**
+   * Transform a block of input samples and insert it into the frequency-domain delay line.
+   * @param input Base pointer to the input samples.
+   * @param channelStride Distance between the samples of consecutive channels.
+   * @param alignment Alignment of the input samples, in samples.
+   * @param silentInputs Optional array of flags for all inputs denoting whether the current block of the input
+   * is silent. If the input was also silent in the previous block, the frequency-domain block is zeroed instead of
+   * being transformed, and processFilter() skips the partitions containing zero blocks. If \p nullptr, all inputs
+   * are transformed.
+   */
+  void processInputs( SampleType const * const input, std::size_t channelStride, std::size_t alignment,
+                      bool const * silentInputs = nullptr );
+
+  /**
+   * Query whether the frequency-domain delay line of an input contains only zeros, i.e., whether
+   * the input has been silent for a period exceeding the maximum filter length.
+   * In this case, processFilter() produces a zero result for this input.
+   */
+  bool inputDecayed( std::size_t inputIndex ) const
+  {
+    return mSilentInputBlocks[inputIndex] > mNumberOfFilterPartitions;
+  }
 
   /**
    * Perform the frequency-domain block convolution for the combination of an input and a filter.
@@ -198,6 +261,11 @@ public:
    */
   void transformImpulseResponse( SampleType const * ir, std::size_t irLength, FrequencyDomainType * result, std::size_t alignment = 0 ) const;
 private:
+  /**
+   * Determine the number of partitions up to the last nonzero partition of a stored filter and update
+   * mFilterPartitionCounts accordingly. To be called whenever a filter has been changed.
+   */
+  void updateFilterPartitionCount( std::size_t filterIdx );
 
   /**
   * Return the number of complex values to represent the frequency-domain DFT representation.
@@ -243,6 +311,12 @@ private:
    */
   std::size_t mFdlCycleOffset;
 
+  /**
+   * Number of consecutive silent input blocks per input, saturated at mNumberOfFilterPartitions+1.
+   * A value of N > 0 means that the N-1 most recent blocks of the frequency-domain delay line are zero.
+   */
+  std::vector<std::size_t> mSilentInputBlocks;
+
   /**
    * Temporary memory buffer for transforming filter partitions and holding the results of
    * the inverse transformation.
@@ -252,11 +326,18 @@ private:
 
   efl::BasicMatrix<std::complex<SampleType> > mFilterPartitionsFrequencyDomain;
 
+  /**
+   * The number of partitions up to the last nonzero partition for each stored filter.
+   */
+  std::vector<std::size_t> mFilterPartitionCounts;
+
   /**
    * Temporarily used buffer to accumulate the results of a frequency-domain block convolution.
    */
   efl::BasicVector<std::complex<SampleType> > mFrequencyDomainAccumulator;
 
+  std::string const mFftImplementation;
+
   std::unique_ptr<rbbl::FftWrapperBase<SampleType> > mFftRepresentation;
 
   /**
@@ -4,6 +4,8 @@
 
 #include <libefl/vector_functions.hpp>
 
+#include <algorithm>
+#include <ciso646>
 #include <complex>
 #include <stdexcept>
 
@@ -33,7 +35,7 @@ CrossfadingConvolverUniform< SampleType >::CrossfadingConvolverUniform(
                    alignment,
                    fftImplementation )
  , mMaxNumberOfRoutingPoints( maxRoutingPoints )
- , mFrequencyDomainOutput( 2,
+ , mFrequencyDomainOutput( 3,
                            mCoreConvolver.dftBlockRepresentationSize(),
                            mCoreConvolver.complexAlignment() )
  , mTimeDomainTempOutput( 2, blockLength, alignment )
@@ -105,68 +107,103 @@ void CrossfadingConvolverUniform< SampleType >::processOutputs(
     std::size_t alignment /*= 0*/ )
 {
   std::size_t const blockSize{ blockLength() };
-  // Zero all time-domain outputs beforehand.
-  // Another solution would be to keep track results written to the outputs, and
-  // to zero, copy or add the buffers as appropriate.
-  for( std::size_t outputIdx( 0 ); outputIdx < numberOfOutputs(); ++outputIdx )
-  {
-    efl::vectorZero( output + outputIdx * outputChannelStride, blockSize,
-                     alignment );
-  }
+  std::size_t const outputAlignment =
+      std::min( alignment, mCoreConvolver.alignment() );
+  std::size_t const coreAlignment = mCoreConvolver.alignment();
 
-  for( RoutingEntry const & routing: mRoutingTable )
+  // The routing table is ordered by output indices, so the routings of each
+  // output form a contiguous range.
+  typename RoutingTable::const_iterator groupBegin = mRoutingTable.begin();
+  for( std::size_t outputIdx( 0 ); outputIdx < numberOfOutputs(); ++outputIdx )
   {
-    // Find the current fade-in and fade-out filters.
-    std::size_t const fadeInFilterIdx =
-        ( mCurrentFilterOutput[ routing.filterIdx ] ) == 0
-            ? routing.filterIdx
-            : routing.filterIdx + mMaxNumFilters;
-    std::size_t const fadeOutFilterIdx =
-        ( mCurrentFilterOutput[ routing.filterIdx ] ) == 0
-            ? routing.filterIdx + mMaxNumFilters
-            : routing.filterIdx;
-
-    mCoreConvolver.processFilter(
-        routing.inputIdx, fadeInFilterIdx, routing.gainLinear,
-        mFrequencyDomainOutput.row( 0 ), false /* add flag */ );
-    mCoreConvolver.processFilter(
-        routing.inputIdx, fadeOutFilterIdx, routing.gainLinear,
-        mFrequencyDomainOutput.row( 1 ), false /* add flag */ );
-    mCoreConvolver.transformOutput( mFrequencyDomainOutput.row( 0 ),
-                                    mTimeDomainTempOutput.row( 0 ) );
-    mCoreConvolver.transformOutput( mFrequencyDomainOutput.row( 1 ),
-                                    mTimeDomainTempOutput.row( 1 ) );
-
-    std::size_t const outputAlignment =
-        std::min( alignment, mCoreConvolver.alignment() );
-    std::size_t const coreAlignment = mCoreConvolver.alignment();
+    SampleType * const outputSignal = output + outputIdx * outputChannelStride;
+    typename RoutingTable::const_iterator groupEnd = groupBegin;
+    while( ( groupEnd != mRoutingTable.end() ) and
+           ( groupEnd->outputIdx == outputIdx ) )
+    {
+      ++groupEnd;
+    }
 
-    efl::ErrorCode res;
-    std::size_t const rampBlock = mCurrentRampBlock[ routing.filterIdx ];
-    if( ( res = efl::vectorMultiplyInplace(
-              mCrossoverRamps.row( 0 ) + rampBlock * blockSize,
-              mTimeDomainTempOutput.row( 0 ), blockSize, coreAlignment ) ) !=
-        efl::noError )
+    // Routings without an active crossfade use only the current filter.
+    // Their contributions are accumulated in the frequency domain, requiring a
+    // single inverse transform per output.
+    bool steadyStateRoutings = false;
+    for( typename RoutingTable::const_iterator routingIt = groupBegin;
+         routingIt != groupEnd; ++routingIt )
+    {
+      if( not transitionActive( routingIt->filterIdx ) )
+      {
+        mCoreConvolver.processFilter(
+            routingIt->inputIdx, currentFilterIndex( routingIt->filterIdx ),
+            routingIt->gainLinear, mFrequencyDomainOutput.row( 2 ),
+            steadyStateRoutings /* add flag */ );
+        steadyStateRoutings = true;
+      }
+    }
+    if( steadyStateRoutings )
     {
-      throw std::runtime_error(
-          "CrossfadingConvolver: Multiplication with fade-in ramp failed." );
+      mCoreConvolver.transformOutput( mFrequencyDomainOutput.row( 2 ),
+                                      outputSignal );
     }
-    if( ( res = efl::vectorMultiplyAddInplace(
-              mCrossoverRamps.row( 1 ) + rampBlock * blockSize,
-              mTimeDomainTempOutput.row( 1 ), mTimeDomainTempOutput.row( 0 ),
-              blockSize, coreAlignment ) ) != efl::noError )
+    else
     {
-      throw std::runtime_error(
-          "CrossfadingConvolver: Multiplication with fade-out ramp failed." );
+      efl::vectorZero( outputSignal, blockSize, alignment );
     }
-    if( ( res = efl::vectorAddInplace(
-              mTimeDomainTempOutput.row( 0 ),
-              output + routing.outputIdx * outputChannelStride, blockSize,
-              outputAlignment ) ) != efl::noError )
+
+    // Routings with an active crossfade filter the signal with the fade-in and
+    // the fade-out filter and apply the crossfade ramps in the time domain.
+    for( typename RoutingTable::const_iterator routingIt = groupBegin;
+         routingIt != groupEnd; ++routingIt )
     {
-      throw std::runtime_error(
-          "CrossfadingConvolver: Adding to output signal failed.." );
+      RoutingEntry const & routing = *routingIt;
+      if( not transitionActive( routing.filterIdx ) )
+      {
+        continue;
+      }
+      std::size_t const fadeInFilterIdx = currentFilterIndex( routing.filterIdx );
+      std::size_t const fadeOutFilterIdx =
+          ( fadeInFilterIdx == routing.filterIdx )
+              ? routing.filterIdx + mMaxNumFilters
+              : routing.filterIdx;
+
+      mCoreConvolver.processFilter(
+          routing.inputIdx, fadeInFilterIdx, routing.gainLinear,
+          mFrequencyDomainOutput.row( 0 ), false /* add flag */ );
+      mCoreConvolver.processFilter(
+          routing.inputIdx, fadeOutFilterIdx, routing.gainLinear,
+          mFrequencyDomainOutput.row( 1 ), false /* add flag */ );
+      mCoreConvolver.transformOutput( mFrequencyDomainOutput.row( 0 ),
+                                      mTimeDomainTempOutput.row( 0 ) );
+      mCoreConvolver.transformOutput( mFrequencyDomainOutput.row( 1 ),
+                                      mTimeDomainTempOutput.row( 1 ) );
+
+      efl::ErrorCode res;
+      std::size_t const rampBlock = mCurrentRampBlock[ routing.filterIdx ];
+      if( ( res = efl::vectorMultiplyInplace(
+                mCrossoverRamps.row( 0 ) + rampBlock * blockSize,
+                mTimeDomainTempOutput.row( 0 ), blockSize, coreAlignment ) ) !=
+          efl::noError )
+      {
+        throw std::runtime_error(
+            "CrossfadingConvolver: Multiplication with fade-in ramp failed." );
+      }
+      if( ( res = efl::vectorMultiplyAddInplace(
+                mCrossoverRamps.row( 1 ) + rampBlock * blockSize,
+                mTimeDomainTempOutput.row( 1 ), mTimeDomainTempOutput.row( 0 ),
+                blockSize, coreAlignment ) ) != efl::noError )
+      {
+        throw std::runtime_error(
+            "CrossfadingConvolver: Multiplication with fade-out ramp failed." );
+      }
+      if( ( res = efl::vectorAddInplace( mTimeDomainTempOutput.row( 0 ),
+                                         outputSignal, blockSize,
+                                         outputAlignment ) ) != efl::noError )
+      {
+        throw std::runtime_error(
+            "CrossfadingConvolver: Adding to output signal failed.." );
+      }
     }
+    groupBegin = groupEnd;
   }
 
   // Advance the ramp counters
@@ -270,6 +270,25 @@ private:
                        std::size_t outputChannelStride,
                        std::size_t alignment );
 
+  /**
+   * Whether a crossfade is currently running for the filter \p filterIdx.
+   */
+  bool transitionActive( std::size_t filterIdx ) const
+  {
+    return mCurrentRampBlock[ filterIdx ] < mNumRampBlocks - 1;
+  }
+
+  /**
+   * Return the index within the core convolver of the current (i.e., fade-in)
+   * filter for the filter \p filterIdx.
+   */
+  std::size_t currentFilterIndex( std::size_t filterIdx ) const
+  {
+    return ( mCurrentFilterOutput[ filterIdx ] == 0 )
+               ? filterIdx
+               : filterIdx + mMaxNumFilters;
+  }
+
   CoreConvolverUniform< SampleType > mCoreConvolver;
 
   struct RoutingEntry
@@ -313,7 +332,10 @@ private:
   std::size_t const mMaxNumberOfRoutingPoints;
 
   /**
-   * Dimension: 2 x dftRepresentationSize
+   * Dimension: 3 x dftRepresentationSize
+   * Rows 0 and 1 hold the fade-in and fade-out results of a routing with an
+   * active crossfade, row 2 accumulates the results of all routings of an
+   * output that are not in a crossfade.
    */
   efl::BasicMatrix<
       typename CoreConvolverUniform< SampleType >::FrequencyDomainType >
@@ -30,6 +30,13 @@ public:
   virtual DataType forwardScalingFactor() const = 0;
 
   virtual DataType inverseScalingFactor( ) const = 0;
+
+  /**
+   * Return the name of the FFT library encapsulated by the wrapper.
+   * In contrast to the name passed to FftWrapperFactory::create(), this is never an alias such as "default", so it
+   * identifies the format of the transformed data.
+   */
+  virtual char const * name() const = 0;
 };
 
 } // namespace rbbl
@@ -49,6 +49,8 @@ public:
 
   /*virtual*/ DataType inverseScalingFactor() const override { return static_cast<DataType>(1.0); }
 
+  /*virtual*/ char const * name() const override { return "ffts"; }
+
 private:
   /**
    * Internal implementation object to avoid FFTS dependencies in the header.
@@ -0,0 +1,300 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "filter_bank_file.hpp"
+
+#include "core_convolver_uniform.hpp"
+
+#include <libefl/alignment.hpp>
+#include <libefl/basic_vector.hpp>
+
+#include <libvisr/detail/compose_message_string.hpp>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <algorithm>
+#include <array>
+#include <ciso646>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace visr
+{
+namespace rbbl
+{
+
+namespace // unnamed
+{
+
+/**
+ * Layout of the file header.
+ * The header consists of an 8-byte identifier, a sequence of 64-bit unsigned integer fields (indexed by the
+ * HeaderField enumeration), and a zero-terminated string naming the FFT library. It is padded to
+ * cHeaderSize bytes.
+ */
+//@{
+char const cMagic[8] = { 'V', 'I', 'S', 'R', 'F', 'B', 'N', 'K' };
+
+std::uint64_t const cFormatVersion = 2;
+
+/**
+ * Value written in the native byte order to detect files written on platforms with a different endianness.
+ */
+std::uint64_t const cByteOrderMark = 0x0102030405060708ull;
+
+enum HeaderField
+{
+  Version = 0,
+  SampleSize,
+  ByteOrder,
+  NumberOfFilters,
+  FilterLength,
+  FilterStride,
+  FilterOffset,
+  BlockLength,
+  NumberOfPartitions,
+  PartitionStride,
+  FrequencyDomainFilterStride,
+  FrequencyDomainOffset,
+  FilterScalingFactor, ///< Bit pattern of a double value.
+  FileSize,
+  NumberOfHeaderFields
+};
+
+std::size_t const cFftNameLength = 64;
+
+std::size_t const cHeaderSize = 256;
+
+static_assert( sizeof(cMagic) + NumberOfHeaderFields * sizeof(std::uint64_t) + cFftNameLength <= cHeaderSize,
+               "Header fields exceed the reserved header size." );
+//@}
+
+void writePadding( std::ofstream & stream, std::size_t numBytes )
+{
+  static std::array<char, 256> const zeros{};
+  while( numBytes > 0 )
+  {
+    std::size_t const chunk = std::min( numBytes, zeros.size() );
+    stream.write( zeros.data(), chunk );
+    numBytes -= chunk;
+  }
+}
+
+} // unnamed namespace
+
+template< typename SampleType >
+class FilterBankFile<SampleType>::Mapping
+{
+public:
+  explicit Mapping( std::string const & fileName )
+   : mFile( fileName.c_str(), boost::interprocess::read_only )
+   , mRegion( mFile, boost::interprocess::read_only )
+  {
+  }
+
+  char const * data() const { return static_cast<char const *>(mRegion.get_address()); }
+
+  std::size_t size() const { return mRegion.get_size(); }
+private:
+  boost::interprocess::file_mapping mFile;
+  boost::interprocess::mapped_region mRegion;
+};
+
+template< typename SampleType >
+constexpr std::size_t FilterBankFile<SampleType>::cDataAlignmentBytes;
+
+template< typename SampleType >
+FilterBankFile<SampleType>::FilterBankFile( std::string const & fileName )
+ : mFilterData( nullptr )
+ , mFilterScalingFactor( 0.0 )
+ , mFrequencyDomainData( nullptr )
+{
+  try
+  {
+    mMapping.reset( new Mapping( fileName ) );
+  }
+  catch( boost::interprocess::interprocess_exception const & ex )
+  {
+    throw std::invalid_argument( detail::composeMessageString( "FilterBankFile: Cannot open file \"", fileName,
+      "\": ", ex.what() ) );
+  }
+  char const * const base = mMapping->data();
+  std::size_t const fileSize = mMapping->size();
+  if( (fileSize < cHeaderSize) or (std::memcmp( base, cMagic, sizeof(cMagic) ) != 0) )
+  {
+    throw std::invalid_argument( detail::composeMessageString( "FilterBankFile: \"", fileName,
+      "\" is not a filter bank file." ) );
+  }
+  std::array<std::uint64_t, NumberOfHeaderFields> header;
+  std::memcpy( header.data(), base + sizeof(cMagic), sizeof(header) );
+  if( header[ByteOrder] != cByteOrderMark )
+  {
+    throw std::invalid_argument( "FilterBankFile: The file has been written on a platform with a different byte order." );
+  }
+  if( header[Version] != cFormatVersion )
+  {
+    throw std::invalid_argument( detail::composeMessageString( "FilterBankFile: Unsupported format version ",
+      header[Version], "." ) );
+  }
+  if( header[SampleSize] != sizeof(SampleType) )
+  {
+    throw std::invalid_argument( "FilterBankFile: The sample type of the file does not match." );
+  }
+  if( header[FileSize] != fileSize )
+  {
+    throw std::invalid_argument( "FilterBankFile: The file is truncated or corrupt." );
+  }
+  char fftName[cFftNameLength];
+  std::memcpy( fftName, base + sizeof(cMagic) + sizeof(header), cFftNameLength );
+  fftName[cFftNameLength-1] = '\0';
+
+  mNumberOfFilters = static_cast<std::size_t>(header[NumberOfFilters]);
+  mFilterLength = static_cast<std::size_t>(header[FilterLength]);
+  mFilterStride = static_cast<std::size_t>(header[FilterStride]);
+  mBlockLength = static_cast<std::size_t>(header[BlockLength]);
+  mFftImplementation = fftName;
+  std::memcpy( &mFilterScalingFactor, &header[FilterScalingFactor], sizeof(mFilterScalingFactor) );
+  mNumberOfPartitions = static_cast<std::size_t>(header[NumberOfPartitions]);
+  mPartitionStride = static_cast<std::size_t>(header[PartitionStride]);
+  mFrequencyDomainFilterStride = static_cast<std::size_t>(header[FrequencyDomainFilterStride]);
+
+  // Check that all data sections lie within the file. The divisions avoid overflows for corrupt header values.
+  std::uint64_t const filterOffset = header[FilterOffset];
+  if( (mFilterStride < mFilterLength) or (filterOffset % cDataAlignmentBytes != 0) or (filterOffset > fileSize)
+    or ((mFilterStride != 0)
+      and (mNumberOfFilters > (fileSize - filterOffset) / (mFilterStride * sizeof(SampleType)))) )
+  {
+    throw std::invalid_argument( "FilterBankFile: Inconsistent time-domain filter section." );
+  }
+  mFilterData = reinterpret_cast<SampleType const *>(base + filterOffset);
+  if( hasFrequencyDomainData() )
+  {
+    std::uint64_t const fdOffset = header[FrequencyDomainOffset];
+    if( (mFrequencyDomainFilterStride < mNumberOfPartitions * mPartitionStride) or (mPartitionStride < mBlockLength + 1)
+      or (fdOffset % cDataAlignmentBytes != 0) or (fdOffset > fileSize)
+      or (mNumberOfFilters > (fileSize - fdOffset) / (mFrequencyDomainFilterStride * sizeof(FrequencyDomainType))) )
+    {
+      throw std::invalid_argument( "FilterBankFile: Inconsistent frequency-domain filter section." );
+    }
+    mFrequencyDomainData = reinterpret_cast<FrequencyDomainType const *>(base + fdOffset);
+  }
+}
+
+template< typename SampleType >
+FilterBankFile<SampleType>::~FilterBankFile() = default;
+
+template< typename SampleType >
+SampleType const * FilterBankFile<SampleType>::filter( std::size_t filterIdx ) const
+{
+  if( filterIdx >= mNumberOfFilters )
+  {
+    throw std::out_of_range( "FilterBankFile::filter(): Filter index exceeds the number of filters." );
+  }
+  return mFilterData + filterIdx * mFilterStride;
+}
+
+template< typename SampleType >
+typename FilterBankFile<SampleType>::FrequencyDomainType const *
+FilterBankFile<SampleType>::frequencyDomainFilter( std::size_t filterIdx ) const
+{
+  if( not hasFrequencyDomainData() )
+  {
+    throw std::logic_error( "FilterBankFile::frequencyDomainFilter(): The file contains no frequency-domain data." );
+  }
+  if( filterIdx >= mNumberOfFilters )
+  {
+    throw std::out_of_range( "FilterBankFile::frequencyDomainFilter(): Filter index exceeds the number of filters." );
+  }
+  return mFrequencyDomainData + filterIdx * mFrequencyDomainFilterStride;
+}
+
+template< typename SampleType >
+/*static*/ void FilterBankFile<SampleType>::write( std::string const & fileName,
+                                                   efl::BasicMatrix<SampleType> const & filters,
+                                                   std::size_t blockLength /*= 0*/,
+                                                   char const * fftImplementation /*= "default"*/ )
+{
+  std::size_t const alignElements = cDataAlignmentBytes / sizeof(SampleType);
+  std::size_t const numFilters = filters.numberOfRows();
+  std::size_t const filterLength = filters.numberOfColumns();
+  std::size_t const filterStride = efl::nextAlignedSize( filterLength, alignElements );
+  std::size_t const filterSectionSize = numFilters * filterStride * sizeof(SampleType);
+
+  // The frequency-domain representation is computed by a convolver configured with the file's data alignment,
+  // which results in aligned partitions.
+  std::unique_ptr<CoreConvolverUniform<SampleType> > convolver;
+  if( (blockLength > 0) and (filterLength > 0) )
+  {
+    convolver.reset( new CoreConvolverUniform<SampleType>( 1, 1, blockLength, filterLength, 1,
+      efl::BasicMatrix<SampleType>(), alignElements, fftImplementation ) );
+  }
+  std::size_t const numPartitions = convolver ? convolver->numberOfFilterPartitions() : 0;
+  std::size_t const partitionStride = convolver ? convolver->dftBlockRepresentationSize() : 0;
+  std::size_t const fdFilterStride = convolver ? convolver->dftFilterRepresentationSize() : 0;
+
+  std::array<std::uint64_t, NumberOfHeaderFields> header{};
+  header[Version] = cFormatVersion;
+  header[SampleSize] = sizeof(SampleType);
+  header[ByteOrder] = cByteOrderMark;
+  header[NumberOfFilters] = numFilters;
+  header[FilterLength] = filterLength;
+  header[FilterStride] = filterStride;
+  header[FilterOffset] = cHeaderSize;
+  header[BlockLength] = convolver ? blockLength : 0;
+  header[NumberOfPartitions] = numPartitions;
+  header[PartitionStride] = partitionStride;
+  header[FrequencyDomainFilterStride] = fdFilterStride;
+  header[FrequencyDomainOffset] = convolver ? cHeaderSize + filterSectionSize : 0;
+  double const scalingFactor = convolver ? static_cast<double>( convolver->filterScalingFactor() ) : 0.0;
+  static_assert( sizeof(scalingFactor) == sizeof(std::uint64_t), "Unexpected size of type double." );
+  std::memcpy( &header[FilterScalingFactor], &scalingFactor, sizeof(scalingFactor) );
+  header[FileSize] = cHeaderSize + filterSectionSize
+    + numFilters * fdFilterStride * sizeof(typename CoreConvolverUniform<SampleType>::FrequencyDomainType);
+
+  std::ofstream stream( fileName, std::ios::binary | std::ios::trunc );
+  if( not stream )
+  {
+    throw std::invalid_argument( detail::composeMessageString( "FilterBankFile::write(): Cannot open file \"",
+      fileName, "\" for writing." ) );
+  }
+  char fftName[cFftNameLength] = {};
+  std::strncpy( fftName, convolver ? convolver->fftLibrary() : "", cFftNameLength - 1 );
+  stream.write( cMagic, sizeof(cMagic) );
+  stream.write( reinterpret_cast<char const *>(header.data()), sizeof(header) );
+  stream.write( fftName, cFftNameLength );
+  writePadding( stream, cHeaderSize - sizeof(cMagic) - sizeof(header) - cFftNameLength );
+
+  for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+  {
+    stream.write( reinterpret_cast<char const *>(filters.row( filterIdx )), filterLength * sizeof(SampleType) );
+    writePadding( stream, (filterStride - filterLength) * sizeof(SampleType) );
+  }
+  if( convolver )
+  {
+    efl::BasicVector<typename CoreConvolverUniform<SampleType>::FrequencyDomainType>
+      transformed( fdFilterStride, convolver->complexAlignment() );
+    for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+    {
+      transformed.zeroFill(); // Ensures a deterministic content of the padding elements.
+      convolver->transformImpulseResponse( filters.row( filterIdx ), filterLength, transformed.data(),
+                                           filters.alignmentElements() );
+      stream.write( reinterpret_cast<char const *>(transformed.data()),
+                    fdFilterStride * sizeof(typename CoreConvolverUniform<SampleType>::FrequencyDomainType) );
+    }
+  }
+  if( not stream )
+  {
+    throw std::invalid_argument( detail::composeMessageString( "FilterBankFile::write(): Error while writing file \"",
+      fileName, "\"." ) );
+  }
+}
+
+// Explicit instantiations
+template class FilterBankFile<float>;
+template class FilterBankFile<double>;
+
+} // namespace rbbl
+} // namespace visr
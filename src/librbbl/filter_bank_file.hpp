@@ -0,0 +1,168 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRBBL_FILTER_BANK_FILE_HPP_INCLUDED
+#define VISR_LIBRBBL_FILTER_BANK_FILE_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+
+#include <libefl/basic_matrix.hpp>
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace visr
+{
+namespace rbbl
+{
+
+/**
+ * Read-only access to a binary filter bank file, which stores a set of FIR filters in a compact form that can be
+ * used without parsing or conversion.
+ * The file is memory-mapped, so opening a file is cheap and the data is paged in on first access.
+ * A filter bank file contains the time-domain impulse responses and, optionally, their frequency-domain
+ * representation as used by CoreConvolverUniform for a specific block length and FFT library. If the latter
+ * matches the configuration of a convolver, the filters can be loaded without any FFT operations
+ * (see CoreConvolverUniform::initFilters()).
+ * All data sections are aligned to cDataAlignmentBytes, and the data is stored in the native byte order.
+ * @tparam SampleType The floating-point type of the filter coefficients.
+ */
+template< typename SampleType >
+class VISR_RBBL_LIBRARY_SYMBOL FilterBankFile
+{
+public:
+  using FrequencyDomainType = std::complex<SampleType>;
+
+  /**
+   * The alignment of all data sections and filter rows within the file, in bytes.
+   */
+  static constexpr std::size_t cDataAlignmentBytes = 64;
+
+  /**
+   * Open and map a filter bank file.
+   * @param fileName The path of the file.
+   * @throw std::invalid_argument If the file cannot be opened, is not a filter bank file, is inconsistent, or has
+   * been written for a different sample type or byte order.
+   */
+  explicit FilterBankFile( std::string const & fileName );
+
+  /**
+   * Destructor, unmaps the file.
+   */
+  ~FilterBankFile();
+
+  FilterBankFile( FilterBankFile const & ) = delete;
+
+  FilterBankFile & operator=( FilterBankFile const & ) = delete;
+
+  std::size_t numberOfFilters() const { return mNumberOfFilters; }
+
+  std::size_t filterLength() const { return mFilterLength; }
+
+  /**
+   * The distance between the start of consecutive time-domain filters, in samples.
+   */
+  std::size_t filterStride() const { return mFilterStride; }
+
+  /**
+   * The guaranteed alignment of the time-domain filters, in samples.
+   */
+  std::size_t alignmentElements() const { return cDataAlignmentBytes / sizeof( SampleType ); }
+
+  /**
+   * Return a pointer to the time-domain coefficients of a filter.
+   * @throw std::out_of_range If \p filterIdx exceeds the number of filters.
+   */
+  SampleType const * filter( std::size_t filterIdx ) const;
+
+  /**
+   * Whether the file contains a frequency-domain representation of the filters.
+   */
+  bool hasFrequencyDomainData() const { return mBlockLength != 0; }
+
+  /**
+   * The block length of the frequency-domain representation, 0 if there is none.
+   */
+  std::size_t blockLength() const { return mBlockLength; }
+
+  /**
+   * The FFT library used to compute the frequency-domain representation (see FftWrapperBase::name()).
+   * Aliases like "default" are resolved when the file is written, because they might denote different libraries
+   * on different platforms or builds.
+   */
+  std::string const & fftImplementation() const { return mFftImplementation; }
+
+  /**
+   * The scaling factor applied to the impulse responses before the transform into the frequency domain, 0 if the file
+   * contains no frequency-domain data (see CoreConvolverUniform::filterScalingFactor()).
+   */
+  double filterScalingFactor() const { return mFilterScalingFactor; }
+
+  std::size_t numberOfPartitions() const { return mNumberOfPartitions; }
+
+  /**
+   * The distance between consecutive frequency-domain partitions of a filter, in complex elements.
+   */
+  std::size_t partitionStride() const { return mPartitionStride; }
+
+  /**
+   * Return a pointer to the first partition of the frequency-domain representation of a filter.
+   * @throw std::logic_error If the file contains no frequency-domain data.
+   * @throw std::out_of_range If \p filterIdx exceeds the number of filters.
+   */
+  FrequencyDomainType const * frequencyDomainFilter( std::size_t filterIdx ) const;
+
+  /**
+   * Write a filter bank file.
+   * @param fileName The path of the file to be created. An existing file is overwritten.
+   * @param filters The filters, each matrix row represents one filter.
+   * @param blockLength If nonzero, the frequency-domain representation of the filters for a CoreConvolverUniform
+   * with this block length is written in addition to the impulse responses.
+   * @param fftImplementation The FFT implementation for computing the frequency-domain representation. The data is used
+   * only by convolvers using the same FFT library.
+   * @throw std::invalid_argument If the file cannot be written.
+   */
+  static void write( std::string const & fileName,
+                     efl::BasicMatrix<SampleType> const & filters,
+                     std::size_t blockLength = 0,
+                     char const * fftImplementation = "default" );
+
+private:
+  /**
+   * Opaque holder of the mapped memory region.
+   */
+  class Mapping;
+
+  std::unique_ptr<Mapping> mMapping;
+
+  std::size_t mNumberOfFilters;
+
+  std::size_t mFilterLength;
+
+  std::size_t mFilterStride;
+
+  SampleType const * mFilterData;
+
+  std::size_t mBlockLength;
+
+  std::string mFftImplementation;
+
+  double mFilterScalingFactor;
+
+  std::size_t mNumberOfPartitions;
+
+  std::size_t mPartitionStride;
+
+  /**
+   * Distance between the frequency-domain representations of consecutive filters, in complex elements.
+   */
+  std::size_t mFrequencyDomainFilterStride;
+
+  FrequencyDomainType const * mFrequencyDomainData;
+};
+
+} // namespace rbbl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRBBL_FILTER_BANK_FILE_HPP_INCLUDED
@@ -5,7 +5,10 @@
 
 #include "export_symbols.hpp"
 
+#include <array>
+#include <algorithm>
 #include <cstddef>
+#include <stdexcept>
 
 namespace visr
 {
@@ -32,8 +35,88 @@ public:
                             std::size_t numSamples,
                             SampleType startDelay, SampleType endDelay,
                             SampleType startGain, SampleType endGain ) = 0;
+
+  /**
+   * The maximum number of outputs that can be computed in one call to interpolateAccumulate().
+   */
+  static constexpr std::size_t cMaxParallelOutputs = 8;
+
+  /**
+   * Interpolate the same sequence with several individual delay and gain ramps, and add the results to the output
+   * buffers.
+   * Computing several outputs in one pass allows implementations to evaluate the interpolation for all outputs in
+   * parallel, for instance in SIMD registers, and to share the accesses to the input sequence.
+   * The semantics of the delay and gain values are the same as in interpolate().
+   * @param basePointer Pointer to the input sequence, as in interpolate().
+   * @param results Array of \p numOutputs output buffers, each holding \p numSamples values. The interpolation results
+   * are added to their content.
+   * @param numOutputs The number of outputs, must not exceed cMaxParallelOutputs.
+   * @param numSamples The number of samples to be computed for each output.
+   * @param startDelays Array of \p numOutputs start delay values (in samples).
+   * @param endDelays Array of \p numOutputs end delay values (in samples).
+   * @param startGains Array of \p numOutputs start gain values (linear scale).
+   * @param endGains Array of \p numOutputs end gain values (linear scale).
+   * The default implementation calls interpolate() for each output and adds the result. To avoid dynamic memory
+   * allocation, it processes the samples in segments of the size of a fixed scratch buffer, with the delay and gain
+   * ramps split at the segment boundaries. Derived classes should override it with a more efficient implementation.
+   */
+  virtual void interpolateAccumulate( SampleType const * basePointer,
+                                      SampleType * const * results,
+                                      std::size_t numOutputs,
+                                      std::size_t numSamples,
+                                      SampleType const * startDelays, SampleType const * endDelays,
+                                      SampleType const * startGains, SampleType const * endGains );
 };
 
+template <typename SampleType>
+void FractionalDelayBase<SampleType>::interpolateAccumulate( SampleType const * basePointer,
+                                                             SampleType * const * results,
+                                                             std::size_t numOutputs,
+                                                             std::size_t numSamples,
+                                                             SampleType const * startDelays,
+                                                             SampleType const * endDelays,
+                                                             SampleType const * startGains,
+                                                             SampleType const * endGains )
+{
+  if( numOutputs > cMaxParallelOutputs )
+  {
+    throw std::invalid_argument( "FractionalDelayBase::interpolateAccumulate(): number of outputs exceeds maximum admissible number." );
+  }
+  constexpr std::size_t scratchSize = 64;
+  std::array<SampleType, scratchSize> scratch;
+  SampleType const numSteps = static_cast<SampleType>(numSamples);
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    SampleType const delayStep = (endDelays[outIdx] - startDelays[outIdx]) / numSteps;
+    SampleType const gainStep = (endGains[outIdx] - startGains[outIdx]) / numSteps;
+    SampleType * const result = results[outIdx];
+    for( std::size_t segmentStart( 0 ); segmentStart < numSamples; segmentStart += scratchSize )
+    {
+      std::size_t const segmentEnd = std::min( segmentStart + scratchSize, numSamples );
+      // The read positions in interpolate() are relative to the end of the computed block, so the base pointer is
+      // moved back by the number of samples following this segment.
+      SampleType const * const segmentBase = basePointer - (numSamples - segmentEnd);
+      SampleType const segmentStartDelay = segmentStart == 0
+        ? startDelays[outIdx] : startDelays[outIdx] + static_cast<SampleType>(segmentStart) * delayStep;
+      SampleType const segmentEndDelay = segmentEnd == numSamples
+        ? endDelays[outIdx] : startDelays[outIdx] + static_cast<SampleType>(segmentEnd) * delayStep;
+      SampleType const segmentStartGain = segmentStart == 0
+        ? startGains[outIdx] : startGains[outIdx] + static_cast<SampleType>(segmentStart) * gainStep;
+      SampleType const segmentEndGain = segmentEnd == numSamples
+        ? endGains[outIdx] : startGains[outIdx] + static_cast<SampleType>(segmentEnd) * gainStep;
+      interpolate( segmentBase, scratch.data(), segmentEnd - segmentStart,
+                   segmentStartDelay, segmentEndDelay, segmentStartGain, segmentEndGain );
+      for( std::size_t sampleIdx( segmentStart ); sampleIdx < segmentEnd; ++sampleIdx )
+      {
+        result[sampleIdx] += scratch[sampleIdx - segmentStart];
+      }
+    }
+  }
+}
+
+template <typename SampleType>
+constexpr std::size_t FractionalDelayBase<SampleType>::cMaxParallelOutputs;
+
 } // namespace rbbl
 } // namespace visr
   
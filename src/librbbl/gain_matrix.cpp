@@ -2,16 +2,52 @@
 
 #include "gain_matrix.hpp"
 
+#include <libefl/matrix_functions.hpp>
 #include <libefl/vector_functions.hpp>
 
 #include <algorithm>
+#include <ciso646>
 #include <limits>
+#include <stdexcept>
 
 namespace visr
 {
 namespace rbbl
 {
 
+namespace // unnamed
+{
+
+/**
+ * Determine whether a set of channel pointers addresses equidistant, non-overlapping rows of a matrix.
+ * @param[out] stride The distance between consecutive channels, valid only if the function returns \p true.
+ */
+template< typename PointerType >
+bool channelStride( PointerType const * channels, std::size_t numberOfChannels, std::size_t blockLength,
+                    std::size_t & stride )
+{
+  if( numberOfChannels <= 1 )
+  {
+    stride = blockLength;
+    return true;
+  }
+  if( channels[1] < channels[0] + blockLength )
+  {
+    return false;
+  }
+  stride = static_cast<std::size_t>(channels[1] - channels[0]);
+  for( std::size_t chIdx( 2 ); chIdx < numberOfChannels; ++chIdx )
+  {
+    if( channels[chIdx] != channels[0] + chIdx * stride )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // unnamed namespace
+
 template< typename ElementType >
 GainMatrix<ElementType>::GainMatrix( std::size_t numberOfInputs,
                         std::size_t numberOfOutputs,
@@ -21,6 +57,8 @@ GainMatrix<ElementType>::GainMatrix( std::size_t numberOfInputs,
                         std::size_t alignment /*= 0 */ )
  : mPreviousGains( numberOfOutputs, numberOfInputs, alignment )
  , mNextGains( numberOfOutputs, numberOfInputs, alignment )
+ , mActiveGains( numberOfOutputs, numberOfInputs, alignment )
+ , mActiveInputSignals( numberOfInputs, blockLength, alignment )
  , mBlockSize( blockLength )
  , mAlignment( alignment )
  , mInterpolationCounter( 0 )
@@ -28,6 +66,8 @@ GainMatrix<ElementType>::GainMatrix( std::size_t numberOfInputs,
  {
   mPreviousGains.fillValue( initialValue );
   mNextGains.copy( mPreviousGains );
+  // The initial gains are constant, i.e., no transition is active.
+  mInterpolationCounter = mFader.interpolationPeriods();
  }
 
 template< typename ElementType >
@@ -74,6 +114,18 @@ void GainMatrix<ElementType>::process( ElementType const * const * input, Elemen
   process( input, output );
 }
 
+template< typename ElementType >
+void GainMatrix<ElementType>::process( ElementType const * const * input, ElementType * const * output,
+                                       std::size_t const * activeInputs, std::size_t numberOfActiveInputs )
+{
+  processAudio( input, output, activeInputs, numberOfActiveInputs );
+  // advance the interpolation counter
+  if( mInterpolationCounter < mFader.interpolationPeriods() )
+  {
+    ++mInterpolationCounter;
+  }
+}
+
 template< typename ElementType >
 void GainMatrix<ElementType>::setNewGains( efl::BasicMatrix<ElementType> const& newGains )
 {
@@ -82,7 +134,21 @@ void GainMatrix<ElementType>::setNewGains( efl::BasicMatrix<ElementType> const&
   {
     throw std::invalid_argument( "GainMatrix::setNewGains(): Dimension of new gain matrix does not match." );
   }
-  setGainsInternal( newGains );
+  std::size_t const numInputs( mNextGains.numberOfColumns() );
+  for( std::size_t outputIdx( 0 ); outputIdx < mNextGains.numberOfRows(); ++outputIdx )
+  {
+    if( not std::equal( newGains.row( outputIdx ), newGains.row( outputIdx ) + numInputs, mNextGains.row( outputIdx ) ) )
+    {
+      setGainsInternal( newGains );
+      return;
+    }
+  }
+}
+
+template< typename ElementType >
+bool GainMatrix<ElementType>::transitionActive() const
+{
+  return mInterpolationCounter < mFader.interpolationPeriods();
 }
 
 template< typename ElementType >
@@ -104,6 +170,20 @@ void GainMatrix<ElementType>::processAudio( ElementType const * const * input, E
     }
     return;
   }
+  // Outside transitions, the gains are constant. If the input and output channels are rows of matrices, the complete
+  // block is computed as a single matrix product.
+  std::size_t inputStride, outputStride;
+  if( (mInterpolationCounter >= mFader.interpolationPeriods())
+    and channelStride( input, numInputs, mBlockSize, inputStride )
+    and channelStride( output, numOutputs, mBlockSize, outputStride ) )
+  {
+    if( efl::matrixMultiply( mNextGains.data(), input[0], output[0], numOutputs, mBlockSize, numInputs,
+                             mNextGains.stride(), inputStride, outputStride, mAlignment ) != efl::noError )
+    {
+      throw std::runtime_error( "GainMatrix::process(): Matrix multiplication failed." );
+    }
+    return;
+  }
   for( std::size_t outputIdx( 0 ); outputIdx < numOutputs; ++outputIdx )
   {
     ElementType * const outVector = output[outputIdx];
@@ -115,6 +195,57 @@ void GainMatrix<ElementType>::processAudio( ElementType const * const * input, E
   }
 }
 
+template< typename ElementType >
+void GainMatrix<ElementType>::processAudio( ElementType const * const * input, ElementType * const * output,
+                                            std::size_t const * activeInputs, std::size_t numberOfActiveInputs )
+{
+  std::size_t const numOutputs( mPreviousGains.numberOfRows() );
+  std::size_t outputStride;
+  if( (numberOfActiveInputs > 0) and (mInterpolationCounter >= mFader.interpolationPeriods())
+    and channelStride( output, numOutputs, mBlockSize, outputStride ) )
+  {
+    for( std::size_t activeIdx( 0 ); activeIdx < numberOfActiveInputs; ++activeIdx )
+    {
+      std::size_t const inputIdx = activeInputs[activeIdx];
+      if( efl::vectorCopy( input[inputIdx], mActiveInputSignals.row( activeIdx ), mBlockSize, mAlignment ) != efl::noError )
+      {
+        throw std::runtime_error( "GainMatrix::process(): Copying of input vector failed." );
+      }
+      for( std::size_t outputIdx( 0 ); outputIdx < numOutputs; ++outputIdx )
+      {
+        mActiveGains( outputIdx, activeIdx ) = mNextGains( outputIdx, inputIdx );
+      }
+    }
+    if( efl::matrixMultiply( mActiveGains.data(), mActiveInputSignals.data(), output[0], numOutputs, mBlockSize,
+                             numberOfActiveInputs, mActiveGains.stride(), mActiveInputSignals.stride(), outputStride,
+                             mAlignment ) != efl::noError )
+    {
+      throw std::runtime_error( "GainMatrix::process(): Matrix multiplication failed." );
+    }
+    return;
+  }
+  for( std::size_t outputIdx( 0 ); outputIdx < numOutputs; ++outputIdx )
+  {
+    ElementType * const outVector = output[outputIdx];
+    if( numberOfActiveInputs == 0 )
+    {
+      efl::ErrorCode res = efl::vectorZero( outVector, mBlockSize, mAlignment );
+      if( res != efl::noError )
+      {
+        throw std::runtime_error( "GainMatrix::process(): Clearing of output vector failed." );
+      }
+      continue;
+    }
+    std::size_t const firstIdx = activeInputs[0];
+    mFader.scale( input[firstIdx], outVector, mPreviousGains( outputIdx, firstIdx ), mNextGains( outputIdx, firstIdx ), mInterpolationCounter );
+    for( std::size_t activeIdx( 1 ); activeIdx < numberOfActiveInputs; ++activeIdx )
+    {
+      std::size_t const inputIdx = activeInputs[activeIdx];
+      mFader.scaleAndAccumulate( input[inputIdx], outVector, mPreviousGains( outputIdx, inputIdx ), mNextGains( outputIdx, inputIdx ), mInterpolationCounter );
+    }
+  }
+}
+
 template< typename ElementType >
 void GainMatrix<ElementType>::setGainsInternal( efl::BasicMatrix<ElementType> const & newGains )
 {
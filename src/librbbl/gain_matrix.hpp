@@ -69,6 +69,8 @@ public:
    * Process multichannel audio by matrixing the number of \p blockLength samples (specified in the constructor) from each
    * input channel to the range of the output channels. If a new set of gain values has been set previously, the
    * transition to the new value will continue. After that, matrixing will be performed using the new gain values.
+   * If no transition is active and both the input and the output vectors are equidistant rows of a matrix (e.g.,
+   * the channels of an audio port), the operation is performed as a single matrix product (efl::matrixMultiply()).
    * @param input A range of arrays containing the input sample vectors. Must be \p numberOfInputs elements long, and each
    * sample vector must contain at least \p blockLength elements.
    * @param[out] output Range of arrays containing the output sample vectors. Must be \p numberOfOutputs elements long, and each
@@ -92,15 +94,38 @@ public:
   void process( ElementType const * const * input, ElementType * const * output,
                 efl::BasicMatrix<ElementType> const& newGains);
 
+  /**
+   * Process multichannel audio using only a subset of the input channels.
+   * The remaining inputs are treated as silent, i.e., they are not accessed at all. The gain transition state is
+   * advanced as in the other process() overloads, so the subset may change between invocations.
+   * If no transition is active and the output vectors are equidistant rows of a matrix, the active inputs are gathered
+   * into an internal buffer and the output is computed as a single matrix product.
+   * @param input A range of arrays containing the input sample vectors. Must be \p numberOfInputs elements long.
+   * Only the entries listed in \p activeInputs are accessed.
+   * @param[out] output Range of arrays containing the output sample vectors. Must be \p numberOfOutputs elements long.
+   * @param activeInputs Array of the indices of the active inputs, each one must be less than \p numberOfInputs.
+   * @param numberOfActiveInputs The number of elements in \p activeInputs. If zero, all outputs are set to zero.
+   */
+  void process( ElementType const * const * input, ElementType * const * output,
+                std::size_t const * activeInputs, std::size_t numberOfActiveInputs );
+
   /**
    * Set a new gain matrix.
    * If no new set of gain values has been set previously, a transition will start that will change the used gains to the new
    * values over a period of \p interpolationSteps samples. If there is a transition currently active, the current interpolated
    * gains will be used as the starting point of a new transistion process (taking \p interpolationSteps samples).
+   * If \p newGains equals the target gains of the current or the most recent transition, the call has no effect. So the
+   * gains can be passed in every block without restarting the transition.
    * @param newGains The matrix of new gain values, dimension must be \p numerOfInputs * \p numberOfOutputs .
    */
   void setNewGains( efl::BasicMatrix<ElementType> const& newGains );
 
+  /**
+   * Return whether a gain transition is in progress.
+   * Outside transitions, process() computes the output as a matrix product if the channels are equidistant rows of a matrix.
+   */
+  bool transitionActive() const;
+
 private:
   /**
    * Internal implementation method for applying 
@@ -110,6 +135,13 @@ private:
    */
   void processAudio( ElementType const * const * input, ElementType * const * output );
 
+  /**
+   * Internal implementation method for applying the matrix gains to a subset of the input signals.
+   * @see process()
+   */
+  void processAudio( ElementType const * const * input, ElementType * const * output,
+                     std::size_t const * activeInputs, std::size_t numberOfActiveInputs );
+
   /**
    * Internal method for applying a new set of matrix gains.
    * @param newGains The new gain matrix to be set.
@@ -127,6 +159,15 @@ private:
    */
   efl::BasicMatrix< ElementType > mNextGains;
 
+  /**
+   * Scratch buffers holding the gain columns and the signals of the active inputs, used to compute the output
+   * of the subset process() overload as a single matrix product.
+   */
+  //@{
+  efl::BasicMatrix< ElementType > mActiveGains;
+  efl::BasicMatrix< ElementType > mActiveInputSignals;
+  //@}
+
   /**
    * The number of samples processed in each invocation of process.
    */
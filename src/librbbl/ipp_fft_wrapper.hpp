@@ -40,6 +40,8 @@ public:
 
   /*virtual*/ DataType inverseScalingFactor() const override { return static_cast<DataType>(1.0); }
 
+  /*virtual*/ char const * name() const override { return "ipp"; }
+
 private:
   /**
    * Internal implementation object to avoid IPP dependencies in the header.
@@ -7,6 +7,7 @@
 #include <array>
 #include <cmath>
 #include <numeric>
+#include <stdexcept>
 
 namespace visr
 {
@@ -17,7 +18,22 @@ LagrangeInterpolator<SampleType, order >::LagrangeInterpolator( std::size_t maxN
                                                                 std::size_t alignmentElements )
   : mDelays(  maxNumSamples, alignmentElements )
   , mGains( maxNumSamples, alignmentElements )
+  , mParallelResults( maxNumSamples * FractionalDelayBase<SampleType>::cMaxParallelOutputs, alignmentElements )
 {
+  // The basis polynomial for tap m is the product of (x_k-mu)/(x_k-x_m) over all k != m, where the tap positions
+  // x_m = m - order/2 are symmetric around the base sample.
+  for( std::size_t tapIdx( 0 ); tapIdx <= order; ++tapIdx )
+  {
+    SampleType denominator = static_cast<SampleType>(1.0);
+    for( std::size_t otherIdx( 0 ); otherIdx <= order; ++otherIdx )
+    {
+      if( otherIdx != tapIdx )
+      {
+        denominator *= static_cast<SampleType>(otherIdx) - static_cast<SampleType>(tapIdx);
+      }
+    }
+    mBasisWeights[tapIdx] = static_cast<SampleType>(1.0) / denominator;
+  }
 }
 
 template <typename SampleType, std::size_t order >
@@ -86,6 +102,106 @@ void LagrangeInterpolator<SampleType, order>::interpolate( SampleType const * ba
   }
 }
 
+template <typename SampleType, std::size_t order >
+void LagrangeInterpolator<SampleType, order>::interpolateAccumulate( SampleType const * basePointer,
+                                                                     SampleType * const * results,
+                                                                     std::size_t numOutputs,
+                                                                     std::size_t numSamples,
+                                                                     SampleType const * startDelays,
+                                                                     SampleType const * endDelays,
+                                                                     SampleType const * startGains,
+                                                                     SampleType const * endGains )
+{
+  constexpr std::size_t numLanes = FractionalDelayBase<SampleType>::cMaxParallelOutputs;
+  if( numSamples > mDelays.size() )
+  {
+    throw std::invalid_argument( "LagrangeInterpolator::interpolateAccumulate(): number of elements exceeds maximum admissible number.");
+  }
+  if( numOutputs > numLanes )
+  {
+    throw std::invalid_argument( "LagrangeInterpolator::interpolateAccumulate(): number of outputs exceeds maximum admissible number.");
+  }
+  if( numOutputs == 0 )
+  {
+    return;
+  }
+  // Linear ramps for the read positions (relative to the base pointer) and the gains of all outputs, using the same
+  // conventions as interpolate(). Unused lanes duplicate the first output with zero gain, so that they read valid
+  // memory locations.
+  std::array<SampleType, numLanes> startPositions;
+  std::array<SampleType, numLanes> positionSteps;
+  std::array<SampleType, numLanes> gains;
+  std::array<SampleType, numLanes> gainSteps;
+  SampleType const numSteps = static_cast<SampleType>(numSamples);
+  for( std::size_t laneIdx( 0 ); laneIdx < numLanes; ++laneIdx )
+  {
+    std::size_t const outIdx = laneIdx < numOutputs ? laneIdx : 0;
+    startPositions[laneIdx] = -static_cast<SampleType>(numSamples + order) - startDelays[outIdx];
+    positionSteps[laneIdx] = (-static_cast<SampleType>(order) - endDelays[outIdx] - startPositions[laneIdx]) / numSteps;
+    gains[laneIdx] = laneIdx < numOutputs ? startGains[outIdx] : static_cast<SampleType>(0.0);
+    gainSteps[laneIdx] = laneIdx < numOutputs ? (endGains[outIdx] - startGains[outIdx]) / numSteps : static_cast<SampleType>(0.0);
+  }
+  // Fractional tap positions relative to the base sample, x_m = m - order/2.
+  SampleType const halfOrder = static_cast<SampleType>(0.5) * static_cast<SampleType>(order);
+
+  SampleType * parallelResults = mParallelResults.data();
+  for( std::size_t sampleIdx( 0 ); sampleIdx < numSamples; ++sampleIdx )
+  {
+    SampleType const rampIdx = static_cast<SampleType>(sampleIdx + 1);
+    std::array<std::ptrdiff_t, numLanes> baseOffsets;
+    std::array<SampleType, numLanes> mu;
+    for( std::size_t laneIdx( 0 ); laneIdx < numLanes; ++laneIdx )
+    {
+      SampleType const position = startPositions[laneIdx] + rampIdx * positionSteps[laneIdx];
+      std::ptrdiff_t const baseOffset = position > 0
+        ? static_cast<std::ptrdiff_t>( position + static_cast<SampleType>(0.5) )
+        : static_cast<std::ptrdiff_t>( position - static_cast<SampleType>(0.5) );
+      baseOffsets[laneIdx] = baseOffset;
+      mu[laneIdx] = position - static_cast<SampleType>(baseOffset);
+    }
+    // Evaluate the Lagrange basis polynomials of all lanes through prefix and suffix products of (x_k - mu), which
+    // avoids divisions and keeps the lanes independent.
+    std::array<std::array<SampleType, numLanes>, order+1> prefix;
+    std::array<SampleType, numLanes> suffix;
+    std::array<SampleType, numLanes> acc;
+    prefix[0].fill( static_cast<SampleType>(1.0) );
+    for( std::size_t tapIdx( 1 ); tapIdx <= order; ++tapIdx )
+    {
+      SampleType const x = static_cast<SampleType>(tapIdx - 1) - halfOrder;
+      for( std::size_t laneIdx( 0 ); laneIdx < numLanes; ++laneIdx )
+      {
+        prefix[tapIdx][laneIdx] = prefix[tapIdx-1][laneIdx] * (x - mu[laneIdx]);
+      }
+    }
+    suffix.fill( static_cast<SampleType>(1.0) );
+    acc.fill( static_cast<SampleType>(0.0) );
+    for( std::size_t tapIdx( order+1 ); tapIdx-- > 0; )
+    {
+      SampleType const x = static_cast<SampleType>(tapIdx) - halfOrder;
+      SampleType const weight = mBasisWeights[tapIdx];
+      for( std::size_t laneIdx( 0 ); laneIdx < numLanes; ++laneIdx )
+      {
+        acc[laneIdx] += weight * prefix[tapIdx][laneIdx] * suffix[laneIdx]
+          * basePointer[baseOffsets[laneIdx] + static_cast<std::ptrdiff_t>(tapIdx)];
+        suffix[laneIdx] *= x - mu[laneIdx];
+      }
+    }
+    SampleType * const sampleResults = parallelResults + sampleIdx * numLanes;
+    for( std::size_t laneIdx( 0 ); laneIdx < numLanes; ++laneIdx )
+    {
+      sampleResults[laneIdx] = (gains[laneIdx] + rampIdx * gainSteps[laneIdx]) * acc[laneIdx];
+    }
+  }
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    SampleType * const result = results[outIdx];
+    for( std::size_t sampleIdx( 0 ); sampleIdx < numSamples; ++sampleIdx )
+    {
+      result[sampleIdx] += parallelResults[sampleIdx * numLanes + outIdx];
+    }
+  }
+}
+
 // Explicit instantiations
 template class LagrangeInterpolator<float, 0>;
 template class LagrangeInterpolator<float, 1>;
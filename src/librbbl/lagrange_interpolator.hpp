@@ -10,6 +10,7 @@
 #include <libefl/basic_vector.hpp>
 #include <libefl/lagrange_coefficient_calculator.hpp>
 
+#include <array>
 #include <cstddef>
 #include <vector>
 
@@ -44,6 +45,13 @@ public:
                             std::size_t numSamples,
                             SampleType startDelay, SampleType endDelay,
                             SampleType startGain, SampleType endGain ) override;
+
+  void interpolateAccumulate( SampleType const * basePointer,
+                              SampleType * const * results,
+                              std::size_t numOutputs,
+                              std::size_t numSamples,
+                              SampleType const * startDelays, SampleType const * endDelays,
+                              SampleType const * startGains, SampleType const * endGains ) override;
 private:
 
   efl::BasicVector<SampleType> mDelays;
@@ -52,6 +60,17 @@ private:
 
   efl::LagrangeCoefficientCalculator<SampleType, order, true> const mCoeffCalculator;
 
+  /**
+   * Intermediate results of interpolateAccumulate(), stored sample by sample with one element for each of the
+   * FractionalDelayBase::cMaxParallelOutputs outputs.
+   */
+  efl::BasicVector<SampleType> mParallelResults;
+
+  /**
+   * Normalisation factors of the Lagrange basis polynomials, used in interpolateAccumulate().
+   */
+  std::array<SampleType, order+1> mBasisWeights;
+
   /**
    * The method delay in samples, in samples. Literal constant. 
    * @note order == 0 means nearest sample interpolation    */
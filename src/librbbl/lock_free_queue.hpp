@@ -0,0 +1,143 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRBBL_LOCK_FREE_QUEUE_HPP_INCLUDED
+#define VISR_LIBRBBL_LOCK_FREE_QUEUE_HPP_INCLUDED
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+namespace visr
+{
+namespace rbbl
+{
+
+/**
+ * Bounded FIFO queue that can be accessed concurrently by multiple producer and consumer threads without locks.
+ * Each slot carries a sequence number that tells whether it is ready to be written or read, so producers and
+ * consumers only contend on the respective position counter (D. Vyukov's bounded MPMC queue algorithm).
+ * Neither push() nor pop() block or allocate memory, which makes the queue suitable for passing data into or out of
+ * realtime threads.
+ * @tparam DataType The element type. Must be default-constructible and should be cheap to move, e.g., a pointer type.
+ */
+template< typename DataType >
+class LockFreeQueue
+{
+public:
+  /**
+   * Constructor.
+   * @param capacity The maximum number of elements, must be an integer power of two.
+   * @throw std::invalid_argument If \p capacity is not a power of two.
+   */
+  explicit LockFreeQueue( std::size_t capacity )
+   : mCells( new Cell[capacity] )
+   , mIndexMask( capacity - 1 )
+   , mPushPosition( 0 )
+   , mPopPosition( 0 )
+  {
+    if( (capacity < 2) or ((capacity & mIndexMask) != 0) )
+    {
+      throw std::invalid_argument( "LockFreeQueue: The capacity must be a power of two." );
+    }
+    for( std::size_t idx( 0 ); idx < capacity; ++idx )
+    {
+      mCells[idx].sequence.store( idx, std::memory_order_relaxed );
+    }
+  }
+
+  LockFreeQueue( LockFreeQueue const & ) = delete;
+
+  LockFreeQueue & operator=( LockFreeQueue const & ) = delete;
+
+  std::size_t capacity() const { return mIndexMask + 1; }
+
+  /**
+   * Append an element to the queue.
+   * @return true if the element has been added, false if the queue is full.
+   */
+  bool push( DataType const & value )
+  {
+    Cell * cell;
+    std::size_t pos = mPushPosition.load( std::memory_order_relaxed );
+    for( ;; )
+    {
+      cell = &mCells[pos & mIndexMask];
+      std::size_t const seq = cell->sequence.load( std::memory_order_acquire );
+      std::ptrdiff_t const diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+      if( diff == 0 )
+      {
+        if( mPushPosition.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+        {
+          break;
+        }
+      }
+      else if( diff < 0 )
+      {
+        return false; // Full.
+      }
+      else
+      {
+        pos = mPushPosition.load( std::memory_order_relaxed );
+      }
+    }
+    cell->data = value;
+    cell->sequence.store( pos + 1, std::memory_order_release );
+    return true;
+  }
+
+  /**
+   * Remove the oldest element from the queue.
+   * @param [out] value The removed element, unchanged if the queue is empty.
+   * @return true if an element has been removed, false if the queue is empty.
+   */
+  bool pop( DataType & value )
+  {
+    Cell * cell;
+    std::size_t pos = mPopPosition.load( std::memory_order_relaxed );
+    for( ;; )
+    {
+      cell = &mCells[pos & mIndexMask];
+      std::size_t const seq = cell->sequence.load( std::memory_order_acquire );
+      std::ptrdiff_t const diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+      if( diff == 0 )
+      {
+        if( mPopPosition.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+        {
+          break;
+        }
+      }
+      else if( diff < 0 )
+      {
+        return false; // Empty.
+      }
+      else
+      {
+        pos = mPopPosition.load( std::memory_order_relaxed );
+      }
+    }
+    value = cell->data;
+    cell->sequence.store( pos + mIndexMask + 1, std::memory_order_release );
+    return true;
+  }
+
+private:
+  struct Cell
+  {
+    std::atomic<std::size_t> sequence;
+    DataType data;
+  };
+
+  std::unique_ptr<Cell[]> mCells;
+
+  std::size_t const mIndexMask;
+
+  std::atomic<std::size_t> mPushPosition;
+
+  std::atomic<std::size_t> mPopPosition;
+};
+
+} // namespace rbbl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRBBL_LOCK_FREE_QUEUE_HPP_INCLUDED
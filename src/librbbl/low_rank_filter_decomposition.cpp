@@ -0,0 +1,305 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "low_rank_filter_decomposition.hpp"
+
+#include <algorithm>
+#include <ciso646>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace visr
+{
+namespace rbbl
+{
+
+namespace // unnamed
+{
+
+/**
+ * Number of additional vectors used in the subspace iteration to speed up the convergence of the dominant subspace.
+ */
+std::size_t const cOversampling = 8;
+
+std::size_t const cMaxIterations = 200;
+
+/**
+ * Orthonormalise the rows of a row-major matrix using the modified Gram-Schmidt algorithm.
+ * Linearly dependent rows are set to zero.
+ */
+void orthonormaliseRows( std::vector<double> & mtx, std::size_t numRows, std::size_t numCols )
+{
+  for( std::size_t rowIdx( 0 ); rowIdx < numRows; ++rowIdx )
+  {
+    double * const row = &mtx[rowIdx * numCols];
+    double const initialNorm = std::sqrt( std::inner_product( row, row + numCols, row, 0.0 ) );
+    // Two passes for numerical stability ("twice is enough").
+    for( std::size_t pass( 0 ); pass < 2; ++pass )
+    {
+      for( std::size_t prevIdx( 0 ); prevIdx < rowIdx; ++prevIdx )
+      {
+        double const * const prev = &mtx[prevIdx * numCols];
+        double const proj = std::inner_product( row, row + numCols, prev, 0.0 );
+        std::transform( row, row + numCols, prev, row, [proj]( double a, double b ){ return a - proj * b; } );
+      }
+    }
+    double const norm = std::sqrt( std::inner_product( row, row + numCols, row, 0.0 ) );
+    if( norm <= 1.0e-12 * initialNorm or norm == 0.0 )
+    {
+      std::fill( row, row + numCols, 0.0 );
+    }
+    else
+    {
+      std::transform( row, row + numCols, row, [norm]( double a ){ return a / norm; } );
+    }
+  }
+}
+
+/**
+ * Eigenvalue decomposition of a real symmetric matrix using the cyclic Jacobi method.
+ * @param [in,out] a Row-major symmetric matrix of dimension n x n. On return, the diagonal holds the eigenvalues.
+ * @param n The dimension of the matrix.
+ * @param [out] v Row-major matrix of dimension n x n holding the eigenvectors as columns.
+ */
+void symmetricEigenDecomposition( std::vector<double> & a, std::size_t n, std::vector<double> & v )
+{
+  v.assign( n * n, 0.0 );
+  for( std::size_t idx( 0 ); idx < n; ++idx )
+  {
+    v[idx * n + idx] = 1.0;
+  }
+  double const totalNorm = std::inner_product( a.begin(), a.end(), a.begin(), 0.0 );
+  for( std::size_t sweep( 0 ); sweep < 100; ++sweep )
+  {
+    double offDiagonal = 0.0;
+    for( std::size_t p( 0 ); p < n; ++p )
+    {
+      for( std::size_t q( p + 1 ); q < n; ++q )
+      {
+        offDiagonal += a[p * n + q] * a[p * n + q];
+      }
+    }
+    if( offDiagonal <= 1.0e-30 * totalNorm )
+    {
+      return;
+    }
+    for( std::size_t p( 0 ); p < n; ++p )
+    {
+      for( std::size_t q( p + 1 ); q < n; ++q )
+      {
+        double const apq = a[p * n + q];
+        if( apq == 0.0 )
+        {
+          continue;
+        }
+        double const theta = (a[q * n + q] - a[p * n + p]) / (2.0 * apq);
+        double const t = (theta >= 0.0 ? 1.0 : -1.0) / (std::abs( theta ) + std::sqrt( theta * theta + 1.0 ));
+        double const c = 1.0 / std::sqrt( t * t + 1.0 );
+        double const s = t * c;
+        for( std::size_t k( 0 ); k < n; ++k )
+        {
+          double const akp = a[k * n + p];
+          double const akq = a[k * n + q];
+          a[k * n + p] = c * akp - s * akq;
+          a[k * n + q] = s * akp + c * akq;
+        }
+        for( std::size_t k( 0 ); k < n; ++k )
+        {
+          double const apk = a[p * n + k];
+          double const aqk = a[q * n + k];
+          a[p * n + k] = c * apk - s * aqk;
+          a[q * n + k] = s * apk + c * aqk;
+        }
+        for( std::size_t k( 0 ); k < n; ++k )
+        {
+          double const vkp = v[k * n + p];
+          double const vkq = v[k * n + q];
+          v[k * n + p] = c * vkp - s * vkq;
+          v[k * n + q] = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Compute the projections of all filters onto a set of vectors.
+ * @param filters The filter matrix (numFilters x filterLength)
+ * @param vectors Row-major matrix of dimension numVectors x filterLength.
+ * @param numVectors The number of vectors.
+ * @param [out] result Row-major matrix of dimension numFilters x numVectors.
+ */
+template< typename SampleType >
+void projectFilters( efl::BasicMatrix<SampleType> const & filters, std::vector<double> const & vectors,
+                     std::size_t numVectors, std::vector<double> & result )
+{
+  std::size_t const numFilters = filters.numberOfRows();
+  std::size_t const filterLength = filters.numberOfColumns();
+  result.assign( numFilters * numVectors, 0.0 );
+  for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+  {
+    SampleType const * const filter = filters.row( filterIdx );
+    for( std::size_t vecIdx( 0 ); vecIdx < numVectors; ++vecIdx )
+    {
+      double const * const vec = &vectors[vecIdx * filterLength];
+      double acc = 0.0;
+      for( std::size_t sampleIdx( 0 ); sampleIdx < filterLength; ++sampleIdx )
+      {
+        acc += static_cast<double>(filter[sampleIdx]) * vec[sampleIdx];
+      }
+      result[filterIdx * numVectors + vecIdx] = acc;
+    }
+  }
+}
+
+} // unnamed namespace
+
+template< typename SampleType >
+LowRankFilterDecomposition<SampleType>::LowRankFilterDecomposition( efl::BasicMatrix<SampleType> const & filters,
+                                                                    std::size_t maxRank,
+                                                                    SampleType relativeErrorTolerance /*= 0.0*/,
+                                                                    std::size_t alignment /*= 0*/ )
+ : mBasisFilters( alignment )
+ , mCoefficients( alignment )
+ , mRelativeError( static_cast<SampleType>(0.0) )
+{
+  if( maxRank == 0 )
+  {
+    throw std::invalid_argument( "LowRankFilterDecomposition: The maximum rank must be greater than zero." );
+  }
+  if( relativeErrorTolerance < static_cast<SampleType>(0.0) )
+  {
+    throw std::invalid_argument( "LowRankFilterDecomposition: The relative error tolerance must not be negative." );
+  }
+  std::size_t const numFilters = filters.numberOfRows();
+  std::size_t const filterLength = filters.numberOfColumns();
+  std::size_t const subspaceDim = std::min( maxRank + cOversampling, std::min( numFilters, filterLength ) );
+
+  double totalEnergy = 0.0;
+  for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+  {
+    SampleType const * const filter = filters.row( filterIdx );
+    for( std::size_t sampleIdx( 0 ); sampleIdx < filterLength; ++sampleIdx )
+    {
+      totalEnergy += static_cast<double>(filter[sampleIdx]) * static_cast<double>(filter[sampleIdx]);
+    }
+  }
+  if( (subspaceDim == 0) or (totalEnergy == 0.0) )
+  {
+    mBasisFilters.resize( 0, filterLength );
+    mCoefficients.resize( numFilters, 0 );
+    return;
+  }
+
+  // Subspace iteration on the filter correlation matrix H^T H (not formed explicitly).
+  // The rows of 'subspace' span the current estimate of the dominant right singular subspace.
+  std::vector<double> subspace( subspaceDim * filterLength );
+  std::mt19937 gen( 1 ); // Fixed seed to obtain reproducible decompositions.
+  std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+  std::generate( subspace.begin(), subspace.end(), [&]() { return dist( gen ); } );
+  orthonormaliseRows( subspace, subspaceDim, filterLength );
+
+  std::vector<double> projections; // numFilters x subspaceDim
+  double capturedEnergy = 0.0;
+  for( std::size_t iteration( 0 ); iteration < cMaxIterations; ++iteration )
+  {
+    projectFilters( filters, subspace, subspaceDim, projections );
+    double const newCapturedEnergy = std::inner_product( projections.begin(), projections.end(), projections.begin(), 0.0 );
+    if( (iteration > 0) and (newCapturedEnergy - capturedEnergy <= 1.0e-12 * totalEnergy) )
+    {
+      break;
+    }
+    capturedEnergy = newCapturedEnergy;
+    std::fill( subspace.begin(), subspace.end(), 0.0 );
+    for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+    {
+      SampleType const * const filter = filters.row( filterIdx );
+      for( std::size_t vecIdx( 0 ); vecIdx < subspaceDim; ++vecIdx )
+      {
+        double const weight = projections[filterIdx * subspaceDim + vecIdx];
+        double * const vec = &subspace[vecIdx * filterLength];
+        for( std::size_t sampleIdx( 0 ); sampleIdx < filterLength; ++sampleIdx )
+        {
+          vec[sampleIdx] += weight * static_cast<double>(filter[sampleIdx]);
+        }
+      }
+    }
+    orthonormaliseRows( subspace, subspaceDim, filterLength );
+  }
+  projectFilters( filters, subspace, subspaceDim, projections );
+
+  // Rayleigh-Ritz step: Diagonalise the projected correlation matrix to obtain the singular vectors.
+  std::vector<double> projectedCorrelation( subspaceDim * subspaceDim, 0.0 );
+  for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+  {
+    double const * const proj = &projections[filterIdx * subspaceDim];
+    for( std::size_t rowIdx( 0 ); rowIdx < subspaceDim; ++rowIdx )
+    {
+      for( std::size_t colIdx( 0 ); colIdx < subspaceDim; ++colIdx )
+      {
+        projectedCorrelation[rowIdx * subspaceDim + colIdx] += proj[rowIdx] * proj[colIdx];
+      }
+    }
+  }
+  std::vector<double> eigenVectors;
+  symmetricEigenDecomposition( projectedCorrelation, subspaceDim, eigenVectors );
+  std::vector<std::size_t> order( subspaceDim );
+  std::iota( order.begin(), order.end(), 0 );
+  std::sort( order.begin(), order.end(), [&]( std::size_t lhs, std::size_t rhs )
+  {
+    return projectedCorrelation[lhs * subspaceDim + lhs] > projectedCorrelation[rhs * subspaceDim + rhs];
+  } );
+
+  // Select the smallest rank that meets the error tolerance.
+  std::size_t const rankLimit = std::min( maxRank, subspaceDim );
+  std::size_t rank = 0;
+  double retainedEnergy = 0.0;
+  while( rank < rankLimit )
+  {
+    retainedEnergy += std::max( projectedCorrelation[order[rank] * subspaceDim + order[rank]], 0.0 );
+    ++rank;
+    if( totalEnergy - retainedEnergy <= static_cast<double>(relativeErrorTolerance) * totalEnergy )
+    {
+      break;
+    }
+  }
+  mRelativeError = static_cast<SampleType>(std::max( totalEnergy - retainedEnergy, 0.0 ) / totalEnergy);
+
+  mBasisFilters.resize( rank, filterLength );
+  mCoefficients.resize( numFilters, rank );
+  for( std::size_t basisIdx( 0 ); basisIdx < rank; ++basisIdx )
+  {
+    std::size_t const eigIdx = order[basisIdx];
+    SampleType * const basis = mBasisFilters.row( basisIdx );
+    for( std::size_t sampleIdx( 0 ); sampleIdx < filterLength; ++sampleIdx )
+    {
+      double acc = 0.0;
+      for( std::size_t vecIdx( 0 ); vecIdx < subspaceDim; ++vecIdx )
+      {
+        acc += eigenVectors[vecIdx * subspaceDim + eigIdx] * subspace[vecIdx * filterLength + sampleIdx];
+      }
+      basis[sampleIdx] = static_cast<SampleType>(acc);
+    }
+    for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+    {
+      double acc = 0.0;
+      for( std::size_t vecIdx( 0 ); vecIdx < subspaceDim; ++vecIdx )
+      {
+        acc += eigenVectors[vecIdx * subspaceDim + eigIdx] * projections[filterIdx * subspaceDim + vecIdx];
+      }
+      mCoefficients( filterIdx, basisIdx ) = static_cast<SampleType>(acc);
+    }
+  }
+}
+
+template< typename SampleType >
+LowRankFilterDecomposition<SampleType>::~LowRankFilterDecomposition() = default;
+
+// explicit instantiations
+template class LowRankFilterDecomposition<float>;
+template class LowRankFilterDecomposition<double>;
+
+} // namespace rbbl
+} // namespace visr
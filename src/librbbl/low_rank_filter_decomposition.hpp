@@ -0,0 +1,87 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRBBL_LOW_RANK_FILTER_DECOMPOSITION_HPP_INCLUDED
+#define VISR_LIBRBBL_LOW_RANK_FILTER_DECOMPOSITION_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+
+#include <libefl/basic_matrix.hpp>
+
+#include <cstddef>
+
+namespace visr
+{
+namespace rbbl
+{
+
+/**
+ * Approximation of a set of FIR filters by weighted sums of a small number of shared basis filters.
+ * The decomposition corresponds to a truncated singular value decomposition of the filter matrix (without removing
+ * the mean filter), i.e., filter \f$h_f\f$ is approximated as \f$h_f \approx \sum_{k=0}^{K-1} c_{f,k} b_k\f$ with the
+ * orthonormal basis filters \f$b_k\f$ and the coefficients \f$c_{f,k} = \langle h_f, b_k \rangle\f$.
+ * For a given rank, this approximation minimises the total squared error over the filter set.
+ * The dominant singular vectors are computed by a subspace iteration, so the cost of the decomposition grows only
+ * linearly with the number and the length of the filters. The computation is intended to be performed offline,
+ * i.e., not in the audio processing thread.
+ * @tparam SampleType The floating-point type of the filter coefficients. Internal computations are performed in
+ * double precision. The class template is explicitly instantiated for the element types float and double.
+ */
+template< typename SampleType >
+class VISR_RBBL_LIBRARY_SYMBOL LowRankFilterDecomposition
+{
+public:
+  /**
+   * Constructor, performs the decomposition.
+   * The rank is the smallest number of basis filters for which the relative error does not exceed
+   * \p relativeErrorTolerance, but at most \p maxRank (or the number or the length of the filters, if smaller).
+   * @param filters The filter set to be decomposed, each matrix row represents one impulse response.
+   * @param maxRank The maximum number of basis filters. Must be greater than zero.
+   * @param relativeErrorTolerance The admissible energy of the approximation error, relative to the total energy of
+   * the filter set. The default value 0.0 results in the rank \p maxRank.
+   * @param alignment The alignment of the basis filter and coefficient matrices, in number of elements.
+   * @throw std::invalid_argument If \p maxRank is zero or \p relativeErrorTolerance is negative.
+   */
+  explicit LowRankFilterDecomposition( efl::BasicMatrix<SampleType> const & filters,
+                                       std::size_t maxRank,
+                                       SampleType relativeErrorTolerance = static_cast<SampleType>(0.0),
+                                       std::size_t alignment = 0 );
+
+  /**
+   * Destructor.
+   */
+  ~LowRankFilterDecomposition();
+
+  /**
+   * Return the number of basis filters of the decomposition.
+   */
+  std::size_t rank() const { return mBasisFilters.numberOfRows(); }
+
+  /**
+   * Return the basis filters as a matrix of dimension rank() x filter length.
+   * The basis filters are orthonormal and are ordered by decreasing contribution to the total energy of the filter set.
+   */
+  efl::BasicMatrix<SampleType> const & basisFilters() const { return mBasisFilters; }
+
+  /**
+   * Return the weights of the basis filters as a matrix of dimension number of filters x rank().
+   */
+  efl::BasicMatrix<SampleType> const & coefficients() const { return mCoefficients; }
+
+  /**
+   * Return the energy of the approximation error relative to the total energy of the filter set.
+   * Zero if the filter set contains only zeros.
+   */
+  SampleType relativeError() const { return mRelativeError; }
+
+private:
+  efl::BasicMatrix<SampleType> mBasisFilters;
+
+  efl::BasicMatrix<SampleType> mCoefficients;
+
+  SampleType mRelativeError;
+};
+
+} // namespace rbbl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRBBL_LOW_RANK_FILTER_DECOMPOSITION_HPP_INCLUDED
@@ -0,0 +1,404 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "low_rank_interpolating_convolver_uniform.hpp"
+
+#include "low_rank_filter_decomposition.hpp"
+
+#include <libvisr/detail/compose_message_string.hpp>
+
+#include <libefl/vector_functions.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <ciso646>
+#include <limits>
+#include <stdexcept>
+
+namespace visr
+{
+namespace rbbl
+{
+template< typename SampleType >
+LowRankInterpolatingConvolverUniform< SampleType >::LowRankInterpolatingConvolverUniform(
+    std::size_t numberOfInputs,
+    std::size_t numberOfOutputs,
+    std::size_t blockLength,
+    std::size_t maxFilterLength,
+    std::size_t maxRoutingPoints,
+    std::size_t maxFilterEntries,
+    std::size_t numberOfInterpolants,
+    std::size_t transitionSamples,
+    std::size_t maxRank,
+    SampleType relativeErrorTolerance,
+    FilterRoutingList const & initialRoutings /*= FilterRoutingList()*/,
+    InterpolationParameterSet const & initialInterpolants /*= InterpolationParameterSet()*/,
+    efl::BasicMatrix< SampleType > const & initialFilters /*= efl::BasicMatrix< SampleType >()*/,
+    std::size_t alignment /*= 0*/,
+    char const * fftImplementation /*= "default"*/ )
+ : mNumberOfInputs( numberOfInputs )
+ , mNumberOfOutputs( numberOfOutputs )
+ , mAlignment( alignment )
+ , mNumberOfInterpolants( numberOfInterpolants )
+ , mRelativeErrorTolerance( relativeErrorTolerance )
+ , mConvolver( numberOfOutputs * maxRank, numberOfOutputs, blockLength, maxFilterLength, maxRank,
+               efl::BasicMatrix< SampleType >( alignment ), alignment, fftImplementation )
+ , mBasisFilters( maxRank, maxFilterLength, alignment )
+ , mFilterCoefficients( maxFilterEntries, maxRank, alignment )
+ , mInterpolantIndices( maxRoutingPoints * numberOfInterpolants, 0 )
+ , mInterpolantWeights( maxRoutingPoints, numberOfInterpolants, alignment )
+ , mPreviousGains( maxRoutingPoints, maxRank, alignment )
+ , mNextGains( maxRoutingPoints, maxRank, alignment )
+ , mFader( blockLength, transitionSamples, alignment )
+ , mTransitionBlock( maxRoutingPoints, mFader.interpolationPeriods() )
+ , mBasisSignals( numberOfOutputs * maxRank, blockLength, alignment )
+ , mFrequencyDomainOutput( mConvolver.dftBlockRepresentationSize(), mConvolver.complexAlignment() )
+ , mTempGains( maxRank, alignment )
+ , mRank( 0 )
+ , mRelativeError( static_cast< SampleType >( 0.0 ) )
+{
+  if( maxRank == 0 )
+  {
+    throw std::invalid_argument( "LowRankInterpolatingConvolverUniform: The maximum rank must be greater than zero." );
+  }
+  if( numberOfInterpolants == 0 )
+  {
+    throw std::invalid_argument( "LowRankInterpolatingConvolverUniform: The number of interpolants must be greater than zero." );
+  }
+  mRoutingTable.reserve( maxRoutingPoints );
+  initRoutingTable( initialRoutings );
+  initFilters( initialFilters );
+  setInterpolants( initialInterpolants, false /*startTransition*/ );
+}
+
+template< typename SampleType >
+LowRankInterpolatingConvolverUniform< SampleType >::~LowRankInterpolatingConvolverUniform() = default;
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::process( SampleType const * const input,
+                                                                  std::size_t inputStride,
+                                                                  SampleType * const output,
+                                                                  std::size_t outputStride,
+                                                                  std::size_t alignment /*= 0*/ )
+{
+  std::size_t const blockSize{ blockLength() };
+  std::size_t const outputAlignment = std::min( alignment, mAlignment );
+  if( mRank == 0 )
+  {
+    for( std::size_t outputIdx( 0 ); outputIdx < numberOfOutputs(); ++outputIdx )
+    {
+      efl::vectorZero( output + outputIdx * outputStride, blockSize, outputAlignment );
+    }
+    return;
+  }
+  // Mix the inputs of all routings into the signals for the combinations of outputs and basis filters, applying the
+  // (possibly time-varying) basis gains of the interpolated filters.
+  for( std::size_t outputIdx( 0 ); outputIdx < numberOfOutputs(); ++outputIdx )
+  {
+    for( std::size_t basisIdx( 0 ); basisIdx < mRank; ++basisIdx )
+    {
+      efl::vectorZero( mBasisSignals.row( outputIdx * maxRank() + basisIdx ), blockSize, mBasisSignals.alignmentElements() );
+    }
+  }
+  for( RoutingEntry const & routing : mRoutingTable )
+  {
+    SampleType const * const inputSignal = input + routing.inputIdx * inputStride;
+    std::size_t const transitionBlock = mTransitionBlock[routing.filterIdx];
+    for( std::size_t basisIdx( 0 ); basisIdx < mRank; ++basisIdx )
+    {
+      mFader.scaleAndAccumulate( inputSignal, mBasisSignals.row( routing.outputIdx * maxRank() + basisIdx ),
+                                 routing.gainLinear * mPreviousGains( routing.filterIdx, basisIdx ),
+                                 routing.gainLinear * mNextGains( routing.filterIdx, basisIdx ),
+                                 transitionBlock );
+    }
+  }
+  for( auto & v : mTransitionBlock )
+  {
+    v = std::min( v + 1, mFader.interpolationPeriods() );
+  }
+
+  // Convolve the mixed signals with the basis filters, accumulating the results for each output in the frequency domain.
+  mConvolver.processInputs( mBasisSignals.data(), mBasisSignals.stride(), mBasisSignals.alignmentElements() );
+  for( std::size_t outputIdx( 0 ); outputIdx < numberOfOutputs(); ++outputIdx )
+  {
+    for( std::size_t basisIdx( 0 ); basisIdx < mRank; ++basisIdx )
+    {
+      mConvolver.processFilter( outputIdx * maxRank() + basisIdx, basisIdx, static_cast< SampleType >( 1.0 ),
+                                mFrequencyDomainOutput.data(), basisIdx > 0 /* add flag */ );
+    }
+    mConvolver.transformOutput( mFrequencyDomainOutput.data(), output + outputIdx * outputStride );
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Manipulation of the routing table
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::clearRoutingTable()
+{
+  mRoutingTable.clear();
+}
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::initRoutingTable( FilterRoutingList const & routings )
+{
+  clearRoutingTable();
+  if( routings.size() > maxNumberOfRoutingPoints() )
+  {
+    throw std::invalid_argument( "LowRankInterpolatingConvolverUniform::initRoutingTable() exceeds the maximum "
+                                 "admissible number of elements " );
+  }
+  for( FilterRouting const & v : routings )
+  {
+    setRoutingEntry( v );
+  }
+}
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::setRoutingEntry( FilterRouting const & routing )
+{
+  setRoutingEntry( routing.inputIndex, routing.outputIndex, routing.filterIndex,
+                   static_cast< SampleType >( routing.gainLinear ) );
+}
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::setRoutingEntry( std::size_t inputIdx,
+                                                                          std::size_t outputIdx,
+                                                                          std::size_t filterIdx,
+                                                                          SampleType gain )
+{
+  if( inputIdx >= numberOfInputs() )
+  {
+    throw std::invalid_argument( "LowRankInterpolatingConvolverUniform::setRoutingEntry(): Input index exceeds the "
+                                 "admissible range." );
+  }
+  if( outputIdx >= numberOfOutputs() )
+  {
+    throw std::invalid_argument( "LowRankInterpolatingConvolverUniform::setRoutingEntry(): Output index exceeds the "
+                                 "admissible range." );
+  }
+  if( filterIdx >= maxNumberOfRoutingPoints() )
+  {
+    throw std::invalid_argument( "LowRankInterpolatingConvolverUniform::setRoutingEntry(): Filter index exceeds the "
+                                 "number of interpolant slots." );
+  }
+  auto const findIt = std::find_if( mRoutingTable.begin(), mRoutingTable.end(),
+    [inputIdx, outputIdx]( RoutingEntry const & entry ) { return (entry.inputIdx == inputIdx) and (entry.outputIdx == outputIdx); } );
+  if( findIt != mRoutingTable.end() )
+  {
+    *findIt = RoutingEntry{ inputIdx, outputIdx, filterIdx, gain };
+    return;
+  }
+  if( mRoutingTable.size() >= maxNumberOfRoutingPoints() )
+  {
+    throw std::invalid_argument( "LowRankInterpolatingConvolverUniform::setRoutingEntry(): Maximum number of routing "
+                                 "points already reached." );
+  }
+  mRoutingTable.push_back( RoutingEntry{ inputIdx, outputIdx, filterIdx, gain } );
+}
+
+template< typename SampleType >
+bool LowRankInterpolatingConvolverUniform< SampleType >::removeRoutingEntry( std::size_t inputIdx, std::size_t outputIdx )
+{
+  auto const findIt = std::find_if( mRoutingTable.begin(), mRoutingTable.end(),
+    [inputIdx, outputIdx]( RoutingEntry const & entry ) { return (entry.inputIdx == inputIdx) and (entry.outputIdx == outputIdx); } );
+  if( findIt == mRoutingTable.end() )
+  {
+    return false;
+  }
+  mRoutingTable.erase( findIt );
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Manipulation of the filters
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::clearFilters()
+{
+  mFilterCoefficients.zeroFill();
+  // Consistent with InterpolatingConvolverUniform: also clear the filters of the running convolution process.
+  mPreviousGains.zeroFill();
+  mNextGains.zeroFill();
+}
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::initFilters( efl::BasicMatrix< SampleType > const & newImpulseResponses )
+{
+  std::size_t const numFilters{ newImpulseResponses.numberOfRows() };
+  if( numFilters > maxNumberOfFilterEntries() )
+  {
+    throw std::invalid_argument( "LowRankInterpolatingConvolverUniform::initFilters(): Size of new filter "
+                                 "matrix exceeds number of filter slots." );
+  }
+  if( newImpulseResponses.numberOfColumns() > maxFilterLength() )
+  {
+    throw std::invalid_argument( "LowRankInterpolatingConvolverUniform::initFilters(): Size of new filter "
+                                 "matrix exceeds maximum filter length." );
+  }
+  LowRankFilterDecomposition< SampleType > const decomposition( newImpulseResponses, maxRank(),
+                                                                mRelativeErrorTolerance, mAlignment );
+  mRank = decomposition.rank();
+  mRelativeError = decomposition.relativeError();
+
+  mBasisFilters.zeroFill();
+  for( std::size_t basisIdx( 0 ); basisIdx < mRank; ++basisIdx )
+  {
+    efl::vectorCopy( decomposition.basisFilters().row( basisIdx ), mBasisFilters.row( basisIdx ),
+                     newImpulseResponses.numberOfColumns(), 0 );
+  }
+  mConvolver.initFilters( mBasisFilters );
+
+  mFilterCoefficients.zeroFill();
+  for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+  {
+    efl::vectorCopy( decomposition.coefficients().row( filterIdx ), mFilterCoefficients.row( filterIdx ), mRank, 0 );
+  }
+
+  // The basis gains of the interpolants refer to the previous basis, so they are recomputed without a transition.
+  for( std::size_t slotIdx( 0 ); slotIdx < maxNumberOfRoutingPoints(); ++slotIdx )
+  {
+    computeBasisGains( slotIdx, mNextGains.row( slotIdx ) );
+    efl::vectorCopy( mNextGains.row( slotIdx ), mPreviousGains.row( slotIdx ), maxRank(), 0 );
+    mTransitionBlock[slotIdx] = mFader.interpolationPeriods();
+  }
+}
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::setImpulseResponse( SampleType const * ir,
+                                                                             std::size_t filterLength,
+                                                                             std::size_t filterIdx,
+                                                                             std::size_t /*alignment = 0*/ )
+{
+  if( filterIdx >= maxNumberOfFilterEntries() )
+  {
+    throw std::invalid_argument( "LowRankInterpolatingConvolverUniform::setImpulseResponse(): Filter index "
+                                 "exceeds number of filter slots." );
+  }
+  if( filterLength > maxFilterLength() )
+  {
+    throw std::invalid_argument( "LowRankInterpolatingConvolverUniform::setImpulseResponse(): Length of new "
+                                 "impulse response exceeds maximum filter length." );
+  }
+  // Project onto the (orthonormal) basis filters.
+  for( std::size_t basisIdx( 0 ); basisIdx < maxRank(); ++basisIdx )
+  {
+    SampleType const * const basis = mBasisFilters.row( basisIdx );
+    SampleType acc = static_cast< SampleType >( 0.0 );
+    for( std::size_t sampleIdx( 0 ); sampleIdx < filterLength; ++sampleIdx )
+    {
+      acc += ir[sampleIdx] * basis[sampleIdx];
+    }
+    mFilterCoefficients( filterIdx, basisIdx ) = acc;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Manipulation of the interpolants
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::setInterpolant( rbbl::InterpolationParameter const & param,
+                                                                         bool startTransition )
+{
+  rbbl::InterpolationParameter::IdType const slotIdx = param.id();
+  if( slotIdx >= maxNumberOfRoutingPoints() )
+  {
+    throw std::out_of_range( "LowRankInterpolatingConvolverUniform::setInterpolant(): interpolant id "
+                             "exceeds number of filter routings. " );
+  }
+  if( param.numberOfInterpolants() != mNumberOfInterpolants )
+  {
+    throw std::invalid_argument( "LowRankInterpolatingConvolverUniform::setInterpolant(): Number of "
+                                 "interpolants in parameter does not match the value set in the convolver." );
+  }
+  InterpolationParameter::IndexType const maxIndex
+    = *( std::max_element( param.indices().begin(), param.indices().end() ) );
+  if( maxIndex >= maxNumberOfFilterEntries() )
+  {
+    throw std::runtime_error( detail::composeMessageString(
+        "LowRankInterpolatingConvolverUniform::setInterpolant(): At least one filter index \'",
+        maxIndex, "\' exceeds maximum admissible index (", maxNumberOfFilterEntries() - 1, ")." ) );
+  }
+  for( std::size_t interpolantIdx( 0 ); interpolantIdx < mNumberOfInterpolants; ++interpolantIdx )
+  {
+    mInterpolantIndices[slotIdx * mNumberOfInterpolants + interpolantIdx] = param.index( interpolantIdx );
+    mInterpolantWeights( slotIdx, interpolantIdx ) = static_cast< SampleType >( param.weight( interpolantIdx ) );
+  }
+  computeBasisGains( slotIdx, mTempGains.data() );
+  setBasisGains( slotIdx, mTempGains.data(), startTransition );
+}
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::setInterpolants( InterpolationParameterSet const & params,
+                                                                          bool startTransition )
+{
+  for( rbbl::InterpolationParameter const & v : params )
+  {
+    setInterpolant( v, startTransition );
+  }
+}
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::clearInterpolants()
+{
+  std::fill( mInterpolantIndices.begin(), mInterpolantIndices.end(), 0 );
+  mInterpolantWeights.zeroFill();
+  mPreviousGains.zeroFill();
+  mNextGains.zeroFill();
+}
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::computeBasisGains( std::size_t slotIdx, SampleType * gains ) const
+{
+  efl::vectorZero( gains, maxRank(), 0 );
+  for( std::size_t interpolantIdx( 0 ); interpolantIdx < mNumberOfInterpolants; ++interpolantIdx )
+  {
+    efl::ErrorCode const res = efl::vectorMultiplyConstantAddInplace< SampleType >(
+        mInterpolantWeights( slotIdx, interpolantIdx ),
+        mFilterCoefficients.row( mInterpolantIndices[slotIdx * mNumberOfInterpolants + interpolantIdx] ),
+        gains, mRank, 0 );
+    if( res != efl::noError )
+    {
+      throw std::runtime_error( detail::composeMessageString(
+          "LowRankInterpolatingConvolverUniform: Computation of basis gains failed: ", efl::errorMessage( res ) ) );
+    }
+  }
+}
+
+template< typename SampleType >
+void LowRankInterpolatingConvolverUniform< SampleType >::setBasisGains( std::size_t slotIdx,
+                                                                        SampleType const * gains,
+                                                                        bool startTransition )
+{
+  std::size_t & transitionBlock = mTransitionBlock[slotIdx];
+  bool const transitionFinished = transitionBlock >= mFader.interpolationPeriods();
+  if( startTransition )
+  {
+    if( not transitionFinished )
+    {
+      // Start the new transition from the currently reached interpolated gains.
+      SampleType const ratio = std::min( static_cast< SampleType >( 1.0 ),
+        static_cast< SampleType >( transitionBlock * blockLength() ) / static_cast< SampleType >( mFader.interpolationSamples() ) );
+      for( std::size_t basisIdx( 0 ); basisIdx < maxRank(); ++basisIdx )
+      {
+        mPreviousGains( slotIdx, basisIdx ) += ratio * ( mNextGains( slotIdx, basisIdx ) - mPreviousGains( slotIdx, basisIdx ) );
+      }
+    }
+    else
+    {
+      efl::vectorCopy( mNextGains.row( slotIdx ), mPreviousGains.row( slotIdx ), maxRank(), 0 );
+    }
+    transitionBlock = 0;
+  }
+  else if( transitionFinished )
+  {
+    efl::vectorCopy( gains, mPreviousGains.row( slotIdx ), maxRank(), 0 );
+  }
+  efl::vectorCopy( gains, mNextGains.row( slotIdx ), maxRank(), 0 );
+}
+
+// explicit instantiations
+template class LowRankInterpolatingConvolverUniform< float >;
+template class LowRankInterpolatingConvolverUniform< double >;
+
+} // namespace rbbl
+} // namespace visr
@@ -0,0 +1,319 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRBBL_LOW_RANK_INTERPOLATING_CONVOLVER_UNIFORM_HPP_INCLUDED
+#define VISR_LIBRBBL_LOW_RANK_INTERPOLATING_CONVOLVER_UNIFORM_HPP_INCLUDED
+
+#include "core_convolver_uniform.hpp"
+#include "export_symbols.hpp"
+#include "filter_routing.hpp"
+#include "gain_fader.hpp"
+#include "interpolation_parameter.hpp"
+
+#include <libefl/basic_matrix.hpp>
+#include <libefl/basic_vector.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace visr
+{
+namespace rbbl
+{
+/**
+ * MIMO convolution with interpolated filters, using a low-rank approximation of the filter set.
+ * This class provides the same interface as InterpolatingConvolverUniform, but the stored filters are decomposed
+ * into a small number of shared basis filters (see LowRankFilterDecomposition). Because the interpolated filter of a
+ * routing is a linear combination of the basis filters, the interpolation weights are applied as gains:
+ * The input signal of each routing is weighted by the basis coefficients of the interpolated filter and mixed into
+ * one signal per output and basis filter, which is then convolved with the respective basis filter.
+ * Thus the convolution cost scales with the number of outputs times the rank, independent of the number of
+ * routings and interpolants (e.g., the number of objects in dynamic binaural rendering). Interpolation is
+ * reduced to a weighted sum of the coefficient vectors of the interpolants.
+ * Crossfades between interpolants are implemented as linear ramps of the basis gains.
+ * @tparam SampleType The floating-point type of the signal samples
+ */
+template< typename SampleType >
+class VISR_RBBL_LIBRARY_SYMBOL LowRankInterpolatingConvolverUniform
+{
+public:
+  /**
+   * Constructor.
+   * @param numberOfInputs The number of input signals processed.
+   * @param numberOfOutputs The number of output channels produced.
+   * @param blockLength The numbers of samples processed for each input or output channels in one process() call.
+   * @param maxFilterLength The maximum length of the FIR filters (in samples).
+   * @param maxRoutingPoints The maximum number of routing points between input and output channels. This is also the
+   * number of interpolant slots, i.e., the filter indices of the routings and the ids of the interpolation parameters
+   * must be less than this value.
+   * @param maxFilterEntries The maximum number of filters that can be stored within the convolver.
+   * @param numberOfInterpolants The number of filters used for interpolating a single filter.
+   * @param transitionSamples Duration of a transition between interpolants in samples.
+   * @param maxRank The maximum number of basis filters.
+   * @param relativeErrorTolerance The admissible energy of the approximation error relative to the energy of the
+   * filter set. Determines the actual rank (up to \p maxRank) for each set of filters passed to initFilters().
+   * @param initialRoutings The initial set of routing points.
+   * @param initialInterpolants List of initial interpolation coefficients to determine the filters for convolution.
+   * @param initialFilters The initial set of filter coefficients. The matrix rows represent the distinct filters.
+   * @param alignment The alignment (given as a multiple of the sample type size) to be used to allocate all data
+   * structure. It also guaranteees the alignment of the input and output samples to the process call.
+   * @param fftImplementation A string to determine the FFT wrapper to be used. The default value results in using
+   * the default FFT implementation for the given data type.
+   */
+  explicit LowRankInterpolatingConvolverUniform( std::size_t numberOfInputs,
+                                                 std::size_t numberOfOutputs,
+                                                 std::size_t blockLength,
+                                                 std::size_t maxFilterLength,
+                                                 std::size_t maxRoutingPoints,
+                                                 std::size_t maxFilterEntries,
+                                                 std::size_t numberOfInterpolants,
+                                                 std::size_t transitionSamples,
+                                                 std::size_t maxRank,
+                                                 SampleType relativeErrorTolerance,
+                                                 FilterRoutingList const & initialRoutings = FilterRoutingList(),
+                                                 InterpolationParameterSet const & initialInterpolants = InterpolationParameterSet(),
+                                                 efl::BasicMatrix< SampleType > const & initialFilters = efl::BasicMatrix< SampleType >(),
+                                                 std::size_t alignment = 0,
+                                                 char const * fftImplementation = "default" );
+
+  /**
+   * Destructor.
+   */
+  ~LowRankInterpolatingConvolverUniform();
+
+  std::size_t numberOfInputs() const { return mNumberOfInputs; }
+
+  std::size_t numberOfOutputs() const { return mNumberOfOutputs; }
+
+  std::size_t blockLength() const { return mConvolver.blockLength(); }
+
+  std::size_t maxNumberOfRoutingPoints() const { return mInterpolantWeights.numberOfRows(); }
+
+  std::size_t maxNumberOfFilterEntries() const { return mFilterCoefficients.numberOfRows(); }
+
+  std::size_t maxFilterLength() const { return mConvolver.maxFilterLength(); }
+
+  std::size_t numberOfRoutingPoints() const { return mRoutingTable.size(); }
+
+  /**
+   * Return the maximum number of basis filters.
+   */
+  std::size_t maxRank() const { return mBasisFilters.numberOfRows(); }
+
+  /**
+   * Return the number of basis filters used for the current filter set.
+   */
+  std::size_t rank() const { return mRank; }
+
+  /**
+   * Return the relative error energy of the approximation of the filter set passed to the most recent initFilters() call.
+   */
+  SampleType relativeApproximationError() const { return mRelativeError; }
+
+  void process( SampleType const * const input,
+                std::size_t inputStride,
+                SampleType * const output,
+                std::size_t outputStride,
+                std::size_t alignment = 0 );
+
+  /**
+   * Manipulation of the routing table.
+   */
+  //@{
+  /**
+   * Remove all entries from the routing table.
+   */
+  void clearRoutingTable();
+
+  /**
+   * Initialize the routing table from a set of entries.
+   * All pre-existing entries are cleared beforehand.
+   * @param routings A vector of routing entries
+   * @throw std::invalid_argument If the number of new entries exceeds the maximally permitted number of routings
+   * @throw std::invalid_argument If any input, output, or filter index exceeds the admissible range for the respective type.
+   */
+  void initRoutingTable( FilterRoutingList const & routings );
+
+  /**
+   * Add a new routing to the routing table.
+   * @throw std::invalid_argument If adding the entry would exceed the maximally permitted number of routings
+   * @throw std::invalid_argument If any input, output, or filter index exceeds the admissible range for the respective type.
+   */
+  void setRoutingEntry( FilterRouting const & routing );
+
+  /**
+   * Add a new routing to the routing table.
+   * @throw std::invalid_argument If adding the entry would exceed the maximally permitted number of routings
+   * @throw std::invalid_argument If any input, output, or filter index exceeds the admissible range for the respective type.
+   */
+  void setRoutingEntry( std::size_t inputIdx,
+                        std::size_t outputIdx,
+                        std::size_t filterIdx,
+                        SampleType gain );
+
+  /**
+   * @return \p true if the entry was removes, \p false if not (i.e., the entry did not exist).
+   */
+  bool removeRoutingEntry( std::size_t inputIdx, std::size_t outputIdx );
+  //@}
+
+  /**
+   * Manipulation of the contained filter representations.
+   */
+  //@{
+  /**
+   * Reset all filters to zero.
+   * This also mutes the currently interpolated filters.
+   */
+  void clearFilters();
+
+  /**
+   * Load a new set of impulse responses, resetting all prior loaded filters, and compute the low-rank
+   * approximation of the filter set.
+   * The interpolated filters of all routings are immediately recomputed from the new filters.
+   * @note This function is computationally expensive and should not be called in the audio processing thread.
+   * @param newFilters The matrix of new filters, with each row representing a filter.
+   * @throw std::invalid_argument If the number of filters (number of rows) exceeds the maximum admissible number of filters.
+   * @throw std::invalid_argument If the length of the filters (number of matrix columns) exceeds the maximum admissible length,
+   */
+  void initFilters( efl::BasicMatrix< SampleType > const & newFilters );
+
+  /**
+   * Set on entry in the set of stored filters to a new impulse response.
+   * The impulse response is approximated within the span of the current basis filters, i.e., the basis is not
+   * recomputed. Use initFilters() to adapt the basis to a changed filter set.
+   * @param ir The new impulse response
+   * @param filterLength Length of the new IR in samples.
+   * @param filterIdx Filter index in the set of stored filters where the new filter is written to.
+   * @param alignment Alignment of the \p ir parameter, in number of elements.
+   */
+  void setImpulseResponse( SampleType const * ir,
+                           std::size_t filterLength,
+                           std::size_t filterIdx,
+                           std::size_t alignment = 0 );
+  //@}
+
+  /**
+   * Handling of interpolants (consisting of filter indices and the corresponding interpolation weights).
+   */
+  //@{
+  /**
+   * Return the number of filters involved in one interpolation process.
+   */
+  std::size_t numberOfInterpolants() const { return mNumberOfInterpolants; }
+
+  /**
+   * Set new interpolation weights for a single filter entry.
+   * @param param Interpolation parameter structure, including id.
+   * @param startTransition Whether this starts a new transition, or directly updates the interpolant without starting
+   * a new transition. If there is a currently unfinished transition, it is continued with the new target filter.
+   */
+  void setInterpolant( rbbl::InterpolationParameter const & param,
+                       bool startTransition );
+
+  /**
+   * Set filter interpolants for a sequence of routing entries
+   * @param param Interpolation parameter sets.
+   * @param startTransition Whether this starts a new transition, or directly updates the interpolants without starting
+   * a new transition.
+   */
+  void setInterpolants( InterpolationParameterSet const & param,
+                        bool startTransition );
+
+  /**
+   * Set all interpolation weights and filter indices to zero.
+   */
+  void clearInterpolants();
+  //@}
+
+private:
+  /**
+   * Compute the basis gains of the interpolated filter for the interpolant slot \p slotIdx and write them to
+   * \p gains.
+   */
+  void computeBasisGains( std::size_t slotIdx, SampleType * gains ) const;
+
+  /**
+   * Set the target basis gains of an interpolant slot.
+   */
+  void setBasisGains( std::size_t slotIdx, SampleType const * gains, bool startTransition );
+
+  struct RoutingEntry
+  {
+    std::size_t inputIdx;
+    std::size_t outputIdx;
+    std::size_t filterIdx;
+    SampleType gainLinear;
+  };
+
+  std::size_t const mNumberOfInputs;
+
+  std::size_t const mNumberOfOutputs;
+
+  std::size_t const mAlignment;
+
+  std::size_t const mNumberOfInterpolants;
+
+  SampleType const mRelativeErrorTolerance;
+
+  /**
+   * Convolution engine, with one input for each combination of output and basis filter.
+   */
+  CoreConvolverUniform< SampleType > mConvolver;
+
+  std::vector< RoutingEntry > mRoutingTable;
+
+  /**
+   * The time-domain basis filters, one per row. Only the first mRank rows are valid.
+   */
+  efl::BasicMatrix< SampleType > mBasisFilters;
+
+  /**
+   * The basis coefficients of the stored filters (maxFilterEntries x maxRank).
+   */
+  efl::BasicMatrix< SampleType > mFilterCoefficients;
+
+  /**
+   * The filter indices and weights of the interpolants, one row per interpolant slot.
+   */
+  //@{
+  std::vector< std::size_t > mInterpolantIndices;
+
+  efl::BasicMatrix< SampleType > mInterpolantWeights;
+  //@}
+
+  /**
+   * Basis gains at the start and the end of the current transition, one row per interpolant slot.
+   */
+  //@{
+  efl::BasicMatrix< SampleType > mPreviousGains;
+
+  efl::BasicMatrix< SampleType > mNextGains;
+  //@}
+
+  GainFader< SampleType > mFader;
+
+  /**
+   * Position within the current transition for each interpolant slot.
+   */
+  std::vector< std::size_t > mTransitionBlock;
+
+  /**
+   * Mixed signals for all combinations of outputs and basis filters.
+   */
+  efl::BasicMatrix< SampleType > mBasisSignals;
+
+  efl::BasicVector< typename CoreConvolverUniform< SampleType >::FrequencyDomainType > mFrequencyDomainOutput;
+
+  /**
+   * Temporary storage for computing basis gains.
+   */
+  efl::BasicVector< SampleType > mTempGains;
+
+  std::size_t mRank;
+
+  SampleType mRelativeError;
+};
+} // namespace rbbl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRBBL_LOW_RANK_INTERPOLATING_CONVOLVER_UNIFORM_HPP_INCLUDED
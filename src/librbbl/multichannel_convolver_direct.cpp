@@ -0,0 +1,317 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "multichannel_convolver_direct.hpp"
+
+#include "filter_bank_file.hpp"
+
+#include <libefl/alignment.hpp>
+#include <libefl/vector_functions.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <ciso646>
+#include <cmath>
+#include <stdexcept>
+
+namespace visr
+{
+namespace rbbl
+{
+
+template< typename SampleType >
+MultichannelConvolverDirect<SampleType>::
+MultichannelConvolverDirect( std::size_t numberOfInputs,
+                             std::size_t numberOfOutputs,
+                             std::size_t blockLength,
+                             std::size_t maxFilterLength,
+                             std::size_t maxRoutingPoints,
+                             std::size_t maxFilterEntries,
+                             FilterRoutingList const & initialRoutings,
+                             efl::BasicMatrix<SampleType> const & initialFilters,
+                             std::size_t alignment /*= 0*/ )
+ : mNumberOfOutputs( numberOfOutputs )
+ , mBlockLength( blockLength )
+ , mMaxNumberOfRoutingPoints( maxRoutingPoints )
+ , mHistoryLength( efl::nextAlignedSize( maxFilterLength > 0 ? maxFilterLength - 1 : 0, alignment ) )
+ , mFilters( maxFilterEntries, maxFilterLength, alignment )
+ , mFilterLengths( maxFilterEntries, 0 )
+ , mInputHistory( numberOfInputs, mHistoryLength + blockLength, alignment )
+ , mSilentInputBlocks( numberOfInputs, 0 )
+ , mDecayBlocks( blockLength > 0 ? (mHistoryLength + blockLength - 1) / blockLength : 0 )
+ , mOutputContributions( numberOfOutputs, 0 )
+{
+  if( blockLength == 0 )
+  {
+    throw std::invalid_argument( "MultichannelConvolverDirect: The block length must be nonzero." );
+  }
+  initFilters( initialFilters );
+  initRoutingTable( initialRoutings );
+}
+
+template< typename SampleType >
+MultichannelConvolverDirect<SampleType>::~MultichannelConvolverDirect() = default;
+
+template< typename SampleType >
+void MultichannelConvolverDirect<SampleType>::
+process( SampleType const * const input, std::size_t inputChannelStride,
+         SampleType * const output, std::size_t outputChannelStride,
+         std::size_t alignment /*= 0*/,
+         bool const * silentInputs /*= nullptr*/,
+         bool * silentOutputs /*= nullptr*/ )
+{
+  std::size_t const historyAlignment = std::min( alignment, mInputHistory.alignmentElements() );
+  for( std::size_t inputIdx( 0 ); inputIdx < numberOfInputs(); ++inputIdx )
+  {
+    SampleType * const history = mInputHistory.row( inputIdx );
+    // Move the most recent samples to the start of the history. Source and destination may overlap, but the
+    // destination always precedes the source.
+    std::copy( history + mBlockLength, history + mBlockLength + mHistoryLength, history );
+    if( efl::vectorCopy( input + inputIdx * inputChannelStride, history + mHistoryLength, mBlockLength,
+                         historyAlignment ) != efl::noError )
+    {
+      throw std::runtime_error( "MultichannelConvolverDirect::process(): Copying of an input signal failed." );
+    }
+    if( silentInputs and silentInputs[inputIdx] )
+    {
+      mSilentInputBlocks[inputIdx] = std::min( mSilentInputBlocks[inputIdx] + 1, mDecayBlocks + 1 );
+    }
+    else
+    {
+      mSilentInputBlocks[inputIdx] = 0;
+    }
+  }
+  std::fill( mOutputContributions.begin(), mOutputContributions.end(), 0 );
+  for( std::size_t outputIdx( 0 ); outputIdx < numberOfOutputs(); ++outputIdx )
+  {
+    if( efl::vectorZero( output + outputIdx * outputChannelStride, mBlockLength, alignment ) != efl::noError )
+    {
+      throw std::runtime_error( "MultichannelConvolverDirect::process(): Zeroing of an output failed." );
+    }
+  }
+  for( RoutingEntry const & routing : mRoutingTable )
+  {
+    if( mSilentInputBlocks[routing.inputIdx] > mDecayBlocks )
+    {
+      continue;
+    }
+    mOutputContributions[routing.outputIdx] = 1;
+    SampleType const * const currentBlock = mInputHistory.row( routing.inputIdx ) + mHistoryLength;
+    SampleType const * const filter = mFilters.row( routing.filterIdx );
+    SampleType * const outputChannel = output + routing.outputIdx * outputChannelStride;
+    std::size_t const filterLength = mFilterLengths[routing.filterIdx];
+    // Accumulate the input blocks delayed by the tap index, scaled by the filter coefficient.
+    // The delayed blocks are generally unaligned.
+    for( std::size_t tapIdx( 0 ); tapIdx < filterLength; ++tapIdx )
+    {
+      SampleType const coeff = routing.gainLinear * filter[tapIdx];
+      if( coeff == static_cast<SampleType>(0.0) )
+      {
+        continue;
+      }
+      if( efl::vectorMultiplyConstantAddInplace( coeff, currentBlock - tapIdx, outputChannel, mBlockLength, 0 )
+          != efl::noError )
+      {
+        throw std::runtime_error( "MultichannelConvolverDirect::process(): Filtering failed." );
+      }
+    }
+  }
+  if( silentOutputs )
+  {
+    for( std::size_t outputIdx( 0 ); outputIdx < numberOfOutputs(); ++outputIdx )
+    {
+      silentOutputs[outputIdx] = not mOutputContributions[outputIdx];
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Manipulation of the routing table
+
+template< typename SampleType >
+void MultichannelConvolverDirect<SampleType>::clearRoutingTable()
+{
+  mRoutingTable.clear();
+}
+
+template< typename SampleType >
+void MultichannelConvolverDirect<SampleType>::initRoutingTable( FilterRoutingList const & routings )
+{
+  clearRoutingTable();
+  if( routings.size() > maxNumberOfRoutingPoints() )
+  {
+    throw std::invalid_argument( "MultichannelConvolverDirect:initRoutingTable() exceeds the maximum admissible number of elements " );
+  }
+  for( FilterRouting const & v : routings )
+  {
+    setRoutingEntry( v );
+  }
+  assert( mRoutingTable.size() <= maxNumberOfRoutingPoints() );
+}
+
+template< typename SampleType >
+void MultichannelConvolverDirect<SampleType>::setRoutingEntry( FilterRouting const & routing )
+{
+  setRoutingEntry( routing.inputIndex, routing.outputIndex, routing.filterIndex, static_cast<SampleType>(routing.gainLinear) );
+}
+
+template< typename SampleType >
+void MultichannelConvolverDirect<SampleType>::setRoutingEntry( std::size_t inputIdx,
+                                                               std::size_t outputIdx,
+                                                               std::size_t filterIdx,
+                                                               SampleType gain )
+{
+  if( inputIdx >= numberOfInputs() )
+  {
+    throw std::invalid_argument( "MultichannelConvolverDirect::setRoutingEntry(): Input index exceeds the admissible range." );
+  }
+  if( outputIdx >= numberOfOutputs() )
+  {
+    throw std::invalid_argument( "MultichannelConvolverDirect::setRoutingEntry(): Output index exceeds the admissible range." );
+  }
+  if( filterIdx >= maxNumberOfFilterEntries() )
+  {
+    throw std::invalid_argument( "MultichannelConvolverDirect::setRoutingEntry(): Filter index exceeds the admissible range." );
+  }
+  RoutingEntry newEntry( inputIdx, outputIdx, filterIdx, gain );
+  typename RoutingTable::iterator findIt = mRoutingTable.find( newEntry );
+  if( findIt != mRoutingTable.end() )
+  {
+    mRoutingTable.erase( findIt );
+  }
+  if( mRoutingTable.size() >= maxNumberOfRoutingPoints() )
+  {
+    throw std::invalid_argument( "MultichannelConvolverDirect::setRoutingEntry(): Maximum number of routing points already reached." );
+  }
+  mRoutingTable.insert( std::move( newEntry ) );
+}
+
+template< typename SampleType >
+bool MultichannelConvolverDirect<SampleType>::removeRoutingEntry( std::size_t inputIdx, std::size_t outputIdx )
+{
+  RoutingEntry const testEntry( inputIdx, outputIdx, 0, 0.0f );
+  auto const eraseRange = mRoutingTable.equal_range( testEntry );
+  mRoutingTable.erase( eraseRange.first, eraseRange.second );
+  return eraseRange.first != mRoutingTable.end();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Manipulation of the filters
+
+template< typename SampleType >
+void MultichannelConvolverDirect<SampleType>::clearFilters()
+{
+  mFilters.zeroFill();
+  std::fill( mFilterLengths.begin(), mFilterLengths.end(), 0 );
+}
+
+template< typename SampleType >
+void MultichannelConvolverDirect<SampleType>::initFilters( efl::BasicMatrix<SampleType> const & newFilters )
+{
+  if( newFilters.numberOfRows() > maxNumberOfFilterEntries() )
+  {
+    throw std::invalid_argument( "MultichannelConvolverDirect::initFilters(): The number of filters exceeds the maximum number of filter entries." );
+  }
+  if( newFilters.numberOfColumns() > maxFilterLength() )
+  {
+    throw std::invalid_argument( "MultichannelConvolverDirect::initFilters(): The filter length exceeds the maximum admissible length." );
+  }
+  clearFilters();
+  for( std::size_t filterIdx( 0 ); filterIdx < newFilters.numberOfRows(); ++filterIdx )
+  {
+    setImpulseResponse( newFilters.row( filterIdx ), newFilters.numberOfColumns(), filterIdx, newFilters.alignmentElements() );
+  }
+}
+
+template< typename SampleType >
+void MultichannelConvolverDirect<SampleType>::initFilters( FilterBankFile<SampleType> const & filterBank )
+{
+  if( filterBank.numberOfFilters() > maxNumberOfFilterEntries() )
+  {
+    throw std::invalid_argument( "MultichannelConvolverDirect::initFilters(): The filter bank exceeds the maximum number of filter entries." );
+  }
+  if( filterBank.filterLength() > maxFilterLength() )
+  {
+    throw std::invalid_argument( "MultichannelConvolverDirect::initFilters(): The filter bank exceeds the maximum filter length." );
+  }
+  clearFilters();
+  for( std::size_t filterIdx( 0 ); filterIdx < filterBank.numberOfFilters(); ++filterIdx )
+  {
+    setImpulseResponse( filterBank.filter( filterIdx ), filterBank.filterLength(), filterIdx,
+                        filterBank.alignmentElements() );
+  }
+}
+
+template< typename SampleType >
+void MultichannelConvolverDirect<SampleType>::
+setImpulseResponse( SampleType const * ir, std::size_t filterLength, std::size_t filterIdx, std::size_t alignment /*= 0*/ )
+{
+  if( filterIdx >= maxNumberOfFilterEntries() )
+  {
+    throw std::invalid_argument( "MultichannelConvolverDirect::setImpulseResponse(): Filter index exceeds the admissible range." );
+  }
+  if( filterLength > maxFilterLength() )
+  {
+    throw std::invalid_argument( "MultichannelConvolverDirect::setImpulseResponse(): Filter length exceeds the admissible length." );
+  }
+  SampleType * const filter = mFilters.row( filterIdx );
+  std::size_t const filterAlignment = std::min( alignment, mFilters.alignmentElements() );
+  if( (efl::vectorCopy( ir, filter, filterLength, filterAlignment ) != efl::noError)
+    or (efl::vectorZero( filter + filterLength, maxFilterLength() - filterLength, 0 ) != efl::noError) )
+  {
+    throw std::runtime_error( "MultichannelConvolverDirect::setImpulseResponse(): Copying of the filter failed." );
+  }
+  updateFilterLength( filterIdx );
+}
+
+template< typename SampleType >
+void MultichannelConvolverDirect<SampleType>::updateFilterLength( std::size_t filterIdx )
+{
+  SampleType const * const filter = mFilters.row( filterIdx );
+  std::size_t length = maxFilterLength();
+  while( (length > 0) and (filter[length - 1] == static_cast<SampleType>(0.0)) )
+  {
+    --length;
+  }
+  mFilterLengths[filterIdx] = length;
+}
+
+namespace // unnamed
+{
+/**
+ * Empirical factor accounting for the lower efficiency of the FFT compared to the streaming multiply-add operations
+ * of the direct form (memory access patterns, bit reversal, and the overhead of the frequency-domain bookkeeping).
+ * Determined from measurements with the default FFT implementation, which placed the break-even point at filter
+ * lengths between 128 (64-sample blocks) and about 200 (1024-sample blocks).
+ */
+static double const cTransformOverhead = 3.5;
+} // unnamed namespace
+
+bool directConvolutionPreferred( std::size_t numberOfInputs,
+                                 std::size_t numberOfOutputs,
+                                 std::size_t blockLength,
+                                 std::size_t maxFilterLength,
+                                 std::size_t maxRoutingPoints )
+{
+  if( (blockLength == 0) or (maxFilterLength == 0) or (maxRoutingPoints == 0) )
+  {
+    return true;
+  }
+  double const dftSize = 2.0 * static_cast<double>(blockLength);
+  double const numPartitions = std::ceil( static_cast<double>(maxFilterLength) / static_cast<double>(blockLength) );
+  // Direct form: One multiply-add per filter tap and output sample for each routing point.
+  double const directCost = 2.0 * static_cast<double>(maxRoutingPoints) * static_cast<double>(maxFilterLength)
+    * static_cast<double>(blockLength);
+  // Fast convolution: One forward real-valued DFT per input, one inverse DFT per output, and one complex multiply-add
+  // per frequency bin and filter partition for each routing point.
+  double const transformCost = 2.5 * dftSize * std::log2( dftSize );
+  double const fastCost = static_cast<double>(numberOfInputs + numberOfOutputs) * cTransformOverhead * transformCost
+    + 8.0 * static_cast<double>(maxRoutingPoints) * numPartitions * static_cast<double>(blockLength + 1);
+  return directCost <= fastCost;
+}
+
+// explicit instantiations
+template class MultichannelConvolverDirect<float>;
+template class MultichannelConvolverDirect<double>;
+
+} // namespace rbbl
+} // namespace visr
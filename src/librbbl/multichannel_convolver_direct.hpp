@@ -0,0 +1,253 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRBBL_MULTICHANNEL_CONVOLVER_DIRECT_HPP_INCLUDED
+#define VISR_LIBRBBL_MULTICHANNEL_CONVOLVER_DIRECT_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+#include "filter_routing.hpp"
+
+#include <libefl/basic_matrix.hpp>
+
+#include <cstddef>
+#include <set>
+#include <vector>
+
+namespace visr
+{
+namespace rbbl
+{
+
+// Forward declaration
+template< typename SampleType >
+class FilterBankFile;
+
+/**
+ * Generic class for MIMO convolution using a direct-form (time-domain) FIR implementation.
+ * It provides the same routing and filter interface as MultichannelConvolverUniform, but computes the convolution
+ * directly as a sum of scaled and delayed input blocks. Each filter tap is applied to a complete block using the
+ * vectorised efl functions. For short filters, this avoids the transform overhead of the fast convolution.
+ * Use directConvolutionPreferred() to decide which of the two implementations is more efficient for a given
+ * configuration.
+ * @tparam SampleType The floating-point type of the signal samples
+ */
+template< typename SampleType >
+class VISR_RBBL_LIBRARY_SYMBOL MultichannelConvolverDirect
+{
+public:
+  /**
+   * Constructor.
+   * @param numberOfInputs The number of input signals processed.
+   * @param numberOfOutputs The number of output channels produced.
+   * @param blockLength The numbers of samples processed for each input or output channels in one process() call.
+   * @param maxFilterLength The maximum length of the FIR filters (in samples).
+   * @param maxRoutingPoints The maximum number of routing points between input and output channels.
+   * @param maxFilterEntries The maximum number of filters that can be stored within the convolver.
+   * @param initialRoutings The initial set of routing points.
+   * @param initialFilters The initial set of filter coefficients. The matrix rows represent the distinct filters.
+   * @param alignment The alignment (given as a multiple of the sample type size) to be used to allocate all data
+   * structure. It also guaranteees the alignment of the input and output samples to the process call.
+   */
+  explicit MultichannelConvolverDirect( std::size_t numberOfInputs,
+                                        std::size_t numberOfOutputs,
+                                        std::size_t blockLength,
+                                        std::size_t maxFilterLength,
+                                        std::size_t maxRoutingPoints,
+                                        std::size_t maxFilterEntries,
+                                        FilterRoutingList const & initialRoutings = FilterRoutingList(),
+                                        efl::BasicMatrix<SampleType> const & initialFilters = efl::BasicMatrix<SampleType>(),
+                                        std::size_t alignment = 0 );
+
+  /**
+   * Destructor.
+   */
+  ~MultichannelConvolverDirect();
+
+  std::size_t numberOfInputs() const { return mInputHistory.numberOfRows(); }
+
+  std::size_t numberOfOutputs() const { return mNumberOfOutputs; }
+
+  std::size_t blockLength() const { return mBlockLength; }
+
+  std::size_t maxNumberOfRoutingPoints() const { return mMaxNumberOfRoutingPoints; }
+
+  std::size_t maxNumberOfFilterEntries() const { return mFilters.numberOfRows(); }
+
+  std::size_t maxFilterLength() const { return mFilters.numberOfColumns(); }
+
+  std::size_t numberOfRoutingPoints() const { return mRoutingTable.size(); }
+
+  /**
+   * Return the length of a stored filter excluding trailing zero coefficients.
+   */
+  std::size_t filterLength( std::size_t filterIdx ) const { return mFilterLengths.at( filterIdx ); }
+
+  /**
+   * Process a block of input samples.
+   * @param input Base pointer of the input samples.
+   * @param inputStride Distance between the samples of consecutive input channels.
+   * @param output Base pointer of the output samples.
+   * @param outputStride Distance between the samples of consecutive output channels.
+   * @param alignment Alignment of the input and output samples, in samples.
+   * @param silentInputs Optional array of flags denoting silent inputs in the current block. Routing points are skipped
+   * once the input history of a silent input contains only silent blocks.
+   * @param silentOutputs Optional array to return for each output whether it is silent, i.e., whether no routing point
+   * contributed to it.
+   */
+  void process( SampleType const * const input, std::size_t inputStride,
+                SampleType * const output, std::size_t outputStride,
+                std::size_t alignment = 0,
+                bool const * silentInputs = nullptr,
+                bool * silentOutputs = nullptr );
+
+  /**
+   * Manipulation of the routing table.
+   * The semantics are identical to MultichannelConvolverUniform.
+   */
+  //@{
+  void clearRoutingTable();
+
+  /**
+   * @throw std::invalid_argument If the number of new entries exceeds the maximally permitted number of routings
+   * @throw std::invalid_argument If any input, output, or filter index exceeds the admissible range for the respective type.
+   */
+  void initRoutingTable( FilterRoutingList const & routings );
+
+  /**
+   * @throw std::invalid_argument If adding the entry would exceed the maximally permitted number of routings
+   * @throw std::invalid_argument If any input, output, or filter index exceeds the admissible range for the respective type.
+   */
+  void setRoutingEntry( FilterRouting const & routing );
+
+  void setRoutingEntry( std::size_t inputIdx, std::size_t outputIdx, std::size_t filterIdx, SampleType gain );
+
+  /**
+   * @return \p true if the entry was removes, \p false if not (i.e., the entry did not exist).
+   */
+  bool removeRoutingEntry( std::size_t inputIdx, std::size_t outputIdx );
+  //@}
+
+  /**
+   * Manipulation of the contained filters.
+   */
+  //@{
+  /**
+   * Reset all filters to zero.
+   */
+  void clearFilters();
+
+  /**
+   * Load a new set of impulse responses, resetting all prior loaded filters.
+   * @param newFilters The matrix of new filters, with each row representing a filter.
+   * @throw std::invalid_argument If the number of filters (number of rows) exceeds the maximum admissible number of filters.
+   * @throw std::invalid_argument If the length of the filters (number of matrix columns) exceeds the maximum admissible length,
+   */
+  void initFilters( efl::BasicMatrix<SampleType> const & newFilters );
+
+  /**
+   * Load a new set of filters from the time-domain data of a filter bank file, resetting all prior loaded filters.
+   * @throw std::invalid_argument If the number or the length of the filters exceed the admissible values.
+   */
+  void initFilters( FilterBankFile<SampleType> const & filterBank );
+
+  void setImpulseResponse( SampleType const * ir, std::size_t filterLength, std::size_t filterIdx, std::size_t alignment = 0 );
+  //@}
+private:
+  /**
+   * Recompute the effective length of a filter, i.e., its length without trailing zeros.
+   */
+  void updateFilterLength( std::size_t filterIdx );
+
+  struct RoutingEntry
+  {
+    explicit RoutingEntry( std::size_t in, std::size_t out, std::size_t filter, SampleType gain = 1.0f )
+      : inputIdx( in ), outputIdx( out ), filterIdx( filter ), gainLinear( gain )
+    {
+    }
+
+    std::size_t inputIdx;
+    std::size_t outputIdx;
+    std::size_t filterIdx;
+    SampleType gainLinear;
+  };
+
+  /**
+   * Function object for ordering the routings within the routing table, grouped by outputs.
+   */
+  struct CompareRoutings
+  {
+    bool operator()( RoutingEntry const & lhs, RoutingEntry const & rhs ) const
+    {
+      if( lhs.outputIdx == rhs.outputIdx )
+      {
+        return lhs.inputIdx < rhs.inputIdx;
+      }
+      else
+      {
+        return lhs.outputIdx < rhs.outputIdx;
+      }
+    }
+  };
+
+  using RoutingTable = std::multiset<RoutingEntry, CompareRoutings>;
+
+  RoutingTable mRoutingTable;
+
+  std::size_t const mNumberOfOutputs;
+
+  std::size_t const mBlockLength;
+
+  std::size_t const mMaxNumberOfRoutingPoints;
+
+  /**
+   * Number of past input samples kept in front of the current block in mInputHistory. This is the maximum filter
+   * length minus one, rounded up to the alignment to keep the current block aligned.
+   */
+  std::size_t const mHistoryLength;
+
+  /**
+   * The stored filters, one per row.
+   */
+  efl::BasicMatrix<SampleType> mFilters;
+
+  /**
+   * Effective length of each filter, excluding trailing zeros.
+   */
+  std::vector<std::size_t> mFilterLengths;
+
+  /**
+   * Past and current input samples, one row per input.
+   */
+  efl::BasicMatrix<SampleType> mInputHistory;
+
+  /**
+   * Number of consecutive silent blocks per input, saturated at mDecayBlocks+1.
+   */
+  std::vector<std::size_t> mSilentInputBlocks;
+
+  /**
+   * Number of blocks covered by the input history preceding the current block.
+   */
+  std::size_t const mDecayBlocks;
+
+  /**
+   * Flags denoting whether any routing point contributed to an output in the current block.
+   */
+  std::vector<char> mOutputContributions;
+};
+
+/**
+ * Cost model to select between direct-form and partitioned fast convolution.
+ * Compares the estimated number of floating-point operations per block of MultichannelConvolverDirect and
+ * MultichannelConvolverUniform for the given configuration, assuming that all routing points are active.
+ * @return \p true if the direct-form implementation is expected to be faster.
+ */
+VISR_RBBL_LIBRARY_SYMBOL bool directConvolutionPreferred( std::size_t numberOfInputs,
+                                                          std::size_t numberOfOutputs,
+                                                          std::size_t blockLength,
+                                                          std::size_t maxFilterLength,
+                                                          std::size_t maxRoutingPoints );
+
+} // namespace rbbl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRBBL_MULTICHANNEL_CONVOLVER_DIRECT_HPP_INCLUDED
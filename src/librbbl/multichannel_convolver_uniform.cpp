@@ -4,7 +4,11 @@
 
 #include <librbbl/fft_wrapper_factory.hpp>
 
+#include <libefl/vector_functions.hpp>
+
+#include <algorithm>
 #include <complex>
+#include <stdexcept>
 
 namespace visr
 {
@@ -27,6 +31,7 @@ MultichannelConvolverUniform( std::size_t numberOfInputs,
                    maxFilterEntries, initialFilters, alignment, fftImplementation)
   , mMaxNumberOfRoutingPoints( maxRoutingPoints )
   , mFrequencyDomainOutput( numberOfOutputs, mCoreConvolver.dftBlockRepresentationSize(), mCoreConvolver.complexAlignment() )
+  , mOutputContributions( numberOfOutputs, 0 )
 {
   initRoutingTable( initialRoutings );
 }
@@ -38,25 +43,45 @@ template< typename SampleType >
 void MultichannelConvolverUniform<SampleType>::
 process( SampleType const * const input, std::size_t inputChannelStride,
          SampleType * const output, std::size_t outputChannelStride,
-         std::size_t alignment /*= 0*/ )
+         std::size_t alignment /*= 0*/,
+         bool const * silentInputs /*= nullptr*/,
+         bool * silentOutputs /*= nullptr*/ )
 {
-  mCoreConvolver.processInputs( input, inputChannelStride, alignment );
-  processOutputs( output, outputChannelStride, alignment );
+  mCoreConvolver.processInputs( input, inputChannelStride, alignment, silentInputs );
+  processOutputs( output, outputChannelStride, alignment, silentOutputs );
 }
 
 template< typename SampleType >
 void MultichannelConvolverUniform<SampleType>::
 processOutputs( SampleType * const output, std::size_t outputChannelStride,
-                std::size_t alignment /*= 0*/ )
+                std::size_t alignment, bool * silentOutputs )
 {
   mFrequencyDomainOutput.zeroFill();
+  std::fill( mOutputContributions.begin(), mOutputContributions.end(), 0 );
   for( RoutingEntry const & routing : mRoutingTable )
   {
+    if( mCoreConvolver.inputDecayed( routing.inputIdx ) )
+    {
+      continue;
+    }
     mCoreConvolver.processFilter( routing.inputIdx, routing.filterIdx, routing.gainLinear, mFrequencyDomainOutput.row(routing.outputIdx), true /* add flag */ );
+    mOutputContributions[routing.outputIdx] = 1;
   }
   for( std::size_t outputIdx(0); outputIdx < numberOfOutputs(); ++outputIdx )
   {
-    mCoreConvolver.transformOutput( mFrequencyDomainOutput.row( outputIdx ), output + outputIdx * outputChannelStride );
+    SampleType * const outputChannel = output + outputIdx * outputChannelStride;
+    if( mOutputContributions[outputIdx] )
+    {
+      mCoreConvolver.transformOutput( mFrequencyDomainOutput.row( outputIdx ), outputChannel );
+    }
+    else if( efl::vectorZero( outputChannel, blockLength(), alignment ) != efl::noError )
+    {
+      throw std::runtime_error( "MultichannelConvolverUniform::processOutputs(): Zeroing of an output failed." );
+    }
+    if( silentOutputs )
+    {
+      silentOutputs[outputIdx] = not mOutputContributions[outputIdx];
+    }
   }
 }
 
@@ -144,6 +169,12 @@ void MultichannelConvolverUniform<SampleType>::initFilters( efl::BasicMatrix<Sam
   mCoreConvolver.initFilters( newFilters );
 }
 
+template< typename SampleType >
+void MultichannelConvolverUniform<SampleType>::initFilters( FilterBankFile<SampleType> const & filterBank )
+{
+  mCoreConvolver.initFilters( filterBank );
+}
+
 template< typename SampleType >
 void MultichannelConvolverUniform<SampleType>::
 setImpulseResponse( SampleType const * ir, std::size_t filterLength, std::size_t filterIdx, std::size_t alignment /*= 0*/ )
@@ -76,9 +76,23 @@ public:
 
   std::size_t numberOfRoutingPoints( ) const { return mRoutingTable.size(); }
 
+  /**
+   * Process a block of input samples.
+   * @param input Base pointer of the input samples.
+   * @param inputStride Distance between the samples of consecutive input channels.
+   * @param output Base pointer of the output samples.
+   * @param outputStride Distance between the samples of consecutive output channels.
+   * @param alignment Alignment of the input and output samples, in samples.
+   * @param silentInputs Optional array of flags denoting silent inputs in the current block. Routing points are skipped
+   * once the filter tail of a silent input has decayed, see CoreConvolverUniform::processInputs().
+   * @param silentOutputs Optional array to return for each output whether it is silent, i.e., whether no routing point
+   * contributed to it.
+   */
   void process( SampleType const * const input, std::size_t inputStride,
                 SampleType * const output, std::size_t outputStride,
-                std::size_t alignment = 0 );
+                std::size_t alignment = 0,
+                bool const * silentInputs = nullptr,
+                bool * silentOutputs = nullptr );
 
   /**
   * Manipulation of the routing table.
@@ -143,6 +157,12 @@ public:
    */
   void initFilters( efl::BasicMatrix<SampleType> const & newFilters );
 
+  /**
+   * Load a new set of filters from a filter bank file, resetting all prior loaded filters.
+   * @see CoreConvolverUniform::initFilters( FilterBankFile<SampleType> const & )
+   */
+  void initFilters( FilterBankFile<SampleType> const & filterBank );
+
   void setImpulseResponse( SampleType const * ir, std::size_t filterLength, std::size_t filterIdx, std::size_t alignment = 0 );
 
 private:
@@ -150,7 +170,7 @@ private:
    * Internal function to apply the filters and to set the oputputs.
    */
   void processOutputs( SampleType * const output, std::size_t outputChannelStride,
-                       std::size_t alignment );
+                       std::size_t alignment, bool * silentOutputs );
 
   CoreConvolverUniform<SampleType> mCoreConvolver;
 
@@ -192,6 +212,11 @@ private:
   std::size_t const mMaxNumberOfRoutingPoints;
 
   efl::BasicMatrix< typename CoreConvolverUniform<SampleType>::FrequencyDomainType > mFrequencyDomainOutput;
+
+  /**
+   * Flags denoting whether any routing point contributed to an output in the current block.
+   */
+  std::vector<char> mOutputContributions;
 };
 
 } // namespace rbbl
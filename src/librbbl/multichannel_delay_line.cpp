@@ -5,6 +5,8 @@
 #include <librbbl/circular_buffer.hpp>
 #include <librbbl/fractional_delay_factory.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <complex>
@@ -56,6 +58,12 @@ std::size_t MultichannelDelayLine<SampleType>::blockLength() const
   return cBlockLength;
 }
 
+template< typename SampleType >
+std::size_t MultichannelDelayLine<SampleType>::historyLength() const
+{
+  return mRingbuffer.length();
+}
+
 template< typename SampleType >
 SampleType MultichannelDelayLine<SampleType>::methodDelaySeconds() const
 {
@@ -100,6 +108,36 @@ void MultichannelDelayLine<SampleType>::interpolate( SampleType * output,
     startGain, endGain );
 }
 
+template <typename SampleType >
+void MultichannelDelayLine<SampleType>::interpolateAccumulate( std::size_t channelIdx,
+                                                               SampleType * const * outputs,
+                                                               std::size_t numberOfOutputs,
+                                                               std::size_t numberOfSamples,
+                                                               SampleType const * startDelays, SampleType const * endDelays,
+                                                               SampleType const * startGains, SampleType const * endGains )
+{
+  if( channelIdx >= numberOfChannels() )
+  {
+    throw std::invalid_argument( "MultichannelDelayLine<SampleType>::interpolateAccumulate()" );
+  }
+  constexpr std::size_t groupSize = FractionalDelayBase<SampleType>::cMaxParallelOutputs;
+  SampleType const * const readPointer = mRingbuffer.getReadPointer( channelIdx, 1 );
+  std::array<SampleType, groupSize> adjustedStartDelays;
+  std::array<SampleType, groupSize> adjustedEndDelays;
+  for( std::size_t groupStart( 0 ); groupStart < numberOfOutputs; groupStart += groupSize )
+  {
+    std::size_t const numGroupOutputs = std::min( numberOfOutputs - groupStart, groupSize );
+    for( std::size_t idx( 0 ); idx < numGroupOutputs; ++idx )
+    {
+      adjustedStartDelays[idx] = adjustDelay( startDelays[groupStart + idx] );
+      adjustedEndDelays[idx] = adjustDelay( endDelays[groupStart + idx] );
+    }
+    mInterpolator->interpolateAccumulate( readPointer, outputs + groupStart, numGroupOutputs, numberOfSamples,
+                                          adjustedStartDelays.data(), adjustedEndDelays.data(),
+                                          startGains + groupStart, endGains + groupStart );
+  }
+}
+
 template <typename SampleType >
 SampleType MultichannelDelayLine<SampleType>::
 adjustDelay( SampleType rawDelay ) const
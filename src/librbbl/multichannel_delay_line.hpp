@@ -78,6 +78,12 @@ public:
    */
   std::size_t blockLength() const;
 
+  /**
+   * Return the number of past samples held for each channel.
+   * After writing this number of zero-valued samples into a channel, all interpolated outputs of this channel are zero.
+   */
+  std::size_t historyLength() const;
+
   /**
   * Return the inherent method delay (or implementation delay).
   * @return Implementation delay in seconds.
@@ -131,6 +137,30 @@ public:
                     SampleType startDelay, SampleType endDelay,
                     SampleType startGain, SampleType endGain );
 
+  /**
+   * Interpolate one input channel for several outputs at once and add the scaled results to the output buffers.
+   * This reads the history of the channel once for all outputs and is therefore more efficient than separate
+   * interpolate() calls if a channel is routed to multiple outputs.
+   * Delays and gains are interpolated linearly in the same way as in interpolate().
+   * @param channelIdx The delay line channel to be interpolated. Must be in the range $0 <= channelIndex < numberOfChannels()$.
+   * @param outputs Array of \p numberOfOutputs output buffers, each holding at least \p numberOfSamples values.
+   * The interpolated signals are added to the existing content.
+   * @param numberOfOutputs The number of output signals.
+   * @param numberOfSamples The number of samples to be generated.
+   * @param startDelays Array of \p numberOfOutputs start delay values (in seconds).
+   * @param endDelays Array of \p numberOfOutputs end delay values (in seconds).
+   * @param startGains Array of \p numberOfOutputs start gain values (linear scale).
+   * @param endGains Array of \p numberOfOutputs end gain values (linear scale).
+   * @throw std::invalid_argument If \p channelIndex exceeds the number of channels in the delay line.
+   * @throw std::out_of_range If any of the delay values is not admissible, see interpolate().
+   */
+  void interpolateAccumulate( std::size_t channelIdx,
+                              SampleType * const * outputs,
+                              std::size_t numberOfOutputs,
+                              std::size_t numberOfSamples,
+                              SampleType const * startDelays, SampleType const * endDelays,
+                              SampleType const * startGains, SampleType const * endGains );
+
 private:
   /**
    * Adjust the delay for the method delay of the interpolator depending on the chosen policy and scale it from seconds to samples.
@@ -6,11 +6,14 @@
 #include "parametric_iir_coefficient.hpp"
 
 #include <libefl/db_linear_conversion.hpp>
-
+#include <libefl/vector_math.hpp>
 
 #include <boost/math/constants/constants.hpp>
 
+#include <algorithm>
+#include <ciso646>
 #include <cmath>
+#include <stdexcept>
 
 namespace visr
 {
@@ -41,15 +44,21 @@ BiquadCoefficient<double> ParametricIirCoefficientCalculator::
 calculateIirCoefficients<double>(ParametricIirCoefficient<double> const &, double);
 /// @endcond NEVER
 
+namespace // unnamed
+{
+
+/**
+ * Compute the biquad coefficients of a parametric filter from the precomputed transcendental terms.
+ * @param sinW0 Sine of the normalised angular centre/cutoff frequency w0.
+ * @param cw0 Cosine of w0.
+ * @param A Square root of the linear gain, i.e., 10^(gain/40). Used only by the peak and shelving types.
+ */
 template< typename T >
-void ParametricIirCoefficientCalculator::
-calculateIirCoefficients( ParametricIirCoefficient<T> const & param,
-                          BiquadCoefficient<T> & coeffs,
-                          T samplingFrequency )
+void calculateFromTerms( ParametricIirCoefficient<T> const & param,
+                         T sinW0, T cw0, T A,
+                         BiquadCoefficient<T> & coeffs )
 {
-  T const w0 = static_cast<T>(2.0) * boost::math::constants::pi<T>()*param.frequency() / samplingFrequency;
-  T const alpha = std::sin( w0 ) / (static_cast<T>(2.0) * param.quality() );
-  T const cw0 = std::cos( w0 );
+  T const alpha = sinW0 / (static_cast<T>(2.0) * param.quality() );
 
   switch( param.type() )
   {
@@ -142,7 +151,6 @@ calculateIirCoefficients( ParametricIirCoefficient<T> const & param,
       // a0 = 1 + alpha / A
       // a1 = -2 * cos( w0 )
       // a2 = 1 - alpha / A
-      T const A = std::sqrt( efl::dB2linear( param.gain() ) );
       T const a0 = static_cast<T>(1.0) + alpha/A;
       coeffs.b0() = (static_cast<T>(1.0) + A *alpha) / a0;
       coeffs.b1() = (static_cast<T>(-2.0)*cw0)/a0;
@@ -159,7 +167,6 @@ calculateIirCoefficients( ParametricIirCoefficient<T> const & param,
       //  a0 = (A + 1) + (A - 1)*cos( w0 ) + 2 * sqrt( A )*alpha
       //  a1 = -2 * ((A - 1) + (A + 1)*cos( w0 ))
       //  a2 = (A + 1) + (A - 1)*cos( w0 ) - 2 * sqrt( A )*alpha
-      T const A = std::sqrt( efl::dB2linear( param.gain() ) );
       T const Asqrt = sqrt( A );
       T const a0 = (A + static_cast<T>(1.0)) + (A - static_cast<T>(1.0))*cw0 + static_cast<T>(2.0) * Asqrt*alpha;
       coeffs.b0() = A*((A + static_cast<T>(1.0)) - (A - static_cast<T>(1.0))*cw0 + static_cast<T>(2.0) * Asqrt*alpha)/a0 ;
@@ -177,7 +184,6 @@ calculateIirCoefficients( ParametricIirCoefficient<T> const & param,
       //  a0 = (A + 1) - (A - 1)*cos( w0 ) + 2 * sqrt( A )*alpha
       //  a1 = 2 * ((A - 1) - (A + 1)*cos( w0 ))
       //  a2 = (A + 1) - (A - 1)*cos( w0 ) - 2 * sqrt( A )*alpha
-      T const A = std::sqrt( efl::dB2linear( param.gain() ) );
       T const Asqrt = sqrt( A );
       T const a0 = (A + static_cast<T>(1.0)) - (A - static_cast<T>(1.0))*cw0 + static_cast<T>(2.0) * Asqrt*alpha;
       coeffs.b0() = A*((A + static_cast<T>(1.0)) + (A - static_cast<T>(1.0))*cw0 + static_cast<T>(2.0) * Asqrt*alpha) / a0;
@@ -190,6 +196,18 @@ calculateIirCoefficients( ParametricIirCoefficient<T> const & param,
   }
 }
 
+} // unnamed namespace
+
+template< typename T >
+void ParametricIirCoefficientCalculator::
+calculateIirCoefficients( ParametricIirCoefficient<T> const & param,
+                          BiquadCoefficient<T> & coeffs,
+                          T samplingFrequency )
+{
+  T const w0 = static_cast<T>(2.0) * boost::math::constants::pi<T>()*param.frequency() / samplingFrequency;
+  calculateFromTerms( param, std::sin( w0 ), std::cos( w0 ), std::sqrt( efl::dB2linear( param.gain() ) ), coeffs );
+}
+
 // Explicit instantiations
 // Note: This code needs to be excluded from Doxygen documentation generation to avoid
 // warnings about non-matching class members.
@@ -213,10 +231,37 @@ void ParametricIirCoefficientCalculator::calculateIirCoefficients( ParametricIir
   {
     throw std::invalid_argument( "calculateIirCoefficients(): The output argument list \"coeffs\" holds less elements than the input list \"params\"." );
   }
-  typename BiquadCoefficientList<CoefficientType>::iterator it = std::transform( params.begin(), params.end(), coeffs.begin(),
-     [samplingFrequency]( ParametricIirCoefficient<CoefficientType> const & params ) { return calculateIirCoefficients<CoefficientType>( params, samplingFrequency ); } );
+  using T = CoefficientType;
+  // Compute the transcendental terms for batches of sections using the vectorised efl functions.
+  // The fixed-size buffers avoid memory allocations, as this function is typically called in the audio thread.
+  std::size_t const batchSize = 32;
+  T w0[batchSize];
+  T sinW0[batchSize];
+  T cosW0[batchSize];
+  T A[batchSize];
+  std::size_t const numParams = params.size();
+  for( std::size_t batchStart( 0 ); batchStart < numParams; batchStart += batchSize )
+  {
+    std::size_t const numElements = std::min( batchSize, numParams - batchStart );
+    for( std::size_t idx( 0 ); idx < numElements; ++idx )
+    {
+      ParametricIirCoefficient<T> const & param = params[batchStart + idx];
+      w0[idx] = static_cast<T>(2.0) * boost::math::constants::pi<T>()*param.frequency() / samplingFrequency;
+      // Halving the level in dB yields the square root of the linear gain.
+      A[idx] = static_cast<T>(0.5) * param.gain();
+    }
+    if( (efl::vectorSinCos( w0, sinW0, cosW0, numElements ) != efl::noError)
+      or (efl::vectorDB2Linear( A, A, numElements ) != efl::noError) )
+    {
+      throw std::runtime_error( "calculateIirCoefficients(): Error while computing the filter terms." );
+    }
+    for( std::size_t idx( 0 ); idx < numElements; ++idx )
+    {
+      calculateFromTerms( params[batchStart + idx], sinW0[idx], cosW0[idx], A[idx], coeffs[batchStart + idx] );
+    }
+  }
   // Fill the remaining entries in coeffs with default (flat) biquad parameters.
-  std::fill( it, coeffs.end(), BiquadCoefficient<CoefficientType>() );
+  std::fill( coeffs.begin() + numParams, coeffs.end(), BiquadCoefficient<CoefficientType>() );
 }
 
 // Note: This code needs to be excluded from Doxygen documentation generation to avoid
@@ -0,0 +1,113 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librbbl/crossfading_convolver_uniform.hpp>
+#include <librbbl/multichannel_convolver_uniform.hpp>
+
+#include <libefl/basic_matrix.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <ciso646>
+#include <cmath>
+#include <cstddef>
+#include <random>
+
+namespace visr
+{
+namespace rbbl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+template< typename SampleType >
+void fillRandom( efl::BasicMatrix<SampleType> & mtx, std::mt19937 & gen )
+{
+  std::uniform_real_distribution<SampleType> dist( -1.0, 1.0 );
+  for( std::size_t rowIdx( 0 ); rowIdx < mtx.numberOfRows(); ++rowIdx )
+  {
+    std::generate( mtx.row( rowIdx ), mtx.row( rowIdx ) + mtx.numberOfColumns(), [&]() { return dist( gen ); } );
+  }
+}
+
+} // unnamed namespace
+
+/**
+ * Compare the crossfading convolver against two static convolvers holding the filters before and after a
+ * filter change. Outside the transition, the output must match the respective static convolver, and during the
+ * transition the linear combination of both.
+ */
+BOOST_AUTO_TEST_CASE( CrossfadingConvolverTransition )
+{
+  using SampleType = float;
+  std::size_t const alignment = 8;
+  std::size_t const numInputs = 2;
+  std::size_t const numOutputs = 3; // Output 2 has no routings and must be zero.
+  std::size_t const blockLength = 16;
+  std::size_t const filterLength = 40;
+  std::size_t const numFilters = 3;
+  std::size_t const transitionSamples = 40;
+  std::size_t const numBlocksBefore = 5;
+  std::size_t const numBlocksAfter = 8;
+
+  std::mt19937 gen( 17 );
+  efl::BasicMatrix<SampleType> filters( numFilters, filterLength, alignment );
+  fillRandom( filters, gen );
+  efl::BasicMatrix<SampleType> newFilters( numFilters, filterLength, alignment );
+  newFilters.copy( filters );
+  std::uniform_real_distribution<SampleType> dist( -1.0, 1.0 );
+  std::generate( newFilters.row( 1 ), newFilters.row( 1 ) + filterLength, [&]() { return dist( gen ); } );
+
+  FilterRoutingList const routings( { { 0, 0, 0, 1.0f }, { 1, 0, 1, 0.5f }, { 1, 1, 2, 1.0f } } );
+
+  CrossfadingConvolverUniform<SampleType> conv( numInputs, numOutputs, blockLength, filterLength, routings.size(),
+    numFilters, transitionSamples, routings, filters, alignment, "kissfft" );
+  MultichannelConvolverUniform<SampleType> refOld( numInputs, numOutputs, blockLength, filterLength, routings.size(),
+    numFilters, routings, filters, alignment, "kissfft" );
+  MultichannelConvolverUniform<SampleType> refNew( numInputs, numOutputs, blockLength, filterLength, routings.size(),
+    numFilters, routings, newFilters, alignment, "kissfft" );
+
+  efl::BasicMatrix<SampleType> input( numInputs, blockLength, alignment );
+  efl::BasicMatrix<SampleType> output( numOutputs, blockLength, alignment );
+  efl::BasicMatrix<SampleType> outputOld( numOutputs, blockLength, alignment );
+  efl::BasicMatrix<SampleType> outputNew( numOutputs, blockLength, alignment );
+
+  SampleType const tolerance = 1.0e-4f;
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocksBefore + numBlocksAfter; ++blockIdx )
+  {
+    if( blockIdx == numBlocksBefore )
+    {
+      conv.setImpulseResponse( newFilters.row( 1 ), filterLength, 1, true /*start transition*/, alignment );
+    }
+    fillRandom( input, gen );
+    conv.process( input.data(), input.stride(), output.data(), output.stride(), alignment );
+    refOld.process( input.data(), input.stride(), outputOld.data(), outputOld.stride(), alignment );
+    refNew.process( input.data(), input.stride(), outputNew.data(), outputNew.stride(), alignment );
+
+    SampleType maxError = 0.0f;
+    for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+    {
+      for( std::size_t sampleIdx( 0 ); sampleIdx < blockLength; ++sampleIdx )
+      {
+        SampleType weightNew = 0.0f;
+        if( blockIdx >= numBlocksBefore )
+        {
+          std::size_t const transitionIdx = (blockIdx - numBlocksBefore) * blockLength + sampleIdx;
+          weightNew = std::min( static_cast<SampleType>(transitionIdx + 1) / static_cast<SampleType>(transitionSamples),
+                                1.0f );
+        }
+        SampleType const expected = weightNew * outputNew( outIdx, sampleIdx )
+          + (1.0f - weightNew) * outputOld( outIdx, sampleIdx );
+        maxError = std::max( maxError, std::abs( output( outIdx, sampleIdx ) - expected ) );
+      }
+    }
+    BOOST_CHECK_MESSAGE( maxError <= tolerance, "Block " << blockIdx << ": maximum deviation " << maxError );
+  }
+}
+
+} // namespace test
+} // namespace rbbl
+} // namespace visr
@@ -0,0 +1,200 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librbbl/core_convolver_uniform.hpp>
+#include <librbbl/filter_bank_file.hpp>
+
+#include <libefl/basic_matrix.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace visr
+{
+namespace rbbl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+/**
+ * Temporary file that is removed when the object goes out of scope.
+ */
+class TemporaryFile
+{
+public:
+  TemporaryFile()
+   : mPath( boost::filesystem::temp_directory_path() / boost::filesystem::unique_path( "visr_filter_bank_%%%%-%%%%.bin" ) )
+  {
+  }
+
+  ~TemporaryFile()
+  {
+    boost::system::error_code ec;
+    boost::filesystem::remove( mPath, ec );
+  }
+
+  std::string name() const { return mPath.string(); }
+private:
+  boost::filesystem::path const mPath;
+};
+
+efl::BasicMatrix<float> randomFilters( std::size_t numFilters, std::size_t filterLength )
+{
+  std::mt19937 gen( 17 );
+  std::uniform_real_distribution<float> dist( -1.0f, 1.0f );
+  efl::BasicMatrix<float> filters( numFilters, filterLength, 16 );
+  for( std::size_t rowIdx( 0 ); rowIdx < numFilters; ++rowIdx )
+  {
+    for( std::size_t colIdx( 0 ); colIdx < filterLength; ++colIdx )
+    {
+      filters( rowIdx, colIdx ) = dist( gen );
+    }
+  }
+  return filters;
+}
+
+/**
+ * Check that two convolvers hold identical frequency-domain filter representations.
+ */
+void checkSameFilters( CoreConvolverUniform<float> const & lhs, CoreConvolverUniform<float> const & rhs,
+                       float tolerance )
+{
+  std::size_t const numBins = lhs.blockLength() + 1;
+  float maxDiff = 0.0f;
+  for( std::size_t filterIdx( 0 ); filterIdx < lhs.maxNumberOfFilterEntries(); ++filterIdx )
+  {
+    for( std::size_t partIdx( 0 ); partIdx < lhs.numberOfFilterPartitions(); ++partIdx )
+    {
+      auto const * lhsPart = lhs.getFdFilterPartition( filterIdx, partIdx );
+      auto const * rhsPart = rhs.getFdFilterPartition( filterIdx, partIdx );
+      for( std::size_t binIdx( 0 ); binIdx < numBins; ++binIdx )
+      {
+        maxDiff = std::max( maxDiff, std::abs( lhsPart[binIdx] - rhsPart[binIdx] ) );
+      }
+    }
+  }
+  BOOST_CHECK_LE( maxDiff, tolerance );
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( FilterBankFileTimeDomain )
+{
+  std::size_t const numFilters = 5;
+  std::size_t const filterLength = 123;
+  efl::BasicMatrix<float> const filters = randomFilters( numFilters, filterLength );
+  TemporaryFile file;
+  FilterBankFile<float>::write( file.name(), filters );
+
+  FilterBankFile<float> const bank( file.name() );
+  BOOST_CHECK_EQUAL( bank.numberOfFilters(), numFilters );
+  BOOST_CHECK_EQUAL( bank.filterLength(), filterLength );
+  BOOST_CHECK( not bank.hasFrequencyDomainData() );
+  BOOST_CHECK_THROW( bank.frequencyDomainFilter( 0 ), std::logic_error );
+  BOOST_CHECK_THROW( bank.filter( numFilters ), std::out_of_range );
+  for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+  {
+    float const * const ir = bank.filter( filterIdx );
+    BOOST_CHECK_EQUAL( reinterpret_cast<std::uintptr_t>(ir) % FilterBankFile<float>::cDataAlignmentBytes, 0 );
+    BOOST_CHECK_EQUAL_COLLECTIONS( ir, ir + filterLength, filters.row( filterIdx ), filters.row( filterIdx ) + filterLength );
+  }
+  // Files for a different sample type are rejected.
+  BOOST_CHECK_THROW( FilterBankFile<double>{ file.name() }, std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE( FilterBankFileLoadConvolver )
+{
+  std::size_t const numFilters = 4;
+  std::size_t const filterLength = 300;
+  std::size_t const blockLength = 64;
+  efl::BasicMatrix<float> const filters = randomFilters( numFilters, filterLength );
+  TemporaryFile fdFile;
+  FilterBankFile<float>::write( fdFile.name(), filters, blockLength, "default" );
+  TemporaryFile tdFile;
+  FilterBankFile<float>::write( tdFile.name(), filters );
+
+  FilterBankFile<float> const fdBank( fdFile.name() );
+  BOOST_CHECK( fdBank.hasFrequencyDomainData() );
+  BOOST_CHECK_EQUAL( fdBank.blockLength(), blockLength );
+  // The alias "default" is stored as the name of the library it denotes in this build.
+  CoreConvolverUniform<float> reference( 1, 1, blockLength, 2 * filterLength, numFilters + 2, filters, 8 );
+  BOOST_CHECK_EQUAL( fdBank.fftImplementation(), reference.fftLibrary() );
+  BOOST_CHECK_NE( fdBank.fftImplementation(), "default" );
+  BOOST_CHECK_EQUAL( fdBank.filterScalingFactor(), static_cast<double>( reference.filterScalingFactor() ) );
+
+  // The reference convolver transforms the filters from the matrix. The others use a different alignment and
+  // a larger maximum filter length, so the frequency-domain data must be copied partition-wise.
+  CoreConvolverUniform<float> fromFdFile( 1, 1, blockLength, 2 * filterLength, numFilters + 2, efl::BasicMatrix<float>(), 8 );
+  fromFdFile.initFilters( fdBank );
+  checkSameFilters( reference, fromFdFile, 0.0f );
+
+  FilterBankFile<float> const tdBank( tdFile.name() );
+  CoreConvolverUniform<float> fromTdFile( 1, 1, blockLength, 2 * filterLength, numFilters + 2, efl::BasicMatrix<float>(), 8 );
+  fromTdFile.initFilters( tdBank );
+  checkSameFilters( reference, fromTdFile, 0.0f );
+
+  // A different block length falls back to transforming the impulse responses.
+  CoreConvolverUniform<float> otherBlockReference( 1, 1, 2 * blockLength, filterLength, numFilters, filters, 8 );
+  CoreConvolverUniform<float> otherBlock( 1, 1, 2 * blockLength, filterLength, numFilters, efl::BasicMatrix<float>(), 8 );
+  otherBlock.initFilters( fdBank );
+  checkSameFilters( otherBlockReference, otherBlock, 0.0f );
+
+  CoreConvolverUniform<float> tooSmall( 1, 1, blockLength, filterLength, numFilters - 1, efl::BasicMatrix<float>(), 8 );
+  BOOST_CHECK_THROW( tooSmall.initFilters( fdBank ), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE( FilterBankFileOtherFftLibrary )
+{
+  std::size_t const numFilters = 3;
+  std::size_t const filterLength = 200;
+  std::size_t const blockLength = 32;
+  efl::BasicMatrix<float> const filters = randomFilters( numFilters, filterLength );
+  CoreConvolverUniform<float> reference( 1, 1, blockLength, filterLength, numFilters, filters, 8, "kissfft" );
+  for( char const * fftLibrary : { "ffts", "ipp" } )
+  {
+    TemporaryFile file;
+    try
+    {
+      FilterBankFile<float>::write( file.name(), filters, blockLength, fftLibrary );
+    }
+    catch( std::exception const & )
+    {
+      continue; // The library is not available in this build.
+    }
+    FilterBankFile<float> const bank( file.name() );
+    BOOST_CHECK_EQUAL( bank.fftImplementation(), fftLibrary );
+    // The frequency-domain data of another library must not be used, the impulse responses are transformed instead.
+    CoreConvolverUniform<float> loaded( 1, 1, blockLength, filterLength, numFilters, efl::BasicMatrix<float>(), 8, "kissfft" );
+    loaded.initFilters( bank );
+    checkSameFilters( reference, loaded, 0.0f );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( FilterBankFileInvalid )
+{
+  BOOST_CHECK_THROW( FilterBankFile<float>{ "nonexistent_filter_bank_file.bin" }, std::invalid_argument );
+  TemporaryFile file;
+  {
+    std::ofstream stream( file.name(), std::ios::binary );
+    stream << "This is not a filter bank file, but it is long enough to hold a header. "
+      "This is not a filter bank file, but it is long enough to hold a header. "
+      "This is not a filter bank file, but it is long enough to hold a header. "
+      "This is not a filter bank file, but it is long enough to hold a header.";
+  }
+  BOOST_CHECK_THROW( FilterBankFile<float>{ file.name() }, std::invalid_argument );
+}
+
+} // namespace test
+} // namespace rbbl
+} // namespace visr
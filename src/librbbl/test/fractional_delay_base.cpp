@@ -0,0 +1,103 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librbbl/fractional_delay_base.hpp>
+#include <librbbl/lagrange_interpolator.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace visr
+{
+namespace rbbl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+/**
+ * Interpolator that implements only the mandatory interface of FractionalDelayBase, thus using the default
+ * implementation of interpolateAccumulate().
+ */
+class InterpolateOnly: public FractionalDelayBase<double>
+{
+public:
+  explicit InterpolateOnly( std::size_t maxNumSamples )
+   : mInterpolator( maxNumSamples )
+  {
+  }
+
+  double methodDelay() const override
+  {
+    return mInterpolator.methodDelay();
+  }
+
+  void interpolate( double const * basePointer, double * result, std::size_t numSamples,
+                    double startDelay, double endDelay, double startGain, double endGain ) override
+  {
+    mInterpolator.interpolate( basePointer, result, numSamples, startDelay, endDelay, startGain, endGain );
+  }
+private:
+  LagrangeInterpolator<double, 3> mInterpolator;
+};
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( FractionalDelayDefaultInterpolateAccumulate )
+{
+  // Longer than the scratch buffer of the default implementation to exercise the splitting of the ramps.
+  std::size_t const numSamples = 150;
+  std::size_t const numOutputs = 3;
+  std::size_t const history = 64;
+
+  std::vector<double> input( numSamples + history );
+  for( std::size_t idx( 0 ); idx < input.size(); ++idx )
+  {
+    input[idx] = std::sin( 0.05 * static_cast<double>(idx) ) + 0.1 * std::cos( 0.7 * static_cast<double>(idx) );
+  }
+  double const * basePointer = input.data() + input.size();
+
+  std::vector<double> const startDelays{ 2.0, 7.25, 31.5 };
+  std::vector<double> const endDelays{ 2.0, 12.8, 20.1 };
+  std::vector<double> const startGains{ 1.0, 0.5, 0.0 };
+  std::vector<double> const endGains{ 1.0, -0.25, 0.75 };
+
+  InterpolateOnly defaultImpl( numSamples );
+  LagrangeInterpolator<double, 3> reference( numSamples );
+
+  std::vector<std::vector<double> > defaultOutputs( numOutputs, std::vector<double>( numSamples, 1.0 ) );
+  std::vector<std::vector<double> > referenceOutputs( numOutputs, std::vector<double>( numSamples, 1.0 ) );
+  std::vector<double *> defaultPtrs;
+  std::vector<double *> referencePtrs;
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    defaultPtrs.push_back( defaultOutputs[outIdx].data() );
+    referencePtrs.push_back( referenceOutputs[outIdx].data() );
+  }
+
+  defaultImpl.interpolateAccumulate( basePointer, defaultPtrs.data(), numOutputs, numSamples,
+                                     startDelays.data(), endDelays.data(), startGains.data(), endGains.data() );
+  reference.interpolateAccumulate( basePointer, referencePtrs.data(), numOutputs, numSamples,
+                                   startDelays.data(), endDelays.data(), startGains.data(), endGains.data() );
+
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    for( std::size_t sampleIdx( 0 ); sampleIdx < numSamples; ++sampleIdx )
+    {
+      BOOST_CHECK_SMALL( defaultOutputs[outIdx][sampleIdx] - referenceOutputs[outIdx][sampleIdx], 1e-9 );
+    }
+  }
+
+  BOOST_CHECK_THROW( defaultImpl.interpolateAccumulate( basePointer, defaultPtrs.data(),
+                                                        FractionalDelayBase<double>::cMaxParallelOutputs + 1,
+                                                        numSamples, startDelays.data(), endDelays.data(),
+                                                        startGains.data(), endGains.data() ),
+                     std::invalid_argument );
+}
+
+} // namespace test
+} // namespace rbbl
+} // namespace visr
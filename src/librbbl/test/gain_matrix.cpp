@@ -0,0 +1,196 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librbbl/gain_matrix.hpp>
+
+#include <libefl/basic_matrix.hpp>
+#include <libefl/initialise_library.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace visr
+{
+namespace rbbl
+{
+namespace test
+{
+
+/**
+ * The matrix-product path used for contiguous channels outside gain transitions must produce the same output as
+ * the channel-wise path used for scattered channel pointers.
+ */
+BOOST_AUTO_TEST_CASE( GainMatrixContiguousMatchesScattered )
+{
+  using SampleType = float;
+  std::size_t const alignment = 8;
+  std::size_t const numInputs = 6;
+  std::size_t const numOutputs = 5;
+  std::size_t const blockLength = 64;
+  std::size_t const interpolationSteps = 2 * blockLength;
+  std::size_t const numBlocks = 8;
+
+  efl::initialiseLibrary();
+  std::mt19937 gen( 11 );
+  std::uniform_real_distribution<SampleType> dist( -1.0f, 1.0f );
+  efl::BasicMatrix<SampleType> initialGains( numOutputs, numInputs, alignment );
+  efl::BasicMatrix<SampleType> newGains( numOutputs, numInputs, alignment );
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    std::generate( initialGains.row( outIdx ), initialGains.row( outIdx ) + numInputs, [&]() { return dist( gen ); } );
+    std::generate( newGains.row( outIdx ), newGains.row( outIdx ) + numInputs, [&]() { return dist( gen ); } );
+  }
+
+  GainMatrix<SampleType> contiguousMatrix( numInputs, numOutputs, blockLength, interpolationSteps, initialGains, alignment );
+  GainMatrix<SampleType> scatteredMatrix( numInputs, numOutputs, blockLength, interpolationSteps, initialGains, alignment );
+
+  efl::BasicMatrix<SampleType> input( numInputs, blockLength, alignment );
+  efl::BasicMatrix<SampleType> contiguousOutput( numOutputs, blockLength, alignment );
+  // Reverse the channel order to obtain channel pointers with a non-uniform stride.
+  efl::BasicMatrix<SampleType> scatteredInput( numInputs, blockLength, alignment );
+  efl::BasicMatrix<SampleType> scatteredOutput( numOutputs, blockLength, alignment );
+  std::vector<SampleType const *> inputPtrs( numInputs );
+  std::vector<SampleType const *> scatteredInputPtrs( numInputs );
+  std::vector<SampleType *> outputPtrs( numOutputs );
+  std::vector<SampleType *> scatteredOutputPtrs( numOutputs );
+  for( std::size_t inIdx( 0 ); inIdx < numInputs; ++inIdx )
+  {
+    inputPtrs[inIdx] = input.row( inIdx );
+    scatteredInputPtrs[inIdx] = scatteredInput.row( numInputs - 1 - inIdx );
+  }
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    outputPtrs[outIdx] = contiguousOutput.row( outIdx );
+    scatteredOutputPtrs[outIdx] = scatteredOutput.row( numOutputs - 1 - outIdx );
+  }
+
+  SampleType maxError = 0.0f;
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    if( blockIdx == 2 )
+    {
+      contiguousMatrix.setNewGains( newGains );
+      scatteredMatrix.setNewGains( newGains );
+    }
+    for( std::size_t inIdx( 0 ); inIdx < numInputs; ++inIdx )
+    {
+      std::generate( input.row( inIdx ), input.row( inIdx ) + blockLength, [&]() { return dist( gen ); } );
+      std::copy( input.row( inIdx ), input.row( inIdx ) + blockLength, scatteredInput.row( numInputs - 1 - inIdx ) );
+    }
+    contiguousMatrix.process( &inputPtrs[0], &outputPtrs[0] );
+    scatteredMatrix.process( &scatteredInputPtrs[0], &scatteredOutputPtrs[0] );
+    for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+    {
+      for( std::size_t sampleIdx( 0 ); sampleIdx < blockLength; ++sampleIdx )
+      {
+        maxError = std::max( maxError, std::abs( contiguousOutput( outIdx, sampleIdx )
+          - scatteredOutput( numOutputs - 1 - outIdx, sampleIdx ) ) );
+      }
+    }
+  }
+  BOOST_CHECK_LE( maxError, 1.0e-5f );
+
+  // Check the final state against the new gains.
+  SampleType expected = 0.0f;
+  for( std::size_t inIdx( 0 ); inIdx < numInputs; ++inIdx )
+  {
+    expected += newGains( 1, inIdx ) * input( inIdx, 7 );
+  }
+  BOOST_CHECK_SMALL( contiguousOutput( 1, 7 ) - expected, 1.0e-5f );
+}
+
+/**
+ * Passing the same gains in every block, as rcl::GainMatrix does for its gain input, must not restart the transition.
+ * After the transition, both the complete and the subset process() overloads compute the exact matrix product.
+ */
+BOOST_AUTO_TEST_CASE( GainMatrixRepeatedGainsFinishTransition )
+{
+  using SampleType = float;
+  std::size_t const alignment = 8;
+  std::size_t const numInputs = 4;
+  std::size_t const numOutputs = 3;
+  std::size_t const blockLength = 32;
+  std::size_t const interpolationPeriods = 3;
+  std::size_t const numBlocks = 6;
+
+  efl::initialiseLibrary();
+  efl::BasicMatrix<SampleType> gains( numOutputs, numInputs, alignment );
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    for( std::size_t inIdx( 0 ); inIdx < numInputs; ++inIdx )
+    {
+      gains( outIdx, inIdx ) = static_cast<SampleType>( outIdx + 1 ) - 0.5f * static_cast<SampleType>( inIdx );
+    }
+  }
+  GainMatrix<SampleType> matrix( numInputs, numOutputs, blockLength, interpolationPeriods * blockLength,
+                                 0.0f, alignment );
+  BOOST_CHECK( not matrix.transitionActive() );
+
+  efl::BasicMatrix<SampleType> input( numInputs, blockLength, alignment );
+  efl::BasicMatrix<SampleType> output( numOutputs, blockLength, alignment );
+  std::vector<SampleType const *> inputPtrs( numInputs );
+  std::vector<SampleType *> outputPtrs( numOutputs );
+  for( std::size_t inIdx( 0 ); inIdx < numInputs; ++inIdx )
+  {
+    inputPtrs[inIdx] = input.row( inIdx );
+    for( std::size_t sampleIdx( 0 ); sampleIdx < blockLength; ++sampleIdx )
+    {
+      input( inIdx, sampleIdx ) = static_cast<SampleType>( (sampleIdx + inIdx) % 5 ) - 2.0f;
+    }
+  }
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    outputPtrs[outIdx] = output.row( outIdx );
+  }
+
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    matrix.setNewGains( gains );
+    BOOST_CHECK_EQUAL( matrix.transitionActive(), blockIdx < interpolationPeriods );
+    matrix.process( &inputPtrs[0], &outputPtrs[0] );
+  }
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    for( std::size_t sampleIdx( 0 ); sampleIdx < blockLength; ++sampleIdx )
+    {
+      SampleType expected = 0.0f;
+      for( std::size_t inIdx( 0 ); inIdx < numInputs; ++inIdx )
+      {
+        expected += gains( outIdx, inIdx ) * input( inIdx, sampleIdx );
+      }
+      BOOST_CHECK_EQUAL( output( outIdx, sampleIdx ), expected );
+    }
+  }
+
+  // Input 2 is inactive, its samples must not contribute.
+  std::vector<std::size_t> const activeInputs{ 0, 1, 3 };
+  std::fill( input.row( 2 ), input.row( 2 ) + blockLength, 100.0f );
+  matrix.setNewGains( gains );
+  matrix.process( &inputPtrs[0], &outputPtrs[0], activeInputs.data(), activeInputs.size() );
+  BOOST_CHECK( not matrix.transitionActive() );
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    for( std::size_t sampleIdx( 0 ); sampleIdx < blockLength; ++sampleIdx )
+    {
+      SampleType expected = 0.0f;
+      for( std::size_t inIdx : activeInputs )
+      {
+        expected += gains( outIdx, inIdx ) * input( inIdx, sampleIdx );
+      }
+      BOOST_CHECK_EQUAL( output( outIdx, sampleIdx ), expected );
+    }
+  }
+
+  // A changed gain matrix starts a new transition.
+  gains( 0, 0 ) = 0.25f;
+  matrix.setNewGains( gains );
+  BOOST_CHECK( matrix.transitionActive() );
+}
+
+} // namespace test
+} // namespace rbbl
+} // namespace visr
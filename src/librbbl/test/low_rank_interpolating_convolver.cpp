@@ -0,0 +1,238 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librbbl/low_rank_filter_decomposition.hpp>
+#include <librbbl/low_rank_interpolating_convolver_uniform.hpp>
+
+#include <libefl/basic_matrix.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <ciso646>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace visr
+{
+namespace rbbl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+template< typename SampleType >
+void fillRandom( efl::BasicMatrix<SampleType> & mtx, std::mt19937 & gen )
+{
+  std::uniform_real_distribution<SampleType> dist( -1.0, 1.0 );
+  for( std::size_t rowIdx( 0 ); rowIdx < mtx.numberOfRows(); ++rowIdx )
+  {
+    std::generate( mtx.row( rowIdx ), mtx.row( rowIdx ) + mtx.numberOfColumns(), [&]() { return dist( gen ); } );
+  }
+}
+
+/**
+ * Create a set of filters that are linear combinations of \p rank random filters.
+ */
+template< typename SampleType >
+void fillLowRank( efl::BasicMatrix<SampleType> & filters, std::size_t rank, std::mt19937 & gen )
+{
+  efl::BasicMatrix<SampleType> generators( rank, filters.numberOfColumns() );
+  fillRandom( generators, gen );
+  efl::BasicMatrix<SampleType> weights( filters.numberOfRows(), rank );
+  fillRandom( weights, gen );
+  for( std::size_t filterIdx( 0 ); filterIdx < filters.numberOfRows(); ++filterIdx )
+  {
+    for( std::size_t sampleIdx( 0 ); sampleIdx < filters.numberOfColumns(); ++sampleIdx )
+    {
+      SampleType acc = 0.0f;
+      for( std::size_t genIdx( 0 ); genIdx < rank; ++genIdx )
+      {
+        acc += weights( filterIdx, genIdx ) * generators( genIdx, sampleIdx );
+      }
+      filters( filterIdx, sampleIdx ) = acc;
+    }
+  }
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( LowRankFilterDecompositionReconstruction )
+{
+  using SampleType = float;
+  std::size_t const numFilters = 20;
+  std::size_t const filterLength = 48;
+  std::size_t const trueRank = 3;
+
+  std::mt19937 gen( 5 );
+  efl::BasicMatrix<SampleType> filters( numFilters, filterLength );
+  fillLowRank( filters, trueRank, gen );
+
+  LowRankFilterDecomposition<SampleType> const decomposition( filters, 8, 1.0e-6f );
+  BOOST_CHECK_EQUAL( decomposition.rank(), trueRank );
+  BOOST_CHECK_LE( decomposition.relativeError(), 1.0e-6f );
+
+  // The basis filters must be orthonormal.
+  efl::BasicMatrix<SampleType> const & basis = decomposition.basisFilters();
+  for( std::size_t lhs( 0 ); lhs < decomposition.rank(); ++lhs )
+  {
+    for( std::size_t rhs( 0 ); rhs < decomposition.rank(); ++rhs )
+    {
+      SampleType dot = 0.0f;
+      for( std::size_t sampleIdx( 0 ); sampleIdx < filterLength; ++sampleIdx )
+      {
+        dot += basis( lhs, sampleIdx ) * basis( rhs, sampleIdx );
+      }
+      BOOST_CHECK_SMALL( dot - (lhs == rhs ? 1.0f : 0.0f), 1.0e-5f );
+    }
+  }
+  SampleType maxError = 0.0f;
+  for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+  {
+    for( std::size_t sampleIdx( 0 ); sampleIdx < filterLength; ++sampleIdx )
+    {
+      SampleType approx = 0.0f;
+      for( std::size_t basisIdx( 0 ); basisIdx < decomposition.rank(); ++basisIdx )
+      {
+        approx += decomposition.coefficients()( filterIdx, basisIdx ) * basis( basisIdx, sampleIdx );
+      }
+      maxError = std::max( maxError, std::abs( approx - filters( filterIdx, sampleIdx ) ) );
+    }
+  }
+  BOOST_CHECK_LE( maxError, 1.0e-4f );
+
+  // Without a tolerance, the maximum rank is used and the truncation error decreases with the rank.
+  efl::BasicMatrix<SampleType> randomFilters( numFilters, filterLength );
+  fillRandom( randomFilters, gen );
+  LowRankFilterDecomposition<SampleType> const rank4( randomFilters, 4 );
+  LowRankFilterDecomposition<SampleType> const rank10( randomFilters, 10 );
+  LowRankFilterDecomposition<SampleType> const tolerance( randomFilters, 20, 0.25f );
+  BOOST_CHECK_EQUAL( rank4.rank(), 4 );
+  BOOST_CHECK_EQUAL( rank10.rank(), 10 );
+  BOOST_CHECK_GT( rank4.relativeError(), rank10.relativeError() );
+  BOOST_CHECK_LE( tolerance.relativeError(), 0.25f );
+  BOOST_CHECK_LT( tolerance.rank(), 20 );
+
+  BOOST_CHECK_THROW( LowRankFilterDecomposition<SampleType>( filters, 0 ), std::invalid_argument );
+}
+
+/**
+ * Compare the output of the low-rank convolver with a direct time-domain convolution using the interpolated filters.
+ * The filter set has an exact low-rank representation, so the results must be identical up to rounding errors,
+ * both for the initial interpolants and after the transition to new interpolants.
+ */
+BOOST_AUTO_TEST_CASE( LowRankInterpolatingConvolverMatchesDirectConvolution )
+{
+  using SampleType = float;
+  std::size_t const alignment = 8;
+  std::size_t const numInputs = 4;   // e.g., objects
+  std::size_t const numOutputs = 2;  // e.g., ears
+  std::size_t const blockLength = 16;
+  std::size_t const filterLength = 40;
+  std::size_t const numFilters = 24;
+  std::size_t const numInterpolants = 3;
+  std::size_t const transitionSamples = 32;
+  std::size_t const numBlocks = 40;
+  std::size_t const changeBlock = 20;
+
+  std::mt19937 gen( 23 );
+  efl::BasicMatrix<SampleType> filters( numFilters, filterLength, alignment );
+  fillLowRank( filters, 5, gen );
+
+  FilterRoutingList routings;
+  for( std::size_t inIdx( 0 ); inIdx < numInputs; ++inIdx )
+  {
+    routings.addRouting( inIdx, 0, inIdx, 1.0 );
+    routings.addRouting( inIdx, 1, inIdx + numInputs, 0.5 );
+  }
+  std::size_t const numRoutings = 2 * numInputs;
+  auto makeInterpolants = [&]( std::size_t offset )
+  {
+    InterpolationParameterSet params;
+    for( std::size_t routingIdx( 0 ); routingIdx < numRoutings; ++routingIdx )
+    {
+      params.insert( InterpolationParameter( routingIdx,
+        { (routingIdx + offset) % numFilters, (routingIdx + offset + 7) % numFilters, (routingIdx + offset + 13) % numFilters },
+        { 0.5f, 0.3f, 0.2f } ) );
+    }
+    return params;
+  };
+  InterpolationParameterSet const initialInterpolants = makeInterpolants( 0 );
+  InterpolationParameterSet const newInterpolants = makeInterpolants( 3 );
+
+  LowRankInterpolatingConvolverUniform<SampleType> convolver( numInputs, numOutputs, blockLength, filterLength,
+    numRoutings, numFilters, numInterpolants, transitionSamples, 8, 1.0e-6f, routings, initialInterpolants,
+    filters, alignment );
+  BOOST_CHECK_EQUAL( convolver.rank(), 5 );
+
+  // Interpolated filters for each routing slot, before and after the change.
+  auto interpolatedFilters = [&]( InterpolationParameterSet const & params )
+  {
+    std::vector<std::vector<SampleType> > result( numRoutings, std::vector<SampleType>( filterLength, 0.0f ) );
+    for( InterpolationParameter const & param : params )
+    {
+      for( std::size_t interpIdx( 0 ); interpIdx < numInterpolants; ++interpIdx )
+      {
+        for( std::size_t sampleIdx( 0 ); sampleIdx < filterLength; ++sampleIdx )
+        {
+          result[param.id()][sampleIdx] += param.weight( interpIdx ) * filters( param.index( interpIdx ), sampleIdx );
+        }
+      }
+    }
+    return result;
+  };
+  std::vector<std::vector<SampleType> > const filtersBefore = interpolatedFilters( initialInterpolants );
+  std::vector<std::vector<SampleType> > const filtersAfter = interpolatedFilters( newInterpolants );
+
+  std::size_t const signalLength = numBlocks * blockLength;
+  efl::BasicMatrix<SampleType> input( numInputs, signalLength, alignment );
+  fillRandom( input, gen );
+  efl::BasicMatrix<SampleType> output( numOutputs, signalLength, alignment );
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    if( blockIdx == changeBlock )
+    {
+      convolver.setInterpolants( newInterpolants, true );
+    }
+    convolver.process( input.data() + blockIdx * blockLength, input.stride(),
+                       output.data() + blockIdx * blockLength, output.stride(), alignment );
+  }
+
+  // Compare against a direct convolution, excluding the samples affected by the transition.
+  std::size_t const changeSample = changeBlock * blockLength;
+  std::size_t const settledSample = changeSample + transitionSamples + filterLength;
+  SampleType maxError = 0.0f;
+  for( std::size_t sampleIdx( 0 ); sampleIdx < signalLength; ++sampleIdx )
+  {
+    if( (sampleIdx >= changeSample) and (sampleIdx < settledSample) )
+    {
+      continue;
+    }
+    std::vector<std::vector<SampleType> > const & current = sampleIdx < changeSample ? filtersBefore : filtersAfter;
+    for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+    {
+      SampleType expected = 0.0f;
+      for( FilterRouting const & routing : routings )
+      {
+        if( routing.outputIndex != outIdx )
+        {
+          continue;
+        }
+        for( std::size_t tapIdx( 0 ); tapIdx < std::min( filterLength, sampleIdx + 1 ); ++tapIdx )
+        {
+          expected += static_cast<SampleType>(routing.gainLinear) * current[routing.filterIndex][tapIdx]
+            * input( routing.inputIndex, sampleIdx - tapIdx );
+        }
+      }
+      maxError = std::max( maxError, std::abs( expected - output( outIdx, sampleIdx ) ) );
+    }
+  }
+  BOOST_CHECK_LE( maxError, 1.0e-4f );
+}
+
+} // namespace test
+} // namespace rbbl
+} // namespace visr
@@ -1,5 +1,7 @@
 /* Copyright Institue of Sound and Vibration Research - All rights reserved. */
 
+#include <librbbl/core_convolver_uniform.hpp>
+#include <librbbl/multichannel_convolver_direct.hpp>
 #include <librbbl/multichannel_convolver_uniform.hpp>
 
 #include <libefl/basic_matrix.hpp>
@@ -12,8 +14,10 @@
 
 #include <ciso646>
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <iterator>
+#include <random>
 #include <stdexcept>
 #include <vector>
 
@@ -79,6 +83,161 @@ BOOST_AUTO_TEST_CASE( MultichannelConvolver )
 }
 #endif
 
+/**
+ * Filters of different lengths in a convolver sized for a long maximum filter length.
+ * Only the partitions up to the last nonzero partition of each filter must be evaluated, without affecting the result.
+ */
+BOOST_AUTO_TEST_CASE( MultichannelConvolverMixedFilterLengths )
+{
+  static const std::size_t alignment = 8;
+  using SampleType = float;
+  std::size_t const blockLength = 16;
+  std::size_t const maxFilterLength = 256;
+  std::size_t const numFilters = 4;
+  std::size_t const numBlocks = 24;
+  std::size_t const signalLength = numBlocks * blockLength;
+
+  std::mt19937 gen( 3 );
+  std::uniform_real_distribution<SampleType> dist( -1.0f, 1.0f );
+  efl::BasicMatrix<SampleType> filters( numFilters, maxFilterLength, alignment ); // zero-initialised
+  std::generate( filters.row( 0 ), filters.row( 0 ) + 20, [&]() { return dist( gen ); } ); // Short filter, 2 partitions
+  std::generate( filters.row( 1 ), filters.row( 1 ) + maxFilterLength, [&]() { return dist( gen ); } ); // Full length
+  // Filter 2 is zero.
+  filters( 3, 100 ) = 0.5f; // Pure delay, 7 partitions.
+
+  CoreConvolverUniform<SampleType> core( 1, 1, blockLength, maxFilterLength, numFilters, filters, alignment );
+  BOOST_CHECK_EQUAL( core.numberOfFilterPartitions(), 16 );
+  BOOST_CHECK_EQUAL( core.filterPartitionCount( 0 ), 2 );
+  BOOST_CHECK_EQUAL( core.filterPartitionCount( 1 ), 16 );
+  BOOST_CHECK_EQUAL( core.filterPartitionCount( 2 ), 0 );
+  BOOST_CHECK_EQUAL( core.filterPartitionCount( 3 ), 7 );
+  core.setImpulseResponse( filters.row( 0 ), maxFilterLength, 1, alignment );
+  BOOST_CHECK_EQUAL( core.filterPartitionCount( 1 ), 2 );
+  core.clearFilters();
+  BOOST_CHECK_EQUAL( core.filterPartitionCount( 0 ), 0 );
+
+  rbbl::FilterRoutingList const routings = { { 0, 0, 0, 1.0f }, { 1, 0, 1, 0.5f }, { 0, 1, 2, 1.0f }, { 1, 1, 3, 1.0f } };
+  MultichannelConvolverUniform<SampleType> convolver( 2, 2, blockLength, maxFilterLength, routings.size(), numFilters,
+                                                      routings, filters, alignment );
+  efl::BasicMatrix<SampleType> input( 2, signalLength, alignment );
+  for( std::size_t chIdx( 0 ); chIdx < 2; ++chIdx )
+  {
+    std::generate( input.row( chIdx ), input.row( chIdx ) + signalLength, [&]() { return dist( gen ); } );
+  }
+  efl::BasicMatrix<SampleType> output( 2, signalLength, alignment );
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    convolver.process( input.data() + blockIdx * blockLength, input.stride(),
+                       output.data() + blockIdx * blockLength, output.stride(), alignment );
+  }
+  SampleType maxError = 0.0f;
+  for( std::size_t outIdx( 0 ); outIdx < 2; ++outIdx )
+  {
+    for( std::size_t sampleIdx( 0 ); sampleIdx < signalLength; ++sampleIdx )
+    {
+      SampleType expected = 0.0f;
+      for( FilterRouting const & routing : routings )
+      {
+        if( routing.outputIndex != outIdx )
+        {
+          continue;
+        }
+        for( std::size_t tapIdx( 0 ); tapIdx <= std::min( sampleIdx, maxFilterLength - 1 ); ++tapIdx )
+        {
+          expected += static_cast<SampleType>(routing.gainLinear) * filters( routing.filterIndex, tapIdx )
+            * input( routing.inputIndex, sampleIdx - tapIdx );
+        }
+      }
+      maxError = std::max( maxError, std::abs( expected - output( outIdx, sampleIdx ) ) );
+    }
+  }
+  BOOST_CHECK_LE( maxError, 1.0e-4f );
+}
+
+/**
+ * The direct-form convolver must produce the same output as the partitioned convolver, including the handling of
+ * silent inputs and routing updates.
+ */
+BOOST_AUTO_TEST_CASE( MultichannelConvolverDirectMatchesUniform )
+{
+  static const std::size_t alignment = 8;
+  using SampleType = float;
+  std::size_t const numInputs = 3;
+  std::size_t const numOutputs = 2;
+  std::size_t const blockLength = 16;
+  std::size_t const maxFilterLength = 37;
+  std::size_t const numFilters = 3;
+  std::size_t const numBlocks = 30;
+  std::size_t const silenceStartBlock = 12;
+  std::size_t const signalLength = numBlocks * blockLength;
+
+  std::mt19937 gen( 7 );
+  std::uniform_real_distribution<SampleType> dist( -1.0f, 1.0f );
+  efl::BasicMatrix<SampleType> filters( numFilters, maxFilterLength, alignment );
+  for( std::size_t filterIdx( 0 ); filterIdx < numFilters; ++filterIdx )
+  {
+    std::generate( filters.row( filterIdx ), filters.row( filterIdx ) + maxFilterLength, [&]() { return dist( gen ); } );
+  }
+  std::fill( filters.row( 2 ) + 5, filters.row( 2 ) + maxFilterLength, 0.0f ); // Short filter
+
+  rbbl::FilterRoutingList const routings = { { 0, 0, 0, 1.0f }, { 1, 0, 1, 0.5f }, { 2, 1, 2, -1.0f }, { 0, 1, 1, 0.25f } };
+  MultichannelConvolverUniform<SampleType> reference( numInputs, numOutputs, blockLength, maxFilterLength, 5, numFilters,
+                                                      routings, filters, alignment );
+  MultichannelConvolverDirect<SampleType> convolver( numInputs, numOutputs, blockLength, maxFilterLength, 5, numFilters,
+                                                     routings, filters, alignment );
+  BOOST_CHECK_EQUAL( convolver.numberOfRoutingPoints(), routings.size() );
+  BOOST_CHECK_EQUAL( convolver.filterLength( 0 ), maxFilterLength );
+  BOOST_CHECK_EQUAL( convolver.filterLength( 2 ), 5 );
+
+  // Input 2 becomes silent after silenceStartBlock.
+  efl::BasicMatrix<SampleType> input( numInputs, signalLength, alignment );
+  for( std::size_t chIdx( 0 ); chIdx < numInputs; ++chIdx )
+  {
+    std::size_t const activeLength = chIdx == 2 ? silenceStartBlock * blockLength : signalLength;
+    std::generate( input.row( chIdx ), input.row( chIdx ) + activeLength, [&]() { return dist( gen ); } );
+  }
+  efl::BasicMatrix<SampleType> output( numOutputs, signalLength, alignment );
+  efl::BasicMatrix<SampleType> referenceOutput( numOutputs, signalLength, alignment );
+  bool silentInputs[numInputs] = { false, false, false };
+  bool silentOutputs[numOutputs];
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    if( blockIdx == numBlocks / 2 )
+    {
+      // Routing changes take effect in the same block for both implementations.
+      reference.removeRoutingEntry( 1, 0 );
+      reference.setRoutingEntry( 1, 1, 0, 2.0f );
+      BOOST_CHECK( convolver.removeRoutingEntry( 1, 0 ) );
+      convolver.setRoutingEntry( 1, 1, 0, 2.0f );
+    }
+    silentInputs[2] = blockIdx >= silenceStartBlock;
+    reference.process( input.data() + blockIdx * blockLength, input.stride(),
+                       referenceOutput.data() + blockIdx * blockLength, referenceOutput.stride(), alignment,
+                       silentInputs );
+    convolver.process( input.data() + blockIdx * blockLength, input.stride(),
+                       output.data() + blockIdx * blockLength, output.stride(), alignment,
+                       silentInputs, silentOutputs );
+  }
+  SampleType maxError = 0.0f;
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    for( std::size_t sampleIdx( 0 ); sampleIdx < signalLength; ++sampleIdx )
+    {
+      maxError = std::max( maxError, std::abs( referenceOutput( outIdx, sampleIdx ) - output( outIdx, sampleIdx ) ) );
+    }
+  }
+  BOOST_CHECK_LE( maxError, 1.0e-4f );
+  BOOST_CHECK( not silentOutputs[0] );
+  BOOST_CHECK( not silentOutputs[1] );
+
+  BOOST_CHECK_THROW( convolver.setRoutingEntry( 3, 0, 0, 1.0f ), std::invalid_argument );
+  BOOST_CHECK_THROW( convolver.setImpulseResponse( filters.row( 0 ), maxFilterLength + 1, 0 ), std::invalid_argument );
+
+  // The cost model selects the direct form for short filters only.
+  BOOST_CHECK( directConvolutionPreferred( 8, 8, 64, 32, 8 ) );
+  BOOST_CHECK( not directConvolutionPreferred( 8, 8, 64, 1024, 8 ) );
+}
+
 } // namespace test
 } // namespace rbbl
 } // namespace visr
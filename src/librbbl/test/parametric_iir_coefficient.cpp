@@ -1,6 +1,10 @@
 /* Copyright Institue of Sound and Vibration Research - All rights reserved. */
 
+#include <librbbl/biquad_coefficient.hpp>
 #include <librbbl/parametric_iir_coefficient.hpp>
+#include <librbbl/parametric_iir_coefficient_calculator.hpp>
+
+#include <libefl/initialise_library.hpp>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/filesystem/path.hpp>
@@ -8,6 +12,7 @@
 
 #include <algorithm>
 #include <ciso646>
+#include <cmath>
 #include <limits>
 #include <stdexcept>
 #include <vector>
@@ -83,6 +88,48 @@ BOOST_AUTO_TEST_CASE( InstantiateIirParameterListFromXml )
   BOOST_CHECK( pl.size() == 3 );
 }
 
+/**
+ * The list version computes the transcendental terms in batches with the vectorised efl functions. Check it against
+ * the scalar version for all filter types, using more sections than fit into one batch.
+ */
+BOOST_AUTO_TEST_CASE( CalculateIirCoefficientListMatchesScalar )
+{
+  efl::initialiseLibrary();
+  using Type = ParametricIirCoefficientBase::Type;
+  std::vector<Type> const types{ Type::lowpass, Type::highpass, Type::bandpass, Type::bandstop,
+                                 Type::allpass, Type::peak, Type::lowshelf, Type::highshelf };
+  std::size_t const numSections = 45;
+  float const samplingFrequency = 48000.0f;
+  ParametricIirCoefficientList<float> params( numSections, ParametricIirCoefficient<float>() );
+  for( std::size_t idx( 0 ); idx < numSections; ++idx )
+  {
+    params[idx] = ParametricIirCoefficient<float>( types[idx % types.size()],
+      50.0f + 400.0f * static_cast<float>(idx), 0.5f + 0.1f * static_cast<float>(idx % 7),
+      -12.0f + static_cast<float>(idx % 9) * 3.0f );
+  }
+  BiquadCoefficientList<float> coeffs( numSections + 3 );
+  ParametricIirCoefficientCalculator::calculateIirCoefficients( params, coeffs, samplingFrequency );
+  for( std::size_t idx( 0 ); idx < numSections; ++idx )
+  {
+    BiquadCoefficient<float> const expected
+      = ParametricIirCoefficientCalculator::calculateIirCoefficients( params[idx], samplingFrequency );
+    for( std::size_t coeffIdx( 0 ); coeffIdx < BiquadCoefficient<float>::cNumberOfCoeffs; ++coeffIdx )
+    {
+      BOOST_CHECK_SMALL( coeffs[idx][coeffIdx] - expected[coeffIdx], 1.0e-5f * std::max( 1.0f, std::abs( expected[coeffIdx] ) ) );
+    }
+  }
+  // The remaining entries are set to flat filters.
+  for( std::size_t idx( numSections ); idx < coeffs.size(); ++idx )
+  {
+    for( std::size_t coeffIdx( 0 ); coeffIdx < BiquadCoefficient<float>::cNumberOfCoeffs; ++coeffIdx )
+    {
+      BOOST_CHECK_EQUAL( coeffs[idx][coeffIdx], BiquadCoefficient<float>()[coeffIdx] );
+    }
+  }
+  BiquadCoefficientList<float> tooShort( numSections - 1 );
+  BOOST_CHECK_THROW( ParametricIirCoefficientCalculator::calculateIirCoefficients( params, tooShort, samplingFrequency ),
+                     std::invalid_argument );
+}
 
 } // namespace test
 } // namespace rbbl
@@ -0,0 +1,88 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librbbl/triple_buffer.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ciso646>
+#include <cstddef>
+#include <vector>
+
+#ifndef VISR_DISABLE_THREADS
+#include <thread>
+#endif
+
+namespace visr
+{
+namespace rbbl
+{
+namespace test
+{
+
+BOOST_AUTO_TEST_CASE( TripleBufferSingleThread )
+{
+  TripleBuffer<int> tb;
+  BOOST_CHECK( not tb.hasNewData() );
+  BOOST_CHECK( not tb.update() );
+
+  tb.writeBuffer() = 1;
+  tb.publish();
+  BOOST_CHECK( tb.hasNewData() );
+  BOOST_CHECK( tb.update() );
+  BOOST_CHECK_EQUAL( tb.readBuffer(), 1 );
+  BOOST_CHECK( not tb.update() );
+  BOOST_CHECK_EQUAL( tb.readBuffer(), 1 );
+
+  // Only the latest value is retrieved.
+  tb.writeBuffer() = 2;
+  tb.publish();
+  tb.writeBuffer() = 3;
+  tb.publish();
+  BOOST_CHECK( tb.update() );
+  BOOST_CHECK_EQUAL( tb.readBuffer(), 3 );
+}
+
+#ifndef VISR_DISABLE_THREADS
+BOOST_AUTO_TEST_CASE( TripleBufferConcurrent )
+{
+  // Each published vector is filled with a single value, so a torn read would show up as differing elements.
+  std::size_t const vecSize = 256;
+  int const numValues = 20000;
+  TripleBuffer< std::vector<int> > tb;
+  tb.writeBuffer().assign( vecSize, 0 );
+  tb.readBuffer().assign( vecSize, 0 );
+
+  std::thread producer( [&tb, numValues, vecSize]()
+  {
+    for( int val( 1 ); val <= numValues; ++val )
+    {
+      tb.writeBuffer().assign( vecSize, val );
+      tb.publish();
+    }
+  } );
+
+  int lastValue = 0;
+  bool consistent = true;
+  while( lastValue < numValues )
+  {
+    if( tb.update() )
+    {
+      std::vector<int> const & vec = tb.readBuffer();
+      int const val = vec.front();
+      consistent = consistent and (val > lastValue);
+      for( int elem : vec )
+      {
+        consistent = consistent and (elem == val);
+      }
+      lastValue = val;
+    }
+  }
+  producer.join();
+  BOOST_CHECK( consistent );
+  BOOST_CHECK_EQUAL( lastValue, numValues );
+}
+#endif // #ifndef VISR_DISABLE_THREADS
+
+} // namespace test
+} // namespace rbbl
+} // namespace visr
@@ -0,0 +1,122 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRBBL_TRIPLE_BUFFER_HPP_INCLUDED
+#define VISR_LIBRBBL_TRIPLE_BUFFER_HPP_INCLUDED
+
+#include <array>
+#include <atomic>
+
+namespace visr
+{
+namespace rbbl
+{
+
+/**
+ * Lock-free exchange of data values between exactly one producer thread and one consumer thread.
+ * The buffer holds three instances of the data type: One owned by the producer, one owned by the consumer, and a
+ * shared instance that holds the most recently published value. Publishing and fetching a value exchange the
+ * ownership of the respective instance with the shared one, so neither side ever blocks or copies data.
+ * Intermediate values are overwritten if the producer publishes more frequently than the consumer fetches, i.e., the
+ * consumer always obtains the latest complete value.
+ * The consumer side (update(), readBuffer()) is wait-free and does not allocate memory, so it can be used in a realtime
+ * thread.
+ * @tparam DataType The contained type, must be default-constructible.
+ */
+template< typename DataType >
+class TripleBuffer
+{
+public:
+  /**
+   * Default constructor, all three instances are default-constructed.
+   */
+  TripleBuffer()
+   : mWriteIndex( 0 )
+   , mShared( 1 )
+   , mReadIndex( 2 )
+  {
+  }
+
+  TripleBuffer( TripleBuffer const & ) = delete;
+
+  TripleBuffer & operator=( TripleBuffer const & ) = delete;
+
+  /**
+   * Producer side: Access the instance owned by the producer. The content is arbitrary after publish(),
+   * typically a previously published value, and must be set completely before the next publish() call.
+   */
+  DataType & writeBuffer() { return mBuffers[mWriteIndex]; }
+
+  /**
+   * Producer side: Make the content of writeBuffer() available to the consumer.
+   */
+  void publish()
+  {
+    unsigned int const previous = mShared.exchange( mWriteIndex | cNewDataFlag, std::memory_order_acq_rel );
+    mWriteIndex = previous & cIndexMask;
+  }
+
+  /**
+   * Consumer side: Check whether a value has been published since the last successful update() call.
+   */
+  bool hasNewData() const
+  {
+    return (mShared.load( std::memory_order_relaxed ) & cNewDataFlag) != 0;
+  }
+
+  /**
+   * Consumer side: Obtain the most recently published value, which becomes accessible through readBuffer().
+   * @return True if a new value has been published since the last call, false otherwise. In the latter case,
+   * readBuffer() is unchanged.
+   */
+  bool update()
+  {
+    if( not hasNewData() )
+    {
+      return false;
+    }
+    unsigned int const previous = mShared.exchange( mReadIndex, std::memory_order_acq_rel );
+    mReadIndex = previous & cIndexMask;
+    return true;
+  }
+
+  /**
+   * Consumer side: Access the instance owned by the consumer.
+   * The consumer may modify or swap the content, which is returned to the producer eventually.
+   */
+  DataType & readBuffer() { return mBuffers[mReadIndex]; }
+
+  DataType const & readBuffer() const { return mBuffers[mReadIndex]; }
+
+private:
+  static constexpr unsigned int cIndexMask = 0x3;
+
+  static constexpr unsigned int cNewDataFlag = 0x4;
+
+  std::array<DataType, 3> mBuffers;
+
+  /**
+   * Index of the instance owned by the producer. Accessed only by the producer thread.
+   */
+  unsigned int mWriteIndex;
+
+  /**
+   * Index of the shared instance, combined with a flag marking whether it holds a new value.
+   */
+  std::atomic<unsigned int> mShared;
+
+  /**
+   * Index of the instance owned by the consumer. Accessed only by the consumer thread.
+   */
+  unsigned int mReadIndex;
+};
+
+template< typename DataType >
+constexpr unsigned int TripleBuffer<DataType>::cIndexMask;
+
+template< typename DataType >
+constexpr unsigned int TripleBuffer<DataType>::cNewDataFlag;
+
+} // namespace rbbl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRBBL_TRIPLE_BUFFER_HPP_INCLUDED
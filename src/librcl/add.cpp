@@ -34,6 +34,7 @@ Add::Add( SignalFlowContext const & context,
     inName << "in" << run;
     std::string const & portName = inName.str();
     std::unique_ptr<AudioInput> newIn( new AudioInput( portName.c_str(), *this, width ) );
+    newIn->setChannelPointerAccess( true ); // The inputs are accessed channel-wise only.
     mInputs.push_back(  std::move( newIn ) );
   }
 }
@@ -4,8 +4,10 @@
 
 #include <libefl/error_codes.hpp>
 #include <libefl/filter_functions.hpp>
+#include <libefl/vector_functions.hpp>
 
 #include <libpml/matrix_parameter_config.hpp>
+#include <libpml/vector_parameter_config.hpp>
 
 #include <librbbl/biquad_coefficient.hpp>
 
@@ -23,7 +25,8 @@ BiquadIirFilter::BiquadIirFilter( SignalFlowContext const & context,
                                   CompositeComponent * parent,
                                   std::size_t numberOfChannels,
                                   std::size_t numberOfBiquads,
-                                  bool controlInput /*= false*/ )
+                                  bool controlInput /*= false*/,
+                                  bool activityInput /*= false*/ )
  : AtomicComponent( context, name, parent )
  , mInput( "in", *this, numberOfChannels )
  , mOutput( "out", *this, numberOfChannels )
@@ -36,6 +39,14 @@ BiquadIirFilter::BiquadIirFilter( SignalFlowContext const & context,
                  pml::MatrixParameterConfig( numberOfChannels,
                                              numberOfBiquads ) )
            : nullptr )
+ , mActivityInput(
+       activityInput
+           ? new ParameterInput< pml::DoubleBufferingProtocol,
+                                 pml::ChannelActivityParameter >(
+                 "activityInput",
+                 *this,
+                 pml::VectorParameterConfig( numberOfChannels ) )
+           : nullptr )
  , cNumberOfChannels( numberOfChannels )
  , cNumberOfBiquadSections( numberOfBiquads )
  , mCoefficients( numberOfChannels,
@@ -46,6 +57,8 @@ BiquadIirFilter::BiquadIirFilter( SignalFlowContext const & context,
            cVectorAlignmentSamples )
 {
   mState.zeroFill();
+  // The transposed direct form II reads each input sample before writing the output sample.
+  declareInPlaceProcessing( mInput, mOutput );
 }
 
 BiquadIirFilter::BiquadIirFilter(
@@ -55,9 +68,15 @@ BiquadIirFilter::BiquadIirFilter(
     std::size_t numberOfChannels,
     std::size_t numberOfBiquads,
     rbbl::BiquadCoefficient< SampleType > const & initialBiquad,
-    bool controlInput /*= false*/ )
- : BiquadIirFilter(
-       context, name, parent, numberOfChannels, numberOfBiquads, controlInput )
+    bool controlInput /*= false*/,
+    bool activityInput /*= false*/ )
+ : BiquadIirFilter( context,
+                    name,
+                    parent,
+                    numberOfChannels,
+                    numberOfBiquads,
+                    controlInput,
+                    activityInput )
 {
   for( std::size_t channelIdx( 0 ); channelIdx < cNumberOfChannels;
        ++channelIdx )
@@ -77,9 +96,15 @@ BiquadIirFilter::BiquadIirFilter(
     std::size_t numberOfChannels,
     std::size_t numberOfBiquads,
     rbbl::BiquadCoefficientList< SampleType > const & coeffs,
-    bool controlInput /*= false*/ )
- : BiquadIirFilter(
-       context, name, parent, numberOfChannels, numberOfBiquads, controlInput )
+    bool controlInput /*= false*/,
+    bool activityInput /*= false*/ )
+ : BiquadIirFilter( context,
+                    name,
+                    parent,
+                    numberOfChannels,
+                    numberOfBiquads,
+                    controlInput,
+                    activityInput )
 {
   if( coeffs.size() != numberOfBiquads )
   {
@@ -101,9 +126,15 @@ BiquadIirFilter::BiquadIirFilter(
     std::size_t numberOfChannels,
     std::size_t numberOfBiquads,
     rbbl::BiquadCoefficientMatrix< SampleType > const & coeffs,
-    bool controlInput /*= false*/ )
- : BiquadIirFilter(
-       context, name, parent, numberOfChannels, numberOfBiquads, controlInput )
+    bool controlInput /*= false*/,
+    bool activityInput /*= false*/ )
+ : BiquadIirFilter( context,
+                    name,
+                    parent,
+                    numberOfChannels,
+                    numberOfBiquads,
+                    controlInput,
+                    activityInput )
 {
   if( ( coeffs.numberOfFilters() != numberOfChannels ) or
       ( coeffs.numberOfSections() != numberOfBiquads ) )
@@ -213,10 +244,48 @@ void BiquadIirFilter::process()
     setCoefficientMatrix( mEqInput->data() );
     mEqInput->resetChanged();
   }
+  pml::ChannelActivityParameter const * const activity{
+    mActivityInput ? &mActivityInput->data() : nullptr
+  };
+  if( mActivityInput and mActivityInput->changed() )
+  {
+    // Clear the states of inactive channels, such that reactivated channels
+    // start without residues of their previous signals.
+    for( std::size_t chIdx{ 0 }; chIdx < cNumberOfChannels; ++chIdx )
+    {
+      if( not activity->active( chIdx ) )
+      {
+        efl::vectorZero( mState.row( chIdx ), mState.numberOfColumns() );
+      }
+    }
+    mActivityInput->resetChanged();
+  }
   std::size_t const numSamples{ period() };
   std::size_t const alignment{ mInput.alignmentSamples() };
   for( std::size_t chIdx{ 0 }; chIdx < cNumberOfChannels; ++chIdx )
   {
+    if( activity and not activity->active( chIdx ) )
+    {
+      efl::vectorZero( mOutput[ chIdx ], numSamples, alignment );
+      mOutput.setSilent( chIdx, true );
+      continue;
+    }
+    if( mInput.silent( chIdx ) )
+    {
+      // Once the tail of the previous signal has decayed, the output is zero
+      // and the filter can be bypassed.
+      SampleType statePeak;
+      efl::vectorMaxMagnitude( mState.row( chIdx ), statePeak,
+                               mState.numberOfColumns() );
+      if( statePeak <= cSilentStateThreshold )
+      {
+        efl::vectorZero( mState.row( chIdx ), mState.numberOfColumns() );
+        efl::vectorZero( mOutput[ chIdx ], numSamples, alignment );
+        mOutput.setSilent( chIdx, true );
+        continue;
+      }
+    }
+    mOutput.setSilent( chIdx, false );
     efl::ErrorCode const res = efl::iirFilterBiquadsSingleChannel(
         mInput[ chIdx ], mOutput[ chIdx ], mState.row( chIdx ),
         mCoefficients.row( chIdx ), numSamples, cNumberOfBiquadSections,
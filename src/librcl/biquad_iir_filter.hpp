@@ -15,6 +15,7 @@
 #include <libefl/basic_vector.hpp>
 
 #include <libpml/biquad_parameter.hpp>
+#include <libpml/channel_activity_parameter.hpp>
 #include <libpml/double_buffering_protocol.hpp>
 
 #include <librbbl/biquad_coefficient.hpp>
@@ -31,6 +32,9 @@ namespace rcl
  * per channel. This class has one input port named "in" and one output port
  * named "out". The widths of the input and the output port are identical and is
  * set by the argument <b>numberOfChannels</b> in the setup() method.
+ * Optionally, the component has a parameter input "activityInput" of type
+ * pml::ChannelActivityParameter. Inactive channels are not filtered, their
+ * outputs are set to zero and their filter states are cleared.
  */
 class VISR_RCL_LIBRARY_SYMBOL BiquadIirFilter: public visr::AtomicComponent
 {
@@ -51,13 +55,16 @@ public:
    * @param numberOfBiquads The number of biquads per audio channel.
    * @param controlInput Flag whether to instantiate a parameter port for
    * receiving filter update commands.
+   * @param activityInput Flag whether to instantiate a parameter port
+   * "activityInput" for the set of active channels.
    */
   explicit BiquadIirFilter( visr::SignalFlowContext const & context,
                             char const * name,
                             visr::CompositeComponent * parent,
                             std::size_t numberOfChannels,
                             std::size_t numberOfBiquads,
-                            bool controlInput = false );
+                            bool controlInput = false,
+                            bool activityInput = false );
 
   /**
    * Constructor that yields a fully initialised object.
@@ -76,6 +83,8 @@ public:
    * a flat, direct-feedthrough filter
    * @param controlInput Flag whether to instantiate a parameter port for
    * receiving filter update commands.
+   * @param activityInput Flag whether to instantiate a parameter port
+   * "activityInput" for the set of active channels.
    */
   explicit BiquadIirFilter(
       visr::SignalFlowContext const & context,
@@ -84,7 +93,8 @@ public:
       std::size_t numberOfChannels,
       std::size_t numberOfBiquads,
       visr::rbbl::BiquadCoefficient< SampleType > const & initialBiquad,
-      bool controlInput = false );
+      bool controlInput = false,
+      bool activityInput = false );
 
   /**
    * Constructor that yields a fully initialised object.
@@ -102,6 +112,8 @@ public:
    * must equal the \p numberOfBiquads parameter.
    * @param controlInput Flag whether to instantiate a parameter port for
    * receiving filter update commands.
+   * @param activityInput Flag whether to instantiate a parameter port
+   * "activityInput" for the set of active channels.
    */
   explicit BiquadIirFilter(
       visr::SignalFlowContext const & context,
@@ -110,7 +122,8 @@ public:
       std::size_t numberOfChannels,
       std::size_t numberOfBiquads,
       visr::rbbl::BiquadCoefficientList< SampleType > const & coeffs,
-      bool controlInput = false );
+      bool controlInput = false,
+      bool activityInput = false );
 
   /**
    * Constructor that yields a fully initialised object.
@@ -130,6 +143,8 @@ public:
    * numberOfChannels x \p numberOfBiquads
    * @param controlInput Flag whether to instantiate a parameter port for
    * receiving filter update commands.
+   * @param activityInput Flag whether to instantiate a parameter port
+   * "activityInput" for the set of active channels.
    */
   explicit BiquadIirFilter(
       visr::SignalFlowContext const & context,
@@ -138,11 +153,16 @@ public:
       std::size_t numberOfChannels,
       std::size_t numberOfBiquads,
       visr::rbbl::BiquadCoefficientMatrix< SampleType > const & coeffs,
-      bool controlInput = false );
+      bool controlInput = false,
+      bool activityInput = false );
 
   /**
    * The process method applies the IIR filters to the audio channels.
    * values to the stream of input samples.
+   * Channels whose input is marked as silent (see visr::AudioPortBase::silent())
+   * are not filtered once the filter state has decayed below
+   * cSilentStateThreshold. In this case, the output is zeroed and marked as
+   * silent.
    */
   void process() override;
 
@@ -239,6 +259,11 @@ private:
                             visr::pml::BiquadParameterMatrix< SampleType > > >
       mEqInput;
 
+  std::unique_ptr<
+      visr::ParameterInput< visr::pml::DoubleBufferingProtocol,
+                            visr::pml::ChannelActivityParameter > >
+      mActivityInput;
+
   /**
    * The number of simultaneous audio channels.
    */
@@ -274,6 +299,12 @@ private:
       visr::rbbl::BiquadCoefficient< SampleType >::cNumberOfCoeffs;
 
   static constexpr std::size_t cBiquadStateStride = 2;
+
+  /**
+   * Maximum magnitude of the filter state below which the output of a channel
+   * with a silent input is considered as silent.
+   */
+  static constexpr SampleType cSilentStateThreshold = 1.0e-10f;
 };
 
 } // namespace rcl
@@ -0,0 +1,104 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "block_stamp_decoder.hpp"
+#include "block_stamp_encoder.hpp"
+
+#include <libpml/empty_parameter_config.hpp>
+
+#include <libvisr/time.hpp>
+
+#include <algorithm>
+#include <ciso646>
+#include <cstring>
+
+namespace visr
+{
+namespace rcl
+{
+
+namespace // unnamed
+{
+
+/**
+ * Parse the block stamp at the beginning of a message.
+ * @param msg The message data.
+ * @param size The length of the message.
+ * @param [out] blockIndex The parsed block number.
+ * @param [out] payloadOffset Start position of the original message.
+ * @return Whether the message starts with a valid block stamp.
+ */
+bool parseBlockStamp( char const * msg, std::size_t size, std::size_t & blockIndex, std::size_t & payloadOffset )
+{
+  std::size_t const prefixLength = std::strlen( BlockStampEncoder::cStampPrefix );
+  if( (size < prefixLength) or (std::strncmp( msg, BlockStampEncoder::cStampPrefix, prefixLength ) != 0) )
+  {
+    return false;
+  }
+  std::size_t pos = prefixLength;
+  blockIndex = 0;
+  while( (pos < size) and (msg[pos] >= '0') and (msg[pos] <= '9') )
+  {
+    blockIndex = 10 * blockIndex + static_cast<std::size_t>(msg[pos] - '0');
+    ++pos;
+  }
+  if( (pos == prefixLength) or (pos == size) or (msg[pos] != '\n') )
+  {
+    return false;
+  }
+  payloadOffset = pos + 1;
+  return true;
+}
+
+} // unnamed namespace
+
+BlockStampDecoder::BlockStampDecoder( SignalFlowContext const & context,
+                                      char const * name,
+                                      CompositeComponent * parent /*= nullptr*/ )
+ : AtomicComponent( context, name, parent )
+ , mInput( "in", *this, pml::EmptyParameterConfig() )
+ , mOutput( "out", *this, pml::EmptyParameterConfig() )
+ , mNumberOfLateMessages( 0 )
+{
+}
+
+BlockStampDecoder::~BlockStampDecoder() = default;
+
+void BlockStampDecoder::process()
+{
+  std::size_t const currentBlock = time().blockCount();
+  while( not mInput.empty() )
+  {
+    pml::StringParameter const & msg = mInput.front();
+    std::size_t blockIndex;
+    std::size_t payloadOffset;
+    if( parseBlockStamp( msg.str(), msg.size(), blockIndex, payloadOffset ) )
+    {
+      if( blockIndex < currentBlock )
+      {
+        ++mNumberOfLateMessages;
+      }
+      // Insert after all messages with the same stamp to retain the order of arrival.
+      auto const insertPos = std::upper_bound( mPendingMessages.begin(), mPendingMessages.end(), blockIndex,
+        []( std::size_t block, std::pair<std::size_t, std::string> const & entry ){ return block < entry.first; } );
+      mPendingMessages.emplace( insertPos, blockIndex, std::string( msg.str() + payloadOffset, msg.size() - payloadOffset ) );
+    }
+    else
+    {
+      status( StatusMessage::Warning, "BlockStampDecoder: Discarding a message without a valid block stamp." );
+    }
+    mInput.pop();
+  }
+  while( (not mPendingMessages.empty()) and (mPendingMessages.front().first <= currentBlock) )
+  {
+    mOutput.enqueue( pml::StringParameter( mPendingMessages.front().second ) );
+    mPendingMessages.pop_front();
+  }
+}
+
+std::size_t BlockStampDecoder::numberOfLateMessages() const
+{
+  return mNumberOfLateMessages;
+}
+
+} // namespace rcl
+} // namespace visr
@@ -0,0 +1,80 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRCL_BLOCK_STAMP_DECODER_HPP_INCLUDED
+#define VISR_LIBRCL_BLOCK_STAMP_DECODER_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/parameter_input.hpp>
+#include <libvisr/parameter_output.hpp>
+
+#include <libpml/message_queue_protocol.hpp>
+#include <libpml/string_parameter.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <utility>
+
+namespace visr
+{
+namespace rcl
+{
+
+/**
+ * Component that releases block-stamped messages created by a BlockStampEncoder at the stamped block.
+ * Messages received at the input "in" are held back until Time::blockCount() reaches the block number of their
+ * stamp. Then the original message (without the stamp) is sent to the output "out", such that a SceneDecoder
+ * (or another message consumer) connected to the output applies it in exactly this block.
+ * Messages are released in the order of their block stamps, messages with equal stamps in the order of their arrival.
+ * Messages whose stamped block has already passed are released immediately and counted as late messages.
+ * Messages without a valid stamp are discarded with a warning.
+ * Both ports use the MessageQueueProtocol with pml::StringParameter messages.
+ */
+class VISR_RCL_LIBRARY_SYMBOL BlockStampDecoder: public AtomicComponent
+{
+public:
+  /**
+   * Constructor.
+   * @param context Configuration object containing basic execution parameters.
+   * @param name The name of the component. Must be unique within the containing composite component (if there is one).
+   * @param parent Pointer to a containing component if there is one. Specify \p nullptr in case of a top-level component.
+   */
+  explicit BlockStampDecoder( SignalFlowContext const & context,
+                              char const * name,
+                              CompositeComponent * parent = nullptr );
+
+  BlockStampDecoder( BlockStampDecoder const & ) = delete;
+
+  ~BlockStampDecoder() override;
+
+  void process() override;
+
+  /**
+   * Return the number of messages that arrived after their stamped block.
+   * A nonzero value indicates that the scheduling latency of the BlockStampEncoder is too small for the
+   * transmission path.
+   */
+  std::size_t numberOfLateMessages() const;
+
+private:
+  using MessageInput = ParameterInput< pml::MessageQueueProtocol, pml::StringParameter >;
+  using MessageOutput = ParameterOutput< pml::MessageQueueProtocol, pml::StringParameter >;
+
+  MessageInput mInput;
+
+  MessageOutput mOutput;
+
+  /**
+   * Messages waiting for their block, sorted by the block number.
+   */
+  std::deque< std::pair<std::size_t, std::string> > mPendingMessages;
+
+  std::size_t mNumberOfLateMessages;
+};
+
+} // namespace rcl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRCL_BLOCK_STAMP_DECODER_HPP_INCLUDED
@@ -0,0 +1,57 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "block_stamp_encoder.hpp"
+
+#include <libpml/empty_parameter_config.hpp>
+
+#include <libvisr/time.hpp>
+
+#include <sstream>
+
+namespace visr
+{
+namespace rcl
+{
+
+char const BlockStampEncoder::cStampPrefix[] = "#block ";
+
+BlockStampEncoder::BlockStampEncoder( SignalFlowContext const & context,
+                                      char const * name,
+                                      CompositeComponent * parent,
+                                      std::size_t schedulingLatency,
+                                      std::size_t numberOfOutputs /*= 1*/ )
+ : AtomicComponent( context, name, parent )
+ , mSchedulingLatency( schedulingLatency )
+ , mInput( "in", *this, pml::EmptyParameterConfig() )
+{
+  mOutputs.reserve( numberOfOutputs );
+  for( std::size_t outIdx( 0 ); outIdx < numberOfOutputs; ++outIdx )
+  {
+    std::stringstream outName;
+    outName << "out" << outIdx;
+    mOutputs.emplace_back( new MessageOutput( outName.str().c_str(), *this, pml::EmptyParameterConfig() ) );
+  }
+}
+
+BlockStampEncoder::~BlockStampEncoder() = default;
+
+void BlockStampEncoder::process()
+{
+  std::string const blockStamp = std::to_string( time().blockCount() + mSchedulingLatency );
+  while( not mInput.empty() )
+  {
+    pml::StringParameter const & msg = mInput.front();
+    mStampedMessage.assign( cStampPrefix );
+    mStampedMessage.append( blockStamp );
+    mStampedMessage.push_back( '\n' );
+    mStampedMessage.append( msg.str(), msg.size() );
+    for( std::unique_ptr<MessageOutput> & output : mOutputs )
+    {
+      output->enqueue( pml::StringParameter( mStampedMessage ) );
+    }
+    mInput.pop();
+  }
+}
+
+} // namespace rcl
+} // namespace visr
@@ -0,0 +1,86 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRCL_BLOCK_STAMP_ENCODER_HPP_INCLUDED
+#define VISR_LIBRCL_BLOCK_STAMP_ENCODER_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/parameter_input.hpp>
+#include <libvisr/parameter_output.hpp>
+
+#include <libpml/message_queue_protocol.hpp>
+#include <libpml/string_parameter.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace visr
+{
+namespace rcl
+{
+
+/**
+ * Component that stamps messages with the block at which they are to take effect.
+ * This is used to apply control messages (e.g., scene metadata) at exactly the same audio block in several
+ * signal flows that run in lockstep, for instance the nodes of a distributed renderer. Each message received
+ * at the input "in" is prefixed with the block number Time::blockCount() + \p schedulingLatency and sent to all
+ * message outputs "out0", "out1", ... The stamped messages are typically transmitted over a network (UdpSender)
+ * and released at the receiving side by a BlockStampDecoder.
+ * The stamped message consists of the prefix cStampPrefix, the decimal block number, a newline character, and
+ * the unaltered original message, which may be a binary message.
+ * All inputs and outputs use the MessageQueueProtocol with pml::StringParameter messages.
+ * @note The block numbers are only meaningful if the block counters of all receiving signal flows are identical,
+ * i.e., if the signal flows have been started at the same block and are driven by a common clock.
+ */
+class VISR_RCL_LIBRARY_SYMBOL BlockStampEncoder: public AtomicComponent
+{
+public:
+  /**
+   * The prefix marking a block-stamped message.
+   */
+  static char const cStampPrefix[];
+
+  /**
+   * Constructor.
+   * @param context Configuration object containing basic execution parameters.
+   * @param name The name of the component. Must be unique within the containing composite component (if there is one).
+   * @param parent Pointer to a containing component if there is one. Specify \p nullptr in case of a top-level component.
+   * @param schedulingLatency The number of blocks between the reception of a message and the block at which it
+   * takes effect. This must exceed the maximum transmission time to the receivers, otherwise messages are applied late.
+   * @param numberOfOutputs The number of message outputs, which receive identical copies of the stamped messages.
+   */
+  explicit BlockStampEncoder( SignalFlowContext const & context,
+                              char const * name,
+                              CompositeComponent * parent,
+                              std::size_t schedulingLatency,
+                              std::size_t numberOfOutputs = 1 );
+
+  BlockStampEncoder( BlockStampEncoder const & ) = delete;
+
+  ~BlockStampEncoder() override;
+
+  void process() override;
+
+private:
+  std::size_t const mSchedulingLatency;
+
+  using MessageInput = ParameterInput< pml::MessageQueueProtocol, pml::StringParameter >;
+  using MessageOutput = ParameterOutput< pml::MessageQueueProtocol, pml::StringParameter >;
+
+  MessageInput mInput;
+
+  std::vector<std::unique_ptr<MessageOutput> > mOutputs;
+
+  /**
+   * Buffer for assembling the stamped messages, kept as a member to reuse the allocated memory.
+   */
+  std::string mStampedMessage;
+};
+
+} // namespace rcl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRCL_BLOCK_STAMP_ENCODER_HPP_INCLUDED
@@ -0,0 +1,83 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "channel_activity_calculator.hpp"
+
+#include <libobjectmodel/object.hpp>
+#include <libobjectmodel/object_vector.hpp>
+
+#include <libpml/vector_parameter_config.hpp>
+
+#include <algorithm>
+#include <ciso646>
+
+namespace visr
+{
+namespace rcl
+{
+
+ChannelActivityCalculator::ChannelActivityCalculator( SignalFlowContext const & context,
+                                                      char const * name,
+                                                      CompositeComponent * parent,
+                                                      std::size_t numberOfObjectChannels,
+                                                      std::size_t releasePeriods )
+ : AtomicComponent( context, name, parent )
+ , mObjectInput( "objectIn", *this, pml::EmptyParameterConfig() )
+ , mActivityOutput( "activityOut", *this, pml::VectorParameterConfig( numberOfObjectChannels ) )
+ , cReleasePeriods( releasePeriods )
+ , mReferenced( numberOfObjectChannels, 0 )
+ // Start with all channels active, so that no signal is suppressed before the first scene arrives.
+ , mHoldCounters( numberOfObjectChannels, releasePeriods + 1 )
+ , mInitialised( false )
+{
+}
+
+ChannelActivityCalculator::~ChannelActivityCalculator() = default;
+
+void ChannelActivityCalculator::process()
+{
+  std::size_t const numChannels = mReferenced.size();
+  if( mObjectInput.changed() )
+  {
+    std::fill( mReferenced.begin(), mReferenced.end(), 0 );
+    for( objectmodel::Object const & obj : mObjectInput.data() )
+    {
+      for( std::size_t chIdx( 0 ); chIdx < obj.numberOfChannels(); ++chIdx )
+      {
+        std::size_t const signalChannelIdx = obj.channelIndex( chIdx );
+        if( signalChannelIdx < numChannels ) // Invalid channel indices are reported by the gain calculators.
+        {
+          mReferenced[signalChannelIdx] = 1;
+        }
+      }
+    }
+    mObjectInput.resetChanged();
+  }
+  bool activityChanged = not mInitialised;
+  for( std::size_t chIdx( 0 ); chIdx < numChannels; ++chIdx )
+  {
+    std::size_t & counter = mHoldCounters[chIdx];
+    if( mReferenced[chIdx] )
+    {
+      activityChanged = activityChanged or (counter == 0);
+      counter = cReleasePeriods + 1;
+    }
+    else if( counter > 0 )
+    {
+      --counter;
+      activityChanged = activityChanged or (counter == 0);
+    }
+  }
+  if( activityChanged )
+  {
+    pml::ChannelActivityParameter & activity = mActivityOutput.data();
+    for( std::size_t chIdx( 0 ); chIdx < numChannels; ++chIdx )
+    {
+      activity.setActive( chIdx, mHoldCounters[chIdx] > 0 );
+    }
+    mActivityOutput.swapBuffers();
+    mInitialised = true;
+  }
+}
+
+} // namespace rcl
+} // namespace visr
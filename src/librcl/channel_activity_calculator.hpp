@@ -0,0 +1,86 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRCL_CHANNEL_ACTIVITY_CALCULATOR_HPP_INCLUDED
+#define VISR_LIBRCL_CHANNEL_ACTIVITY_CALCULATOR_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/parameter_input.hpp>
+#include <libvisr/parameter_output.hpp>
+
+#include <libpml/channel_activity_parameter.hpp>
+#include <libpml/double_buffering_protocol.hpp>
+#include <libpml/object_vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace visr
+{
+namespace rcl
+{
+
+/**
+ * Component to determine the set of object signal channels that need to be processed.
+ * A channel is active if it is referenced by an object in the scene. After the last referencing object has been
+ * removed, the channel stays active for a configurable number of periods to let gain transitions and
+ * filter tails in the processing components complete. Components receiving the activity (e.g., GainVector,
+ * BiquadIirFilter, DelayVector, GainMatrix) skip the computations for inactive channels.
+ * The component has a parameter input "objectIn" (pml::ObjectVector) and a parameter output "activityOut"
+ * (pml::ChannelActivityParameter), both using the DoubleBufferingProtocol. The output is updated only if the
+ * activity of at least one channel changes.
+ */
+class VISR_RCL_LIBRARY_SYMBOL ChannelActivityCalculator: public AtomicComponent
+{
+public:
+  /**
+   * Constructor.
+   * @param context Configuration object containing basic execution parameters.
+   * @param name The name of the component. Must be unique within the containing composite component (if there is one).
+   * @param parent Pointer to a containing component if there is one. Specify \p nullptr in case of a top-level component.
+   * @param numberOfObjectChannels The number of object signal channels.
+   * @param releasePeriods The number of periods a channel remains active after it ceased to be referenced by an
+   * object. This value should not be less than the transition time (in periods) of the gain components fed by
+   * the object channels, because otherwise fade-outs are truncated.
+   */
+  explicit ChannelActivityCalculator( SignalFlowContext const & context,
+                                      char const * name,
+                                      CompositeComponent * parent,
+                                      std::size_t numberOfObjectChannels,
+                                      std::size_t releasePeriods );
+
+  ChannelActivityCalculator( ChannelActivityCalculator const & ) = delete;
+
+  ~ChannelActivityCalculator() override;
+
+  void process() override;
+
+private:
+  ParameterInput<pml::DoubleBufferingProtocol, pml::ObjectVector> mObjectInput;
+
+  ParameterOutput<pml::DoubleBufferingProtocol, pml::ChannelActivityParameter> mActivityOutput;
+
+  std::size_t const cReleasePeriods;
+
+  /**
+   * Whether a channel is referenced by an object of the current scene.
+   */
+  std::vector<std::uint8_t> mReferenced;
+
+  /**
+   * The number of periods each channel remains active, 0 denotes an inactive channel.
+   */
+  std::vector<std::size_t> mHoldCounters;
+
+  /**
+   * Flag to enforce sending the initial activity state.
+   */
+  bool mInitialised;
+};
+
+} // namespace rcl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRCL_CHANNEL_ACTIVITY_CALCULATOR_HPP_INCLUDED
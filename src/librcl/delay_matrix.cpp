@@ -29,6 +29,7 @@ namespace rcl
  , mNextGains(cVectorAlignmentSamples)
  , mNextDelays(cVectorAlignmentSamples)
  , mTmpResult( mOutput.alignmentSamples() ) // Use the same alignment as for the audio port
+ , mProcessingMode( ProcessingMode::Pairwise )
  , cSamplingFrequency( static_cast<SampleType>( samplingFrequency() ) )
 {
 }
@@ -44,7 +45,8 @@ DelayMatrix::DelayMatrix( SignalFlowContext const & context,
     MethodDelayPolicy methodDelayPolicy,
     ControlPortConfig controlInputs,
     SampleType initialDelaySeconds /*= static_cast<SampleType>(0.0)*/,
-    SampleType initialGainLinear /*= static_cast<SampleType>(1.0)*/ )
+    SampleType initialGainLinear /*= static_cast<SampleType>(1.0)*/,
+    ProcessingMode processingMode /*= ProcessingMode::Pairwise*/ )
  : AtomicComponent( context, name, parent )
  , mInput( "in", *this )
  , mOutput( "out", *this )
@@ -53,11 +55,12 @@ DelayMatrix::DelayMatrix( SignalFlowContext const & context,
  , mNextGains( cVectorAlignmentSamples )
  , mNextDelays( cVectorAlignmentSamples )
  , mTmpResult( mOutput.alignmentSamples() ) // Use the same alignment as for the audio port
+ , mProcessingMode( ProcessingMode::Pairwise )
  , cSamplingFrequency( static_cast<SampleType>(samplingFrequency()) )
 {
   setup( numberOfInputs, numberOfOutputs, interpolationSteps,
          maximumDelaySeconds, interpolationMethod, methodDelayPolicy,
-         controlInputs, initialDelaySeconds, initialGainLinear );
+         controlInputs, initialDelaySeconds, initialGainLinear, processingMode );
 }
 
 DelayMatrix::DelayMatrix( SignalFlowContext const & context,
@@ -71,7 +74,8 @@ DelayMatrix::DelayMatrix( SignalFlowContext const & context,
     MethodDelayPolicy methodDelayPolicy,
     ControlPortConfig controlInputs,
     efl::BasicMatrix< SampleType > const & initialDelaysSeconds,
-    efl::BasicMatrix< SampleType > const & initialGainsLinear )
+    efl::BasicMatrix< SampleType > const & initialGainsLinear,
+    ProcessingMode processingMode /*= ProcessingMode::Pairwise*/ )
   : AtomicComponent( context, name, parent )
   , mInput( "in", *this )
   , mOutput( "out", *this )
@@ -80,11 +84,12 @@ DelayMatrix::DelayMatrix( SignalFlowContext const & context,
   , mNextGains( cVectorAlignmentSamples )
   , mNextDelays( cVectorAlignmentSamples )
   , mTmpResult( mOutput.alignmentSamples() ) // Use the same alignment as for the audio port
+  , mProcessingMode( ProcessingMode::Pairwise )
   , cSamplingFrequency( static_cast<SampleType>(samplingFrequency()) )
 {
   setup( numberOfInputs, numberOfOutputs, interpolationSteps,
     maximumDelaySeconds, interpolationMethod, methodDelayPolicy,
-    controlInputs, initialDelaysSeconds, initialGainsLinear );
+    controlInputs, initialDelaysSeconds, initialGainsLinear, processingMode );
 }
 
 
@@ -98,7 +103,8 @@ void DelayMatrix::setup( std::size_t numberOfInputs,
                          MethodDelayPolicy methodDelayPolicy,
                          ControlPortConfig controlInputs,
                          SampleType initialDelaySeconds /* = static_cast<SampleType>(1.0) */,
-                         SampleType initialGainLinear /* = static_cast<SampleType>(0.0) */ )
+                         SampleType initialGainLinear /* = static_cast<SampleType>(0.0) */,
+                         ProcessingMode processingMode /*= ProcessingMode::Pairwise*/ )
 {
   efl::BasicMatrix< SampleType > initialDelayMtx( numberOfOutputs, numberOfInputs, cVectorAlignmentSamples );
   efl::BasicMatrix< SampleType > initialGainMtx( numberOfOutputs, numberOfInputs, cVectorAlignmentSamples );
@@ -107,7 +113,7 @@ void DelayMatrix::setup( std::size_t numberOfInputs,
 
   setup( numberOfInputs, numberOfOutputs, interpolationSteps, maximumDelaySeconds, interpolationMethod,
          methodDelayPolicy, controlInputs,
-         initialDelayMtx, initialGainMtx );
+         initialDelayMtx, initialGainMtx, processingMode );
 }
 
  void DelayMatrix::setup( std::size_t numberOfInputs,
@@ -118,7 +124,8 @@ void DelayMatrix::setup( std::size_t numberOfInputs,
                           MethodDelayPolicy methodDelayPolicy,
                           ControlPortConfig controlInputs,
                           efl::BasicMatrix< SampleType > const & initialDelaysSeconds,
-                          efl::BasicMatrix< SampleType > const & initialGainsLinear )
+                          efl::BasicMatrix< SampleType > const & initialGainsLinear,
+                          ProcessingMode processingMode /*= ProcessingMode::Pairwise*/ )
 {
   if( interpolationSteps % period() != 0 )
   {
@@ -156,6 +163,13 @@ void DelayMatrix::setup( std::size_t numberOfInputs,
   mNextDelays.resize( numberOfOutputs, numberOfInputs );
   mTmpResult.resize( period() );
 
+  mProcessingMode = processingMode;
+  mActiveOutputs.resize( numberOfOutputs );
+  mActiveStartDelays.resize( numberOfOutputs );
+  mActiveEndDelays.resize( numberOfOutputs );
+  mActiveStartGains.resize( numberOfOutputs );
+  mActiveEndGains.resize( numberOfOutputs );
+
   mCurrentGains.copy( initialGainsLinear );
   mCurrentDelays.copy( initialDelaysSeconds );
   mNextGains.copy( mCurrentGains );
@@ -195,11 +209,7 @@ void DelayMatrix::process()
     mDelayInput->resetChanged();
   }
 
-  std::size_t const blockLength = period();
-  std::size_t const numberOfInputs = mInput.width();
-  std::size_t const numberOfOutputs = mOutput.width();
-
-  mDelayLine->write( mInput.data(), mInput.channelStrideSamples(), numberOfInputs, mInput.alignmentSamples() );
+  mDelayLine->write( mInput.data(), mInput.channelStrideSamples(), mInput.width(), mInput.alignmentSamples() );
 
   SampleType const currentGainRatio =
       static_cast<SampleType>(mGainInterpolationCounter)
@@ -215,6 +225,24 @@ void DelayMatrix::process()
       static_cast<SampleType>(std::min(mDelayInterpolationCounter+1, mInterpolationBlocks) )
       / static_cast<SampleType>(mInterpolationBlocks);
 
+  if( mProcessingMode == ProcessingMode::SharedInput )
+  {
+    processSharedInput( currentDelayRatio, nextDelayRatio, currentGainRatio, nextGainRatio );
+  }
+  else
+  {
+    processPairwise( currentDelayRatio, nextDelayRatio, currentGainRatio, nextGainRatio );
+  }
+  mGainInterpolationCounter = std::min( mInterpolationBlocks, mGainInterpolationCounter+1 );
+  mDelayInterpolationCounter = std::min( mInterpolationBlocks, mDelayInterpolationCounter+1 );
+}
+
+void DelayMatrix::processPairwise( SampleType currentDelayRatio, SampleType nextDelayRatio,
+                                   SampleType currentGainRatio, SampleType nextGainRatio )
+{
+  std::size_t const blockLength = period();
+  std::size_t const numberOfInputs = mInput.width();
+  std::size_t const numberOfOutputs = mOutput.width();
   std::size_t const signalAlignment = mTmpResult.alignmentElements();
 
   for( std::size_t outIdx(0); outIdx < numberOfOutputs; ++outIdx )
@@ -239,8 +267,50 @@ void DelayMatrix::process()
       }
     }
   }
-  mGainInterpolationCounter = std::min( mInterpolationBlocks, mGainInterpolationCounter+1 );
-  mDelayInterpolationCounter = std::min( mInterpolationBlocks, mDelayInterpolationCounter+1 );
+}
+
+void DelayMatrix::processSharedInput( SampleType currentDelayRatio, SampleType nextDelayRatio,
+                                      SampleType currentGainRatio, SampleType nextGainRatio )
+{
+  std::size_t const blockLength = period();
+  std::size_t const numberOfInputs = mInput.width();
+  std::size_t const numberOfOutputs = mOutput.width();
+  std::size_t const signalAlignment = mTmpResult.alignmentElements();
+
+  for( std::size_t outIdx(0); outIdx < numberOfOutputs; ++outIdx )
+  {
+    efl::ErrorCode res = efl::vectorZero( mOutput[outIdx], blockLength, signalAlignment );
+    if( res != efl::noError )
+    {
+      status( StatusMessage::Error, "Error while zeroing output channel: ", efl::errorMessage(res) );
+    }
+  }
+  for( std::size_t inIdx(0); inIdx < numberOfInputs; ++inIdx )
+  {
+    // Collect the routing points of this input that contribute to the output within this block.
+    std::size_t numActive = 0;
+    for( std::size_t outIdx(0); outIdx < numberOfOutputs; ++outIdx )
+    {
+      SampleType const startGain = (static_cast<SampleType>(1.0)-currentGainRatio) * mCurrentGains(outIdx, inIdx) + currentGainRatio *  mNextGains(outIdx, inIdx);
+      SampleType const endGain = (static_cast<SampleType>(1.0)-nextGainRatio) * mCurrentGains(outIdx, inIdx) + nextGainRatio *  mNextGains(outIdx, inIdx);
+      if( (startGain == static_cast<SampleType>(0.0)) and (endGain == static_cast<SampleType>(0.0)) )
+      {
+        continue;
+      }
+      mActiveOutputs[numActive] = mOutput[outIdx];
+      mActiveStartDelays[numActive] = (static_cast<SampleType>(1.0)-currentDelayRatio) * mCurrentDelays(outIdx, inIdx) + currentDelayRatio *  mNextDelays(outIdx, inIdx);
+      mActiveEndDelays[numActive] = (static_cast<SampleType>(1.0)-nextDelayRatio) * mCurrentDelays(outIdx, inIdx) + nextDelayRatio *  mNextDelays(outIdx, inIdx);
+      mActiveStartGains[numActive] = startGain;
+      mActiveEndGains[numActive] = endGain;
+      ++numActive;
+    }
+    if( numActive > 0 )
+    {
+      mDelayLine->interpolateAccumulate( inIdx, mActiveOutputs.data(), numActive, blockLength,
+                                         mActiveStartDelays.data(), mActiveEndDelays.data(),
+                                         mActiveStartGains.data(), mActiveEndGains.data() );
+    }
+  }
 }
 
 void DelayMatrix::setDelayAndGain( efl::BasicMatrix< SampleType > const & newDelays,
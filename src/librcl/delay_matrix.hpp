@@ -22,6 +22,7 @@
 #include <cstddef> // for std::size_t
 #include <memory>
 #include <valarray>
+#include <vector>
 
 namespace visr
 {
@@ -57,6 +58,15 @@ public:
     All = Delay | Gain
   };
 
+  /**
+   * Enumeration selecting the processing strategy.
+   */
+  enum class ProcessingMode
+  {
+    Pairwise, ///< Interpolate each input-output pair separately and add the result to the output.
+    SharedInput ///< Interpolate the history of each input for all outputs at once, skipping routing points with zero gain.
+  };
+
   /**
    * Constructor, creates a basic, not fully initialised object. 
    * A setup() method must be called before the component before the process() method can be used.
@@ -92,6 +102,8 @@ public:
    * channels (in seconds, default: 0.0)
    * @param initialGainLinear The initial delay value for all
    * channels (in linear scale, default: 1.0)
+   * @param processingMode Whether the routing points are computed pairwise or for all outputs of an input at once.
+   * The latter is typically faster for large or sparsely populated matrices, but the results are not bit-identical.
    */
   explicit DelayMatrix( SignalFlowContext const & context,
                         char const * name,
@@ -104,7 +116,8 @@ public:
                         MethodDelayPolicy methodDelayPolicy,
                         ControlPortConfig controlInputs,
                         SampleType initialDelaySeconds = static_cast<SampleType>(0.0),
-                        SampleType initialGainLinear = static_cast<SampleType>(1.0) );
+                        SampleType initialGainLinear = static_cast<SampleType>(1.0),
+                        ProcessingMode processingMode = ProcessingMode::Pairwise );
 
   /**
    * Constructor, creates a fully initialised object.
@@ -131,6 +144,7 @@ public:
    * @param initialGainsLinear The initial gain values for all
    * channels, given in a linear scale.  The the number of
    * elements in this vector must match the channel number of this object.
+   * @param processingMode Whether the routing points are computed pairwise or for all outputs of an input at once.
    */
   explicit DelayMatrix( SignalFlowContext const & context,
                         char const * name,
@@ -143,7 +157,8 @@ public:
                         MethodDelayPolicy methodDelayPolicy,
                         ControlPortConfig controlInputs,
                         efl::BasicMatrix< SampleType > const & initialDelaysSeconds,
-                        efl::BasicMatrix< SampleType > const & initialGainsLinear );
+                        efl::BasicMatrix< SampleType > const & initialGainsLinear,
+                        ProcessingMode processingMode = ProcessingMode::Pairwise );
 
   /**
    * Setup method to initialise the object and set the parameters.
@@ -164,6 +179,8 @@ public:
    * channels (in seconds, default: 0.0)
    * @param initialGainLinear The initial delay value for all
    * channels (in linear scale, default: 1.0)
+   * @param processingMode Whether the routing points are computed pairwise or for all outputs of an input at once.
+   * The latter is typically faster for large or sparsely populated matrices, but the results are not bit-identical.
    */
   void setup( std::size_t numberOfInputs,
               std::size_t numberOfOutputs,
@@ -173,7 +190,8 @@ public:
               MethodDelayPolicy methodDelayPolicy,
               ControlPortConfig controlInputs,
               SampleType initialDelaySeconds = static_cast<SampleType>(0.0),
-              SampleType initialGainLinear = static_cast<SampleType>(1.0) );
+              SampleType initialGainLinear = static_cast<SampleType>(1.0),
+              ProcessingMode processingMode = ProcessingMode::Pairwise );
 
   /**
   * Setup method to initialise the object and set the parameters.
@@ -195,6 +213,7 @@ public:
   * @param initialGainsLinear The initial gain values for all
   * channels, given in a linear scale.  The the number of
   * elements in this vector must match the channel number of this object.
+  * @param processingMode Whether the routing points are computed pairwise or for all outputs of an input at once.
   */
   void setup( std::size_t numberOfInputs,
               std::size_t numberOfOutputs,
@@ -204,7 +223,8 @@ public:
               MethodDelayPolicy methodDelayPolicy,
               ControlPortConfig controlInputs,
               efl::BasicMatrix< SampleType > const & initialDelaysSeconds,
-              efl::BasicMatrix< SampleType > const & initialGainsLinear );
+              efl::BasicMatrix< SampleType > const & initialGainsLinear,
+              ProcessingMode processingMode = ProcessingMode::Pairwise );
 
   /**
    * The process method applies the (interpolated) delay and gain
@@ -272,6 +292,17 @@ public:
   void setGain( efl::BasicMatrix< SampleType > const & newGains );
 
 private:
+  /**
+   * Process method for ProcessingMode::Pairwise.
+   */
+  void processPairwise( SampleType currentDelayRatio, SampleType nextDelayRatio,
+                        SampleType currentGainRatio, SampleType nextGainRatio );
+
+  /**
+   * Process method for ProcessingMode::SharedInput.
+   */
+  void processSharedInput( SampleType currentDelayRatio, SampleType nextDelayRatio,
+                           SampleType currentGainRatio, SampleType nextGainRatio );
 
   /**
    * The audio input port for this component.
@@ -326,6 +357,23 @@ private:
    */
   efl::BasicVector< SampleType > mTmpResult;
 
+  /**
+   * The selected processing strategy.
+   */
+  ProcessingMode mProcessingMode;
+
+  /**
+   * Intermediate storage for ProcessingMode::SharedInput, holding the output pointers, delays and gains of the
+   * active routing points of one input. Allocated in setup() to avoid allocations in the process() method.
+   */
+  //@{
+  std::vector< SampleType * > mActiveOutputs;
+  std::vector< SampleType > mActiveStartDelays;
+  std::vector< SampleType > mActiveEndDelays;
+  std::vector< SampleType > mActiveStartGains;
+  std::vector< SampleType > mActiveEndGains;
+  //@}
+
   /**
    * The sampling frequency of the audio signal flow, converted to floating-point 
    * for more convenient runtime calculations of the sample value.
@@ -87,10 +87,16 @@ void DelayVector::setup( std::size_t numberOfChannels,
     mDelayInput.reset( new ParameterInput<pml::DoubleBufferingProtocol, pml::VectorParameter<SampleType> >( "delayInput", *this, pml::VectorParameterConfig( numberOfChannels ) ) );
   }
 
+  if( (controlInputs & ControlPortConfig::ChannelActivity) != ControlPortConfig::None )
+  {
+    mActivityInput.reset( new ParameterInput<pml::DoubleBufferingProtocol, pml::ChannelActivityParameter >( "activityInput", *this, pml::VectorParameterConfig( numberOfChannels ) ) );
+  }
+
   mCurrentGains.resize(numberOfChannels);
   mCurrentDelays.resize(numberOfChannels);
   mNextGains.resize(numberOfChannels);
   mNextDelays.resize(numberOfChannels);
+  mSilentInputSamples.assign( numberOfChannels, 0 );
 
   mDelayLine.reset( new rbbl::MultichannelDelayLine<SampleType>( numberOfChannels, samplingFrequency(), period(),
     maximumDelaySeconds, interpolationMethod, methodDelayPolicy, mInput.alignmentSamples() ) );
@@ -179,8 +185,20 @@ void DelayVector::process()
       static_cast<SampleType>(std::min(mDelayInterpolationCounter+1, mInterpolationBlocks) )
       / static_cast<SampleType>(mInterpolationBlocks);
 
+  pml::ChannelActivityParameter const * const activity = mActivityInput ? &mActivityInput->data() : nullptr;
+  std::size_t const historyLength = mDelayLine->historyLength();
+
   for( std::size_t chIdx(0); chIdx < numberOfChannels; ++chIdx )
   {
+    mSilentInputSamples[chIdx] = mInput.silent( chIdx )
+      ? std::min( mSilentInputSamples[chIdx] + blockLength, historyLength ) : 0;
+    if( (activity and not activity->active( chIdx )) or (mSilentInputSamples[chIdx] >= historyLength) )
+    {
+      efl::vectorZero( mOutput[chIdx], blockLength, mOutput.alignmentSamples() );
+      mOutput.setSilent( chIdx, true );
+      continue;
+    }
+    mOutput.setSilent( chIdx, false );
     mDelayLine->interpolate( mOutput[chIdx], chIdx, blockLength,
                              (static_cast<SampleType>(1.0)-currentDelayRatio) * mCurrentDelays[chIdx] + currentDelayRatio *  mNextDelays[chIdx],
                              (static_cast<SampleType>(1.0)-nextDelayRatio) * mCurrentDelays[chIdx] + nextDelayRatio *  mNextDelays[chIdx],
@@ -13,6 +13,7 @@
 
 #include <libefl/basic_vector.hpp>
 
+#include <libpml/channel_activity_parameter.hpp>
 #include <libpml/double_buffering_protocol.hpp>
 #include <libpml/vector_parameter.hpp>
 
@@ -21,6 +22,7 @@
 #include <cstddef> // for std::size_t
 #include <memory>
 #include <valarray>
+#include <vector>
 
 namespace visr
 {
@@ -53,7 +55,13 @@ public:
     None = 0,
     Delay = 1 << 0,
     Gain = 1 << 1,
-    All = Delay | Gain
+    All = Delay | Gain,
+    /**
+     * Parameter input "activityInput" of type pml::ChannelActivityParameter.
+     * Inactive channels are still written into the delay line, but not interpolated, and their outputs are zero.
+     * This flag is not part of \p All.
+     */
+    ChannelActivity = 1 << 2
   };
 
   /**
@@ -126,6 +134,9 @@ public:
   /**
    * The process method applies the (interpolated) delay and gain
    * values to the stream of input samples.
+   * If the input of a channel has been marked as silent (see AudioPortBase::silent()) for
+   * the complete history of the delay line, the interpolation is skipped and the output is
+   * zeroed and marked as silent.
    */
   void process( );
 
@@ -204,6 +215,8 @@ private:
 
   std::unique_ptr<ParameterInput<pml::DoubleBufferingProtocol, pml::VectorParameter<SampleType> > > mGainInput;
 
+  std::unique_ptr<ParameterInput<pml::DoubleBufferingProtocol, pml::ChannelActivityParameter > > mActivityInput;
+
   /**
   * The number of simultaneous audio channels.
   */
@@ -242,6 +255,11 @@ private:
   */
   efl::BasicVector< SampleType > mNextDelays;
 
+  /**
+   * Number of consecutive silent input samples per channel, saturated at the history length of the delay line.
+   */
+  std::vector< std::size_t > mSilentInputSamples;
+
   /**
    * The sampling frequency of the audio signal flow, converted to floating-point 
    * for more convenient runtime calculations of the sample value.
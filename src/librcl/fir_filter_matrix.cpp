@@ -2,6 +2,7 @@
 
 #include "fir_filter_matrix.hpp"
 
+#include <librbbl/multichannel_convolver_direct.hpp>
 #include <librbbl/multichannel_convolver_uniform.hpp>
 
 #include <ciso646>
@@ -27,6 +28,26 @@ FirFilterMatrix::ControlPortConfig operator|(FirFilterMatrix::ControlPortConfig
   return static_cast<FirFilterMatrix::ControlPortConfig>( static_cast<T>(lhs) | static_cast<T>(rhs) );
 }
 
+namespace // unnamed
+{
+
+bool useTimeDomainConvolution( FirFilterMatrix::ConvolutionMethod method,
+                               std::size_t numberOfInputs, std::size_t numberOfOutputs, std::size_t blockLength,
+                               std::size_t filterLength, std::size_t maxRoutings )
+{
+  switch( method )
+  {
+  case FirFilterMatrix::ConvolutionMethod::TimeDomain:
+    return true;
+  case FirFilterMatrix::ConvolutionMethod::Partitioned:
+    return false;
+  default:
+    return rbbl::directConvolutionPreferred( numberOfInputs, numberOfOutputs, blockLength, filterLength, maxRoutings );
+  }
+}
+
+} // unnamed namespace
+
 FirFilterMatrix::FirFilterMatrix( SignalFlowContext const & context,
                                   char const * name,
                                   CompositeComponent * parent /*= nullptr*/ )
@@ -48,14 +69,25 @@ FirFilterMatrix::FirFilterMatrix( SignalFlowContext const & context,
   efl::BasicMatrix<SampleType> const & filters /*= efl::BasicMatrix<SampleType>()*/,
   rbbl::FilterRoutingList const & routings /*= rbbl::FilterRoutingList()*/,
   ControlPortConfig controlInputs /*= ControlPortConfig::None*/,
-  char const * fftImplementation /*= "default"*/ )
+  char const * fftImplementation /*= "default"*/,
+  ConvolutionMethod method /*= ConvolutionMethod::Automatic*/ )
   : AtomicComponent( context, name, parent )
   , mInput( "in", *this, numberOfInputs )
   , mOutput( "out", *this, numberOfOutputs )
-  , mConvolver(new rbbl::MultichannelConvolverUniform<SampleType>(
+  , mConvolver( useTimeDomainConvolution( method, numberOfInputs, numberOfOutputs, period(), filterLength, maxRoutings )
+    ? nullptr
+    : new rbbl::MultichannelConvolverUniform<SampleType>(
     numberOfInputs, numberOfOutputs, period(),
     filterLength, maxRoutings, maxFilters,
     routings, filters, cVectorAlignmentSamples, fftImplementation ) )
+  , mDirectConvolver( mConvolver
+    ? nullptr
+    : new rbbl::MultichannelConvolverDirect<SampleType>(
+    numberOfInputs, numberOfOutputs, period(),
+    filterLength, maxRoutings, maxFilters,
+    routings, filters, cVectorAlignmentSamples ) )
+  , mSilentInputs( false, numberOfInputs )
+  , mSilentOutputs( false, numberOfOutputs )
 {
   if( (controlInputs & ControlPortConfig::Filters) != ControlPortConfig::None )
   {
@@ -124,24 +156,59 @@ void FirFilterMatrix::process()
       mSingleRoutingInput->pop();
     }
   }
-  mConvolver->process( mInput.data(), mInput.channelStrideSamples(), 
-                       mOutput.data(), mOutput.channelStrideSamples(),
-                       cVectorAlignmentSamples );
+  std::size_t const numberOfInputs = mInput.width();
+  for( std::size_t inIdx( 0 ); inIdx < numberOfInputs; ++inIdx )
+  {
+    mSilentInputs[inIdx] = mInput.silent( inIdx );
+  }
+  bool const * const silentInputs = numberOfInputs > 0 ? &mSilentInputs[0] : nullptr;
+  bool * const silentOutputs = mOutput.width() > 0 ? &mSilentOutputs[0] : nullptr;
+  if( mDirectConvolver )
+  {
+    mDirectConvolver->process( mInput.data(), mInput.channelStrideSamples(),
+                               mOutput.data(), mOutput.channelStrideSamples(),
+                               cVectorAlignmentSamples, silentInputs, silentOutputs );
+  }
+  else
+  {
+    mConvolver->process( mInput.data(), mInput.channelStrideSamples(),
+                         mOutput.data(), mOutput.channelStrideSamples(),
+                         cVectorAlignmentSamples, silentInputs, silentOutputs );
+  }
+  for( std::size_t outIdx( 0 ); outIdx < mOutput.width(); ++outIdx )
+  {
+    mOutput.setSilent( outIdx, mSilentOutputs[outIdx] );
+  }
+}
+
+FirFilterMatrix::ConvolutionMethod FirFilterMatrix::convolutionMethod() const
+{
+  return mDirectConvolver ? ConvolutionMethod::TimeDomain : ConvolutionMethod::Partitioned;
 }
 
 void FirFilterMatrix::clearRoutings()
 {
+  if( mDirectConvolver )
+  {
+    mDirectConvolver->clearRoutingTable();
+    return;
+  }
   mConvolver->clearRoutingTable();
 }
 
 void FirFilterMatrix::addRouting( std::size_t inputIdx, std::size_t outputIdx, std::size_t filterIdx, SampleType const gain )
 {
+  if( mDirectConvolver )
+  {
+    mDirectConvolver->setRoutingEntry( inputIdx, outputIdx, filterIdx, gain );
+    return;
+  }
   mConvolver->setRoutingEntry( inputIdx, outputIdx, filterIdx, gain );
 }
 
 void FirFilterMatrix::addRouting( rbbl::FilterRouting const & routing )
 {
-  mConvolver->setRoutingEntry( routing.inputIndex, routing.outputIndex, routing.filterIndex, static_cast<SampleType>(routing.gainLinear) );
+  addRouting( routing.inputIndex, routing.outputIndex, routing.filterIndex, static_cast<SampleType>(routing.gainLinear) );
 }
 
 void FirFilterMatrix::addRoutings( rbbl::FilterRoutingList const & routings )
@@ -160,23 +227,52 @@ void FirFilterMatrix::setRoutings( rbbl::FilterRoutingList const & routings )
 
 bool FirFilterMatrix::removeRouting( std::size_t inputIdx, std::size_t outputIdx )
 {
+  if( mDirectConvolver )
+  {
+    return mDirectConvolver->removeRoutingEntry( inputIdx, outputIdx );
+  }
   return mConvolver->removeRoutingEntry( inputIdx, outputIdx );
 }
 
 void FirFilterMatrix::clearFilters()
 {
+  if( mDirectConvolver )
+  {
+    mDirectConvolver->clearFilters();
+    return;
+  }
   mConvolver->clearFilters();
 }
 
 void FirFilterMatrix::setFilter( std::size_t filterIdx, SampleType const * const impulseResponse, std::size_t filterLength, std::size_t alignment /*=0*/ )
 {
+  if( mDirectConvolver )
+  {
+    mDirectConvolver->setImpulseResponse( impulseResponse, filterLength, filterIdx, alignment );
+    return;
+  }
   mConvolver->setImpulseResponse( impulseResponse, filterLength, filterIdx, alignment );
 }
 
 void FirFilterMatrix::setFilters( efl::BasicMatrix<SampleType> const & filterSet )
 {
+  if( mDirectConvolver )
+  {
+    mDirectConvolver->initFilters( filterSet );
+    return;
+  }
   mConvolver->initFilters( filterSet );
 }
 
+void FirFilterMatrix::setFilters( rbbl::FilterBankFile<SampleType> const & filterBank )
+{
+  if( mDirectConvolver )
+  {
+    mDirectConvolver->initFilters( filterBank );
+    return;
+  }
+  mConvolver->initFilters( filterBank );
+}
+
 } // namespace rcl
 } // namespace visr
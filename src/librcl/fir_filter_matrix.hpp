@@ -23,6 +23,7 @@
 
 #include <cstddef> // for std::size_t
 #include <memory>
+#include <valarray>
 
 namespace visr
 {
@@ -30,6 +31,10 @@ namespace visr
 namespace rbbl
 {
 template< typename SampleType >
+class FilterBankFile;
+template< typename SampleType >
+class MultichannelConvolverDirect;
+template< typename SampleType >
 class MultichannelConvolverUniform;
 }
   
@@ -59,6 +64,16 @@ public:
     All = Filters | Routings | AllRoutings ///< All control inputs active
   };
 
+  /**
+   * Enumeration to select the convolution algorithm.
+   */
+  enum class ConvolutionMethod
+  {
+    Automatic,   ///< Select the more efficient algorithm for the configuration, see rbbl::directConvolutionPreferred()
+    TimeDomain,  ///< Direct-form time-domain convolution (rbbl::MultichannelConvolverDirect)
+    Partitioned  ///< Uniformly partitioned fast convolution (rbbl::MultichannelConvolverUniform)
+  };
+
   /**
    * Constructor.
    * @param context Configuration object containing basic execution parameters.
@@ -89,6 +104,8 @@ public:
   * @param controlInputs Enumeration to select which parameter update ports are instantiated. Default: ControlPortConfig::None
   * @param fftImplementation name of the FFt library to be used. See rbbl::FftWrapperFactory for available names.
   * Optional parameter, default is "default", i.e., the default FFt library for the platform.
+  * @param method The convolution algorithm. The default ConvolutionMethod::Automatic uses direct-form convolution
+  * for short filters, where it is more efficient than the partitioned fast convolution.
   */
   explicit FirFilterMatrix( SignalFlowContext const & context,
                             char const * name,
@@ -101,7 +118,8 @@ public:
                             efl::BasicMatrix<SampleType> const & filters = efl::BasicMatrix<SampleType>(),
                             rbbl::FilterRoutingList const & routings = rbbl::FilterRoutingList(),
                             ControlPortConfig controlInputs = ControlPortConfig::None,
-                            char const * fftImplementation = "default" );
+                            char const * fftImplementation = "default",
+                            ConvolutionMethod method = ConvolutionMethod::Automatic );
 
   /**
    * Desctructor
@@ -110,9 +128,18 @@ public:
 
   /**
    * The process method performs the multichannel convolution.
+   * Inputs marked as silent (see AudioPortBase::silent()) are not transformed, and their routing points are
+   * skipped once the filter tails have decayed. Outputs without contributing routing points are zeroed and marked
+   * as silent.
    */
   void process( );
 
+  /**
+   * Return the convolution algorithm used by this component, either ConvolutionMethod::TimeDomain or
+   * ConvolutionMethod::Partitioned.
+   */
+  ConvolutionMethod convolutionMethod() const;
+
   /**
    * Clear all routings points.
    * The filters remain initialised.
@@ -145,6 +172,12 @@ public:
 
   void setFilters( efl::BasicMatrix<SampleType> const & filterSet );
 
+  /**
+   * Replace all filters by the content of a filter bank file.
+   * This avoids the transformation of the filters if the file contains a matching frequency-domain representation.
+   */
+  void setFilters( rbbl::FilterBankFile<SampleType> const & filterBank );
+
 private:
   /**
    * The audio input port for this component.
@@ -169,6 +202,19 @@ private:
   std::unique_ptr< AllRoutingsInput > mAllRoutingsInput;
 
   std::unique_ptr<rbbl::MultichannelConvolverUniform<SampleType> > mConvolver;
+
+  /**
+   * Direct-form convolution engine, used instead of mConvolver for short filters.
+   */
+  std::unique_ptr<rbbl::MultichannelConvolverDirect<SampleType> > mDirectConvolver;
+
+  /**
+   * Silence flags of the inputs and outputs in the format required by the convolver.
+   */
+  //@{
+  std::valarray<bool> mSilentInputs;
+  std::valarray<bool> mSilentOutputs;
+  //@}
 };
 
 /**
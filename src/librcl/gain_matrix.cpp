@@ -5,6 +5,7 @@
 #include <libefl/vector_functions.hpp>
 
 #include <libpml/matrix_parameter.hpp>
+#include <libpml/vector_parameter_config.hpp>
 
 #include <ciso646>
 
@@ -20,13 +21,15 @@ namespace rcl
  , mInput( "in", *this )
  , mOutput( "out", *this )
 {
+  mInput.setChannelPointerAccess( true ); // The input is accessed through channel pointers only.
 }
 
 void GainMatrix::setup( std::size_t numberOfInputs,
     std::size_t numberOfOutputs,
     std::size_t interpolationSteps,
     SampleType initialGain /*= static_cast<SampleType>(0.0)*/,
-    bool controlInput /* = true */ )
+    bool controlInput /* = true */,
+    bool activityInput /* = false */ )
 {
   mInput.setWidth( numberOfInputs );
   mOutput.setWidth( numberOfOutputs );
@@ -38,13 +41,15 @@ void GainMatrix::setup( std::size_t numberOfInputs,
     mGainInput.reset( new ParameterInput<pml::SharedDataProtocol, pml::MatrixParameter<SampleType> >( "gainInput", *this,
       pml::MatrixParameterConfig( numberOfOutputs, numberOfInputs ) ) );
   }
+  setupActivityInput( activityInput );
 }
 
 void GainMatrix::setup( std::size_t numberOfInputs,
                         std::size_t numberOfOutputs,
                         std::size_t interpolationSteps,
                         efl::BasicMatrix< SampleType > const & initialGains,
-                        bool controlInput /* = true */)
+                        bool controlInput /* = true */,
+                        bool activityInput /* = false */ )
 {
   if( (initialGains.numberOfColumns() != numberOfInputs) or( initialGains.numberOfRows() != numberOfOutputs ) )
   {
@@ -61,14 +66,32 @@ void GainMatrix::setup( std::size_t numberOfInputs,
     mGainInput.reset( new ParameterInput<pml::SharedDataProtocol, pml::MatrixParameter<SampleType> >( "gainInput", *this,
                       pml::MatrixParameterConfig( numberOfOutputs, numberOfInputs ) ) );
   }
+  setupActivityInput( activityInput );
+}
+
+void GainMatrix::setupActivityInput( bool activityInput )
+{
+  std::size_t const numberOfInputs = mInput.width();
+  mActiveInputs.resize( numberOfInputs );
+  for( std::size_t inIdx( 0 ); inIdx < numberOfInputs; ++inIdx )
+  {
+    mActiveInputs[inIdx] = inIdx;
+  }
+  mNumberOfActiveInputs = numberOfInputs;
+  mProcessedInputs.resize( numberOfInputs );
+  if( activityInput )
+  {
+    mActivityInput.reset( new ParameterInput<pml::DoubleBufferingProtocol, pml::ChannelActivityParameter >( "activityInput", *this,
+                          pml::VectorParameterConfig( numberOfInputs ) ) );
+  }
 }
 
 void GainMatrix::process()
 {
   if( mGainInput )
   {
-    // TODO: Adapt logic to reset the gain matrix only after it has been actually changed. 
-    // This would be a match for the DoubleBufferingProtocol.
+    // The shared data protocol does not signal changes, so the gains are passed in every block.
+    // setNewGains() starts a transition only if they differ from the current target gains.
     mMatrix->setNewGains( mGainInput->data() );
   }
 
@@ -91,8 +114,41 @@ void GainMatrix::process()
   }
   mInput.getChannelPointers( &mInputChannels[0] );
   mOutput.getChannelPointers( &mOutputChannels[0] );
-
-  mMatrix->process( &mInputChannels[0], &mOutputChannels[0] );
+  if( mActivityInput and mActivityInput->changed() )
+  {
+    pml::ChannelActivityParameter const & activity = mActivityInput->data();
+    mNumberOfActiveInputs = 0;
+    for( std::size_t inIdx( 0 ); inIdx < mInput.width(); ++inIdx )
+    {
+      if( activity.active( inIdx ) )
+      {
+        mActiveInputs[mNumberOfActiveInputs++] = inIdx;
+      }
+    }
+    mActivityInput->resetChanged();
+  }
+  std::size_t numberOfProcessedInputs = 0;
+  for( std::size_t activeIdx( 0 ); activeIdx < mNumberOfActiveInputs; ++activeIdx )
+  {
+    std::size_t const inIdx = mActiveInputs[activeIdx];
+    if( not mInput.silent( inIdx ) )
+    {
+      mProcessedInputs[numberOfProcessedInputs++] = inIdx;
+    }
+  }
+  if( numberOfProcessedInputs == mInput.width() )
+  {
+    mMatrix->process( &mInputChannels[0], &mOutputChannels[0] );
+  }
+  else
+  {
+    mMatrix->process( &mInputChannels[0], &mOutputChannels[0], mProcessedInputs.data(), numberOfProcessedInputs );
+  }
+  bool const silentOutputs = numberOfProcessedInputs == 0;
+  for( std::size_t outIdx( 0 ); outIdx < mOutput.width(); ++outIdx )
+  {
+    mOutput.setSilent( outIdx, silentOutputs );
+  }
 }
 
 } // namespace rcl
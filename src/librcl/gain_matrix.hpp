@@ -17,6 +17,8 @@
 // For some reason, the forward declaration causes a compile error on MSVC,
 // so we include the header for the moment.
 // Also, I am not sure whether it makes sense to use a separate type as an alias to efl::BasicMatrix
+#include <libpml/channel_activity_parameter.hpp>
+#include <libpml/double_buffering_protocol.hpp>
 #include <libpml/matrix_parameter.hpp>
 #include <libpml/shared_data_protocol.hpp>
 
@@ -26,6 +28,7 @@
 #include <cstddef> // for std::size_t
 #include <memory>
 #include <valarray>
+#include <vector>
 
 namespace visr
 {
@@ -42,6 +45,8 @@ namespace rcl
  * This class has one input port named "in" and one output port named "out".
  * The width of these ports is determined by the arguments "numberOfInput" and "numberOfOutputs", respectively,
  * which are passed to the setup() method.
+ * Optionally, the component has a parameter input "activityInput" of type pml::ChannelActivityParameter
+ * describing the active input channels. Inactive inputs are skipped in the matrixing operation.
  */
 class VISR_RCL_LIBRARY_SYMBOL GainMatrix: public AtomicComponent
 {
@@ -67,13 +72,16 @@ public:
    * @param initialGain The initial entries of the the gain matrix (linear scale). All entries are initialised to 
    * this value (default: 0.0)
    * @param controlInput Flag controlling whether to instantiate a parameter input to receive gain matrix updates.
+   * @param activityInput Flag controlling whether to instantiate a parameter input "activityInput" to skip inactive
+   * input channels (default: false)
    * @todo Describe the complete semantics of the transition.
    */
   void setup( std::size_t numberOfInputs, 
               std::size_t numberOfOutputs,
               std::size_t interpolationSteps,
               SampleType initialGain = static_cast<SampleType>(0.0),
-              bool controlInput = true );
+              bool controlInput = true,
+              bool activityInput = false );
   /**
   * Setup method to initialise the object and set the parameters.
   * @param numberOfInputs The number of signals in the input signal.
@@ -84,16 +92,30 @@ public:
   * @param initialGains The initial entries of the the gain matrix (linear scale). The row and column
   * numbers of the matrix must match the arguments numberOfOutputs and numberOfInputs, respectively.
   * @param controlInput Flag controlling whether to instantiate a parameter input to receive gain matrix updates.
+  * @param activityInput Flag controlling whether to instantiate a parameter input "activityInput" to skip inactive
+  * input channels (default: false)
   */
   void setup( std::size_t numberOfInputs,
               std::size_t numberOfOutputs,
               std::size_t interpolationSteps,
               efl::BasicMatrix< SampleType > const & initialGains,
-              bool controlInput = true );
+              bool controlInput = true,
+              bool activityInput = false );
 
+  /**
+   * Apply the (interpolated) gain matrix to the input signals.
+   * Inputs that are inactive or marked as silent (see AudioPortBase::silent()) are skipped. If all inputs are
+   * skipped, the outputs are zeroed and marked as silent.
+   */
   void process( );
 
 private:
+  /**
+   * Initialise the list of active inputs and create the activity input if requested.
+   * Called by the setup() methods after the port widths have been set.
+   */
+  void setupActivityInput( bool activityInput );
+
   std::unique_ptr< rbbl::GainMatrix< SampleType > > mMatrix;
 
   AudioInput mInput;
@@ -110,6 +132,22 @@ private:
   //@}
 
   std::unique_ptr<ParameterInput<pml::SharedDataProtocol, pml::MatrixParameter<SampleType> > > mGainInput;
+
+  std::unique_ptr<ParameterInput<pml::DoubleBufferingProtocol, pml::ChannelActivityParameter > > mActivityInput;
+
+  /**
+   * Indices of the currently active inputs, all inputs if there is no activity input.
+   * Preallocated to the number of inputs, of which the first mNumberOfActiveInputs elements are valid.
+   */
+  std::vector<std::size_t> mActiveInputs;
+
+  std::size_t mNumberOfActiveInputs;
+
+  /**
+   * Indices of the inputs processed in the current block, i.e., the active inputs that are not silent.
+   * Preallocated to the number of inputs.
+   */
+  std::vector<std::size_t> mProcessedInputs;
 };
 
 } // namespace rcl
@@ -26,6 +26,8 @@ GainVector::GainVector( SignalFlowContext const & context,
  , mCurrentGains(cVectorAlignmentSamples)
  , mNextGains(cVectorAlignmentSamples)
 {
+  // The gains are applied element-wise, so the output can overwrite the input.
+  declareInPlaceProcessing( mInput, mOutput );
 }
 
 
@@ -34,18 +36,20 @@ GainVector::~GainVector() = default;
 void GainVector::setup( std::size_t numberOfChannels,
                          std::size_t interpolationSteps,
                          bool controlInputs,
-                         SampleType initialGainLinear /* = static_cast<SampleType>(0.0) */ )
+                         SampleType initialGainLinear /* = static_cast<SampleType>(0.0) */,
+                         bool activityInput /*= false*/ )
 {
   efl::BasicVector< SampleType > gainVector( numberOfChannels, cVectorAlignmentSamples );
   efl::vectorFill( initialGainLinear, gainVector.data(), numberOfChannels, cVectorAlignmentSamples );
 
-  setup( numberOfChannels, interpolationSteps, controlInputs, gainVector );
+  setup( numberOfChannels, interpolationSteps, controlInputs, gainVector, activityInput );
 }
 
  void GainVector::setup( std::size_t numberOfChannels,
                           std::size_t interpolationSteps,
                           bool controlInputs,
-                          efl::BasicVector< SampleType > const & initialGainsLinear )
+                          efl::BasicVector< SampleType > const & initialGainsLinear,
+                          bool activityInput /*= false*/ )
 {
   mNumberOfChannels = numberOfChannels;
   mInput.setWidth(numberOfChannels);
@@ -55,6 +59,10 @@ void GainVector::setup( std::size_t numberOfChannels,
   {
     mGainInput.reset( new ParameterInput<pml::DoubleBufferingProtocol, pml::VectorParameter<SampleType> >( "gainInput", *this, pml::VectorParameterConfig( numberOfChannels ) ) );
   }
+  if( activityInput )
+  {
+    mActivityInput.reset( new ParameterInput<pml::DoubleBufferingProtocol, pml::ChannelActivityParameter >( "activityInput", *this, pml::VectorParameterConfig( numberOfChannels ) ) );
+  }
   mCurrentGains.resize(numberOfChannels);
   mNextGains.resize(numberOfChannels);
 
@@ -82,12 +90,20 @@ void GainVector::process()
     setGain( mGainInput->data() ); // This resets the interpolation counter.
     mGainInput->resetChanged();
   }
+  // The activity is evaluated in every period, so the change flag is not needed.
+  pml::ChannelActivityParameter const * const activity = mActivityInput ? &mActivityInput->data() : nullptr;
 
   for( std::size_t chIdx(0); chIdx < mNumberOfChannels; ++chIdx )
   {
     SampleType const * inPtr = mInput[chIdx];
     SampleType * outPtr = mOutput[chIdx];
 
+    if( activity and not activity->active( chIdx ) )
+    {
+      efl::vectorZero( outPtr, period(), mOutput.alignmentSamples() );
+      continue;
+    }
+
     SampleType const oldGain = mCurrentGains[chIdx];
     SampleType const nextGain = mNextGains[chIdx];
 
@@ -11,6 +11,7 @@
 #include <libvisr/constants.hpp>
 #include <libvisr/parameter_input.hpp>
 
+#include <libpml/channel_activity_parameter.hpp>
 #include <libpml/double_buffering_protocol.hpp>
 #include <libpml/vector_parameter.hpp>
 
@@ -39,6 +40,8 @@ namespace rcl
  * This class has one input port named "in" and one output port named "out".
  * The widths of the input and the output port are identical and is
  * set by the argument <b>numberOfChannels</b> in the setup() method.
+ * Optionally, the component has a parameter input "activityInput" of type pml::ChannelActivityParameter.
+ * Inactive channels are not processed, their outputs are set to zero.
  */
 class VISR_RCL_LIBRARY_SYMBOL GainVector: public AtomicComponent
 {
@@ -73,11 +76,14 @@ public:
    * @param controlInputs Whether the component should contain parameter inputs for the gain parameter.
    * @param initialGainLinear The initial delay value for all
    * channels (in linear scale, default: 1.0)
+   * @param activityInput Whether the component should contain a parameter input "activityInput" to skip
+   * inactive channels (default: false).
    */
   void setup( std::size_t numberOfChannels, 
               std::size_t interpolationSteps,
               bool controlInputs = false,
-              SampleType initialGainLinear = static_cast<SampleType>(1.0) );
+              SampleType initialGainLinear = static_cast<SampleType>(1.0),
+              bool activityInput = false );
   /**
   * Setup method to initialise the object and set the parameters.
   * @param numberOfChannels The number of signals in the input signal.
@@ -87,11 +93,14 @@ public:
   * @param initialGainsLinear The initial gain values for all
   * channels, given in a linear scale.  The the number of
   * elements in this vector must match the channel number of this object.
+  * @param activityInput Whether the component should contain a parameter input "activityInput" to skip
+  * inactive channels (default: false).
   */
   void setup( std::size_t numberOfChannels,
               std::size_t interpolationSteps,
               bool controlInputs,
-              efl::BasicVector< SampleType > const & initialGainsLinear );
+              efl::BasicVector< SampleType > const & initialGainsLinear,
+              bool activityInput = false );
 
   /**
    * The process method applies the (interpolated) delay and gain
@@ -129,6 +138,11 @@ private:
 
   std::unique_ptr<ParameterInput<pml::DoubleBufferingProtocol, pml::VectorParameter<SampleType> > > mGainInput;
 
+  /**
+   * Optional input for the set of active channels.
+   */
+  std::unique_ptr<ParameterInput<pml::DoubleBufferingProtocol, pml::ChannelActivityParameter > > mActivityInput;
+
   /**
    * The number of simultaneous audio channels.
    */
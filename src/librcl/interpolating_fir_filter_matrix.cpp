@@ -3,6 +3,7 @@
 #include "interpolating_fir_filter_matrix.hpp"
 
 #include <librbbl/interpolating_convolver_uniform.hpp>
+#include <librbbl/low_rank_interpolating_convolver_uniform.hpp>
 
 #include <ciso646>
 #include <type_traits>
@@ -48,7 +49,9 @@ InterpolatingFirFilterMatrix::InterpolatingFirFilterMatrix(
         initialInterpolants /*= rbbl::InterpolationParameterSet()*/,
     rbbl::FilterRoutingList const & routings /*= rbbl::FilterRoutingList()*/,
     ControlPortConfig controlInputs /*= ControlPortConfig::None*/,
-    char const * fftImplementation /*= "default" */ )
+    char const * fftImplementation /*= "default" */,
+    std::size_t maxRank /*= 0*/,
+    SampleType rankTolerance /*= 0.0*/ )
  : AtomicComponent( context, name, parent )
  , mInput( "in", *this, numberOfInputs )
  , mOutput( "out", *this, numberOfOutputs )
@@ -70,7 +73,7 @@ InterpolatingFirFilterMatrix::InterpolatingFirFilterMatrix(
                  *this,
                  pml::InterpolationParameterConfig( numberOfInterpolants ) )
            : nullptr )
- , mConvolver( new rbbl::InterpolatingConvolverUniform< SampleType >(
+ , mConvolver( maxRank != 0 ? nullptr : new rbbl::InterpolatingConvolverUniform< SampleType >(
        numberOfInputs,
        numberOfOutputs,
        period(),
@@ -84,6 +87,22 @@ InterpolatingFirFilterMatrix::InterpolatingFirFilterMatrix(
        filters,
        cVectorAlignmentSamples,
        fftImplementation ) )
+ , mLowRankConvolver( maxRank == 0 ? nullptr : new rbbl::LowRankInterpolatingConvolverUniform< SampleType >(
+       numberOfInputs,
+       numberOfOutputs,
+       period(),
+       filterLength,
+       maxRoutings,
+       maxFilters,
+       numberOfInterpolants,
+       transitionSamples,
+       maxRank,
+       rankTolerance,
+       routings,
+       initialInterpolants,
+       filters,
+       cVectorAlignmentSamples,
+       fftImplementation ) )
 {
 }
 
@@ -140,14 +159,35 @@ void InterpolatingFirFilterMatrix::process()
     }
   }
 
-  mConvolver->process( mInput.data(), mInput.channelStrideSamples(),
-                       mOutput.data(), mOutput.channelStrideSamples(),
-                       cVectorAlignmentSamples );
+  if( mLowRankConvolver )
+  {
+    mLowRankConvolver->process( mInput.data(), mInput.channelStrideSamples(),
+                                mOutput.data(), mOutput.channelStrideSamples(),
+                                cVectorAlignmentSamples );
+  }
+  else
+  {
+    mConvolver->process( mInput.data(), mInput.channelStrideSamples(),
+                         mOutput.data(), mOutput.channelStrideSamples(),
+                         cVectorAlignmentSamples );
+  }
+}
+
+std::size_t InterpolatingFirFilterMatrix::rank() const
+{
+  return mLowRankConvolver ? mLowRankConvolver->rank() : 0;
 }
 
 void InterpolatingFirFilterMatrix::clearRoutings()
 {
-  mConvolver->clearRoutingTable();
+  if( mLowRankConvolver )
+  {
+    mLowRankConvolver->clearRoutingTable();
+  }
+  else
+  {
+    mConvolver->clearRoutingTable();
+  }
 }
 
 void InterpolatingFirFilterMatrix::addRouting( std::size_t inputIdx,
@@ -155,15 +195,21 @@ void InterpolatingFirFilterMatrix::addRouting( std::size_t inputIdx,
                                                std::size_t filterIdx,
                                                SampleType const gain )
 {
-  mConvolver->setRoutingEntry( inputIdx, outputIdx, filterIdx, gain );
+  if( mLowRankConvolver )
+  {
+    mLowRankConvolver->setRoutingEntry( inputIdx, outputIdx, filterIdx, gain );
+  }
+  else
+  {
+    mConvolver->setRoutingEntry( inputIdx, outputIdx, filterIdx, gain );
+  }
 }
 
 void InterpolatingFirFilterMatrix::addRouting(
     rbbl::FilterRouting const & routing )
 {
-  mConvolver->setRoutingEntry(
-      routing.inputIndex, routing.outputIndex, routing.filterIndex,
-      static_cast< SampleType >( routing.gainLinear ) );
+  addRouting( routing.inputIndex, routing.outputIndex, routing.filterIndex,
+              static_cast< SampleType >( routing.gainLinear ) );
 }
 
 void InterpolatingFirFilterMatrix::addRoutings(
@@ -185,12 +231,21 @@ void InterpolatingFirFilterMatrix::setRoutings(
 bool InterpolatingFirFilterMatrix::removeRouting( std::size_t inputIdx,
                                                   std::size_t outputIdx )
 {
-  return mConvolver->removeRoutingEntry( inputIdx, outputIdx );
+  return mLowRankConvolver
+             ? mLowRankConvolver->removeRoutingEntry( inputIdx, outputIdx )
+             : mConvolver->removeRoutingEntry( inputIdx, outputIdx );
 }
 
 void InterpolatingFirFilterMatrix::clearFilters()
 {
-  mConvolver->clearFilters();
+  if( mLowRankConvolver )
+  {
+    mLowRankConvolver->clearFilters();
+  }
+  else
+  {
+    mConvolver->clearFilters();
+  }
 }
 
 void InterpolatingFirFilterMatrix::setFilter(
@@ -199,21 +254,43 @@ void InterpolatingFirFilterMatrix::setFilter(
     std::size_t filterLength,
     std::size_t alignment /*=0*/ )
 {
-  mConvolver->setImpulseResponse( impulseResponse, filterLength, filterIdx,
-                                  alignment );
+  if( mLowRankConvolver )
+  {
+    mLowRankConvolver->setImpulseResponse( impulseResponse, filterLength,
+                                           filterIdx, alignment );
+  }
+  else
+  {
+    mConvolver->setImpulseResponse( impulseResponse, filterLength, filterIdx,
+                                    alignment );
+  }
 }
 
 void InterpolatingFirFilterMatrix::setFilters(
     efl::BasicMatrix< SampleType > const & filterSet )
 {
-  mConvolver->initFilters( filterSet );
+  if( mLowRankConvolver )
+  {
+    mLowRankConvolver->initFilters( filterSet );
+  }
+  else
+  {
+    mConvolver->initFilters( filterSet );
+  }
 }
 
 void InterpolatingFirFilterMatrix::setInterpolant(
     rbbl::InterpolationParameter const & interpolant,
     bool startTransition )
 {
-  mConvolver->setInterpolant( interpolant, startTransition );
+  if( mLowRankConvolver )
+  {
+    mLowRankConvolver->setInterpolant( interpolant, startTransition );
+  }
+  else
+  {
+    mConvolver->setInterpolant( interpolant, startTransition );
+  }
 }
 
 void InterpolatingFirFilterMatrix::setInterpolant(
@@ -222,9 +299,8 @@ void InterpolatingFirFilterMatrix::setInterpolant(
     std::vector< float > const & weights,
     bool startTransition )
 {
-  mConvolver->setInterpolant(
-      rbbl::InterpolationParameter( id, indices, weights ),
-      startTransition );
+  setInterpolant( rbbl::InterpolationParameter( id, indices, weights ),
+                  startTransition );
 }
 
 void InterpolatingFirFilterMatrix::setInterpolant(
@@ -233,9 +309,8 @@ void InterpolatingFirFilterMatrix::setInterpolant(
     std::initializer_list< float > const & weights,
     bool startTransition )
 {
-  mConvolver->setInterpolant(
-      rbbl::InterpolationParameter( id, indices, weights ),
-      startTransition );
+  setInterpolant( rbbl::InterpolationParameter( id, indices, weights ),
+                  startTransition );
 }
 
 } // namespace rcl
@@ -31,6 +31,8 @@ namespace rbbl
 {
 template< typename SampleType >
 class InterpolatingConvolverUniform;
+template< typename SampleType >
+class LowRankInterpolatingConvolverUniform;
 }
 
 namespace rcl
@@ -91,6 +93,17 @@ public:
    * @param fftImplementation name of the FFt library to be used. See
    * rbbl::FftWrapperFactory for available names. Optional parameter, default is
    * "default", i.e., the default FFt library for the platform.
+   * @param maxRank If nonzero, the filters are approximated by at most this
+   * number of shared basis filters (see
+   * rbbl::LowRankInterpolatingConvolverUniform). The interpolation weights are
+   * then applied as gains to the basis filters, and the convolution cost scales
+   * with the number of outputs times the rank instead of the number of
+   * routings. Default: 0, i.e., the filters are interpolated and convolved
+   * directly.
+   * @param rankTolerance Admissible energy of the approximation error relative
+   * to the energy of the filter set, used to reduce the rank below \p maxRank
+   * if possible. Only used if \p maxRank is nonzero. Default: 0.0, i.e., the
+   * rank \p maxRank is used.
    */
   explicit InterpolatingFirFilterMatrix(
       SignalFlowContext const & context,
@@ -109,7 +122,9 @@ public:
           rbbl::InterpolationParameterSet(),
       rbbl::FilterRoutingList const & routings = rbbl::FilterRoutingList(),
       ControlPortConfig controlInputs = ControlPortConfig::None,
-      char const * fftImplementation = "default" );
+      char const * fftImplementation = "default",
+      std::size_t maxRank = 0,
+      SampleType rankTolerance = static_cast< SampleType >( 0.0 ) );
 
   /**
    * Desctructor
@@ -166,6 +181,12 @@ public:
    */
   bool removeRouting( std::size_t inputIdx, std::size_t outputIdx );
 
+  /**
+   * Return the number of basis filters used for the current filter set, or 0
+   * if the filters are not approximated by basis filters.
+   */
+  std::size_t rank() const;
+
   /**
    * Set all stored filters to zero.
    */
@@ -178,6 +199,8 @@ public:
    * @param filterLength The length of the impulse response.
    * @param alignment The alignment of \p impulseResponse, defaults to 0 (no
    * alignment guarantee).
+   * @note If the filters are approximated by basis filters, the impulse
+   * response is projected onto the current basis filters.
    * @throw std::out_of_range If \p filterIdx exceeds the number of filter
    * entries of the component
    * @throw std::invalid_argument If the filter length exceeds the maximum
@@ -194,6 +217,8 @@ public:
    * entries in the component, the remaining filters are zeroed.
    * @throw std::invalid_argument If the number of rows in \p filterSet exceeds
    * the number of filter entries in the component.
+   * @note If the filters are approximated by basis filters, this recomputes the
+   * decomposition, which is computationally expensive.
    * @throw std::invalid_argument If the length of the filters (number of
    * columns) exceeds the maximum filter length set for the component.
    */
@@ -266,8 +291,16 @@ private:
       ParameterInput< pml::MessageQueueProtocol, pml::InterpolationParameter > >
       mInterpolantInput;
 
+  /**
+   * The convolution engine, only one of them is instantiated.
+   */
+  //@{
   std::unique_ptr< rbbl::InterpolatingConvolverUniform< SampleType > >
       mConvolver;
+
+  std::unique_ptr< rbbl::LowRankInterpolatingConvolverUniform< SampleType > >
+      mLowRankConvolver;
+  //@}
 };
 
 /**
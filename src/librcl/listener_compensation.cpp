@@ -53,6 +53,18 @@ namespace rcl
   , mDelayOutput( "delayOutput", *this)
 {
   m_array = arrayConfig;
+  std::size_t const numSpeakers = m_array.getNumSpeakers();
+  mSpeakerX.resize( numSpeakers );
+  mSpeakerY.resize( numSpeakers );
+  mSpeakerZ.resize( numSpeakers );
+  mDistances.resize( numSpeakers );
+  for( std::size_t i = 0; i < numSpeakers; ++i )
+  {
+    panning::XYZ const & pos = m_array.getPosition( i );
+    mSpeakerX[i] = pos.x;
+    mSpeakerY[i] = pos.y;
+    mSpeakerZ[i] = pos.z;
+  }
   pml::VectorParameterConfig const vectorConfig( mNumberOfLoudspeakers );
 
   mGainOutput.setParameterConfig( vectorConfig );
@@ -73,6 +85,7 @@ void ListenerCompensation::process()
     }
 
     setListenerPosition(pos.x(), pos.y(), pos.z());
+    calcDistances();
     if( calcGainComp( gains ) != 0 )
     {
       throw std::runtime_error("ListenerCompensation::process(): calcGainComp() failed.");
@@ -96,31 +109,37 @@ void ListenerCompensation::process()
   }
 }
 
-int ListenerCompensation::calcGainComp( efl::BasicVector<Afloat> & gainComp )
+void ListenerCompensation::calcDistances()
 {
-  panning::XYZ l1;
-  Afloat rad = 0.0f, max_rad = 0.0f, x = 0.0f, y = 0.0f, z = 0.0f;
-
-  //setting listener position
-  x = m_listenerPos.x;
-  y = m_listenerPos.y;
-  z = m_listenerPos.z;
-
-  for (std::size_t i = 0; i < m_array.getNumSpeakers(); i++) {
-
-    l1 = m_array.getPosition( i );
-
-    rad = std::sqrt(std::pow((l1.x - x), 2.0f) + std::pow((l1.y - y), 2.0f) + std::pow((l1.z - z), 2.0f));
-
-    gainComp[i] = rad;
-
-    if ( gainComp[i]>max_rad)
-      max_rad = gainComp[i];
+  Afloat const x = m_listenerPos.x;
+  Afloat const y = m_listenerPos.y;
+  Afloat const z = m_listenerPos.z;
+  std::size_t const numSpeakers = mDistances.size();
+  Afloat const * const speakerX = mSpeakerX.data();
+  Afloat const * const speakerY = mSpeakerY.data();
+  Afloat const * const speakerZ = mSpeakerZ.data();
+  Afloat * const distances = mDistances.data();
+  // Plain multiplications instead of std::pow() allow the compiler to vectorise this loop.
+  for( std::size_t i = 0; i < numSpeakers; ++i )
+  {
+    Afloat const dx = speakerX[i] - x;
+    Afloat const dy = speakerY[i] - y;
+    Afloat const dz = speakerZ[i] - z;
+    distances[i] = std::sqrt( dx*dx + dy*dy + dz*dz );
   }
+}
 
-  for (std::size_t i = 0; i < m_array.getNumSpeakers(); i++) {
+int ListenerCompensation::calcGainComp( efl::BasicVector<Afloat> & gainComp )
+{
+  std::size_t const numSpeakers = mDistances.size();
+  if( numSpeakers == 0 )
+  {
+    return 0;
+  }
+  Afloat const max_rad = *std::max_element( mDistances.data(), mDistances.data() + numSpeakers );
+  for (std::size_t i = 0; i < numSpeakers; i++) {
 
-    gainComp[i] = (gainComp[i]/max_rad);
+    gainComp[i] = (mDistances[i]/max_rad);
   }
   return 0;
 }
@@ -128,30 +147,15 @@ int ListenerCompensation::calcGainComp( efl::BasicVector<Afloat> & gainComp )
 
 int ListenerCompensation::calcDelayComp( efl::BasicVector<Afloat> & delayComp )
 {
-  
-  Afloat rad=0.0f, max_rad=0.0f, x=0.0f, y=0.0f, z=0.0f;
-  panning::XYZ l1;
-
-  //setting listener position
-  x = m_listenerPos.x;
-  y = m_listenerPos.y;
-  z = m_listenerPos.z;
-
-  for (std::size_t i = 0; i < m_array.getNumSpeakers(); i++) {
-
-    l1 = m_array.getPosition( i );
-
-    rad = std::sqrt(std::pow((l1.x-x),2.0f) + std::pow((l1.y-y),2.0f) + std::pow((l1.z-z),2.0f));
-
-    delayComp[i] = rad;
-
-    if (delayComp[i]>max_rad)
-      max_rad = delayComp[i];
+  std::size_t const numSpeakers = mDistances.size();
+  if( numSpeakers == 0 )
+  {
+    return 0;
   }
+  Afloat const max_rad = *std::max_element( mDistances.data(), mDistances.data() + numSpeakers );
+  for ( std::size_t i = 0; i < numSpeakers; i++){
 
-  for ( std::size_t i = 0; i < m_array.getNumSpeakers(); i++){
-
-    delayComp[i] = std::abs(delayComp[i]-max_rad)/c_0;
+    delayComp[i] = std::abs(mDistances[i]-max_rad)/c_0;
   }
   return 0;
 }
@@ -75,6 +75,12 @@ private:
     return 0;
   }
 
+  /**
+   * Compute the distances between the listener and all loudspeakers into mDistances.
+   * This is done once per position update and shared by calcGainComp() and calcDelayComp().
+   */
+  void calcDistances();
+
   /**
    * Internal method to calculate the compensation gains.
    * @param [out] gainComp The result vector for the calculated gains (linear scale). It must have the dimension 'numberOfLoudspeakers'.
@@ -93,6 +99,21 @@ private:
   panning::XYZ m_listenerPos; //position of the listener
   std::size_t const mNumberOfLoudspeakers;
 
+  /**
+   * Loudspeaker positions stored as separate coordinate vectors, such that the distance computation operates on
+   * contiguous arrays.
+   */
+  //@{
+  efl::BasicVector<Afloat> mSpeakerX;
+  efl::BasicVector<Afloat> mSpeakerY;
+  efl::BasicVector<Afloat> mSpeakerZ;
+  //@}
+
+  /**
+   * Distances between the listener and the loudspeakers, computed by calcDistances().
+   */
+  efl::BasicVector<Afloat> mDistances;
+
   ParameterInput<pml::DoubleBufferingProtocol, pml::ListenerPosition > mPositionInput;
   ParameterOutput<pml::DoubleBufferingProtocol, pml::VectorParameter<Afloat> > mGainOutput;
   ParameterOutput<pml::DoubleBufferingProtocol, pml::VectorParameter<Afloat> > mDelayOutput;
@@ -0,0 +1,54 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "matrix_row_selector.hpp"
+
+#include <libefl/vector_functions.hpp>
+
+#include <libpml/matrix_parameter_config.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace visr
+{
+namespace rcl
+{
+
+MatrixRowSelector::MatrixRowSelector( SignalFlowContext const & context,
+                                      char const * name,
+                                      CompositeComponent * parent,
+                                      std::size_t numberOfInputRows,
+                                      std::size_t numberOfColumns,
+                                      std::vector<std::size_t> const & rowSelection )
+ : AtomicComponent( context, name, parent )
+ , mRowSelection( rowSelection )
+ , mInput( "in", *this, pml::MatrixParameterConfig( numberOfInputRows, numberOfColumns ) )
+ , mOutput( "out", *this, pml::MatrixParameterConfig( rowSelection.size(), numberOfColumns ) )
+{
+  if( std::any_of( rowSelection.begin(), rowSelection.end(),
+                   [numberOfInputRows]( std::size_t idx ){ return idx >= numberOfInputRows; } ) )
+  {
+    throw std::invalid_argument( "MatrixRowSelector: A row index exceeds the number of input rows." );
+  }
+}
+
+MatrixRowSelector::~MatrixRowSelector() = default;
+
+void MatrixRowSelector::process()
+{
+  pml::MatrixParameter<SampleType> const & in = mInput.data();
+  pml::MatrixParameter<SampleType> & out = mOutput.data();
+  std::size_t const numColumns = out.numberOfColumns();
+  std::size_t const alignment = std::min( in.alignmentElements(), out.alignmentElements() );
+  for( std::size_t rowIdx( 0 ); rowIdx < mRowSelection.size(); ++rowIdx )
+  {
+    if( efl::vectorCopy( in.row( mRowSelection[rowIdx] ), out.row( rowIdx ), numColumns, alignment ) != efl::noError )
+    {
+      status( StatusMessage::Error, "MatrixRowSelector: Error while copying matrix rows." );
+      return;
+    }
+  }
+}
+
+} // namespace rcl
+} // namespace visr
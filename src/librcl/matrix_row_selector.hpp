@@ -0,0 +1,69 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRCL_MATRIX_ROW_SELECTOR_HPP_INCLUDED
+#define VISR_LIBRCL_MATRIX_ROW_SELECTOR_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/constants.hpp>
+#include <libvisr/parameter_input.hpp>
+#include <libvisr/parameter_output.hpp>
+
+#include <libpml/matrix_parameter.hpp>
+#include <libpml/shared_data_protocol.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace visr
+{
+namespace rcl
+{
+
+/**
+ * Component to extract a subset of rows from a matrix parameter.
+ * This is used, for instance, to pass the gains for a subset of loudspeakers computed by a panning calculator
+ * to a GainMatrix that renders only these loudspeakers.
+ * The component has a parameter input "in" and a parameter output "out", both of type pml::MatrixParameter
+ * and using the SharedDataProtocol. Because the SharedDataProtocol does not signal changes, the selected rows
+ * are copied in each process() call.
+ */
+class VISR_RCL_LIBRARY_SYMBOL MatrixRowSelector: public AtomicComponent
+{
+public:
+  /**
+   * Constructor.
+   * @param context Configuration object containing basic execution parameters.
+   * @param name The name of the component. Must be unique within the containing composite component (if there is one).
+   * @param parent Pointer to a containing component if there is one. Specify \p nullptr in case of a top-level component.
+   * @param numberOfInputRows The number of rows of the input matrix.
+   * @param numberOfColumns The number of columns of both the input and the output matrix.
+   * @param rowSelection The (zero-offset) indices of the input rows that form the rows of the output matrix, in this order.
+   * @throw std::invalid_argument If an index in \p rowSelection exceeds the number of input rows.
+   */
+  explicit MatrixRowSelector( SignalFlowContext const & context,
+                              char const * name,
+                              CompositeComponent * parent,
+                              std::size_t numberOfInputRows,
+                              std::size_t numberOfColumns,
+                              std::vector<std::size_t> const & rowSelection );
+
+  MatrixRowSelector( MatrixRowSelector const & ) = delete;
+
+  ~MatrixRowSelector() override;
+
+  void process() override;
+
+private:
+  std::vector<std::size_t> const mRowSelection;
+
+  ParameterInput<pml::SharedDataProtocol, pml::MatrixParameter<SampleType> > mInput;
+
+  ParameterOutput<pml::SharedDataProtocol, pml::MatrixParameter<SampleType> > mOutput;
+};
+
+} // namespace rcl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRCL_MATRIX_ROW_SELECTOR_HPP_INCLUDED
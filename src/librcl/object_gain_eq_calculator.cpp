@@ -72,6 +72,9 @@ void ObjectGainEqCalculator::process( objectmodel::ObjectVector const & objects,
   {
     LevelType const objLevel = obj.level();
     std::size_t const numObjChannels = obj.numberOfChannels();
+    // For multichannel objects, the coefficients are computed only for the first valid channel and copied to the
+    // remaining channels.
+    std::size_t firstChannelIdx = cNumberOfObjectChannels;
     for( std::size_t chIdx(0); chIdx < numObjChannels; ++chIdx )
     {
         std::size_t const signalChannelIdx = obj.channelIndex( chIdx );
@@ -81,11 +84,15 @@ void ObjectGainEqCalculator::process( objectmodel::ObjectVector const & objects,
           continue;
         }
         objectSignalGains[ signalChannelIdx ] = objLevel;
-        // Potential minor performance improvement possible: For multichannel objects, compute the coefficients only for the first channel,
-        // and copy it to the remaining channels.
+        if( firstChannelIdx < cNumberOfObjectChannels )
+        {
+          objectChannelEqs[signalChannelIdx] = objectChannelEqs[firstChannelIdx];
+          continue;
+        }
         rbbl::ParametricIirCoefficientCalculator::calculateIirCoefficients<SampleType>( obj.eqCoefficients(),
                                                                                              objectChannelEqs[signalChannelIdx],
                                                                                              static_cast<SampleType>(cSamplingFrequency) );
+        firstChannelIdx = signalChannelIdx;
     }
   }
 }
@@ -9,6 +9,7 @@
 #include <libefl/degree_radian_conversion.hpp>
 #include <libefl/matrix_functions.hpp>
 #include <libefl/vector_functions.hpp>
+#include <libefl/vector_math.hpp>
 
 #include <libobjectmodel/object_vector.hpp>
 #include <libobjectmodel/channel_object.hpp>
@@ -62,6 +63,7 @@ PanningCalculator::PanningCalculator( SignalFlowContext const & context,
  , mTmpGains( mNumberOfRegularLoudspeakers, cVectorAlignmentSamples )
  , mTmpHfGains( mNumberOfRegularLoudspeakers, cVectorAlignmentSamples )
  , mTmpDiffuseGains( mNumberOfRegularLoudspeakers, cVectorAlignmentSamples )
+ , mPlaneWavePositions( 6, mNumberOfObjects, cVectorAlignmentSamples )
  , mLfNormalisation( (lfNormalisation == Normalisation::Default)
                      ? ((panningMode & PanningMode::HF) == PanningMode::Nothing ? Normalisation::Energy : Normalisation::Amplitude ) : lfNormalisation )
  , mHfNormalisation( (hfNormalisation == Normalisation::Default) ? Normalisation::Energy : hfNormalisation )
@@ -203,6 +205,29 @@ void PanningCalculator::process()
       diffuseGains->zeroFill();
     }
 
+    // Convert the positions of all plane waves to cartesian coordinates in one batch.
+    std::size_t numPlaneWaves = 0;
+    for( objectmodel::Object const & obj : objects )
+    {
+      objectmodel::PlaneWave const * pw = dynamic_cast<objectmodel::PlaneWave const *>(&obj);
+      if( pw and (obj.numberOfChannels() == 1) and (numPlaneWaves < mNumberOfObjects) )
+      {
+        mPlaneWavePositions( 0, numPlaneWaves ) = pw->incidenceAzimuth();
+        mPlaneWavePositions( 1, numPlaneWaves ) = pw->incidenceElevation();
+        mPlaneWavePositions( 2, numPlaneWaves ) = pw->referenceDistance();
+        ++numPlaneWaves;
+      }
+    }
+    efl::ErrorCode const convRes = efl::vectorSpherical2Cartesian( mPlaneWavePositions.row( 0 ), mPlaneWavePositions.row( 1 ),
+      mPlaneWavePositions.row( 2 ), mPlaneWavePositions.row( 3 ), mPlaneWavePositions.row( 4 ), mPlaneWavePositions.row( 5 ),
+      numPlaneWaves, cVectorAlignmentSamples );
+    if( convRes != efl::noError )
+    {
+      status( StatusMessage::Error, "Error while converting plane wave positions: ", efl::errorMessage( convRes ) );
+      return;
+    }
+    std::size_t planeWaveIdx = 0;
+
     // Loop over all objects.
     for( objectmodel::Object const & obj : objects )
     {
@@ -273,7 +298,17 @@ void PanningCalculator::process()
       if( pw )
       {
         SampleType x,y,z;
-        std::tie( x, y, z ) = efl::spherical2cartesian( pw->incidenceAzimuth(), pw->incidenceElevation(), pw->referenceDistance() );
+        if( planeWaveIdx < numPlaneWaves )
+        {
+          x = mPlaneWavePositions( 3, planeWaveIdx );
+          y = mPlaneWavePositions( 4, planeWaveIdx );
+          z = mPlaneWavePositions( 5, planeWaveIdx );
+          ++planeWaveIdx;
+        }
+        else
+        {
+          std::tie( x, y, z ) = efl::spherical2cartesian( pw->incidenceAzimuth(), pw->incidenceElevation(), pw->referenceDistance() );
+        }
         mVbapCalculator->calculateGainsUnNormalised( x, y, z, &mTmpGains[0], true /*planeWave*/ );
         diffuseRatio = 0.0f;
         objectHandled = true;
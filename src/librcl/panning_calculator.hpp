@@ -219,6 +219,14 @@ private:
 
   mutable efl::BasicVector<SampleType> mTmpDiffuseGains;
 
+  /**
+   * Positions of the plane wave objects of the current object vector, converted in one batch before the gain
+   * calculation. The rows hold azimuth, elevation, and distance followed by the cartesian x, y, and z coordinates,
+   * the columns correspond to the plane waves in the order of their appearance in the object vector.
+   * Dimension: 6 x mNumberOfObjects
+   */
+  mutable efl::BasicMatrix<SampleType> mPlaneWavePositions;
+
   Normalisation const mLfNormalisation;
 
   Normalisation const mHfNormalisation;
@@ -3,6 +3,7 @@
 #include "scene_decoder.hpp"
 
 #include <libobjectmodel/object_vector.hpp>
+#include <libobjectmodel/object_vector_binary_parser.hpp>
 #include <libobjectmodel/object_vector_parser.hpp>
 
 #include <libpml/empty_parameter_config.hpp>
@@ -32,10 +33,17 @@ void SceneDecoder::process()
   objectmodel::ObjectVector & objects = mObjectVectorOutput.data();
   while( not mDatagramInput.empty() )
   {
-    char const * nextMsg = mDatagramInput.front().str();
+    pml::StringParameter const & nextMsg = mDatagramInput.front();
     try
     {
-      objectmodel::ObjectVectorParser::updateObjectVector( nextMsg, objects );
+      if( objectmodel::ObjectVectorBinaryParser::isBinaryMessage( nextMsg.str(), nextMsg.size() ) )
+      {
+        objectmodel::ObjectVectorBinaryParser::updateObjectVector( nextMsg.str(), nextMsg.size(), objects );
+      }
+      else
+      {
+        objectmodel::ObjectVectorParser::updateObjectVector( nextMsg.str(), nextMsg.size(), objects );
+      }
       mObjectVectorOutput.swapBuffers();
     }
     catch( std::exception const & ex )
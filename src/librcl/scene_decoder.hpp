@@ -34,6 +34,8 @@ namespace rcl
 
 /**
  * Component to decode audio objects from messages (typically received from a network).
+ * Both JSON messages and the binary object vector format (objectmodel::ObjectVectorBinaryParser) are accepted,
+ * the format is detected for each message individually.
  * This component has neither audio inputs or outputs.
  */
 class VISR_RCL_LIBRARY_SYMBOL SceneDecoder: public AtomicComponent
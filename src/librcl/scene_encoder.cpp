@@ -3,12 +3,14 @@
 #include "scene_encoder.hpp"
 
 #include <libobjectmodel/object_vector.hpp>
+#include <libobjectmodel/object_vector_binary_parser.hpp>
 #include <libobjectmodel/object_vector_parser.hpp>
 
 #include <libpml/empty_parameter_config.hpp>
 
 #include <ciso646>
 #include <sstream>
+#include <string>
 
 namespace visr
 {
@@ -17,8 +19,10 @@ namespace rcl
 
   SceneEncoder::SceneEncoder( SignalFlowContext const & context,
                               char const * name,
-                              CompositeComponent * parent /*= nullptr*/ )
+                              CompositeComponent * parent /*= nullptr*/,
+                              Encoding encoding /*= Encoding::Json*/ )
  : AtomicComponent( context, name, parent )
+ , mEncoding( encoding )
  , mObjectInput( "objectInput", *this, pml::EmptyParameterConfig( ) )
  , mDatagramOutput( "messageOutput", *this, pml::EmptyParameterConfig() )
 {
@@ -30,9 +34,18 @@ SceneEncoder::~SceneEncoder()
 
 void SceneEncoder::process()
 {
-  std::stringstream msg;
-  objectmodel::ObjectVectorParser::encodeObjectVector( mObjectInput.data(), msg );
-  mDatagramOutput.enqueue( pml::StringParameter( msg.str( ) ) );
+  if( mEncoding == Encoding::Binary )
+  {
+    std::string msg;
+    objectmodel::ObjectVectorBinaryParser::encodeObjectVector( mObjectInput.data(), msg );
+    mDatagramOutput.enqueue( pml::StringParameter( msg ) );
+  }
+  else
+  {
+    std::stringstream msg;
+    objectmodel::ObjectVectorParser::encodeObjectVector( mObjectInput.data(), msg );
+    mDatagramOutput.enqueue( pml::StringParameter( msg.str( ) ) );
+  }
 }
 
 } // namespace rcl
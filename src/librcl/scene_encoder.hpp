@@ -24,21 +24,32 @@ namespace rcl
 {
 
 /**
- * Component to encode audio objects to JSON messages (typically to be sent over a network).
+ * Component to encode audio objects to JSON or binary messages (typically to be sent over a network).
  * This component has neither audio inputs or outputs.
  */
 class VISR_RCL_LIBRARY_SYMBOL SceneEncoder: public AtomicComponent
 {
 public:
+  /**
+   * Message format created by the encoder.
+   */
+  enum class Encoding
+  {
+    Json,  /**< JSON text messages (objectmodel::ObjectVectorParser) */
+    Binary /**< Compact binary messages (objectmodel::ObjectVectorBinaryParser) */
+  };
+
   /**
    * Constructor.
    * @param context Configuration object containing basic execution parameters.
    * @param name The name of the component. Must be unique within the containing composite component (if there is one).
    * @param parent Pointer to a containing component if there is one. Specify \p nullptr in case of a top-level component.
+   * @param encoding The format of the created messages.
    */
   explicit SceneEncoder( SignalFlowContext const & context,
                          char const * name,
-                         CompositeComponent * parent = nullptr );
+                         CompositeComponent * parent = nullptr,
+                         Encoding encoding = Encoding::Json );
 
   /**
    * Disabled (deleted) copy constructor
@@ -52,13 +63,15 @@ public:
   ~SceneEncoder();
 
   /**
-   * Transform the incoming object vector into a JSON message.
+   * Transform the incoming object vector into a message.
    * @warning At the moment, a message is created in each process call.
    * @todo Create a triggering/timing method to control the output rate.
    */
   void process() override;
 
 private:
+  Encoding const mEncoding;
+
   ParameterInput< pml::SharedDataProtocol, pml::ObjectVector> mObjectInput;
   ParameterOutput< pml::MessageQueueProtocol, pml::StringParameter > mDatagramOutput;
 };
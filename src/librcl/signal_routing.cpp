@@ -18,6 +18,7 @@ namespace rcl
  , mInput( "in", *this )
  , mOutput( "out", *this )
 {
+  mInput.setChannelPointerAccess( true ); // The input is accessed channel-wise only.
 }
 
 SignalRouting::~SignalRouting()
@@ -31,6 +31,7 @@ SparseGainMatrix::SparseGainMatrix( SignalFlowContext const & context,
  , mInput( "in", *this, numberOfInputs )
  , mOutput( "out", *this, numberOfOutputs )
 {
+  mInput.setChannelPointerAccess( true ); // The input is accessed channel-wise only.
   if( (controlInputs & ControlPortConfig::Gain) != ControlPortConfig::No )
   {
     mGainInput.reset( new GainInput( "gainInput", *this,
@@ -0,0 +1,189 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librcl/biquad_iir_filter.hpp>
+#include <librcl/channel_activity_calculator.hpp>
+#include <librcl/delay_vector.hpp>
+#include <librcl/gain_matrix.hpp>
+#include <librcl/gain_vector.hpp>
+
+#include <librrl/audio_signal_flow.hpp>
+
+#include <libvisr/audio_input.hpp>
+#include <libvisr/audio_output.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/parameter_input.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <libobjectmodel/point_source.hpp>
+
+#include <libpml/double_buffering_protocol.hpp>
+#include <libpml/empty_parameter_config.hpp>
+#include <libpml/initialise_parameter_library.hpp>
+#include <libpml/object_vector.hpp>
+
+#include <librbbl/biquad_coefficient.hpp>
+
+#include <libefl/basic_matrix.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace visr
+{
+namespace rcl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+std::size_t const cNumInputs = 4;
+std::size_t const cNumOutputs = 3;
+std::size_t const cBlockSize = 32;
+
+/**
+ * Object-domain processing chain gain -> EQ -> delay -> matrix, optionally controlled by a ChannelActivityCalculator.
+ */
+class ActivityTestFlow: public CompositeComponent
+{
+public:
+  ActivityTestFlow( SignalFlowContext const & context, bool useActivity, std::size_t releasePeriods,
+                    efl::BasicMatrix<SampleType> const & matrixGains )
+   : CompositeComponent( context, "", nullptr )
+   , mInput( "in", *this, cNumInputs )
+   , mOutput( "out", *this, cNumOutputs )
+   , mGain( context, "Gain", this )
+   // Lowpass section, so that the filter state matters.
+   , mEq( context, "Eq", this, cNumInputs, 1,
+          rbbl::BiquadCoefficient<SampleType>( 0.0675f, 0.1349f, 0.0675f, -1.1430f, 0.4128f ), false, useActivity )
+   , mDelay( context, "Delay", this )
+   , mMatrix( context, "Matrix", this )
+  {
+    mGain.setup( cNumInputs, cBlockSize, false, 0.5f, useActivity );
+    mDelay.setup( cNumInputs, cBlockSize, 0.01f, "lagrangeOrder3", DelayVector::MethodDelayPolicy::Add,
+                  useActivity ? DelayVector::ControlPortConfig::ChannelActivity : DelayVector::ControlPortConfig::None,
+                  0.0005f, 1.0f ); // Less than one period, so that inputs reach the output in the same block.
+    mMatrix.setup( cNumInputs, cNumOutputs, cBlockSize, matrixGains, false, useActivity );
+    audioConnection( mInput, mGain.audioPort( "in" ) );
+    audioConnection( mGain.audioPort( "out" ), mEq.audioPort( "in" ) );
+    audioConnection( mEq.audioPort( "out" ), mDelay.audioPort( "in" ) );
+    audioConnection( mDelay.audioPort( "out" ), mMatrix.audioPort( "in" ) );
+    audioConnection( mMatrix.audioPort( "out" ), mOutput );
+    if( useActivity )
+    {
+      mObjectInput.reset( new ParameterInput<pml::DoubleBufferingProtocol, pml::ObjectVector>( "objectIn", *this, pml::EmptyParameterConfig() ) );
+      mCalculator.reset( new ChannelActivityCalculator( context, "Calculator", this, cNumInputs, releasePeriods ) );
+      parameterConnection( *mObjectInput, mCalculator->parameterPort( "objectIn" ) );
+      parameterConnection( mCalculator->parameterPort( "activityOut" ), mGain.parameterPort( "activityInput" ) );
+      parameterConnection( mCalculator->parameterPort( "activityOut" ), mEq.parameterPort( "activityInput" ) );
+      parameterConnection( mCalculator->parameterPort( "activityOut" ), mDelay.parameterPort( "activityInput" ) );
+      parameterConnection( mCalculator->parameterPort( "activityOut" ), mMatrix.parameterPort( "activityInput" ) );
+    }
+  }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+  std::unique_ptr<ParameterInput<pml::DoubleBufferingProtocol, pml::ObjectVector> > mObjectInput;
+  std::unique_ptr<ChannelActivityCalculator> mCalculator;
+  GainVector mGain;
+  BiquadIirFilter mEq;
+  DelayVector mDelay;
+  GainMatrix mMatrix;
+};
+
+pml::ObjectVector sceneWithChannels( std::initializer_list<objectmodel::Object::ChannelIndex> channels )
+{
+  pml::ObjectVector scene;
+  objectmodel::ObjectId id = 0;
+  for( objectmodel::Object::ChannelIndex chIdx : channels )
+  {
+    objectmodel::PointSource obj( id++ );
+    obj.resetNumberOfChannels( 1 );
+    obj.setChannelIndex( 0, chIdx );
+    scene.insert( obj );
+  }
+  return scene;
+}
+
+SampleType maxDifference( std::vector<SampleType> const & lhs, std::vector<SampleType> const & rhs )
+{
+  SampleType diff = 0.0f;
+  for( std::size_t idx( 0 ); idx < lhs.size(); ++idx )
+  {
+    diff = std::max( diff, std::abs( lhs[idx] - rhs[idx] ) );
+  }
+  return diff;
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( ChannelActivitySkipsUnusedChannels )
+{
+  pml::initialiseParameterLibrary();
+  SignalFlowContext const context( cBlockSize, 48000 );
+  std::size_t const releasePeriods = 3;
+
+  std::mt19937 gen( 7 );
+  std::uniform_real_distribution<SampleType> dist( -1.0f, 1.0f );
+  efl::BasicMatrix<SampleType> matrixGains( cNumOutputs, cNumInputs, cVectorAlignmentSamples );
+  for( std::size_t rowIdx( 0 ); rowIdx < cNumOutputs; ++rowIdx )
+  {
+    for( std::size_t colIdx( 0 ); colIdx < cNumInputs; ++colIdx )
+    {
+      matrixGains( rowIdx, colIdx ) = dist( gen );
+    }
+  }
+
+  ActivityTestFlow activityComp( context, true, releasePeriods, matrixGains );
+  ActivityTestFlow referenceComp( context, false, releasePeriods, matrixGains );
+  rrl::AudioSignalFlow activityFlow( activityComp );
+  rrl::AudioSignalFlow referenceFlow( referenceComp );
+
+  std::vector<SampleType> input( cNumInputs * cBlockSize );
+  std::vector<SampleType> referenceInput( cNumInputs * cBlockSize );
+  std::vector<SampleType> activityOutput( cNumOutputs * cBlockSize );
+  std::vector<SampleType> referenceOutput( cNumOutputs * cBlockSize );
+  auto processBlock = [&]( bool silenceUnused )
+  {
+    std::generate( input.begin(), input.end(), [&](){ return dist( gen ); } );
+    referenceInput = input;
+    if( silenceUnused )
+    {
+      std::fill( referenceInput.begin() + 1 * cBlockSize, referenceInput.begin() + 2 * cBlockSize, 0.0f );
+      std::fill( referenceInput.begin() + 3 * cBlockSize, referenceInput.begin() + 4 * cBlockSize, 0.0f );
+    }
+    activityFlow.process( input.data(), cBlockSize, 1, activityOutput.data(), cBlockSize, 1 );
+    referenceFlow.process( referenceInput.data(), cBlockSize, 1, referenceOutput.data(), cBlockSize, 1 );
+  };
+
+  // The reference receives silence in the unused channels 1 and 3 throughout, whereas the activity-controlled
+  // flow keeps processing them during the release period.
+  BOOST_CHECK( activityFlow.injectParameter( "objectIn", sceneWithChannels( { 0, 2 } ) ) );
+  for( std::size_t blockIdx( 0 ); blockIdx < releasePeriods; ++blockIdx )
+  {
+    processBlock( true );
+    BOOST_CHECK_GT( maxDifference( activityOutput, referenceOutput ), 1.0e-3f );
+  }
+  // After the release, the unused channels are skipped, which is equivalent to silent inputs.
+  for( std::size_t blockIdx( 0 ); blockIdx < 10; ++blockIdx )
+  {
+    processBlock( true );
+    BOOST_CHECK_LE( maxDifference( activityOutput, referenceOutput ), 1.0e-6f );
+  }
+  // Reactivated channels contribute to the output again.
+  BOOST_CHECK( activityFlow.injectParameter( "objectIn", sceneWithChannels( { 0, 1, 2, 3 } ) ) );
+  processBlock( true );
+  BOOST_CHECK_GT( maxDifference( activityOutput, referenceOutput ), 1.0e-3f );
+}
+
+} // namespace test
+} // namespace rcl
+} // namespace visr
@@ -0,0 +1,185 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librcl/delay_matrix.hpp>
+
+#include <librrl/audio_signal_flow.hpp>
+
+#include <libvisr/signal_flow_context.hpp>
+
+#include <libefl/basic_matrix.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace visr
+{
+namespace rcl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+void fillRandom( efl::BasicMatrix<SampleType> & mtx, std::mt19937 & gen, SampleType minVal, SampleType maxVal,
+                 SampleType zeroProbability )
+{
+  std::uniform_real_distribution<SampleType> valueDist( minVal, maxVal );
+  std::uniform_real_distribution<SampleType> zeroDist( 0.0f, 1.0f );
+  for( std::size_t rowIdx( 0 ); rowIdx < mtx.numberOfRows(); ++rowIdx )
+  {
+    for( std::size_t colIdx( 0 ); colIdx < mtx.numberOfColumns(); ++colIdx )
+    {
+      mtx( rowIdx, colIdx ) = zeroDist( gen ) < zeroProbability ? 0.0f : valueDist( gen );
+    }
+  }
+}
+
+/**
+ * Run a pairwise and a shared-input DelayMatrix with identical parameters and return the maximum absolute
+ * difference of the outputs.
+ */
+SampleType compareProcessingModes( char const * interpolationMethod, std::size_t numInputs, std::size_t numOutputs )
+{
+  std::size_t const blockSize = 64;
+  std::size_t const numBlocks = 24;
+  std::size_t const interpolationSteps = 4 * blockSize;
+  SampleType const maxDelay = 0.01f;
+  SignalFlowContext const context( blockSize, 48000 );
+
+  std::mt19937 gen( 42 );
+  efl::BasicMatrix<SampleType> delays( numOutputs, numInputs, cVectorAlignmentSamples );
+  efl::BasicMatrix<SampleType> gains( numOutputs, numInputs, cVectorAlignmentSamples );
+  fillRandom( delays, gen, 0.0f, 0.5f * maxDelay, 0.0f );
+  fillRandom( gains, gen, -1.0f, 1.0f, 0.5f );
+
+  DelayMatrix pairwise( context, "Pairwise", nullptr, numInputs, numOutputs, interpolationSteps, maxDelay,
+                        interpolationMethod, DelayMatrix::MethodDelayPolicy::Add, DelayMatrix::ControlPortConfig::None,
+                        delays, gains, DelayMatrix::ProcessingMode::Pairwise );
+  DelayMatrix shared( context, "Shared", nullptr, numInputs, numOutputs, interpolationSteps, maxDelay,
+                      interpolationMethod, DelayMatrix::MethodDelayPolicy::Add, DelayMatrix::ControlPortConfig::None,
+                      delays, gains, DelayMatrix::ProcessingMode::SharedInput );
+  rrl::AudioSignalFlow pairwiseFlow( pairwise );
+  rrl::AudioSignalFlow sharedFlow( shared );
+
+  std::uniform_real_distribution<SampleType> signalDist( -1.0f, 1.0f );
+  std::vector<SampleType> input( numInputs * blockSize );
+  std::vector<SampleType> pairwiseOutput( numOutputs * blockSize );
+  std::vector<SampleType> sharedOutput( numOutputs * blockSize );
+  SampleType maxDiff = 0.0f;
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    if( blockIdx == numBlocks / 2 )
+    {
+      // Start a transition, including routing points that are switched on or off.
+      fillRandom( delays, gen, 0.0f, 0.5f * maxDelay, 0.0f );
+      fillRandom( gains, gen, -1.0f, 1.0f, 0.5f );
+      pairwise.setDelayAndGain( delays, gains );
+      shared.setDelayAndGain( delays, gains );
+    }
+    std::generate( input.begin(), input.end(), [&](){ return signalDist( gen ); } );
+    pairwiseFlow.process( input.data(), blockSize, 1, pairwiseOutput.data(), blockSize, 1 );
+    sharedFlow.process( input.data(), blockSize, 1, sharedOutput.data(), blockSize, 1 );
+    for( std::size_t idx( 0 ); idx < pairwiseOutput.size(); ++idx )
+    {
+      maxDiff = std::max( maxDiff, std::abs( pairwiseOutput[idx] - sharedOutput[idx] ) );
+    }
+  }
+  return maxDiff;
+}
+
+/**
+ * Check that a DelayMatrix with whole-sample delays reproduces the exactly delayed and scaled input signals.
+ */
+void checkExpectedOutput( DelayMatrix::ProcessingMode processingMode )
+{
+  std::size_t const blockSize = 32;
+  std::size_t const numBlocks = 6;
+  std::size_t const numInputs = 2;
+  std::size_t const numOutputs = 3;
+  SamplingFrequencyType const samplingFrequency = 48000;
+  SignalFlowContext const context( blockSize, samplingFrequency );
+
+  std::size_t const delaySamples[numOutputs][numInputs] = { { 0, 5 }, { 3, 17 }, { 40, 1 } };
+  SampleType const gainValues[numOutputs][numInputs] = { { 1.0f, 0.5f }, { -2.0f, 0.0f }, { 0.25f, 1.0f } };
+  efl::BasicMatrix<SampleType> delays( numOutputs, numInputs, cVectorAlignmentSamples );
+  efl::BasicMatrix<SampleType> gains( numOutputs, numInputs, cVectorAlignmentSamples );
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    for( std::size_t inIdx( 0 ); inIdx < numInputs; ++inIdx )
+    {
+      delays( outIdx, inIdx ) = static_cast<SampleType>( delaySamples[outIdx][inIdx] )
+        / static_cast<SampleType>( samplingFrequency );
+      gains( outIdx, inIdx ) = gainValues[outIdx][inIdx];
+    }
+  }
+  DelayMatrix matrix( context, "Matrix", nullptr, numInputs, numOutputs, blockSize, 0.01f, "nearestSample",
+                      DelayMatrix::MethodDelayPolicy::Add, DelayMatrix::ControlPortConfig::None,
+                      delays, gains, processingMode );
+  rrl::AudioSignalFlow flow( matrix );
+
+  // Integer-valued signals, such that the scaled and summed outputs are exact.
+  auto const inputSignal = []( std::size_t inIdx, std::size_t sampleIdx )
+  {
+    return static_cast<SampleType>( (sampleIdx * (inIdx + 3)) % 23 ) - 11.0f;
+  };
+  std::vector<SampleType> input( numInputs * blockSize );
+  std::vector<SampleType> output( numOutputs * blockSize );
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    for( std::size_t inIdx( 0 ); inIdx < numInputs; ++inIdx )
+    {
+      for( std::size_t sIdx( 0 ); sIdx < blockSize; ++sIdx )
+      {
+        input[inIdx * blockSize + sIdx] = inputSignal( inIdx, blockIdx * blockSize + sIdx );
+      }
+    }
+    flow.process( input.data(), blockSize, 1, output.data(), blockSize, 1 );
+    for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+    {
+      for( std::size_t sIdx( 0 ); sIdx < blockSize; ++sIdx )
+      {
+        std::size_t const sampleIdx = blockIdx * blockSize + sIdx;
+        SampleType expected = 0.0f;
+        for( std::size_t inIdx( 0 ); inIdx < numInputs; ++inIdx )
+        {
+          std::size_t const delay = delaySamples[outIdx][inIdx];
+          if( sampleIdx >= delay )
+          {
+            expected += gainValues[outIdx][inIdx] * inputSignal( inIdx, sampleIdx - delay );
+          }
+        }
+        BOOST_CHECK_SMALL( output[outIdx * blockSize + sIdx] - expected, 1.0e-5f );
+      }
+    }
+  }
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( DelayMatrixExpectedOutput )
+{
+  checkExpectedOutput( DelayMatrix::ProcessingMode::Pairwise );
+  checkExpectedOutput( DelayMatrix::ProcessingMode::SharedInput );
+}
+
+BOOST_AUTO_TEST_CASE( DelayMatrixSharedInputMatchesPairwise )
+{
+  for( char const * method : { "nearestSample", "lagrangeOrder1", "lagrangeOrder3", "lagrangeOrder4" } )
+  {
+    // 11 outputs exercise both a full and a partially filled group of parallel outputs.
+    SampleType const maxDiff = compareProcessingModes( method, 3, 11 );
+    BOOST_CHECK_MESSAGE( maxDiff < 1.0e-5f, std::string( "Interpolation method " ) + method
+                         + ": maximum difference " + std::to_string( maxDiff ) );
+  }
+}
+
+} // namespace test
+} // namespace rcl
+} // namespace visr
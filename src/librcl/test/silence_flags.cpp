@@ -0,0 +1,248 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librcl/biquad_iir_filter.hpp>
+#include <librcl/delay_vector.hpp>
+#include <librcl/fir_filter_matrix.hpp>
+#include <librcl/gain_matrix.hpp>
+
+#include <librrl/audio_signal_flow.hpp>
+
+#include <libvisr/audio_input.hpp>
+#include <libvisr/audio_output.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <librbbl/biquad_coefficient.hpp>
+#include <librbbl/filter_routing.hpp>
+
+#include <libefl/basic_matrix.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace visr
+{
+namespace rcl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+std::size_t const cNumInputs = 4;
+std::size_t const cNumOutputs = 2;
+std::size_t const cBlockSize = 32;
+std::size_t const cFilterLength = 200;
+std::size_t const cDelaySamples = 96;
+SampleType const cEqCoefficients[5] = { 0.0675f, 0.1349f, 0.0675f, -1.1430f, 0.4128f };
+rbbl::FilterRoutingList const cFirRouting( { { 0, 0, 0, 1.0 }, { 1, 1, 1, 1.0 }, { 2, 0, 2, 0.5 }, { 3, 1, 3, 0.5 } } );
+
+/**
+ * Processing chain EQ -> delay -> FIR matrix -> gain matrix, where all components support silence flags.
+ * The FIR matrix maps inputs 0 and 2 to output 0, and inputs 1 and 3 to output 1.
+ */
+class SilenceTestFlow: public CompositeComponent
+{
+public:
+  SilenceTestFlow( SignalFlowContext const & context, efl::BasicMatrix<SampleType> const & filters,
+                   efl::BasicMatrix<SampleType> const & matrixGains )
+   : CompositeComponent( context, "", nullptr )
+   , mInput( "in", *this, cNumInputs )
+   , mOutput( "out", *this, cNumOutputs )
+   , mEq( context, "Eq", this, cNumInputs, 1,
+          rbbl::BiquadCoefficient<SampleType>( cEqCoefficients[0], cEqCoefficients[1], cEqCoefficients[2],
+                                               cEqCoefficients[3], cEqCoefficients[4] ) )
+   , mDelay( context, "Delay", this )
+   , mFir( context, "Fir", this, cNumInputs, cNumOutputs, cFilterLength, cNumInputs, cNumInputs, filters,
+           cFirRouting )
+   , mMatrix( context, "Matrix", this )
+  {
+    // The method delay is compensated, so the total delay is a whole number of samples.
+    mDelay.setup( cNumInputs, cBlockSize, 0.01f, "lagrangeOrder3", DelayVector::MethodDelayPolicy::Limit,
+                  DelayVector::ControlPortConfig::None,
+                  static_cast<SampleType>( cDelaySamples ) / static_cast<SampleType>( context.samplingFrequency() ), 1.0f );
+    mMatrix.setup( cNumOutputs, cNumOutputs, cBlockSize, matrixGains, false );
+    audioConnection( mInput, mEq.audioPort( "in" ) );
+    audioConnection( mEq.audioPort( "out" ), mDelay.audioPort( "in" ) );
+    audioConnection( mDelay.audioPort( "out" ), mFir.audioPort( "in" ) );
+    audioConnection( mFir.audioPort( "out" ), mMatrix.audioPort( "in" ) );
+    audioConnection( mMatrix.audioPort( "out" ), mOutput );
+  }
+
+  bool firOutputSilent( std::size_t channelIdx ) { return mFir.audioPort( "out" ).silent( channelIdx ); }
+
+  bool matrixOutputSilent( std::size_t channelIdx ) { return mMatrix.audioPort( "out" ).silent( channelIdx ); }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+  BiquadIirFilter mEq;
+  DelayVector mDelay;
+  FirFilterMatrix mFir;
+  GainMatrix mMatrix;
+};
+
+/**
+ * Compute the output of the processing chain sample by sample.
+ * @param input The input signals, one row per channel.
+ */
+efl::BasicMatrix<SampleType> expectedOutput( efl::BasicMatrix<SampleType> const & input,
+                                             efl::BasicMatrix<SampleType> const & filters,
+                                             efl::BasicMatrix<SampleType> const & matrixGains )
+{
+  std::size_t const numSamples = input.numberOfColumns();
+  efl::BasicMatrix<SampleType> delayed( cNumInputs, numSamples );
+  for( std::size_t chIdx( 0 ); chIdx < cNumInputs; ++chIdx )
+  {
+    // Transposed direct form II, as used by BiquadIirFilter.
+    SampleType v1 = 0.0f;
+    SampleType v2 = 0.0f;
+    for( std::size_t sIdx( 0 ); sIdx < numSamples; ++sIdx )
+    {
+      SampleType const x = input( chIdx, sIdx );
+      SampleType const y = cEqCoefficients[0] * x + v1;
+      v1 = v2 + cEqCoefficients[1] * x - cEqCoefficients[3] * y;
+      v2 = cEqCoefficients[2] * x - cEqCoefficients[4] * y;
+      if( sIdx + cDelaySamples < numSamples )
+      {
+        delayed( chIdx, sIdx + cDelaySamples ) = y;
+      }
+    }
+  }
+  efl::BasicMatrix<SampleType> filtered( cNumOutputs, numSamples );
+  for( auto const & routing : cFirRouting )
+  {
+    for( std::size_t sIdx( 0 ); sIdx < numSamples; ++sIdx )
+    {
+      SampleType sum = 0.0f;
+      for( std::size_t tapIdx( 0 ); tapIdx < std::min( cFilterLength, sIdx + 1 ); ++tapIdx )
+      {
+        sum += filters( routing.filterIndex, tapIdx ) * delayed( routing.inputIndex, sIdx - tapIdx );
+      }
+      filtered( routing.outputIndex, sIdx ) += static_cast<SampleType>( routing.gainLinear ) * sum;
+    }
+  }
+  efl::BasicMatrix<SampleType> output( cNumOutputs, numSamples );
+  for( std::size_t outIdx( 0 ); outIdx < cNumOutputs; ++outIdx )
+  {
+    for( std::size_t sIdx( 0 ); sIdx < numSamples; ++sIdx )
+    {
+      for( std::size_t inIdx( 0 ); inIdx < cNumOutputs; ++inIdx )
+      {
+        output( outIdx, sIdx ) += matrixGains( outIdx, inIdx ) * filtered( inIdx, sIdx );
+      }
+    }
+  }
+  return output;
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( SilenceFlagsBypassDecayedChannels )
+{
+  SignalFlowContext const context( cBlockSize, 48000 );
+  std::mt19937 gen( 11 );
+  std::uniform_real_distribution<SampleType> dist( -1.0f, 1.0f );
+
+  efl::BasicMatrix<SampleType> filters( cNumInputs, cFilterLength, cVectorAlignmentSamples );
+  for( std::size_t rowIdx( 0 ); rowIdx < cNumInputs; ++rowIdx )
+  {
+    for( std::size_t colIdx( 0 ); colIdx < cFilterLength; ++colIdx )
+    {
+      filters( rowIdx, colIdx ) = dist( gen ) * std::exp( -0.02f * static_cast<SampleType>(colIdx) );
+    }
+  }
+  efl::BasicMatrix<SampleType> matrixGains( cNumOutputs, cNumOutputs, cVectorAlignmentSamples );
+  matrixGains( 0, 0 ) = 0.7f; matrixGains( 0, 1 ) = -0.3f;
+  matrixGains( 1, 0 ) = 0.2f; matrixGains( 1, 1 ) = 0.9f;
+
+  SilenceTestFlow bypass( context, filters, matrixGains );
+  SilenceTestFlow reference( context, filters, matrixGains );
+  rrl::AudioSignalFlow bypassFlow( bypass );
+  rrl::AudioSignalFlow referenceFlow( reference );
+  bypassFlow.setSilenceDetection( true );
+  BOOST_CHECK( bypassFlow.silenceDetectionEnabled() );
+  BOOST_CHECK_THROW( bypassFlow.setSilenceDetection( true, -1.0f ), std::invalid_argument );
+
+  // Inputs 0 and 2 carry a signal up to block 70, input 1 in blocks 0-2 and 60-69, input 3 is always silent.
+  std::size_t const numBlocks = 130;
+  std::vector<SampleType> input( cNumInputs * cBlockSize );
+  std::vector<SampleType> bypassOutput( cNumOutputs * cBlockSize );
+  std::vector<SampleType> referenceOutput( cNumOutputs * cBlockSize );
+  efl::BasicMatrix<SampleType> allInputs( cNumInputs, numBlocks * cBlockSize );
+  efl::BasicMatrix<SampleType> allOutputs( cNumOutputs, numBlocks * cBlockSize );
+  SampleType maxDiff = 0.0f;
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    bool const active[cNumInputs] = { blockIdx < 70, (blockIdx < 3) or (blockIdx >= 60 and blockIdx < 70),
+                                      blockIdx < 70, false };
+    for( std::size_t chIdx( 0 ); chIdx < cNumInputs; ++chIdx )
+    {
+      std::generate( input.begin() + chIdx * cBlockSize, input.begin() + (chIdx + 1) * cBlockSize,
+                     [&](){ return active[chIdx] ? dist( gen ) : 0.0f; } );
+    }
+    bypassFlow.process( input.data(), cBlockSize, 1, bypassOutput.data(), cBlockSize, 1 );
+    referenceFlow.process( input.data(), cBlockSize, 1, referenceOutput.data(), cBlockSize, 1 );
+    for( std::size_t idx( 0 ); idx < bypassOutput.size(); ++idx )
+    {
+      maxDiff = std::max( maxDiff, std::abs( bypassOutput[idx] - referenceOutput[idx] ) );
+    }
+    for( std::size_t sIdx( 0 ); sIdx < cBlockSize; ++sIdx )
+    {
+      for( std::size_t chIdx( 0 ); chIdx < cNumInputs; ++chIdx )
+      {
+        allInputs( chIdx, blockIdx * cBlockSize + sIdx ) = input[chIdx * cBlockSize + sIdx];
+      }
+      for( std::size_t chIdx( 0 ); chIdx < cNumOutputs; ++chIdx )
+      {
+        allOutputs( chIdx, blockIdx * cBlockSize + sIdx ) = bypassOutput[chIdx * cBlockSize + sIdx];
+      }
+    }
+    if( blockIdx == 2 )
+    {
+      BOOST_CHECK( not bypass.firOutputSilent( 1 ) );
+    }
+    if( blockIdx == 55 )
+    {
+      // The tails of input 1 have decayed through the complete chain, input 0 and 2 are still active.
+      BOOST_CHECK( bypass.firOutputSilent( 1 ) );
+      BOOST_CHECK( not bypass.firOutputSilent( 0 ) );
+      BOOST_CHECK( not bypass.matrixOutputSilent( 0 ) );
+    }
+    if( blockIdx == 62 )
+    {
+      BOOST_CHECK( not bypass.firOutputSilent( 1 ) );
+    }
+  }
+  // All signals have decayed at the end.
+  BOOST_CHECK( bypass.firOutputSilent( 0 ) );
+  BOOST_CHECK( bypass.firOutputSilent( 1 ) );
+  BOOST_CHECK( bypass.matrixOutputSilent( 0 ) );
+  BOOST_CHECK( bypass.matrixOutputSilent( 1 ) );
+  // Without silence detection, no flags are set.
+  BOOST_CHECK( not reference.firOutputSilent( 1 ) );
+  BOOST_CHECK( not reference.matrixOutputSilent( 0 ) );
+
+  BOOST_CHECK_LE( maxDiff, 1.0e-6f );
+
+  // The bypassed processing matches the direct computation of the chain.
+  efl::BasicMatrix<SampleType> const expected = expectedOutput( allInputs, filters, matrixGains );
+  SampleType maxError = 0.0f;
+  for( std::size_t chIdx( 0 ); chIdx < cNumOutputs; ++chIdx )
+  {
+    for( std::size_t sIdx( 0 ); sIdx < allOutputs.numberOfColumns(); ++sIdx )
+    {
+      maxError = std::max( maxError, std::abs( allOutputs( chIdx, sIdx ) - expected( chIdx, sIdx ) ) );
+    }
+  }
+  BOOST_CHECK_LE( maxError, 1.0e-4f );
+}
+
+} // namespace test
+} // namespace rcl
+} // namespace visr
@@ -0,0 +1,166 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librcl/udp_scene_receiver.hpp>
+
+#include <librrl/audio_signal_flow.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/parameter_input.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <libobjectmodel/object_vector.hpp>
+#include <libobjectmodel/object_vector_binary_parser.hpp>
+#include <libobjectmodel/object_vector_parser.hpp>
+#include <libobjectmodel/point_source.hpp>
+
+#include <libpml/double_buffering_protocol.hpp>
+#include <libpml/empty_parameter_config.hpp>
+#include <libpml/initialise_parameter_library.hpp>
+#include <libpml/object_vector.hpp>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <ciso646>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace visr
+{
+namespace rcl
+{
+namespace test
+{
+
+#ifndef VISR_DISABLE_THREADS
+
+namespace // unnamed
+{
+
+/**
+ * Records the size of the received object vector.
+ */
+class SceneSink: public AtomicComponent
+{
+public:
+  SceneSink( SignalFlowContext const & context, char const * name, CompositeComponent * parent )
+   : AtomicComponent( context, name, parent )
+   , mInput( "objectIn", *this, pml::EmptyParameterConfig() )
+   , mNumberOfObjects( 0 )
+   , mNumberOfChanges( 0 )
+  {
+  }
+
+  void process() override
+  {
+    if( mInput.changed() )
+    {
+      mNumberOfObjects = mInput.data().size();
+      ++mNumberOfChanges;
+      mInput.resetChanged();
+    }
+  }
+
+  std::size_t numberOfObjects() const { return mNumberOfObjects; }
+
+  std::size_t numberOfChanges() const { return mNumberOfChanges; }
+private:
+  ParameterInput< pml::DoubleBufferingProtocol, pml::ObjectVector > mInput;
+  std::size_t mNumberOfObjects;
+  std::size_t mNumberOfChanges;
+};
+
+class ReceiverTestFlow: public CompositeComponent
+{
+public:
+  ReceiverTestFlow( SignalFlowContext const & context )
+   : CompositeComponent( context, "", nullptr )
+   , mReceiver( context, "Receiver", this, 0 /*port chosen by the operating system*/ )
+   , mSink( context, "Sink", this )
+  {
+    parameterConnection( mReceiver.parameterPort( "objectVectorOutput" ), mSink.parameterPort( "objectIn" ) );
+  }
+
+  SceneSink const & sink() const { return mSink; }
+
+  std::size_t receiverPort() const { return mReceiver.port(); }
+private:
+  UdpSceneReceiver mReceiver;
+  SceneSink mSink;
+};
+
+/**
+ * Process the flow until the sink has seen the expected number of objects, or the timeout is reached.
+ */
+bool processUntil( rrl::AudioSignalFlow & flow, SceneSink const & sink, std::size_t expectedObjects )
+{
+  for( std::size_t iter( 0 ); iter < 400; ++iter )
+  {
+    flow.process( nullptr, nullptr );
+    if( sink.numberOfObjects() == expectedObjects )
+    {
+      return true;
+    }
+    std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+  }
+  return false;
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( UdpSceneReceiverDecodesMessages )
+{
+  pml::initialiseParameterLibrary();
+  SignalFlowContext const context( 64, 48000 );
+  ReceiverTestFlow comp( context );
+  rrl::AudioSignalFlow flow( comp );
+
+  boost::asio::io_service ioService;
+  boost::asio::ip::udp::socket socket( ioService, boost::asio::ip::udp::v4() );
+  boost::asio::ip::udp::endpoint const target( boost::asio::ip::address_v4::loopback(),
+                                               static_cast<unsigned short>(comp.receiverPort()) );
+
+  objectmodel::ObjectVector initialScene;
+  for( objectmodel::ObjectId id( 0 ); id < 2; ++id )
+  {
+    objectmodel::PointSource ps( id );
+    ps.resetNumberOfChannels( 1 );
+    ps.setChannelIndex( 0, id );
+    initialScene.insert( ps );
+  }
+  std::stringstream jsonStr;
+  objectmodel::ObjectVectorParser::encodeObjectVector( initialScene, jsonStr );
+  std::string const jsonMsg = jsonStr.str();
+  socket.send_to( boost::asio::buffer( jsonMsg ), target );
+  BOOST_CHECK( processUntil( flow, comp.sink(), 2 ) );
+
+  // Binary messages update the existing scene.
+  objectmodel::ObjectVector update;
+  objectmodel::PointSource ps( 2 );
+  ps.resetNumberOfChannels( 1 );
+  ps.setChannelIndex( 0, 2 );
+  update.insert( ps );
+  std::string binaryMsg;
+  objectmodel::ObjectVectorBinaryParser::encodeObjectVector( update, binaryMsg );
+  socket.send_to( boost::asio::buffer( binaryMsg ), target );
+  BOOST_CHECK( processUntil( flow, comp.sink(), 3 ) );
+
+  // Without new messages, the output is not marked as changed.
+  std::size_t const numChanges = comp.sink().numberOfChanges();
+  for( std::size_t iter( 0 ); iter < 10; ++iter )
+  {
+    flow.process( nullptr, nullptr );
+  }
+  BOOST_CHECK_EQUAL( comp.sink().numberOfChanges(), numChanges );
+}
+
+#endif // #ifndef VISR_DISABLE_THREADS
+
+} // namespace test
+} // namespace rcl
+} // namespace visr
@@ -16,6 +16,7 @@
 #endif
 
 
+#include <atomic>
 #include <ciso646>
 #include <memory>
 #include <sstream>
@@ -36,6 +37,10 @@ public:
     ~Impl();
     void process(UdpReceiver::MessageOutput & messageOutput);
 
+    std::size_t port() const;
+
+    std::size_t numberOfReceivedMessages() const;
+
 private:
 
     void handleReceiveData(const boost::system::error_code& error,
@@ -68,6 +73,8 @@ private:
     */
     std::deque< pml::StringParameter > mInternalMessageBuffer;
 
+    std::atomic<std::size_t> mNumberOfReceivedMessages;
+
 #ifndef VISR_DISABLE_THREADS
     std::unique_ptr< boost::thread > mServiceThread;
 
@@ -93,12 +100,23 @@ void UdpReceiver::process()
   mImpl->process(mDatagramOutput);
 }
 
+std::size_t UdpReceiver::port() const
+{
+  return mImpl->port();
+}
+
+std::size_t UdpReceiver::numberOfReceivedMessages() const
+{
+  return mImpl->numberOfReceivedMessages();
+}
+
 // ==========================================================================
 // Implementation class
 
 UdpReceiver::Impl::Impl( std::size_t port,
                          Mode mode )
  : mMode( mode )
+ , mNumberOfReceivedMessages( 0 )
 {
     using boost::asio::ip::udp;
     mIoServiceInstance.reset(new boost::asio::io_service());
@@ -153,6 +171,16 @@ UdpReceiver::Impl::~Impl()
 #endif
 }
 
+std::size_t UdpReceiver::Impl::port() const
+{
+  return mSocket->local_endpoint().port();
+}
+
+std::size_t UdpReceiver::Impl::numberOfReceivedMessages() const
+{
+  return mNumberOfReceivedMessages.load();
+}
+
 void UdpReceiver::Impl::process( UdpReceiver::MessageOutput & messageOutput )
 {
   if(  mMode == Mode::Synchronous )
@@ -179,6 +207,7 @@ void UdpReceiver::Impl::handleReceiveData( const boost::system::error_code& erro
 #endif
     mInternalMessageBuffer.push_back( pml::StringParameter( std::string( &mReceiveBuffer[0], numBytesTransferred ) ) );
   }
+  ++mNumberOfReceivedMessages;
   mSocket->async_receive_from( boost::asio::buffer(mReceiveBuffer),
                                mRemoteEndpoint,
                                boost::bind(&Impl::handleReceiveData, this,
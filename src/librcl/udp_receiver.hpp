@@ -45,7 +45,7 @@ public:
    * @param context Configuration object containing basic execution parameters.
    * @param name The name of the component. Must be unique within the containing composite component (if there is one).
    * @param parent Pointer to a containing component if there is one. Specify \p nullptr in case of a top-level component
-   * @param port The UDP port number to receive data.
+   * @param port The UDP port number to receive data. If 0, an unused port is chosen by the operating system, see port().
    * @param mode The mode how data is received. See documentation of enumeration Mode.
    */
   explicit UdpReceiver( SignalFlowContext const & context,
@@ -64,6 +64,19 @@ public:
    */
   void process() override;
 
+  /**
+   * Return the UDP port number the component is bound to.
+   * Used to query the port chosen by the operating system if the component was constructed with port number 0.
+   */
+  std::size_t port() const;
+
+  /**
+   * Return the number of datagrams received so far.
+   * In the asynchronous mode, the datagrams counted here are sent to the output in the next process() call.
+   * This function can be called from any thread.
+   */
+  std::size_t numberOfReceivedMessages() const;
+
 private:
   class Impl;
 
@@ -0,0 +1,205 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "udp_scene_receiver.hpp"
+
+#include <libobjectmodel/object_vector.hpp>
+#include <libobjectmodel/object_vector_binary_parser.hpp>
+#include <libobjectmodel/object_vector_parser.hpp>
+
+#include <libpml/empty_parameter_config.hpp>
+
+#include <librbbl/triple_buffer.hpp>
+
+#include <boost/array.hpp>
+#include <boost/asio/placeholders.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/bind/bind.hpp>
+#ifndef VISR_DISABLE_THREADS
+#include <boost/thread/thread.hpp>
+#endif
+
+#include <ciso646>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+namespace visr
+{
+namespace rcl
+{
+
+class UdpSceneReceiver::Impl
+{
+public:
+  explicit Impl( std::size_t port );
+
+  ~Impl();
+
+  /**
+   * Transfer the most recently decoded scene into \p objects.
+   * Called from the process() method, does neither block nor allocate.
+   * @return true if a new scene has been transferred, false if there was no new scene.
+   */
+  bool fetchScene( objectmodel::ObjectVector & objects );
+
+  std::size_t port() const;
+
+private:
+  void handleReceiveData( const boost::system::error_code& error,
+                          std::size_t numBytesTransferred );
+
+  void startReceive();
+
+  static std::size_t const cMaxMessageLength = 65536;
+
+  boost::asio::io_service mIoService;
+
+  std::unique_ptr<boost::asio::ip::udp::socket> mSocket;
+
+  boost::asio::ip::udp::endpoint mRemoteEndpoint;
+
+  boost::array<char, cMaxMessageLength> mReceiveBuffer;
+
+  /**
+   * The current state of the scene, accumulating all received messages.
+   * Accessed only by the receiving thread.
+   */
+  objectmodel::ObjectVector mScene;
+
+  /**
+   * Lock-free handover of decoded scenes from the receiving thread to process().
+   * The instances exchanged with the output parameter are returned to the receiving thread, where their
+   * content is overwritten. Therefore the deallocation of outdated objects also takes place in that thread.
+   */
+  rbbl::TripleBuffer<objectmodel::ObjectVector> mSceneExchange;
+
+#ifndef VISR_DISABLE_THREADS
+  std::unique_ptr< boost::thread > mServiceThread;
+#endif
+};
+
+UdpSceneReceiver::UdpSceneReceiver( SignalFlowContext const & context,
+                                    char const * name,
+                                    CompositeComponent * parent,
+                                    std::size_t port )
+ : AtomicComponent( context, name, parent )
+ , mImpl( new Impl( port ) )
+ , mObjectVectorOutput( "objectVectorOutput", *this, pml::EmptyParameterConfig() )
+{
+}
+
+UdpSceneReceiver::~UdpSceneReceiver() = default;
+
+void UdpSceneReceiver::process()
+{
+  if( mImpl->fetchScene( mObjectVectorOutput.data() ) )
+  {
+    // The previous content of the output buffer is overwritten entirely, so no copy is needed.
+    mObjectVectorOutput.swapBuffers();
+  }
+}
+
+std::size_t UdpSceneReceiver::port() const
+{
+  return mImpl->port();
+}
+
+// ==========================================================================
+// Implementation class
+
+UdpSceneReceiver::Impl::Impl( std::size_t port )
+{
+#ifdef VISR_DISABLE_THREADS
+  throw std::invalid_argument( "UdpSceneReceiver: This component is not supported because threads are disabled." );
+#else
+  using boost::asio::ip::udp;
+  mSocket.reset( new udp::socket( mIoService ) );
+  boost::system::error_code ec;
+  mSocket->open( udp::v4(), ec );
+  if( ec )
+  {
+    throw std::runtime_error( "UdpSceneReceiver: Error opening UDP port" );
+  }
+  mSocket->set_option( boost::asio::socket_base::reuse_address( true ) );
+  mSocket->bind( udp::endpoint( udp::v4(), static_cast<unsigned short>(port) ) );
+
+  startReceive();
+  // The pending receive operation keeps the io_service running until it is stopped in the destructor.
+  mServiceThread.reset( new boost::thread( boost::bind( &boost::asio::io_service::run, &mIoService ) ) );
+#endif // VISR_DISABLE_THREADS
+}
+
+UdpSceneReceiver::Impl::~Impl()
+{
+  mIoService.stop();
+#ifndef VISR_DISABLE_THREADS
+  if( mServiceThread.get() != nullptr )
+  {
+    mServiceThread->join();
+  }
+#endif
+}
+
+bool UdpSceneReceiver::Impl::fetchScene( objectmodel::ObjectVector & objects )
+{
+  if( not mSceneExchange.update() )
+  {
+    return false;
+  }
+  objects.swap( mSceneExchange.readBuffer() );
+  return true;
+}
+
+std::size_t UdpSceneReceiver::Impl::port() const
+{
+  return mSocket->local_endpoint().port();
+}
+
+void UdpSceneReceiver::Impl::startReceive()
+{
+  mSocket->async_receive_from( boost::asio::buffer( mReceiveBuffer ),
+                               mRemoteEndpoint,
+                               boost::bind( &Impl::handleReceiveData, this,
+                                            boost::asio::placeholders::error,
+                                            boost::asio::placeholders::bytes_transferred ) );
+}
+
+void UdpSceneReceiver::Impl::handleReceiveData( const boost::system::error_code& error,
+                                                std::size_t numBytesTransferred )
+{
+  if( error == boost::asio::error::operation_aborted )
+  {
+    return;
+  }
+  if( not error )
+  {
+    char const * const msg = &mReceiveBuffer[0];
+    try
+    {
+      if( objectmodel::ObjectVectorBinaryParser::isBinaryMessage( msg, numBytesTransferred ) )
+      {
+        objectmodel::ObjectVectorBinaryParser::updateObjectVector( msg, numBytesTransferred, mScene );
+      }
+      else
+      {
+        objectmodel::ObjectVectorParser::updateObjectVector( msg, numBytesTransferred, mScene );
+      }
+    }
+    catch( std::exception const & ex )
+    {
+      std::cerr << "UdpSceneReceiver: Error while decoding a scene metadata message: " << ex.what() << std::endl;
+    }
+    // Publish only after the last message of a burst in order to avoid copying intermediate scene states.
+    boost::system::error_code ec;
+    if( mSocket->available( ec ) == 0 )
+    {
+      mSceneExchange.writeBuffer().assign( mScene );
+      mSceneExchange.publish();
+    }
+  }
+  startReceive();
+}
+
+} // namespace rcl
+} // namespace visr
@@ -0,0 +1,81 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRCL_UDP_SCENE_RECEIVER_HPP_INCLUDED
+#define VISR_LIBRCL_UDP_SCENE_RECEIVER_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+
+#include <libvisr/constants.hpp>
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/parameter_output.hpp>
+
+#include <libpml/object_vector.hpp>
+#include <libpml/double_buffering_protocol.hpp>
+
+#include <memory>
+
+namespace visr
+{
+namespace rcl
+{
+
+/**
+ * A component that receives object metadata messages from a UDP network port and decodes them into an object vector.
+ * This combines the functionality of a UdpReceiver in asynchronous mode and a SceneDecoder, but performs both
+ * the reception and the decoding of the messages in a thread instantiated by the component.
+ * The decoded scene is passed to the process() method through a lock-free triple buffer, so the process() method
+ * does not parse, allocate, or wait for locks. Its only work is to exchange the content of the output parameter
+ * with the most recently decoded scene.
+ * As in SceneDecoder, both JSON and binary (objectmodel::ObjectVectorBinaryParser) messages are accepted.
+ * If several messages are received between two process() calls, the output reflects the combined effect of all of them.
+ * This component has neither audio inputs or outputs.
+ */
+class VISR_RCL_LIBRARY_SYMBOL UdpSceneReceiver: public AtomicComponent
+{
+public:
+  /**
+   * Constructor.
+   * @param context Configuration object containing basic execution parameters.
+   * @param name The name of the component. Must be unique within the containing composite component (if there is one).
+   * @param parent Pointer to a containing component if there is one. Specify \p nullptr in case of a top-level component
+   * @param port The UDP port number to receive data. If 0, an unused port is chosen by the operating system, see port().
+   * @throw std::invalid_argument if VISR is built without thread support.
+   */
+  explicit UdpSceneReceiver( SignalFlowContext const & context,
+                             char const * name,
+                             CompositeComponent * parent,
+                             std::size_t port );
+
+  /**
+   * Disabled (deleted) copy constructor
+   */
+  UdpSceneReceiver( UdpSceneReceiver const & ) = delete;
+
+  /**
+   * Destructor.
+   */
+  ~UdpSceneReceiver();
+
+  /**
+   * The process function.
+   */
+  void process() override;
+
+  /**
+   * Return the UDP port number the component is bound to.
+   * Used to query the port chosen by the operating system if the component was constructed with port number 0.
+   */
+  std::size_t port() const;
+
+private:
+  class Impl;
+
+  std::unique_ptr<Impl> mImpl;
+
+  ParameterOutput< pml::DoubleBufferingProtocol, pml::ObjectVector > mObjectVectorOutput;
+};
+
+} // namespace rcl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRCL_UDP_SCENE_RECEIVER_HPP_INCLUDED
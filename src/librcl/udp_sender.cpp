@@ -188,8 +188,8 @@ void UdpSender::Impl::process( UdpSender::MessageInput & messageInput )
       bool const transmissionPending = not mInternalMessageBuffer.empty();
       while( not messageInput.empty() )
       {
-        char const * nextMsg = messageInput.front().str();
-        mInternalMessageBuffer.push_back( pml::StringParameter( nextMsg ) );
+        // Copy the complete parameter to retain binary messages containing zero bytes.
+        mInternalMessageBuffer.push_back( messageInput.front() );
         messageInput.pop();
       }
       if( not mInternalMessageBuffer.empty() and not transmissionPending )
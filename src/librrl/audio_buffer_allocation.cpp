@@ -0,0 +1,323 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "audio_buffer_allocation.hpp"
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/audio_input.hpp>
+#include <libvisr/audio_output.hpp>
+#include <libvisr/audio_sample_type.hpp>
+#include <libvisr/impl/audio_port_base_implementation.hpp>
+#include <libvisr/impl/component_implementation.hpp>
+
+#include <algorithm>
+#include <ciso646>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+namespace visr
+{
+namespace rrl
+{
+
+constexpr std::size_t AudioBufferAssignment::cWholePort;
+
+namespace // unnamed
+{
+
+/**
+ * Internal representation of a port within the existing pool layout.
+ */
+struct PortEntry
+{
+  impl::AudioPortBaseImplementation * port;
+  std::size_t channel; ///< Channel index for single channels of gathered ports, AudioBufferAssignment::cWholePort otherwise.
+  std::size_t begin; ///< Start offset within the existing pool (bytes)
+  std::size_t end; ///< One past the end offset within the existing pool (bytes)
+  std::ptrdiff_t scheduleIndex; ///< Position of the containing component in the schedule, -1 for top-level ports
+  bool topLevel;
+  bool writer; ///< Whether the containing component writes to this port.
+};
+
+/**
+ * A contiguous memory region in the existing pool shared by one or more ports.
+ */
+struct Cluster
+{
+  std::size_t begin;
+  std::size_t end;
+  std::ptrdiff_t firstUse;
+  std::ptrdiff_t lastUse;
+  std::vector<std::size_t> members; ///< Indices into the port entry table.
+  bool allocated;
+  std::size_t newOffset; ///< Offset relative to the start of the region for the sample type.
+
+  std::size_t size() const { return end - begin; }
+};
+
+bool lifetimesOverlap( Cluster const & lhs, Cluster const & rhs )
+{
+  return (lhs.firstUse <= rhs.lastUse) and (rhs.firstUse <= lhs.lastUse);
+}
+
+/**
+ * Check whether a cluster can be placed at \p offset without conflicting with the already allocated clusters.
+ * @param ignore Index of a cluster to be excluded from the check (used for in-place placement), or
+ * std::numeric_limits<std::size_t>::max() to check against all clusters.
+ */
+bool placementValid( std::vector<Cluster> const & clusters, std::size_t clusterIdx, std::size_t offset,
+                     std::size_t ignore )
+{
+  Cluster const & cl = clusters[clusterIdx];
+  for( std::size_t otherIdx( 0 ); otherIdx < clusters.size(); ++otherIdx )
+  {
+    Cluster const & other = clusters[otherIdx];
+    if( (otherIdx == clusterIdx) or (otherIdx == ignore) or (not other.allocated) )
+    {
+      continue;
+    }
+    if( lifetimesOverlap( cl, other )
+      and (offset < other.newOffset + other.size()) and (other.newOffset < offset + cl.size()) )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Try to place the cluster \p clusterIdx on top of an input signal of the component writing it.
+ * @return True if the placement succeeded.
+ */
+bool placeInPlace( std::vector<Cluster> & clusters, std::size_t clusterIdx,
+                   std::vector<PortEntry> const & entries,
+                   std::map<impl::AudioPortBaseImplementation const *, std::size_t> const & entryLookup,
+                   std::vector<std::size_t> const & entryCluster,
+                   std::vector<AtomicComponent *> const & schedule )
+{
+  Cluster & cl = clusters[clusterIdx];
+  std::vector<std::size_t> writers;
+  std::copy_if( cl.members.begin(), cl.members.end(), std::back_inserter( writers ),
+                [&entries]( std::size_t idx ){ return entries[idx].writer; } );
+  if( writers.size() != 1 )
+  {
+    return false;
+  }
+  PortEntry const & outEntry = entries[writers.front()];
+  AtomicComponent const * comp = schedule[outEntry.scheduleIndex];
+  for( auto const & inPlacePair : comp->inPlacePorts() )
+  {
+    if( &(inPlacePair.second->implementation()) != outEntry.port )
+    {
+      continue;
+    }
+    auto const inFindIt = entryLookup.find( &(inPlacePair.first->implementation()) );
+    if( inFindIt == entryLookup.end() )
+    {
+      continue;
+    }
+    PortEntry const & inEntry = entries[inFindIt->second];
+    if( inEntry.channel != AudioBufferAssignment::cWholePort )
+    {
+      continue; // In-place placement is not supported for gathered inputs.
+    }
+    std::size_t const inClusterIdx = entryCluster[inFindIt->second];
+    Cluster const & inCluster = clusters[inClusterIdx];
+    if( (not inCluster.allocated) or (inCluster.lastUse != outEntry.scheduleIndex)
+      or (inEntry.end - inEntry.begin != outEntry.end - outEntry.begin) )
+    {
+      continue;
+    }
+    // The in-place input must be the only access of this component to the input cluster.
+    bool const exclusiveAccess = std::all_of( inCluster.members.begin(), inCluster.members.end(),
+      [&entries, &inEntry, &outEntry]( std::size_t idx )
+      { return (entries[idx].scheduleIndex != outEntry.scheduleIndex) or (entries[idx].port == inEntry.port); } );
+    if( not exclusiveAccess )
+    {
+      continue;
+    }
+    std::size_t const inPos = inCluster.newOffset + (inEntry.begin - inCluster.begin);
+    std::size_t const outRelative = outEntry.begin - cl.begin;
+    if( inPos < outRelative )
+    {
+      continue;
+    }
+    std::size_t const candidate = inPos - outRelative;
+    if( placementValid( clusters, clusterIdx, candidate, inClusterIdx ) )
+    {
+      cl.newOffset = candidate;
+      cl.allocated = true;
+      return true;
+    }
+  }
+  return false;
+}
+
+void placeFirstFit( std::vector<Cluster> & clusters, std::size_t clusterIdx )
+{
+  Cluster & cl = clusters[clusterIdx];
+  std::vector<std::size_t> candidates( 1, 0 );
+  for( Cluster const & other : clusters )
+  {
+    if( other.allocated and lifetimesOverlap( cl, other ) )
+    {
+      candidates.push_back( other.newOffset + other.size() );
+    }
+  }
+  std::sort( candidates.begin(), candidates.end() );
+  for( std::size_t candidate : candidates )
+  {
+    if( placementValid( clusters, clusterIdx, candidate, std::numeric_limits<std::size_t>::max() ) )
+    {
+      cl.newOffset = candidate;
+      cl.allocated = true;
+      return;
+    }
+  }
+  // Cannot happen, because the end of the last conflicting cluster is always a valid position.
+  throw std::logic_error( "computeLivenessBufferLayout(): Internal logic error: No valid buffer placement found." );
+}
+
+} // unnamed namespace
+
+std::size_t computeLivenessBufferLayout( std::vector<AtomicComponent *> const & schedule,
+                                         std::vector<impl::AudioPortBaseImplementation *> const & topLevelPorts,
+                                         char const * poolBase,
+                                         std::vector<AudioBufferAssignment> & assignments )
+{
+  std::vector<PortEntry> entries;
+  auto addPort = [&entries, poolBase]( impl::AudioPortBaseImplementation * port, std::ptrdiff_t scheduleIdx, bool topLevel )
+  {
+    if( (port->width() == 0) or (port->basePointer() == nullptr) )
+    {
+      return;
+    }
+    bool const writer = port->direction() == PortBase::Direction::Output;
+    if( port->gathered() )
+    {
+      // Gathered ports reference their channels individually.
+      for( std::size_t chIdx( 0 ); chIdx < port->width(); ++chIdx )
+      {
+        std::size_t const begin = static_cast<std::size_t>(static_cast<char const *>(port->channelPointer( chIdx )) - poolBase);
+        entries.push_back( PortEntry{ port, chIdx, begin, begin + port->channelStrideBytes(), scheduleIdx, topLevel, writer } );
+      }
+      return;
+    }
+    std::size_t const begin = static_cast<std::size_t>(static_cast<char const *>(port->basePointer()) - poolBase);
+    std::size_t const end = begin + port->width() * port->channelStrideBytes();
+    entries.push_back( PortEntry{ port, AudioBufferAssignment::cWholePort, begin, end, scheduleIdx, topLevel, writer } );
+  };
+  for( impl::AudioPortBaseImplementation * port : topLevelPorts )
+  {
+    addPort( port, -1, true );
+  }
+  for( std::size_t compIdx( 0 ); compIdx < schedule.size(); ++compIdx )
+  {
+    for( impl::AudioPortBaseImplementation * port : schedule[compIdx]->implementation().audioPorts() )
+    {
+      addPort( port, static_cast<std::ptrdiff_t>(compIdx), false );
+    }
+  }
+  std::map<impl::AudioPortBaseImplementation const *, std::size_t> entryLookup;
+  std::map<AudioSampleType::Id, std::vector<std::size_t> > typedEntries;
+  for( std::size_t entryIdx( 0 ); entryIdx < entries.size(); ++entryIdx )
+  {
+    entryLookup[entries[entryIdx].port] = entryIdx;
+    typedEntries[entries[entryIdx].port->sampleType()].push_back( entryIdx );
+  }
+  std::ptrdiff_t const scheduleLength = static_cast<std::ptrdiff_t>(schedule.size());
+
+  assignments.clear();
+  std::size_t totalSize = 0;
+  for( auto & typeEntry : typedEntries )
+  {
+    std::vector<std::size_t> & indices = typeEntry.second;
+    std::sort( indices.begin(), indices.end(),
+               [&entries]( std::size_t lhs, std::size_t rhs ){ return entries[lhs].begin < entries[rhs].begin; } );
+    // Form clusters of overlapping memory regions.
+    std::vector<Cluster> clusters;
+    std::vector<std::size_t> entryCluster( entries.size(), 0 );
+    for( std::size_t entryIdx : indices )
+    {
+      PortEntry const & entry = entries[entryIdx];
+      if( clusters.empty() or (entry.begin >= clusters.back().end) )
+      {
+        clusters.push_back( Cluster{ entry.begin, entry.end, 0, 0, {}, false, 0 } );
+      }
+      Cluster & cl = clusters.back();
+      cl.end = std::max( cl.end, entry.end );
+      cl.members.push_back( entryIdx );
+      entryCluster[entryIdx] = clusters.size() - 1;
+    }
+    // Determine the lifetimes
+    for( Cluster & cl : clusters )
+    {
+      bool pinned = false;
+      std::ptrdiff_t firstWrite = std::numeric_limits<std::ptrdiff_t>::max();
+      std::ptrdiff_t firstRead = std::numeric_limits<std::ptrdiff_t>::max();
+      std::ptrdiff_t lastRead = -1;
+      for( std::size_t entryIdx : cl.members )
+      {
+        PortEntry const & entry = entries[entryIdx];
+        pinned = pinned or entry.topLevel;
+        if( entry.writer )
+        {
+          firstWrite = std::min( firstWrite, entry.scheduleIndex );
+        }
+        else
+        {
+          firstRead = std::min( firstRead, entry.scheduleIndex );
+          lastRead = std::max( lastRead, entry.scheduleIndex );
+        }
+      }
+      // Signals without a writer or signals read before being written must retain their contents.
+      pinned = pinned or (firstWrite == std::numeric_limits<std::ptrdiff_t>::max()) or (firstRead <= firstWrite);
+      if( pinned )
+      {
+        cl.firstUse = -1;
+        cl.lastUse = scheduleLength;
+      }
+      else
+      {
+        cl.firstUse = firstWrite;
+        cl.lastUse = std::max( lastRead, firstWrite );
+      }
+    }
+    // Allocation order: By start of the lifetime, larger clusters first.
+    std::vector<std::size_t> order( clusters.size() );
+    for( std::size_t idx( 0 ); idx < order.size(); ++idx )
+    {
+      order[idx] = idx;
+    }
+    std::stable_sort( order.begin(), order.end(), [&clusters]( std::size_t lhs, std::size_t rhs )
+    {
+      return (clusters[lhs].firstUse < clusters[rhs].firstUse)
+        or ((clusters[lhs].firstUse == clusters[rhs].firstUse) and (clusters[lhs].size() > clusters[rhs].size()));
+    } );
+    std::size_t regionSize = 0;
+    for( std::size_t clusterIdx : order )
+    {
+      Cluster const & cl = clusters[clusterIdx];
+      bool const canBeInPlace = (cl.firstUse >= 0) and (cl.firstUse < scheduleLength);
+      if( not (canBeInPlace and placeInPlace( clusters, clusterIdx, entries, entryLookup, entryCluster, schedule ) ) )
+      {
+        placeFirstFit( clusters, clusterIdx );
+      }
+      regionSize = std::max( regionSize, cl.newOffset + cl.size() );
+    }
+    for( Cluster const & cl : clusters )
+    {
+      for( std::size_t entryIdx : cl.members )
+      {
+        assignments.push_back( AudioBufferAssignment{ entries[entryIdx].port, entries[entryIdx].channel,
+                                                      totalSize + cl.newOffset + (entries[entryIdx].begin - cl.begin) } );
+      }
+    }
+    totalSize += regionSize;
+  }
+  return totalSize;
+}
+
+} // namespace rrl
+} // namespace visr
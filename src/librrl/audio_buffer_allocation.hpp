@@ -0,0 +1,73 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRRL_AUDIO_BUFFER_ALLOCATION_HPP_INCLUDED
+#define VISR_LIBRRL_AUDIO_BUFFER_ALLOCATION_HPP_INCLUDED
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace visr
+{
+// Forward declarations
+class AtomicComponent;
+namespace impl
+{
+class AudioPortBaseImplementation;
+}
+
+namespace rrl
+{
+
+/**
+ * New location of an audio port within a reorganised audio signal pool.
+ */
+struct AudioBufferAssignment
+{
+  /**
+   * Special value for \p channel denoting that the assignment applies to the whole port.
+   */
+  static constexpr std::size_t cWholePort = std::numeric_limits<std::size_t>::max();
+
+  impl::AudioPortBaseImplementation * port;
+
+  /**
+   * The channel index if the assignment refers to a single channel of a gathered port
+   * (impl::AudioPortBaseImplementation::gathered()), cWholePort otherwise.
+   */
+  std::size_t channel;
+
+  /**
+   * Offset of the first channel of the port relative to the start of the pool, in bytes.
+   */
+  std::size_t byteOffset;
+};
+
+/**
+ * Compute a memory layout for the audio signal pool in which signals with non-overlapping lifetimes share the same memory.
+ * The function starts from an existing, initialised buffer assignment (each send port having its dedicated memory region)
+ * and groups all ports that share memory into clusters.
+ * The lifetime of a cluster spans from the position of its first writing component in the sequential schedule to the
+ * position of its last reading component. Clusters containing top-level ports, clusters without a writer, or clusters
+ * that are read before they are written are kept alive over the whole schedule.
+ * The clusters are then placed using a first-fit strategy, such that clusters with overlapping lifetimes do not share memory.
+ * In addition, if a component declares an input/output pair as in-place capable
+ * (AtomicComponent::declareInPlaceProcessing()), the output is placed on top of the input if the input
+ * signal is not used afterwards.
+ * The relative layout of the ports within a cluster (and thus the channel strides) is preserved.
+ * The channels of gathered ports are treated as individual single-channel ports.
+ * @param schedule The sequential processing schedule.
+ * @param topLevelPorts The external audio ports of the top-level component.
+ * @param poolBase Base address of the existing audio signal pool.
+ * @param[out] assignments New locations for all ports contained in the pool.
+ * @return The required size of the new pool (in bytes).
+ */
+std::size_t computeLivenessBufferLayout( std::vector<AtomicComponent *> const & schedule,
+                                         std::vector<impl::AudioPortBaseImplementation *> const & topLevelPorts,
+                                         char const * poolBase,
+                                         std::vector<AudioBufferAssignment> & assignments );
+
+} // namespace rrl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRRL_AUDIO_BUFFER_ALLOCATION_HPP_INCLUDED
@@ -2,11 +2,15 @@
 
 #include "audio_signal_flow.hpp"
 
+#include "audio_buffer_allocation.hpp"
 #include "audio_connection_map.hpp"
 #include "communication_area.hpp"
+#include "external_buffer_binding.hpp"
 #include "integrity_checking.hpp"
 #include "parameter_connection_graph.hpp"
 #include "parameter_connection_map.hpp"
+#include "parameter_injection_queue.hpp"
+#include "pipeline_executor.hpp"
 #include "port_utilities.hpp"
 #include "scheduling_graph.hpp"
 
@@ -21,6 +25,7 @@
 
 #include <libvisr/atomic_component.hpp>
 #include <libvisr/audio_sample_type.hpp>
+#include <libvisr/parameter_base.hpp>
 #include <libvisr/parameter_input.hpp>
 #include <libvisr/parameter_output.hpp>
 #include <libvisr/communication_protocol_base.hpp>
@@ -40,6 +45,7 @@
 #include <ciso646>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <numeric>
 #include <sstream>
@@ -59,9 +65,15 @@ namespace visr
 namespace rrl
 {
 
-AudioSignalFlow::AudioSignalFlow( Component & flow )
+AudioSignalFlow::AudioSignalFlow( Component & flow,
+                                  BufferAllocation bufferAllocation /*= BufferAllocation::Dedicated*/ )
  : mFlow( flow.implementation() )
+ , mExternalBufferBinding( false )
+ , mSilenceDetection( false )
+ , mSilenceThreshold( static_cast<SampleType>(0.0) )
+ , mBufferAllocation( bufferAllocation )
  , mParameterExchangeMutex( new ParameterExchangeMutexType{} )
+ , mParameterExchangeLocking( true )
 {
   std::stringstream checkMessages;
   bool const checkResult = checkConnectionIntegrity( mFlow, true/* hierarchical*/, checkMessages );
@@ -99,8 +111,14 @@ AudioSignalFlow::AudioSignalFlow( Component & flow )
     throw std::runtime_error( detail::composeMessageString( "AudioSignalFlow: Parameter infrastructure could not be initialised.",
                                                              checkMessages.str() ) );
   }
-
-
+  for( ProtocolReceiveEndpoints::value_type const & endpoint : mProtocolReceiveEndpoints )
+  {
+    if( endpoint.second->supportsParameterInjection() )
+    {
+      mParameterInjectionQueues[endpoint.first].reset(
+        new ParameterInjectionQueue( *(endpoint.second), cParameterInjectionQueueLength ) );
+    }
+  }
 
   // TODO: Use the full list of components 
   bool const initScheduleResult = initialiseSchedule( checkMessages, adjustedAudioConnections, adjustedParameterConnections );
@@ -110,12 +128,22 @@ AudioSignalFlow::AudioSignalFlow( Component & flow )
                                                              checkMessages.str()) );
   }
 
+  if( (bufferAllocation == BufferAllocation::Liveness) and mFlow.isComposite() )
+  {
+    reassignAudioBuffersByLiveness();
+  }
+  mAudioConnections.reset( new AudioConnectionMap() );
+  mAudioConnections->swap( adjustedAudioConnections );
+  mParameterConnections.reset( new ParameterConnectionMap( adjustedParameterConnections ) );
+
   visr::impl::TimeImplementation & timeImpl = mFlow.timeImplementation();
   timeImpl.resetCounter();
 }
 
 AudioSignalFlow::~AudioSignalFlow()
 {
+  // Stop the worker threads before any other member is destroyed.
+  mPipeline.reset();
 }
 
 std::size_t AudioSignalFlow::period() const
@@ -140,19 +168,42 @@ AudioSignalFlow::process( SampleType const * const * captureSamples,
                           std::size_t captureStrideSamples /*= 1*/,
                           std::size_t playbackStrideSamples /*= 1*/ )
 {
+  std::size_t const period = mFlow.period();
   // This assumes that all capture ports have the default sample type "SampleType"
-  for( std::size_t chIdx( 0 ); chIdx < numberOfCaptureChannels(); ++chIdx )
+  for( std::size_t portIdx( 0 ); portIdx < mCaptureBinding->numberOfPorts(); ++portIdx )
+  {
+    std::size_t const chOffset = mCaptureBinding->channelOffset( portIdx );
+    // The external capture buffers are only read by the bound ports, so casting away the constness is safe.
+    if( mExternalBufferBinding and mCaptureBinding->bind( portIdx,
+        const_cast<SampleType * const *>(captureSamples) + chOffset, captureStrideSamples ) )
+    {
+      continue;
+    }
+    for( std::size_t chIdx( chOffset ); chIdx < chOffset + mCaptureBinding->width( portIdx ); ++chIdx )
+    {
+      SampleType * chPtr = reinterpret_cast<SampleType*>(mCaptureChannels[chIdx]);
+      efl::ErrorCode const res = (captureStrideSamples == 1)
+       ? efl::vectorCopy( captureSamples[chIdx], chPtr, period, 0 )
+       : efl::vectorCopyStrided( captureSamples[chIdx], chPtr, captureStrideSamples,
+                                1 /*destination stride*/, period, 0);
+      if( res != efl::noError )
+      {
+        throw std::runtime_error( "AudioSignalFlow: Error while copying input samples samples." );
+      }
+    }
+  }
+  if( mExternalBufferBinding )
   {
-    SampleType * chPtr = reinterpret_cast<SampleType*>(mCaptureChannels[chIdx]);
-    efl::ErrorCode const res = (captureStrideSamples == 1)
-     ? efl::vectorCopy( captureSamples[chIdx], chPtr, mFlow.period(), 0 )
-     : efl::vectorCopyStrided( captureSamples[chIdx], chPtr, captureStrideSamples,
-                              1 /*destination stride*/, mFlow.period(), 0);
-    if( res != efl::noError )
+    for( std::size_t portIdx( 0 ); portIdx < mPlaybackBinding->numberOfPorts(); ++portIdx )
     {
-      throw std::runtime_error( "AudioSignalFlow: Error while copying input samples samples." );
+      mPlaybackBinding->bind( portIdx, playbackSamples + mPlaybackBinding->channelOffset( portIdx ),
+                              playbackStrideSamples, mCaptureBinding.get() );
     }
   }
+  if( mSilenceDetection )
+  {
+    detectCaptureSilence();
+  }
   try
   {
     executeComponents();
@@ -162,16 +213,24 @@ AudioSignalFlow::process( SampleType const * const * captureSamples,
     throw std::invalid_argument( detail::composeMessageString("Error during execution of processing schedule: ", ex.what()) );
   }
   // This assumes that all capture ports have the default sample type "SampleType"
-  for( std::size_t chIdx( 0 ); chIdx < numberOfPlaybackChannels(); ++chIdx )
+  for( std::size_t portIdx( 0 ); portIdx < mPlaybackBinding->numberOfPorts(); ++portIdx )
   {
-    SampleType const * chPtr = reinterpret_cast<SampleType const*>(mPlaybackChannels[chIdx]);
-    efl::ErrorCode const res = ( playbackStrideSamples == 1 )
-     ? efl::vectorCopy( chPtr, playbackSamples[chIdx], mFlow.period(), 0 )
-     : efl::vectorCopyStrided( chPtr, playbackSamples[chIdx], 1 /*source stride*/,
-                               playbackStrideSamples, mFlow.period(), 0);
-    if( res != efl::noError )
+    if( mExternalBufferBinding and mPlaybackBinding->bound( portIdx ) )
     {
-      throw std::runtime_error( "AudioSignalFlow: Error while copying output samples samples." );
+      continue;
+    }
+    std::size_t const chOffset = mPlaybackBinding->channelOffset( portIdx );
+    for( std::size_t chIdx( chOffset ); chIdx < chOffset + mPlaybackBinding->width( portIdx ); ++chIdx )
+    {
+      SampleType const * chPtr = reinterpret_cast<SampleType const*>(mPlaybackChannels[chIdx]);
+      efl::ErrorCode const res = ( playbackStrideSamples == 1 )
+       ? efl::vectorCopy( chPtr, playbackSamples[chIdx], period, 0 )
+       : efl::vectorCopyStrided( chPtr, playbackSamples[chIdx], 1 /*source stride*/,
+                                 playbackStrideSamples, period, 0);
+      if( res != efl::noError )
+      {
+        throw std::runtime_error( "AudioSignalFlow: Error while copying output samples samples." );
+      }
     }
   }
   // TODO: use a sophisticated enumeration to signal error conditions
@@ -185,17 +244,40 @@ void AudioSignalFlow::process( SampleType const * captureSamples,
                                std::size_t playbackChannelStride,
                                std::size_t playbackSampleStride )
 {
-  for( std::size_t chIdx( 0 ); chIdx < numberOfCaptureChannels(); ++chIdx )
+  for( std::size_t portIdx( 0 ); portIdx < mCaptureBinding->numberOfPorts(); ++portIdx )
   {
-    SampleType const * src = captureSamples + chIdx * captureChannelStride;
-    SampleType * dest = reinterpret_cast<SampleType*>(mCaptureChannels[chIdx]);
+    std::size_t const chOffset = mCaptureBinding->channelOffset( portIdx );
+    if( mExternalBufferBinding and mCaptureBinding->bind( portIdx,
+        const_cast<SampleType *>(captureSamples) + chOffset * captureChannelStride,
+        captureChannelStride, captureSampleStride ) )
+    {
+      continue;
+    }
+    for( std::size_t chIdx( chOffset ); chIdx < chOffset + mCaptureBinding->width( portIdx ); ++chIdx )
+    {
+      SampleType const * src = captureSamples + chIdx * captureChannelStride;
+      SampleType * dest = reinterpret_cast<SampleType*>(mCaptureChannels[chIdx]);
 
-    efl::ErrorCode const res = efl::vectorCopyStrided( src, dest, captureSampleStride, 1, mFlow.period(), 0 );
-    if( res != efl::noError )
+      efl::ErrorCode const res = efl::vectorCopyStrided( src, dest, captureSampleStride, 1, mFlow.period(), 0 );
+      if( res != efl::noError )
+      {
+        throw std::runtime_error( "AudioSignalFlow: Error while copying input samples samples." );
+      }
+    }
+  }
+  if( mExternalBufferBinding )
+  {
+    for( std::size_t portIdx( 0 ); portIdx < mPlaybackBinding->numberOfPorts(); ++portIdx )
     {
-      throw std::runtime_error( "AudioSignalFlow: Error while copying input samples samples." );
+      mPlaybackBinding->bind( portIdx,
+                              playbackSamples + mPlaybackBinding->channelOffset( portIdx ) * playbackChannelStride,
+                              playbackChannelStride, playbackSampleStride, mCaptureBinding.get() );
     }
   }
+  if( mSilenceDetection )
+  {
+    detectCaptureSilence();
+  }
   try
   {
     executeComponents();
@@ -205,51 +287,170 @@ void AudioSignalFlow::process( SampleType const * captureSamples,
     throw std::runtime_error( detail::composeMessageString( "Error during execution of processing schedule: ", ex.what() ) );
   }
   // This assumes that all capture ports have the default sample type "SampleType"
-  for( std::size_t chIdx( 0 ); chIdx < numberOfPlaybackChannels(); ++chIdx )
+  for( std::size_t portIdx( 0 ); portIdx < mPlaybackBinding->numberOfPorts(); ++portIdx )
   {
-    SampleType const * src = reinterpret_cast<SampleType const *>(mPlaybackChannels[chIdx]);
-    SampleType * dest = playbackSamples + chIdx * playbackChannelStride;
-    efl::ErrorCode const res = efl::vectorCopyStrided( src, dest, 1, playbackSampleStride, mFlow.period(), 0 );
-    if( res != efl::noError )
+    if( mExternalBufferBinding and mPlaybackBinding->bound( portIdx ) )
     {
-      throw std::runtime_error( "AudioSignalFlow: Error while copying output samples samples." );
+      continue;
     }
+    std::size_t const chOffset = mPlaybackBinding->channelOffset( portIdx );
+    for( std::size_t chIdx( chOffset ); chIdx < chOffset + mPlaybackBinding->width( portIdx ); ++chIdx )
+    {
+      SampleType const * src = reinterpret_cast<SampleType const *>(mPlaybackChannels[chIdx]);
+      SampleType * dest = playbackSamples + chIdx * playbackChannelStride;
+      efl::ErrorCode const res = efl::vectorCopyStrided( src, dest, 1, playbackSampleStride, mFlow.period(), 0 );
+      if( res != efl::noError )
+      {
+        throw std::runtime_error( "AudioSignalFlow: Error while copying output samples samples." );
+      }
+    }
+  }
+}
+
+void AudioSignalFlow::setExternalBufferBinding( bool enable )
+{
+  if( enable and mPipeline )
+  {
+    throw std::logic_error( "AudioSignalFlow::setExternalBufferBinding(): External buffers cannot be bound in pipelined execution mode." );
+  }
+  if( not enable )
+  {
+    mCaptureBinding->releaseAll();
+    mPlaybackBinding->releaseAll();
+  }
+  mExternalBufferBinding = enable;
+}
+
+bool AudioSignalFlow::externalBufferBindingEnabled() const
+{
+  return mExternalBufferBinding;
+}
+
+void AudioSignalFlow::setSilenceDetection( bool enable, SampleType threshold /*= 0.0*/ )
+{
+  if( threshold < static_cast<SampleType>(0.0) )
+  {
+    throw std::invalid_argument( "AudioSignalFlow::setSilenceDetection(): The threshold must not be negative." );
+  }
+  if( not enable )
+  {
+    for( impl::AudioPortBaseImplementation * port : mTopLevelAudioInputs )
+    {
+      for( std::size_t chIdx( 0 ); chIdx < port->width(); ++chIdx )
+      {
+        port->setSilent( chIdx, false );
+      }
+    }
+  }
+  mSilenceDetection = enable;
+  mSilenceThreshold = threshold;
+}
+
+bool AudioSignalFlow::silenceDetectionEnabled() const
+{
+  return mSilenceDetection;
+}
+
+void AudioSignalFlow::detectCaptureSilence()
+{
+  std::size_t const period = mFlow.period();
+  for( impl::AudioPortBaseImplementation * port : mTopLevelAudioInputs )
+  {
+    if( port->sampleType() != AudioSampleType::TypeToId<SampleType>::id )
+    {
+      continue;
+    }
+    for( std::size_t chIdx( 0 ); chIdx < port->width(); ++chIdx )
+    {
+      SampleType peak;
+      if( efl::vectorMaxMagnitude( static_cast<SampleType const *>(port->channelPointer( chIdx )), peak, period, 0 )
+          != efl::noError )
+      {
+        throw std::runtime_error( "AudioSignalFlow: Error while detecting silent capture signals." );
+      }
+      port->setSilent( chIdx, peak <= mSilenceThreshold );
+    }
+  }
+}
+
+std::size_t AudioSignalFlow::numberOfBoundExternalPorts() const
+{
+  std::size_t numBound = 0;
+  for( std::size_t portIdx( 0 ); portIdx < mCaptureBinding->numberOfPorts(); ++portIdx )
+  {
+    numBound += mCaptureBinding->bound( portIdx ) ? 1 : 0;
+  }
+  for( std::size_t portIdx( 0 ); portIdx < mPlaybackBinding->numberOfPorts(); ++portIdx )
+  {
+    numBound += mPlaybackBinding->bound( portIdx ) ? 1 : 0;
   }
+  return numBound;
 }
 
 void AudioSignalFlow::executeComponents()
 {
-  std::lock_guard<ParameterExchangeMutexType>
-    guard( parameterExchangeMutex() );
+  std::unique_lock<ParameterExchangeMutexType>
+    guard( parameterExchangeMutex(), std::defer_lock );
+  if( mParameterExchangeLocking )
+  {
+    guard.lock();
+  }
+  visr::impl::TimeImplementation & timeImpl = mFlow.timeImplementation();
+  std::size_t const blockIdx = timeImpl.blockCount();
   try
   {
+    for( auto & injectionQueue : mParameterInjectionQueues )
+    {
+      injectionQueue.second->deliver();
+    }
+    if( mPipeline )
+    {
+      mPipeline->execute();
+#ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
+      if( mRuntimeProfiler )
+      {
+        // Hardware counters are not measured for components executed in the pipeline threads.
+        mRuntimeProfiler->skipHardwareCounters();
+        mRuntimeProfiler->finishIteration();
+      }
+#endif
+    }
+    else
 #ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
     if( mRuntimeProfiler )
     {
       RuntimeProfiler::MeasurementVector & timing
        = mRuntimeProfiler->currentData();
-      std::size_t compIdx{ 0 };
-      for( AtomicComponent * pc : mProcessingSchedule )
+      for( std::size_t compIdx{ 0 }; compIdx < mProcessingSchedule.size(); ++compIdx )
       {
+        if( not scheduledInBlock( compIdx, blockIdx ) )
+        {
+          timing[ compIdx ] = static_cast<RuntimeProfiler::TimeType>( 0.0 );
+          mRuntimeProfiler->setHardwareCounters( compIdx, static_cast<RuntimeProfiler::TimeType>( 0.0 ) );
+          continue;
+        }
+        mRuntimeProfiler->startHardwareCounters();
         auto const startTime = std::chrono::high_resolution_clock::now();
-        pc->process();
+        mProcessingSchedule[ compIdx ]->process();
         auto const endTime = std::chrono::high_resolution_clock::now();
+        mRuntimeProfiler->stopHardwareCounters( compIdx );
         RuntimeProfiler::TimeType const elapsed
           = std::chrono::duration<RuntimeProfiler::TimeType>( endTime - startTime ).count();
         timing[ compIdx ] = elapsed;
-        ++compIdx;
       }
       mRuntimeProfiler->finishIteration();
     }
     else
 #endif
     {
-      for( AtomicComponent * pc : mProcessingSchedule )
+      for( std::size_t compIdx{ 0 }; compIdx < mProcessingSchedule.size(); ++compIdx )
       {
-        pc->process();
+        if( scheduledInBlock( compIdx, blockIdx ) )
+        {
+          mProcessingSchedule[ compIdx ]->process();
+        }
       }
     }
-    visr::impl::TimeImplementation & timeImpl = mFlow.timeImplementation();
     timeImpl.advanceBlockCounter();
   }
   catch( std::exception const & ex )
@@ -260,6 +461,306 @@ void AudioSignalFlow::executeComponents()
   }
 }
 
+void AudioSignalFlow::executeStage( std::size_t stageIdx )
+{
+  std::size_t const blockIdx = mFlow.timeImplementation().blockCount();
+#ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
+  // The stages write to disjoint elements of the timing data.
+  RuntimeProfiler::MeasurementVector * timing = mRuntimeProfiler ? &(mRuntimeProfiler->currentData()) : nullptr;
+#endif
+  for( std::size_t compIdx : mPipeline->stageSchedule( stageIdx ) )
+  {
+    if( not scheduledInBlock( compIdx, blockIdx ) )
+    {
+#ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
+      if( timing )
+      {
+        (*timing)[ compIdx ] = static_cast<RuntimeProfiler::TimeType>( 0.0 );
+      }
+#endif
+      continue;
+    }
+    mPipeline->prepareComponent( compIdx );
+#ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
+    if( timing )
+    {
+      auto const startTime = std::chrono::high_resolution_clock::now();
+      mProcessingSchedule[ compIdx ]->process();
+      auto const endTime = std::chrono::high_resolution_clock::now();
+      (*timing)[ compIdx ] = std::chrono::duration<RuntimeProfiler::TimeType>( endTime - startTime ).count();
+      continue;
+    }
+#endif
+    mProcessingSchedule[ compIdx ]->process();
+  }
+}
+
+void AudioSignalFlow::enablePipeline( std::size_t numberOfStages, int realtimePriority /*= 0*/, bool cpuAffinity /*= false*/ )
+{
+  if( numberOfStages == 0 )
+  {
+    throw std::invalid_argument( "AudioSignalFlow::enablePipeline(): The number of stages must be at least one." );
+  }
+  if( numberOfStages == 1 )
+  {
+    disablePipeline();
+    return;
+  }
+  std::size_t const numComponents = mProcessingSchedule.size();
+  if( numberOfStages > numComponents )
+  {
+    throw std::invalid_argument( "AudioSignalFlow::enablePipeline(): The number of stages exceeds the number of components." );
+  }
+  std::vector<double> costs( numComponents, 1.0 );
+#ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
+  if( mRuntimeProfiler and (mRuntimeProfiler->statisticsSamples() > 0) )
+  {
+    RuntimeProfiler::MeasurementVector means( numComponents, cVectorAlignmentSamples );
+    mRuntimeProfiler->getMean( means );
+    std::copy( means.data(), means.data() + numComponents, costs.begin() );
+  }
+#endif
+  std::map<impl::ComponentImplementation const *, std::size_t> scheduleIndices;
+  for( std::size_t compIdx( 0 ); compIdx < numComponents; ++compIdx )
+  {
+    scheduleIndices[&(mProcessingSchedule[compIdx]->implementation())] = compIdx;
+  }
+  // A new stage can start at schedule position idx only if no parameter connection spans this position.
+  std::vector<char> cutAllowed( numComponents + 1, 1 );
+  for( ParameterConnectionMap::value_type const & connection : *mParameterConnections )
+  {
+    auto const sendIt = scheduleIndices.find( &(connection.first->parent()) );
+    auto const receiveIt = scheduleIndices.find( &(connection.second->parent()) );
+    if( (sendIt == scheduleIndices.end()) or (receiveIt == scheduleIndices.end()) )
+    {
+      continue; // Top-level parameter ports do not constrain the stages.
+    }
+    std::size_t const first = std::min( sendIt->second, receiveIt->second );
+    std::size_t const last = std::max( sendIt->second, receiveIt->second );
+    std::fill( cutAllowed.begin() + first + 1, cutAllowed.begin() + last + 1, 0 );
+  }
+  // Partition the schedule into contiguous sections minimising the maximum cost of a section.
+  // maxCost[k][idx]: Minimum achievable maximum cost for the first idx components in k+1 stages.
+  double const infinity = std::numeric_limits<double>::infinity();
+  std::vector<double> prefixCost( numComponents + 1, 0.0 );
+  std::partial_sum( costs.begin(), costs.end(), prefixCost.begin() + 1 );
+  std::vector<std::vector<double> > maxCost( numberOfStages, std::vector<double>( numComponents + 1, infinity ) );
+  std::vector<std::vector<std::size_t> > stageStart( numberOfStages, std::vector<std::size_t>( numComponents + 1, 0 ) );
+  for( std::size_t idx( 1 ); idx <= numComponents; ++idx )
+  {
+    maxCost[0][idx] = prefixCost[idx];
+  }
+  for( std::size_t stageIdx( 1 ); stageIdx < numberOfStages; ++stageIdx )
+  {
+    for( std::size_t idx( stageIdx + 1 ); idx <= numComponents; ++idx )
+    {
+      if( not cutAllowed[idx] and (idx != numComponents) )
+      {
+        continue;
+      }
+      for( std::size_t start( stageIdx ); start < idx; ++start )
+      {
+        if( not cutAllowed[start] )
+        {
+          continue;
+        }
+        double const cost = std::max( maxCost[stageIdx - 1][start], prefixCost[idx] - prefixCost[start] );
+        if( cost < maxCost[stageIdx][idx] )
+        {
+          maxCost[stageIdx][idx] = cost;
+          stageStart[stageIdx][idx] = start;
+        }
+      }
+    }
+  }
+  if( maxCost[numberOfStages - 1][numComponents] == infinity )
+  {
+    throw std::invalid_argument( detail::composeMessageString( "AudioSignalFlow::enablePipeline(): The flow cannot be divided into ",
+      numberOfStages, " stages without cutting parameter connections." ) );
+  }
+  std::vector<std::size_t> componentStages( numComponents );
+  std::size_t end = numComponents;
+  for( std::size_t stageIdx( numberOfStages ); stageIdx-- > 0; )
+  {
+    std::size_t const start = stageIdx == 0 ? 0 : stageStart[stageIdx][end];
+    std::fill( componentStages.begin() + start, componentStages.begin() + end, stageIdx );
+    end = start;
+  }
+  initialisePipeline( componentStages, realtimePriority, cpuAffinity );
+}
+
+void AudioSignalFlow::enablePipeline( std::map< std::string, std::size_t > const & stageAssignments,
+                                      int realtimePriority /*= 0*/, bool cpuAffinity /*= false*/ )
+{
+  std::size_t const numComponents = mProcessingSchedule.size();
+  std::map<std::string, std::size_t> nameIndices;
+  std::map<impl::ComponentImplementation const *, std::size_t> scheduleIndices;
+  for( std::size_t compIdx( 0 ); compIdx < numComponents; ++compIdx )
+  {
+    nameIndices[mProcessingSchedule[compIdx]->implementation().fullName()] = compIdx;
+    scheduleIndices[&(mProcessingSchedule[compIdx]->implementation())] = compIdx;
+  }
+  std::vector<std::size_t> explicitStages( numComponents, std::numeric_limits<std::size_t>::max() );
+  for( auto const & assignment : stageAssignments )
+  {
+    auto const findIt = nameIndices.find( assignment.first );
+    if( findIt == nameIndices.end() )
+    {
+      throw std::invalid_argument( detail::composeMessageString( "AudioSignalFlow::enablePipeline(): The flow contains no atomic component named \"",
+        assignment.first, "\"." ) );
+    }
+    explicitStages[findIt->second] = assignment.second;
+  }
+  // Predecessors of each component within the schedule.
+  std::vector<std::vector<std::size_t> > predecessors( numComponents );
+  auto const addDependency = [&]( impl::ComponentImplementation const & sender, impl::ComponentImplementation const & receiver )
+  {
+    auto const sendIt = scheduleIndices.find( &sender );
+    auto const receiveIt = scheduleIndices.find( &receiver );
+    if( (sendIt != scheduleIndices.end()) and (receiveIt != scheduleIndices.end()) and (sendIt->second < receiveIt->second) )
+    {
+      predecessors[receiveIt->second].push_back( sendIt->second );
+    }
+  };
+  for( AudioConnectionMap::value_type const & connection : *mAudioConnections )
+  {
+    addDependency( connection.first.port()->parent(), connection.second.port()->parent() );
+  }
+  for( ParameterConnectionMap::value_type const & connection : *mParameterConnections )
+  {
+    addDependency( connection.first->parent(), connection.second->parent() );
+  }
+  std::vector<std::size_t> componentStages( numComponents, 0 );
+  for( std::size_t compIdx( 0 ); compIdx < numComponents; ++compIdx )
+  {
+    std::size_t inferredStage = 0;
+    for( std::size_t predIdx : predecessors[compIdx] )
+    {
+      inferredStage = std::max( inferredStage, componentStages[predIdx] );
+    }
+    if( explicitStages[compIdx] == std::numeric_limits<std::size_t>::max() )
+    {
+      componentStages[compIdx] = inferredStage;
+    }
+    else if( explicitStages[compIdx] < inferredStage )
+    {
+      throw std::invalid_argument( detail::composeMessageString( "AudioSignalFlow::enablePipeline(): Component \"",
+        mProcessingSchedule[compIdx]->implementation().fullName(), "\" is assigned to stage ", explicitStages[compIdx],
+        ", but receives inputs from stage ", inferredStage, "." ) );
+    }
+    else
+    {
+      componentStages[compIdx] = explicitStages[compIdx];
+    }
+  }
+  std::size_t const numStages = numComponents == 0 ? 1
+    : *std::max_element( componentStages.begin(), componentStages.end() ) + 1;
+  for( std::size_t stageIdx( 0 ); stageIdx < numStages; ++stageIdx )
+  {
+    if( std::find( componentStages.begin(), componentStages.end(), stageIdx ) == componentStages.end() )
+    {
+      throw std::invalid_argument( detail::composeMessageString( "AudioSignalFlow::enablePipeline(): Stage ", stageIdx,
+        " does not contain any components." ) );
+    }
+  }
+  if( numStages == 1 )
+  {
+    disablePipeline();
+    return;
+  }
+  initialisePipeline( componentStages, realtimePriority, cpuAffinity );
+}
+
+void AudioSignalFlow::initialisePipeline( std::vector< std::size_t > const & componentStages,
+                                          int realtimePriority, bool cpuAffinity )
+{
+#ifdef VISR_DISABLE_THREADS
+  throw std::logic_error( "AudioSignalFlow: Pipelined execution is not supported because threads are disabled." );
+#endif
+  if( not mFlow.isComposite() )
+  {
+    throw std::logic_error( "AudioSignalFlow: Pipelined execution requires a composite signal flow." );
+  }
+  if( mBufferAllocation != BufferAllocation::Dedicated )
+  {
+    throw std::logic_error( "AudioSignalFlow: Pipelined execution requires the buffer allocation strategy BufferAllocation::Dedicated." );
+  }
+  if( mExternalBufferBinding )
+  {
+    throw std::logic_error( "AudioSignalFlow: Pipelined execution cannot be used together with the binding of external buffers." );
+  }
+  std::map<impl::ComponentImplementation const *, std::size_t> scheduleIndices;
+  for( std::size_t compIdx( 0 ); compIdx < mProcessingSchedule.size(); ++compIdx )
+  {
+    scheduleIndices[&(mProcessingSchedule[compIdx]->implementation())] = compIdx;
+  }
+  std::stringstream messages;
+  for( ParameterConnectionMap::value_type const & connection : *mParameterConnections )
+  {
+    auto const sendIt = scheduleIndices.find( &(connection.first->parent()) );
+    auto const receiveIt = scheduleIndices.find( &(connection.second->parent()) );
+    if( (sendIt != scheduleIndices.end()) and (receiveIt != scheduleIndices.end())
+      and (componentStages[sendIt->second] != componentStages[receiveIt->second]) )
+    {
+      messages << "Parameter connection " << fullyQualifiedName( *(connection.first) ) << " -> "
+               << fullyQualifiedName( *(connection.second) ) << " crosses a stage boundary.\n";
+    }
+  }
+  for( AudioConnectionMap::value_type const & connection : *mAudioConnections )
+  {
+    auto const sendIt = scheduleIndices.find( &(connection.first.port()->parent()) );
+    auto const receiveIt = scheduleIndices.find( &(connection.second.port()->parent()) );
+    if( (sendIt != scheduleIndices.end()) and (receiveIt != scheduleIndices.end())
+      and (componentStages[sendIt->second] > componentStages[receiveIt->second]) )
+    {
+      messages << "Audio connection " << connection.first << " -> " << connection.second
+               << " leads to an earlier stage.\n";
+    }
+  }
+  if( not messages.str().empty() )
+  {
+    throw std::invalid_argument( detail::composeMessageString( "AudioSignalFlow: Invalid assignment of pipeline stages: ",
+                                                               messages.str() ) );
+  }
+  disablePipeline();
+  mPipeline.reset( new PipelineExecutor( mProcessingSchedule, componentStages, *mAudioConnections, mFlow.period(),
+                                         [this]( std::size_t stageIdx ) { executeStage( stageIdx ); },
+                                         realtimePriority, cpuAffinity ) );
+  updateExternalChannelPointers();
+}
+
+void AudioSignalFlow::disablePipeline()
+{
+  if( mPipeline )
+  {
+    mPipeline->restorePorts();
+    mPipeline.reset();
+    updateExternalChannelPointers();
+  }
+}
+
+std::size_t AudioSignalFlow::numberOfPipelineStages() const
+{
+  return mPipeline ? mPipeline->numberOfStages() : 1;
+}
+
+std::map< std::string, std::size_t > AudioSignalFlow::pipelineStageAssignment() const
+{
+  std::map< std::string, std::size_t > assignment;
+  for( std::size_t stageIdx( 0 ); stageIdx < numberOfPipelineStages(); ++stageIdx )
+  {
+    for( std::size_t compIdx( 0 ); compIdx < mProcessingSchedule.size(); ++compIdx )
+    {
+      if( (not mPipeline) or std::binary_search( mPipeline->stageSchedule( stageIdx ).begin(),
+                                                 mPipeline->stageSchedule( stageIdx ).end(), compIdx ) )
+      {
+        assignment[ mProcessingSchedule[compIdx]->implementation().fullName() ] = stageIdx;
+      }
+    }
+  }
+  return assignment;
+}
+
 std::size_t AudioSignalFlow::numberOfAudioCapturePorts() const
 {
   return mTopLevelAudioInputs.size();
@@ -597,6 +1098,27 @@ bool AudioSignalFlow::initialiseSchedule( std::ostream & messages,
     auto const schedule = depGraph.sequentialSchedule();
     mProcessingSchedule.assign( schedule.begin(), schedule.end() );
   }
+  mExecutionRates.clear();
+  // Components with an automatic phase are assigned consecutive phases in schedule order, such that components with
+  // the same interval are distributed evenly over the blocks.
+  std::size_t automaticPhaseCounter = 0;
+  for( AtomicComponent const * atom : mProcessingSchedule )
+  {
+    std::size_t const interval = atom->executionInterval();
+    std::size_t phase = 0;
+    if( interval > 1 )
+    {
+      if( not atom->implementation().audioPorts().empty() )
+      {
+        messages << "Atomic component \"" << atom->implementation().fullName()
+                 << "\" has audio ports and therefore cannot have an execution interval larger than one.\n";
+        result = false;
+      }
+      phase = atom->executionPhase() == AtomicComponent::cAutomaticPhase
+        ? (automaticPhaseCounter++) % interval : atom->executionPhase();
+    }
+    mExecutionRates.push_back( std::make_pair( interval, phase ) );
+  }
   return result;
 }
 
@@ -616,6 +1138,8 @@ using ChannelVector = std::vector<AudioChannel>;
 
 using PortOffsetLookup = std::map<impl::AudioPortBaseImplementation *, std::size_t>;
 
+using GatherPortLookup = std::map<impl::AudioPortBaseImplementation *, std::vector<std::size_t> >;
+
 /**
  * Check whether a connection list is contiguous, i.e., refers to a contiguous index range of send channels according to the offset table
  * \p offsetTable
@@ -738,14 +1262,19 @@ bool AudioSignalFlow::initialiseAudioConnections( std::ostream & messages, Audio
   std::size_t const alignment = cVectorAlignmentBytes; // Maybe replace by a function that returns the current alignment setting.
   std::size_t const blockSize = mFlow.period();
   std::size_t totalAudioPoolSize = 0;
+  mGatheredPorts.clear();
 
   std::map<AudioSampleType::Id, PortOffsetLookup> allSendPortOffsets;
   std::map<AudioSampleType::Id, PortOffsetLookup> allReceivePortOffsets;
+  // Receive ports referencing non-contiguous channels directly (without routing components), together with
+  // the pool channel indices of their channels.
+  std::map<AudioSampleType::Id, GatherPortLookup> allGatherPorts;
 
   for( AudioSampleType::Id sampleTypeId : usedSampleTypes )
   {
     PortOffsetLookup sendOffsets;
     PortOffsetLookup receiveOffsets;
+    GatherPortLookup gatherPorts;
     std::size_t sendPortOffset = 0;
 
     if( mFlow.isComposite() ) // Atomic, non-composite top-level components receive special treatment (below).
@@ -798,6 +1327,25 @@ bool AudioSignalFlow::initialiseAudioConnections( std::ostream & messages, Audio
           receiveOffsets.insert( std::make_pair( receivePort, receivePortOffset ) );
           tmpConnections.insert( localConnections.begin(), localConnections.end() );
         }
+        else if( receivePort->channelPointerAccess() and not isToplevelPort( receivePort ) )
+        {
+          // The receiving component accesses the port through channel pointers only, so the channels can be
+          // referenced at their locations in the pool instead of copying them into a contiguous range.
+          std::size_t const receiveWidth = receivePort->width();
+          std::vector<std::size_t> sendIndices( receiveWidth );
+          for( std::size_t idx( 0 ); idx < receiveWidth; ++idx )
+          {
+            auto const offsetIt = sendOffsets.find( sends[idx].port() );
+            if( offsetIt == sendOffsets.end() )
+            {
+              throw std::logic_error( "AudioSignalFlow::initialiseAudio(): Internal logic error"
+                  "Send port not found in offset table." );
+            }
+            sendIndices[idx] = offsetIt->second + sends[idx].channel();
+          }
+          gatherPorts.insert( std::make_pair( receivePort, std::move( sendIndices ) ) );
+          tmpConnections.insert( localConnections.begin(), localConnections.end() );
+        }
         else
         {
           std::size_t const receiveWidth = receivePort->width();
@@ -911,12 +1459,16 @@ bool AudioSignalFlow::initialiseAudioConnections( std::ostream & messages, Audio
     }
     allSendPortOffsets.insert( std::make_pair( sampleTypeId, std::move( sendOffsets ) ) );
     allReceivePortOffsets.insert( std::make_pair( sampleTypeId, std::move( receiveOffsets ) ) );
+    allGatherPorts.insert( std::make_pair( sampleTypeId, std::move( gatherPorts ) ) );
 
     std::size_t const typedPoolSize = sendPortOffset * efl::nextAlignedSize( blockSize*AudioSampleType::typeSize( sampleTypeId ), alignment );
     totalAudioPoolSize += typedPoolSize;
   }
   mAudioSignalPool.reset( new AudioSignalPool( totalAudioPoolSize, alignment ) );
 
+  // Channel offsets of all ports of the standard sample type, used for binding external buffers.
+  std::vector<ExternalBufferBinding::PortOffset> standardTypePortOffsets;
+
   // Second run: Do the actual buffer assignment (for contiguous input and output ranges)
   std::size_t poolOffsetBytes = 0;
   for( AudioSampleType::Id sampleTypeId : usedSampleTypes )
@@ -933,6 +1485,11 @@ bool AudioSignalFlow::initialiseAudioConnections( std::ostream & messages, Audio
 
     PortOffsetLookup const sendOffsets = allSendPortOffsets[sampleTypeId] ;
     PortOffsetLookup const receiveOffsets = allReceivePortOffsets[sampleTypeId];
+    if( sampleTypeId == AudioSampleType::TypeToId<SampleType>::id )
+    {
+      standardTypePortOffsets.assign( sendOffsets.begin(), sendOffsets.end() );
+      standardTypePortOffsets.insert( standardTypePortOffsets.end(), receiveOffsets.begin(), receiveOffsets.end() );
+    }
 
     for( auto const sendEntry : sendOffsets )
     {
@@ -966,6 +1523,19 @@ bool AudioSignalFlow::initialiseAudioConnections( std::ostream & messages, Audio
       std::size_t finalByteOffset = typeOffset + channelSizeBytes * channelOffset;
       receiveEntry.first->setBufferConfig( mAudioSignalPool->basePointer() + finalByteOffset, channelSizeSamples );
     }
+
+    for( auto const & gatherEntry : allGatherPorts[sampleTypeId] )
+    {
+      std::vector<void*> channelPointers( gatherEntry.second.size() );
+      std::transform( gatherEntry.second.begin(), gatherEntry.second.end(), channelPointers.begin(),
+        [this, typeOffset, channelSizeBytes]( std::size_t channelIdx )
+        { return static_cast<void*>( mAudioSignalPool->basePointer() + typeOffset + channelSizeBytes * channelIdx ); } );
+      gatherEntry.first->setGatherConfig( channelPointers, channelSizeSamples );
+      if( sampleTypeId == AudioSampleType::TypeToId<SampleType>::id )
+      {
+        mGatheredPorts.push_back( gatherEntry.first );
+      }
+    }
   }
   if( poolOffsetBytes != totalAudioPoolSize )
   {
@@ -981,36 +1551,100 @@ bool AudioSignalFlow::initialiseAudioConnections( std::ostream & messages, Audio
   std::copy_if( mFlow.audioPorts().begin(), mFlow.audioPorts().end(), std::back_inserter(mTopLevelAudioOutputs),
                   []( impl::AudioPortBaseImplementation const * port ){ return port->direction() == PortBase::Direction::Output; } );
 
+  initialiseExternalChannels( standardTypePortOffsets );
+
+  // Let the receive ports report the silence flags set by the producers of the connected signals.
+  for( AudioConnectionMap::value_type const & connection : tmpConnections )
+  {
+    connection.second.port()->setSilentFlagSource( connection.second.channel(),
+      connection.first.port()->silentFlag( connection.first.channel() ) );
+  }
+
+  finalConnections.swap( tmpConnections );
+  return true;
+}
+
+void AudioSignalFlow::initialiseExternalChannels(
+  std::vector<std::pair<impl::AudioPortBaseImplementation *, std::size_t> > const & standardTypePortOffsets )
+{
   // Not sure whether we want to keep that or whether the process() stage should access the top-level input and output ports directly.
   // The code below fails if there are audio ports with types differing from the standard type.
   // Also, if there is more than one in- or output, the ordering is undefined.
+  updateExternalChannelPointers();
+  mCaptureBinding.reset( new ExternalBufferBinding( mTopLevelAudioInputs, standardTypePortOffsets, mGatheredPorts,
+                                                    mFlow.period() ) );
+  mPlaybackBinding.reset( new ExternalBufferBinding( mTopLevelAudioOutputs, standardTypePortOffsets, mGatheredPorts,
+                                                     mFlow.period() ) );
+}
+
+void AudioSignalFlow::updateExternalChannelPointers()
+{
   mCaptureChannels.clear();
   mPlaybackChannels.clear();
-  std::size_t externalCaptureChannelIdx = 0;
   for( impl::AudioPortBaseImplementation * port : mTopLevelAudioInputs )
   {
     char * basePointer = static_cast<char*>(port->basePointer());
     std::size_t const width = port->width();
     std::size_t const stride = port->channelStrideBytes();
-    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx, ++externalCaptureChannelIdx )
+    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
     {
       mCaptureChannels.push_back( basePointer + chIdx * stride );
     }
   }
-  std::size_t externalPlaybackChannelIdx = 0;
   for( impl::AudioPortBaseImplementation * port : mTopLevelAudioOutputs )
   {
     char * basePointer = static_cast<char*>(port->basePointer());
     std::size_t const width = port->width();
     std::size_t const stride = port->channelStrideBytes();
-    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx, ++externalPlaybackChannelIdx )
+    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
     {
       mPlaybackChannels.push_back( basePointer + chIdx * stride );
     }
   }
+}
 
-  finalConnections.swap( tmpConnections );
-  return true;
+void AudioSignalFlow::reassignAudioBuffersByLiveness()
+{
+  std::vector<impl::AudioPortBaseImplementation *> const topLevelPorts( mFlow.audioPorts().begin(), mFlow.audioPorts().end() );
+  std::vector<AudioBufferAssignment> assignments;
+  std::size_t const poolSize = computeLivenessBufferLayout( mProcessingSchedule, topLevelPorts,
+                                                            mAudioSignalPool->basePointer(), assignments );
+  std::unique_ptr<AudioSignalPool> newPool( new AudioSignalPool( poolSize, cVectorAlignmentBytes ) );
+  std::size_t standardTypeRegionStart = poolSize;
+  for( AudioBufferAssignment const & assignment : assignments )
+  {
+    if( assignment.channel != AudioBufferAssignment::cWholePort )
+    {
+      assignment.port->setChannelPointer( assignment.channel, newPool->basePointer() + assignment.byteOffset );
+    }
+    else
+    {
+      assignment.port->setBufferConfig( newPool->basePointer() + assignment.byteOffset,
+                                        assignment.port->channelStrideSamples() );
+    }
+    if( assignment.port->sampleType() == AudioSampleType::TypeToId<SampleType>::id )
+    {
+      standardTypeRegionStart = std::min( standardTypeRegionStart, assignment.byteOffset );
+    }
+  }
+  mAudioSignalPool.swap( newPool );
+
+  std::vector<ExternalBufferBinding::PortOffset> standardTypePortOffsets;
+  for( AudioBufferAssignment const & assignment : assignments )
+  {
+    if( (assignment.port->sampleType() == AudioSampleType::TypeToId<SampleType>::id)
+      and (assignment.channel == AudioBufferAssignment::cWholePort) )
+    {
+      standardTypePortOffsets.push_back( std::make_pair( assignment.port,
+        (assignment.byteOffset - standardTypeRegionStart) / assignment.port->channelStrideBytes() ) );
+    }
+  }
+  initialiseExternalChannels( standardTypePortOffsets );
+}
+
+std::size_t AudioSignalFlow::audioSignalPoolSize() const
+{
+  return mAudioSignalPool->size();
 }
 
 AudioSignalFlow::ParameterExchangeMutexType &
@@ -1019,6 +1653,50 @@ AudioSignalFlow::parameterExchangeMutex() const
   return *mParameterExchangeMutex;
 }
 
+void AudioSignalFlow::setParameterExchangeLocking( bool enable )
+{
+  mParameterExchangeLocking = enable;
+}
+
+bool AudioSignalFlow::parameterExchangeLocking() const
+{
+  return mParameterExchangeLocking;
+}
+
+constexpr std::size_t AudioSignalFlow::cParameterInjectionQueueLength;
+
+bool AudioSignalFlow::injectParameter( char const * portName,
+                                       std::unique_ptr< ParameterBase > && value )
+{
+  auto const findIt = mParameterInjectionQueues.find( std::string( portName ) );
+  if( findIt == mParameterInjectionQueues.end() )
+  {
+    if( mProtocolReceiveEndpoints.find( std::string( portName ) ) == mProtocolReceiveEndpoints.end() )
+    {
+      throw std::out_of_range( detail::composeMessageString( "External receive port named \"", portName , "\" does not exist." ) );
+    }
+    throw std::invalid_argument( detail::composeMessageString( "AudioSignalFlow::injectParameter(): The protocol of the external receive port \"",
+                                                               portName, "\" does not support parameter injection." ) );
+  }
+  if( not value )
+  {
+    throw std::invalid_argument( "AudioSignalFlow::injectParameter(): The parameter value must not be empty." );
+  }
+  CommunicationProtocolBase const * protocol = mProtocolReceiveEndpoints.at( findIt->first )->getProtocol();
+  if( value->type() != protocol->parameterType() )
+  {
+    throw std::invalid_argument( detail::composeMessageString( "AudioSignalFlow::injectParameter(): The parameter type does not match the type of the external receive port \"",
+                                                               portName, "\"." ) );
+  }
+  return findIt->second->push( value );
+}
+
+bool AudioSignalFlow::injectParameter( char const * portName, ParameterBase const & value )
+{
+  std::unique_ptr< ParameterBase > copy( value.clone() );
+  return injectParameter( portName, std::move( copy ) );
+}
+
 #ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
 visr::rrl::RuntimeProfiler const &
 AudioSignalFlow::runtimeProfiler()  const
@@ -1045,10 +1723,11 @@ bool AudioSignalFlow::runtimeProfilingEnabled() const
   return mRuntimeProfiler != nullptr;
 }
 
-bool AudioSignalFlow::enableRuntimeProfiling( std::size_t measurementBufferSize )
+bool AudioSignalFlow::enableRuntimeProfiling( std::size_t measurementBufferSize,
+                                              bool hardwareCounters /*= false*/ )
 {
   bool const previous = runtimeProfilingEnabled();
-  mRuntimeProfiler.reset( new RuntimeProfiler( *this, measurementBufferSize ) );
+  mRuntimeProfiler.reset( new RuntimeProfiler( *this, measurementBufferSize, hardwareCounters ) );
   return previous;
 }
 
@@ -19,13 +19,16 @@
 #include <memory>
 #include <set>
 #include <stdexcept>
+#include <string>
 #include <mutex>
+#include <utility>
 #include <vector>
 
 namespace visr
 {
 // Forward declarations
 class AtomicComponent;
+class ParameterBase;
 class ParameterPortBase;
 
 namespace impl
@@ -39,7 +42,10 @@ namespace rrl
 // Forward declarations
 class AudioSignalPool;
 class AudioConnectionMap;
+class ExternalBufferBinding;
 class ParameterConnectionMap;
+class ParameterInjectionQueue;
+class PipelineExecutor;
 #ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
 class RuntimeProfiler;
 #endif
@@ -60,12 +66,26 @@ public:
       std::size_t; // TODO: Check whether to introduce a consistently used type
                    // alias for indices
 
+  /**
+   * Strategy for assigning memory within the audio signal pool to the audio signals of the flow.
+   */
+  enum class BufferAllocation
+  {
+    Dedicated, /**< Each send port receives its own memory region (default). */
+    Liveness   /**< Signals whose lifetimes within the sequential schedule do not overlap share the same memory,
+                    and outputs declared as in-place capable reuse their input buffers. This reduces the memory
+                    footprint of the audio signals. It requires that components write all samples of their outputs
+                    in every process() call and do not rely on the contents of their output buffers from previous blocks. */
+  };
+
   /**
    * Constructor.
    * @param flow The component (composite or atomic) containing the processing
    * functionality.
+   * @param bufferAllocation The strategy for allocating memory to the audio signals.
    */
-  explicit AudioSignalFlow( Component & flow );
+  explicit AudioSignalFlow( Component & flow,
+                            BufferAllocation bufferAllocation = BufferAllocation::Dedicated );
 
   /**
    * Destructor.
@@ -139,6 +159,142 @@ public:
                                SampleType * const * playbackSamples,
                                bool & status );
 
+  /**
+   * Support for binding external sample buffers directly to the top-level audio ports.
+   * If enabled, the process() functions try to use the capture and playback buffers passed by the caller
+   * directly as the buffers of the external audio ports (and all ports sharing these buffers), instead of
+   * copying the samples from and to the internal audio signal pool.
+   * A port is bound only if the external buffers of all its channels are aligned to visr::cVectorAlignmentBytes,
+   * have contiguous samples, and are separated by a constant channel stride that is a multiple of the alignment and
+   * not smaller than the period. Otherwise, and for ports whose pool region is shared with other
+   * top-level ports or is only partially used by other ports, the samples are copied as before.
+   * The decision is made anew in each process() call, so buffers that change between callbacks are supported.
+   * The default is disabled.
+   */
+  //@{
+  /**
+   * Enable or disable the binding of external buffers.
+   * Disabling resets all ports to their buffers in the audio signal pool.
+   * @note Must not be called concurrently with process().
+   */
+  void setExternalBufferBinding( bool enable );
+
+  /**
+   * Query whether the binding of external buffers is enabled.
+   */
+  bool externalBufferBindingEnabled() const;
+
+  /**
+   * Return the number of top-level capture and playback ports that were bound to external buffers in the
+   * most recent process() call.
+   * Mainly intended for diagnostic purposes.
+   */
+  std::size_t numberOfBoundExternalPorts() const;
+  //@}
+
+  /**
+   * Detection of silent capture signals.
+   * If enabled, the process() functions mark each channel of the top-level capture ports as silent (see
+   * AudioPortBase::silent()) if no sample of the current block exceeds a threshold in magnitude. Components
+   * supporting silence flags can use this information to skip processing.
+   * The default is disabled, i.e., capture channels are never marked as silent.
+   */
+  //@{
+  /**
+   * Enable or disable the silence detection for the capture signals.
+   * @param enable The new state of the silence detection. Disabling resets the silence flags of all capture channels.
+   * @param threshold The magnitude up to which a sample is considered silent. The default value 0 marks only blocks of
+   * exact zeros as silent.
+   * @throw std::invalid_argument If \p threshold is negative.
+   * @note Must not be called concurrently with process().
+   */
+  void setSilenceDetection( bool enable, SampleType threshold = static_cast<SampleType>(0.0) );
+
+  /**
+   * Query whether the silence detection for capture signals is enabled.
+   */
+  bool silenceDetectionEnabled() const;
+  //@}
+
+  /**
+   * Pipelined execution.
+   * If enabled, the atomic components are divided into stages that are executed concurrently on different threads,
+   * each stage processing a different block: In each process() call, stage \p k processes the signals of the block
+   * that entered the flow \p k calls earlier. Audio signals crossing stage boundaries are passed through delay
+   * buffers, such that producer and consumer never access the same memory concurrently. Consequently, the output
+   * of the flow is delayed by numberOfPipelineStages()-1 blocks compared to sequential execution, and the outputs are
+   * zero during the first blocks. In exchange, the computational load of a block is distributed over several cores.
+   * Restrictions:
+   * - The flow must be a composite component and use BufferAllocation::Dedicated.
+   * - Parameter connections between atomic components must not cross stage boundaries, because the protocols are
+   *   not synchronised between threads. Top-level parameter ports can be connected to any stage.
+   * - The binding of external buffers cannot be used together with pipelined execution.
+   * - The time() of a component refers to the current process() call, not to the delayed block.
+   * The components of a stage are executed in the order of the sequential schedule.
+   * Stage 0 runs in the thread calling process(), the other stages in dedicated worker threads. For realtime
+   * operation, the workers should run with the realtime priority of the audio callback and, to give each stage its
+   * own core, with a fixed CPU affinity (parameters \p realtimePriority and \p cpuAffinity of enablePipeline()).
+   * If these settings fail, e.g., due to missing privileges, a warning is printed and the workers run unchanged.
+   */
+  //@{
+  /**
+   * Enable pipelined execution with an automatically balanced assignment of components to stages.
+   * The sequential schedule is divided into \p numberOfStages contiguous sections with minimal maximum cost, without
+   * cutting parameter connections. The cost of a component is its mean execution time if runtime profiling is enabled
+   * and statistics are available, and one otherwise.
+   * @param numberOfStages The number of pipeline stages. A value of one disables the pipelined execution.
+   * @param realtimePriority If nonzero, the worker threads are run with the SCHED_FIFO policy and this priority.
+   * @param cpuAffinity If true, the worker thread of stage \p k is bound to the CPU core \p k (modulo the number of
+   * cores). Supported on Linux only.
+   * @throw std::invalid_argument If \p numberOfStages is zero or if the flow cannot be divided into the requested
+   * number of stages.
+   * @throw std::logic_error If the flow does not fulfil the requirements for pipelined execution.
+   * @note Must not be called concurrently with process().
+   */
+  void enablePipeline( std::size_t numberOfStages, int realtimePriority = 0, bool cpuAffinity = false );
+
+  /**
+   * Enable pipelined execution with a user-defined assignment of components to stages.
+   * Components not contained in \p stageAssignments are assigned to the latest stage of the atomic components
+   * they receive audio signals or parameters from, or to stage zero if there are no such components. That is, it
+   * suffices to name the first components of each stage.
+   * @param stageAssignments Map from the full names of atomic components to their stage indices.
+   * @param realtimePriority If nonzero, the worker threads are run with the SCHED_FIFO policy and this priority.
+   * @param cpuAffinity If true, the worker thread of stage \p k is bound to the CPU core \p k (modulo the number of
+   * cores). Supported on Linux only.
+   * @throw std::invalid_argument If a component name does not exist, if a component would be executed in an earlier
+   * stage than one of its inputs, if a parameter connection crosses a stage boundary, or if a stage is empty.
+   * @throw std::logic_error If the flow does not fulfil the requirements for pipelined execution.
+   * @note Must not be called concurrently with process().
+   */
+  void enablePipeline( std::map< std::string, std::size_t > const & stageAssignments,
+                       int realtimePriority = 0, bool cpuAffinity = false );
+
+  /**
+   * Return to sequential execution.
+   * @note Must not be called concurrently with process().
+   */
+  void disablePipeline();
+
+  /**
+   * Return the number of pipeline stages, 1 if pipelined execution is disabled.
+   * The additional latency of the flow is numberOfPipelineStages()-1 blocks.
+   */
+  std::size_t numberOfPipelineStages() const;
+
+  /**
+   * Return the stage of each atomic component, indexed by the full component names.
+   * Mainly intended for diagnostic purposes.
+   */
+  std::map< std::string, std::size_t > pipelineStageAssignment() const;
+  //@}
+
+  /**
+   * Return the total size of the memory used for the internal audio signals, in bytes.
+   * Mainly intended for diagnostic purposes, e.g., to assess the effect of the buffer allocation strategy.
+   */
+  std::size_t audioSignalPoolSize() const;
+
   /**
    * Return the number of samples processed in each process() function
    * @note At the moment this is required by the Python binding.
@@ -317,6 +473,58 @@ public:
    */
   ParameterExchangeMutexType & parameterExchangeMutex()
       const;
+
+  /**
+   * Enable or disable the locking of parameterExchangeMutex() by the audio thread in each process() call.
+   * Enabled by default. Flows whose external parameters are passed exclusively via injectParameter() can disable
+   * the locking, so that the audio thread never waits for other threads.
+   * In this case, the external parameter ports and the statistics of the runtime profiler must not be accessed
+   * directly while the flow is running, because these accesses are not synchronised with the audio thread anymore.
+   * @note Must not be called concurrently with process().
+   */
+  void setParameterExchangeLocking( bool enable );
+
+  /**
+   * Query whether the audio thread locks parameterExchangeMutex() in each process() call.
+   */
+  bool parameterExchangeLocking() const;
+  //@}
+
+  /**
+   * Lock-free passing of parameters to the top-level parameter inputs.
+   * Injected parameters are queued without locking and forwarded to the
+   * respective port at the start of the next process() call, with the same
+   * effect as setting them through the protocol interface of
+   * externalParameterReceivePort(). The functions can be called from any
+   * thread, concurrently with process().
+   * Supported for the standard protocols of the pml library.
+   */
+  //@{
+  /**
+   * The maximum number of parameters that can be pending for a port.
+   */
+  static constexpr std::size_t cParameterInjectionQueueLength = 64;
+
+  /**
+   * Pass a parameter value to a top-level parameter input.
+   * @param portName The name of the top-level parameter port.
+   * @param value The parameter value. Ownership is transferred only if the
+   * call succeeds.
+   * @return true if the value has been queued, false if the queue of the port
+   * is full.
+   * @throw std::out_of_range If no top-level parameter input named \p portName
+   * exists.
+   * @throw std::invalid_argument If the protocol of the port does not support
+   * parameter injection, or if the parameter type does not match.
+   */
+  bool injectParameter( char const * portName,
+                        std::unique_ptr< ParameterBase > && value );
+
+  /**
+   * Pass a copy of a parameter value to a top-level parameter input.
+   * @see injectParameter( char const *, std::unique_ptr< ParameterBase > && )
+   */
+  bool injectParameter( char const * portName, ParameterBase const & value );
   //@}
 
 #ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
@@ -329,7 +537,16 @@ public:
 
   bool runtimeProfilingEnabled() const;
 
-  bool enableRuntimeProfiling( std::size_t measurementBufferSize );
+  /**
+   * Enable the runtime profiling, replacing any previously active profiler.
+   * @param measurementBufferSize Number of iterations for which the raw timings are retained.
+   * @param hardwareCounters Whether to additionally measure the hardware performance counters (CPU cycles,
+   * instructions, cache misses, branch misses) of each atomic component. The counters are opened for the calling thread,
+   * see RuntimeProfiler::attachToCurrentThread() if the flow is executed by another thread.
+   * @return Whether profiling was enabled before the call.
+   * @throw std::runtime_error If \p hardwareCounters is true, but the counters are not available on this system.
+   */
+  bool enableRuntimeProfiling( std::size_t measurementBufferSize, bool hardwareCounters = false );
 
   bool disableRuntimeProfiling();
 
@@ -357,6 +574,36 @@ private:
       AudioConnectionMap const & originalConnections,
       AudioConnectionMap & finalConnections );
 
+  /**
+   * Reorganise the audio signal pool such that signals with non-overlapping lifetimes share memory.
+   * Must be called after the processing schedule has been created.
+   */
+  void reassignAudioBuffersByLiveness();
+
+  /**
+   * Set up the external capture and playback channel pointers and the data structures for binding external
+   * buffers, based on the current buffer configuration of the top-level ports.
+   * @param standardTypePortOffsets The channel offsets of all ports of the standard sample type within the pool region
+   * for this sample type.
+   */
+  void initialiseExternalChannels( std::vector<std::pair<impl::AudioPortBaseImplementation *, std::size_t> > const
+                                   & standardTypePortOffsets );
+
+  /**
+   * Recompute the external capture and playback channel pointers from the buffer configuration of the top-level
+   * ports.
+   */
+  void updateExternalChannelPointers();
+
+  /**
+   * Start the pipelined execution for a given assignment of the scheduled components to stages.
+   * @param componentStages The stage for each entry of mProcessingSchedule.
+   * @param realtimePriority The realtime priority of the worker threads, 0 for the default priority.
+   * @param cpuAffinity Whether to bind the worker threads to separate CPU cores.
+   * @throw std::invalid_argument If the assignment violates the connections of the flow.
+   */
+  void initialisePipeline( std::vector< std::size_t > const & componentStages, int realtimePriority, bool cpuAffinity );
+
   /**
    * Initialise the parameter infrastructure.
    * @return True if the initialisation was successful, false otherwise. In this
@@ -378,6 +625,8 @@ private:
   /**
    * Initialise the schedule for executing the contained elements.
    * @return Boolean value indicating whether the initialisation was successful.
+   * This also determines the execution intervals and phases of the scheduled components, staggering the automatic
+   * phases of components with the same interval.
    * @param [out] messages Output stream containing error messages and warnings
    * generated during the initialisation.
    * @param audioConnections The audio connection relations of the final signal
@@ -405,6 +654,21 @@ private:
    */
   void executeComponents();
 
+  /**
+   * Execute the components of a pipeline stage in the current block. Called concurrently for different stages.
+   */
+  void executeStage( std::size_t stageIdx );
+
+  /**
+   * Return whether the component at position \p scheduleIdx of the processing schedule is executed in the block
+   * with index \p blockIdx.
+   */
+  bool scheduledInBlock( std::size_t scheduleIdx, std::size_t blockIdx ) const
+  {
+    std::pair< std::size_t, std::size_t > const & rate = mExecutionRates[ scheduleIdx ];
+    return (rate.first == 1) or (blockIdx % rate.first == rate.second);
+  }
+
   /**
    * The signal flow handled by this object.
    * Can be either an atomic or a (hierarchical) composite component/
@@ -440,6 +704,32 @@ private:
   std::vector< char * > mCaptureChannels;
   std::vector< char * > mPlaybackChannels;
 
+  /**
+   * Receive ports of the standard sample type that reference non-contiguous channels directly, i.e., without
+   * an inserted routing component.
+   */
+  std::vector< impl::AudioPortBaseImplementation * > mGatheredPorts;
+
+  /**
+   * Support for binding external buffers directly to the top-level ports.
+   */
+  //@{
+  bool mExternalBufferBinding;
+
+  std::unique_ptr< ExternalBufferBinding > mCaptureBinding;
+
+  std::unique_ptr< ExternalBufferBinding > mPlaybackBinding;
+  //@}
+
+  /**
+   * Set the silence flags of the top-level capture channels from the current input samples.
+   */
+  void detectCaptureSilence();
+
+  bool mSilenceDetection;
+
+  SampleType mSilenceThreshold;
+
   /**
    * Data structures to hold top-level parameter ports (or their input/output
    * facilities)
@@ -460,12 +750,43 @@ private:
 
   ProcessingSchedule mProcessingSchedule;
 
+  /**
+   * Execution interval and phase (in blocks) for each entry of mProcessingSchedule.
+   * Automatic phases are resolved when the schedule is created.
+   * @see AtomicComponent::setExecutionInterval()
+   */
+  std::vector< std::pair< std::size_t, std::size_t > > mExecutionRates;
+
+  BufferAllocation const mBufferAllocation;
+
+  /**
+   * The connections of the final (flattened) signal flow, retained for setting up the pipelined execution.
+   */
+  //@{
+  std::unique_ptr< AudioConnectionMap > mAudioConnections;
+
+  std::unique_ptr< ParameterConnectionMap > mParameterConnections;
+  //@}
+
+  /**
+   * Support for pipelined execution, null if the flow is executed sequentially.
+   */
+  std::unique_ptr< PipelineExecutor > mPipeline;
+
   /**
    * Synchronisation object for accesses to external parameter ports.
    */
   mutable std::unique_ptr< ParameterExchangeMutexType >
       mParameterExchangeMutex;
 
+  bool mParameterExchangeLocking;
+
+  /**
+   * Lock-free queues for parameters passed to the top-level parameter inputs.
+   */
+  std::map< std::string, std::unique_ptr< ParameterInjectionQueue > >
+      mParameterInjectionQueues;
+
 #ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
   /**
    *
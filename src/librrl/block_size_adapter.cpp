@@ -0,0 +1,194 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "block_size_adapter.hpp"
+
+#include "audio_signal_flow.hpp"
+
+#include <libefl/vector_functions.hpp>
+
+#include <algorithm>
+#include <ciso646>
+#include <stdexcept>
+
+namespace visr
+{
+namespace rrl
+{
+
+namespace // unnamed
+{
+
+std::size_t greatestCommonDivisor( std::size_t a, std::size_t b )
+{
+  while( b != 0 )
+  {
+    std::size_t const rem = a % b;
+    a = b;
+    b = rem;
+  }
+  return a;
+}
+
+std::size_t adapterLatency( std::size_t devicePeriod, std::size_t flowPeriod )
+{
+  if( devicePeriod == 0 )
+  {
+    throw std::invalid_argument( "BlockSizeAdapter: The device period must not be zero." );
+  }
+  return flowPeriod - greatestCommonDivisor( devicePeriod, flowPeriod );
+}
+
+void copyChannel( SampleType const * src, SampleType * dest, std::size_t numSamples )
+{
+  if( efl::vectorCopy( src, dest, numSamples ) != efl::noError )
+  {
+    throw std::runtime_error( "BlockSizeAdapter: Error while copying audio samples." );
+  }
+}
+
+} // unnamed namespace
+
+BlockSizeAdapter::BlockSizeAdapter( AudioSignalFlow & flow, std::size_t devicePeriod )
+ : mFlow( flow )
+ , cDevicePeriod( devicePeriod )
+ , cFlowPeriod( flow.period() )
+ , cLatency( adapterLatency( devicePeriod, flow.period() ) )
+ , cNumberOfCaptureChannels( flow.numberOfCaptureChannels() )
+ , cNumberOfPlaybackChannels( flow.numberOfPlaybackChannels() )
+ , cDirect( devicePeriod % flow.period() == 0 )
+ , mCapturePointers( cNumberOfCaptureChannels, nullptr )
+ , mPlaybackPointers( cNumberOfPlaybackChannels, nullptr )
+ , mInputBlock( cVectorAlignmentSamples )
+ , mInputFill( 0 )
+ , mOutputBlock( cVectorAlignmentSamples )
+ , mOutputFifo( cVectorAlignmentSamples )
+ , mFifoReadPos( 0 )
+ , mFifoFill( 0 )
+{
+  if( not cDirect )
+  {
+    mInputBlock.resize( cNumberOfCaptureChannels, cFlowPeriod );
+    mOutputBlock.resize( cNumberOfPlaybackChannels, cFlowPeriod );
+    mOutputFifo.resize( cNumberOfPlaybackChannels, cLatency + cFlowPeriod );
+    for( std::size_t chIdx( 0 ); chIdx < cNumberOfCaptureChannels; ++chIdx )
+    {
+      mCapturePointers[chIdx] = mInputBlock.row( chIdx );
+    }
+    for( std::size_t chIdx( 0 ); chIdx < cNumberOfPlaybackChannels; ++chIdx )
+    {
+      mPlaybackPointers[chIdx] = mOutputBlock.row( chIdx );
+    }
+  }
+  reset();
+}
+
+BlockSizeAdapter::~BlockSizeAdapter() = default;
+
+bool BlockSizeAdapter::process( SampleType const * const * captureSamples,
+                                SampleType * const * playbackSamples )
+{
+  return cDirect ? processDirect( captureSamples, playbackSamples )
+                 : processBuffered( captureSamples, playbackSamples );
+}
+
+/*static*/ void BlockSizeAdapter::processFunction( void * userData,
+                                                   SampleType const * const * captureSamples,
+                                                   SampleType * const * playbackSamples,
+                                                   bool & status )
+{
+  BlockSizeAdapter * adapter = reinterpret_cast<BlockSizeAdapter *>( userData );
+  status = adapter->process( captureSamples, playbackSamples );
+}
+
+void BlockSizeAdapter::reset()
+{
+  mInputFill = 0;
+  mOutputFifo.zeroFill();
+  mFifoReadPos = 0;
+  // The FIFO is prefilled with silence corresponding to the latency.
+  mFifoFill = cLatency;
+}
+
+bool BlockSizeAdapter::processDirect( SampleType const * const * captureSamples,
+                                      SampleType * const * playbackSamples )
+{
+  bool status = true;
+  for( std::size_t offset( 0 ); offset < cDevicePeriod; offset += cFlowPeriod )
+  {
+    for( std::size_t chIdx( 0 ); chIdx < cNumberOfCaptureChannels; ++chIdx )
+    {
+      mCapturePointers[chIdx] = captureSamples[chIdx] + offset;
+    }
+    for( std::size_t chIdx( 0 ); chIdx < cNumberOfPlaybackChannels; ++chIdx )
+    {
+      mPlaybackPointers[chIdx] = playbackSamples[chIdx] + offset;
+    }
+    status = mFlow.process( mCapturePointers.data(), mPlaybackPointers.data() ) and status;
+  }
+  return status;
+}
+
+bool BlockSizeAdapter::processBuffered( SampleType const * const * captureSamples,
+                                        SampleType * const * playbackSamples )
+{
+  bool status = true;
+  std::size_t offset = 0;
+  while( offset < cDevicePeriod )
+  {
+    std::size_t const chunkSize = std::min( cDevicePeriod - offset, cFlowPeriod - mInputFill );
+    for( std::size_t chIdx( 0 ); chIdx < cNumberOfCaptureChannels; ++chIdx )
+    {
+      copyChannel( captureSamples[chIdx] + offset, mInputBlock.row( chIdx ) + mInputFill, chunkSize );
+    }
+    mInputFill += chunkSize;
+    if( mInputFill == cFlowPeriod )
+    {
+      status = mFlow.process( mCapturePointers.data(), mPlaybackPointers.data() ) and status;
+      writeOutputFifo();
+      mInputFill = 0;
+    }
+    readOutputFifo( playbackSamples, offset, chunkSize );
+    offset += chunkSize;
+  }
+  return status;
+}
+
+void BlockSizeAdapter::writeOutputFifo()
+{
+  std::size_t const capacity = mOutputFifo.numberOfColumns();
+  std::size_t const writePos = (mFifoReadPos + mFifoFill) % capacity;
+  std::size_t const firstSegment = std::min( cFlowPeriod, capacity - writePos );
+  for( std::size_t chIdx( 0 ); chIdx < cNumberOfPlaybackChannels; ++chIdx )
+  {
+    copyChannel( mOutputBlock.row( chIdx ), mOutputFifo.row( chIdx ) + writePos, firstSegment );
+    if( firstSegment < cFlowPeriod )
+    {
+      copyChannel( mOutputBlock.row( chIdx ) + firstSegment, mOutputFifo.row( chIdx ), cFlowPeriod - firstSegment );
+    }
+  }
+  mFifoFill += cFlowPeriod;
+}
+
+void BlockSizeAdapter::readOutputFifo( SampleType * const * playbackSamples, std::size_t offset, std::size_t numSamples )
+{
+  // Cannot happen with the latency chosen in the constructor.
+  if( numSamples > mFifoFill )
+  {
+    throw std::logic_error( "BlockSizeAdapter: Internal logic error: Output FIFO underrun." );
+  }
+  std::size_t const capacity = mOutputFifo.numberOfColumns();
+  std::size_t const firstSegment = std::min( numSamples, capacity - mFifoReadPos );
+  for( std::size_t chIdx( 0 ); chIdx < cNumberOfPlaybackChannels; ++chIdx )
+  {
+    copyChannel( mOutputFifo.row( chIdx ) + mFifoReadPos, playbackSamples[chIdx] + offset, firstSegment );
+    if( firstSegment < numSamples )
+    {
+      copyChannel( mOutputFifo.row( chIdx ), playbackSamples[chIdx] + offset + firstSegment, numSamples - firstSegment );
+    }
+  }
+  mFifoReadPos = (mFifoReadPos + numSamples) % capacity;
+  mFifoFill -= numSamples;
+}
+
+} // namespace rrl
+} // namespace visr
@@ -0,0 +1,170 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRRL_BLOCK_SIZE_ADAPTER_HPP_INCLUDED
+#define VISR_LIBRRL_BLOCK_SIZE_ADAPTER_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+
+#include <libefl/basic_matrix.hpp>
+
+#include <libvisr/constants.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace visr
+{
+namespace rrl
+{
+// Forward declarations
+class AudioSignalFlow;
+
+/**
+ * Adapter to run a signal flow with a period that differs from the period of the audio device.
+ * This allows to choose the block size of the flow, e.g., for efficient FFT-based processing, independently of
+ * the latency constraints of the audio interface.
+ * If the device period is a multiple of the flow period, each device block is split into several flow blocks
+ * that are processed directly, without buffering or additional latency.
+ * Otherwise, the input signals are collected until a complete flow block is available, and the output signals are
+ * passed through a FIFO. This adds a latency of <tt>flowPeriod - gcd(devicePeriod, flowPeriod)</tt> samples,
+ * which is the minimum delay that avoids underruns of the output FIFO. In this mode, the flow is executed in the
+ * device callbacks in which an input block is completed, so the processing load per callback is not uniform.
+ */
+class VISR_RRL_LIBRARY_SYMBOL BlockSizeAdapter
+{
+public:
+  /**
+   * Constructor.
+   * @param flow The signal flow to be executed. It is not owned by the adapter and must outlive it.
+   * @param devicePeriod The number of samples passed in each call of process().
+   * @throw std::invalid_argument If \p devicePeriod is zero.
+   */
+  explicit BlockSizeAdapter( AudioSignalFlow & flow, std::size_t devicePeriod );
+
+  /**
+   * Destructor.
+   */
+  ~BlockSizeAdapter();
+
+  BlockSizeAdapter( BlockSizeAdapter const & ) = delete;
+
+  BlockSizeAdapter & operator=( BlockSizeAdapter const & ) = delete;
+
+  std::size_t devicePeriod() const { return cDevicePeriod; }
+
+  std::size_t flowPeriod() const { return cFlowPeriod; }
+
+  /**
+   * Return the delay of the output signals introduced by the adapter, in samples.
+   * This does not include any latency of the signal flow itself.
+   */
+  std::size_t latency() const { return cLatency; }
+
+  /**
+   * Process one device block.
+   * @param captureSamples Array of pointers to the input channels, each holding devicePeriod() contiguous samples.
+   * The number of channels must match the number of capture channels of the flow.
+   * @param playbackSamples Array of pointers to the output channels, each holding devicePeriod() contiguous
+   * samples. The number of channels must match the number of playback channels of the flow.
+   * @return False if any execution of the flow reported an error.
+   */
+  bool process( SampleType const * const * captureSamples,
+                SampleType * const * playbackSamples );
+
+  /**
+   * Callback function compatible with audiointerfaces::AudioInterface::registerCallback().
+   * @param userData Pointer to the BlockSizeAdapter object.
+   * @param captureSamples Array of pointers to the input channels.
+   * @param playbackSamples Array of pointers to the output channels.
+   * @param status Set to the return value of process().
+   */
+  static void processFunction( void * userData,
+                               SampleType const * const * captureSamples,
+                               SampleType * const * playbackSamples,
+                               bool & status );
+
+  /**
+   * Discard the buffered signals and restore the initial state of the FIFOs.
+   * @note Must not be called concurrently with process().
+   */
+  void reset();
+
+private:
+  /**
+   * Split a device block into flow blocks that are processed in place.
+   */
+  bool processDirect( SampleType const * const * captureSamples,
+                      SampleType * const * playbackSamples );
+
+  /**
+   * Process a device block through the input buffer and the output FIFO.
+   */
+  bool processBuffered( SampleType const * const * captureSamples,
+                        SampleType * const * playbackSamples );
+
+  /**
+   * Append the output block of the flow to the output FIFO.
+   */
+  void writeOutputFifo();
+
+  /**
+   * Remove \p numSamples samples from the output FIFO and write them to the playback channels, starting at
+   * \p offset.
+   */
+  void readOutputFifo( SampleType * const * playbackSamples, std::size_t offset, std::size_t numSamples );
+
+  AudioSignalFlow & mFlow;
+
+  std::size_t const cDevicePeriod;
+
+  std::size_t const cFlowPeriod;
+
+  std::size_t const cLatency;
+
+  std::size_t const cNumberOfCaptureChannels;
+
+  std::size_t const cNumberOfPlaybackChannels;
+
+  /**
+   * Whether the device period is a multiple of the flow period.
+   */
+  bool const cDirect;
+
+  /**
+   * Channel pointers passed to the flow.
+   */
+  //@{
+  std::vector<SampleType const *> mCapturePointers;
+  std::vector<SampleType *> mPlaybackPointers;
+  //@}
+
+  /**
+   * Input samples collected for the next flow block (buffered mode only).
+   */
+  efl::BasicMatrix<SampleType> mInputBlock;
+
+  /**
+   * Number of samples in mInputBlock.
+   */
+  std::size_t mInputFill;
+
+  /**
+   * Output block of the flow (buffered mode only).
+   */
+  efl::BasicMatrix<SampleType> mOutputBlock;
+
+  /**
+   * Circular buffer holding the output samples not yet passed to the device (buffered mode only).
+   * The capacity is latency() + flowPeriod().
+   */
+  efl::BasicMatrix<SampleType> mOutputFifo;
+
+  std::size_t mFifoReadPos;
+
+  std::size_t mFifoFill;
+};
+
+} // namespace rrl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRRL_BLOCK_SIZE_ADAPTER_HPP_INCLUDED
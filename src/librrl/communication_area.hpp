@@ -27,6 +27,11 @@ public:
 
   char const * basePointer() const { return mPool.data(); }
 
+  /**
+   * Return the size of the pool in bytes.
+   */
+  std::size_t size() const { return mPool.size(); }
+
 private:
   efl::AlignedArray<char> mPool;
 };
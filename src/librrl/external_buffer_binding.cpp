@@ -0,0 +1,210 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "external_buffer_binding.hpp"
+
+#include "port_utilities.hpp"
+
+#include <libefl/alignment.hpp>
+
+#include <libvisr/audio_sample_type.hpp>
+#include <libvisr/impl/audio_port_base_implementation.hpp>
+
+#include <algorithm>
+#include <ciso646>
+#include <cstddef>
+
+namespace visr
+{
+namespace rrl
+{
+
+ExternalBufferBinding::ExternalBufferBinding( std::vector<impl::AudioPortBaseImplementation *> const & topLevelPorts,
+                                              std::vector<PortOffset> const & portOffsets,
+                                              std::vector<impl::AudioPortBaseImplementation *> const & gatheredPorts,
+                                              std::size_t period )
+ : mPeriod( period )
+{
+  std::size_t externalChannelOffset = 0;
+  for( impl::AudioPortBaseImplementation * port : topLevelPorts )
+  {
+    PortEntry entry;
+    entry.externalChannelOffset = externalChannelOffset;
+    entry.width = port->width();
+    entry.bound = false;
+    entry.boundBegin = nullptr;
+    entry.boundEnd = nullptr;
+    entry.poolBase = static_cast<char*>(port->basePointer());
+    entry.poolChannelStrideSamples = port->channelStrideSamples();
+    externalChannelOffset += entry.width;
+
+    auto const findIt = std::find_if( portOffsets.begin(), portOffsets.end(),
+      [port]( PortOffset const & val ){ return val.first == port; } );
+    entry.bindable = (findIt != portOffsets.end())
+      and (port->sampleType() == AudioSampleType::TypeToId<SampleType>::id)
+      and (entry.width > 0);
+    if( entry.bindable )
+    {
+      std::size_t const begin = findIt->second;
+      std::size_t const end = begin + entry.width;
+      for( PortOffset const & alias : portOffsets )
+      {
+        std::size_t const aliasBegin = alias.second;
+        std::size_t const aliasEnd = aliasBegin + alias.first->width();
+        if( (aliasEnd <= begin) or (aliasBegin >= end) or (alias.first->width() == 0) )
+        {
+          continue; // No overlap
+        }
+        // Aliases straddling the region boundary or other top-level ports sharing the region
+        // (e.g., feedthrough connections) prevent the binding.
+        if( (aliasBegin < begin) or (aliasEnd > end)
+          or ((alias.first != port) and isToplevelPort( alias.first )) )
+        {
+          entry.bindable = false;
+          entry.aliases.clear();
+          break;
+        }
+        entry.aliases.push_back( std::make_pair( alias.first, aliasBegin - begin ) );
+      }
+    }
+    if( entry.bindable )
+    {
+      char const * const regionEnd = entry.poolBase + entry.width * port->channelStrideBytes();
+      for( impl::AudioPortBaseImplementation * gathered : gatheredPorts )
+      {
+        for( std::size_t chIdx( 0 ); chIdx < gathered->width(); ++chIdx )
+        {
+          char const * const chPtr = static_cast<char const *>(gathered->channelPointer( chIdx ));
+          if( (chPtr >= entry.poolBase) and (chPtr < regionEnd) )
+          {
+            entry.channelAliases.push_back( ChannelAlias{ gathered, chIdx,
+              static_cast<std::size_t>(chPtr - entry.poolBase) / port->channelStrideBytes() } );
+          }
+        }
+      }
+    }
+    mPorts.push_back( std::move( entry ) );
+  }
+}
+
+ExternalBufferBinding::~ExternalBufferBinding() = default;
+
+bool ExternalBufferBinding::bind( std::size_t portIdx, SampleType * const * channelPointers,
+                                  std::size_t sampleStride,
+                                  ExternalBufferBinding const * exclude /*= nullptr*/ )
+{
+  PortEntry & entry = mPorts[portIdx];
+  if( (not entry.bindable) or (sampleStride != 1) )
+  {
+    release( portIdx );
+    return false;
+  }
+  std::size_t channelStride = entry.poolChannelStrideSamples;
+  if( entry.width > 1 )
+  {
+    std::ptrdiff_t const diff = channelPointers[1] - channelPointers[0];
+    if( diff <= 0 )
+    {
+      release( portIdx );
+      return false;
+    }
+    for( std::size_t chIdx( 2 ); chIdx < entry.width; ++chIdx )
+    {
+      if( channelPointers[chIdx] - channelPointers[chIdx-1] != diff )
+      {
+        release( portIdx );
+        return false;
+      }
+    }
+    channelStride = static_cast<std::size_t>(diff);
+  }
+  return bindUniform( portIdx, channelPointers[0], channelStride, exclude );
+}
+
+bool ExternalBufferBinding::bind( std::size_t portIdx, SampleType * basePointer,
+                                  std::size_t channelStride, std::size_t sampleStride,
+                                  ExternalBufferBinding const * exclude /*= nullptr*/ )
+{
+  PortEntry & entry = mPorts[portIdx];
+  if( (not entry.bindable) or (sampleStride != 1) )
+  {
+    release( portIdx );
+    return false;
+  }
+  return bindUniform( portIdx, basePointer, entry.width > 1 ? channelStride : entry.poolChannelStrideSamples,
+                      exclude );
+}
+
+bool ExternalBufferBinding::bindUniform( std::size_t portIdx, SampleType * basePtr, std::size_t channelStride,
+                                         ExternalBufferBinding const * exclude )
+{
+  PortEntry & entry = mPorts[portIdx];
+  if( (not efl::checkAlignment( basePtr, cVectorAlignmentSamples ))
+    or (channelStride < mPeriod) or (channelStride % cVectorAlignmentSamples != 0) )
+  {
+    release( portIdx );
+    return false;
+  }
+  char const * const regionBegin = reinterpret_cast<char const *>(basePtr);
+  char const * const regionEnd = reinterpret_cast<char const *>(basePtr + (entry.width-1) * channelStride + mPeriod );
+  if( exclude and exclude->overlapsBoundRegion( regionBegin, regionEnd ) )
+  {
+    release( portIdx );
+    return false;
+  }
+  if( entry.bound and (entry.boundBegin == regionBegin) and (entry.boundEnd == regionEnd) )
+  {
+    return true; // Already bound to the same buffer, nothing to do.
+  }
+  for( auto const & alias : entry.aliases )
+  {
+    alias.first->setBufferConfig( basePtr + alias.second * channelStride, channelStride );
+  }
+  for( ChannelAlias const & alias : entry.channelAliases )
+  {
+    alias.port->setChannelPointer( alias.channel, basePtr + alias.offset * channelStride );
+  }
+  entry.bound = true;
+  entry.boundBegin = regionBegin;
+  entry.boundEnd = regionEnd;
+  return true;
+}
+
+bool ExternalBufferBinding::overlapsBoundRegion( char const * begin, char const * end ) const
+{
+  return std::any_of( mPorts.begin(), mPorts.end(), [begin, end]( PortEntry const & entry )
+  {
+    return entry.bound and (begin < entry.boundEnd) and (entry.boundBegin < end);
+  } );
+}
+
+void ExternalBufferBinding::releaseAll()
+{
+  for( std::size_t portIdx( 0 ); portIdx < mPorts.size(); ++portIdx )
+  {
+    release( portIdx );
+  }
+}
+
+void ExternalBufferBinding::release( std::size_t portIdx )
+{
+  PortEntry & entry = mPorts[portIdx];
+  if( not entry.bound )
+  {
+    return;
+  }
+  std::size_t const strideBytes = entry.poolChannelStrideSamples * sizeof(SampleType);
+  for( auto const & alias : entry.aliases )
+  {
+    alias.first->setBufferConfig( entry.poolBase + alias.second * strideBytes, entry.poolChannelStrideSamples );
+  }
+  for( ChannelAlias const & alias : entry.channelAliases )
+  {
+    alias.port->setChannelPointer( alias.channel, entry.poolBase + alias.offset * strideBytes );
+  }
+  entry.bound = false;
+  entry.boundBegin = nullptr;
+  entry.boundEnd = nullptr;
+}
+
+} // namespace rrl
+} // namespace visr
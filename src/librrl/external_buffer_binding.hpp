@@ -0,0 +1,180 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRRL_EXTERNAL_BUFFER_BINDING_HPP_INCLUDED
+#define VISR_LIBRRL_EXTERNAL_BUFFER_BINDING_HPP_INCLUDED
+
+#include <libvisr/constants.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace visr
+{
+// Forward declarations
+namespace impl
+{
+class AudioPortBaseImplementation;
+}
+
+namespace rrl
+{
+
+/**
+ * Internal helper class to bind externally provided sample buffers (e.g., the buffers of an audio interface)
+ * directly to the top-level audio ports of a signal flow, thus avoiding the copying of samples
+ * between the external buffers and the audio signal pool.
+ * Binding a top-level port means re-pointing all ports that share (alias) the memory region of this port in
+ * the audio signal pool to the external buffer.
+ * This is only possible if all these aliasing ports are fully contained within the region of the top-level
+ * port, if no other top-level port overlaps with this region, and if the external buffer meets the alignment
+ * and channel stride requirements of the audio ports.
+ * In all other cases, the caller must fall back to copying.
+ * @note Only ports with the standard sample type visr::SampleType are considered.
+ */
+class ExternalBufferBinding
+{
+public:
+  /**
+   * Pair of an audio port and the offset (in channels) of its first channel within the audio signal pool region
+   * of the sample type visr::SampleType.
+   */
+  using PortOffset = std::pair<impl::AudioPortBaseImplementation *, std::size_t>;
+
+  /**
+   * Constructor.
+   * @param topLevelPorts The top-level ports, in the order of the external channel indices.
+   * @param portOffsets The channel offsets of all ports (including the top-level ports) within the
+   * pool region of the standard sample type.
+   * @param gatheredPorts Ports referencing non-contiguous channels in the pool (see
+   * impl::AudioPortBaseImplementation::setGatherConfig()). Channels located within the region of a top-level port
+   * are re-pointed individually.
+   * @param period The number of samples per block.
+   * @pre All ports must be initialised, i.e., point to their location in the audio signal pool.
+   */
+  explicit ExternalBufferBinding( std::vector<impl::AudioPortBaseImplementation *> const & topLevelPorts,
+                                  std::vector<PortOffset> const & portOffsets,
+                                  std::vector<impl::AudioPortBaseImplementation *> const & gatheredPorts,
+                                  std::size_t period );
+
+  ~ExternalBufferBinding();
+
+  /**
+   * Return the number of top-level ports handled by this object.
+   */
+  std::size_t numberOfPorts() const { return mPorts.size(); }
+
+  /**
+   * Return the index of the first external channel of the top-level port \p portIdx.
+   */
+  std::size_t channelOffset( std::size_t portIdx ) const { return mPorts[portIdx].externalChannelOffset; }
+
+  /**
+   * Return the width of the top-level port \p portIdx.
+   */
+  std::size_t width( std::size_t portIdx ) const { return mPorts[portIdx].width; }
+
+  /**
+   * Query whether the top-level port \p portIdx can, in principle, be bound to external buffers.
+   */
+  bool bindable( std::size_t portIdx ) const { return mPorts[portIdx].bindable; }
+
+  /**
+   * Query whether the top-level port \p portIdx is currently bound to an external buffer.
+   */
+  bool bound( std::size_t portIdx ) const { return mPorts[portIdx].bound; }
+
+  /**
+   * Try to bind the top-level port \p portIdx to the external channel buffers.
+   * If the binding is not possible, all aliasing ports are reset to their locations in the audio signal pool.
+   * @param portIdx Index of the top-level port.
+   * @param channelPointers Array of pointers to the external channel buffers. The first entry corresponds to the
+   * first channel of the port.
+   * @param sampleStride The stride between consecutive samples in the external buffers. Only 1 is supported for binding.
+   * @param exclude Optional binding object whose currently bound memory regions must not overlap with the
+   * external buffers. Used to prevent binding playback buffers that share memory with bound capture buffers.
+   * @return True if the port has been bound, false if the caller needs to copy the samples from or to the pool.
+   * @note The buffers passed for input ports are not modified, although non-const pointers are used here.
+   */
+  bool bind( std::size_t portIdx, SampleType * const * channelPointers, std::size_t sampleStride,
+             ExternalBufferBinding const * exclude = nullptr );
+
+  /**
+   * Try to bind the top-level port \p portIdx to a matrix of external samples with fixed channel and sample strides.
+   * @param portIdx Index of the top-level port.
+   * @param basePointer Pointer to the first sample of the first channel of the port.
+   * @param channelStride Number of samples between consecutive channels.
+   * @param sampleStride Number of samples between consecutive samples of a channel. Only 1 is supported for binding.
+   * @param exclude Optional binding object whose currently bound memory regions must not overlap with the
+   * external buffers.
+   * @return True if the port has been bound, false if the caller needs to copy the samples.
+   */
+  bool bind( std::size_t portIdx, SampleType * basePointer, std::size_t channelStride, std::size_t sampleStride,
+             ExternalBufferBinding const * exclude = nullptr );
+
+  /**
+   * Query whether the memory range [\p begin, \p end) overlaps with the region of any currently bound port.
+   */
+  bool overlapsBoundRegion( char const * begin, char const * end ) const;
+
+  /**
+   * Reset all ports to their locations within the audio signal pool.
+   */
+  void releaseAll();
+
+private:
+  /**
+   * Bind the port \p portIdx to a buffer with a uniform channel stride, provided that the alignment and stride
+   * requirements are met.
+   */
+  bool bindUniform( std::size_t portIdx, SampleType * basePtr, std::size_t channelStride,
+                    ExternalBufferBinding const * exclude );
+
+  /**
+   * Reset all aliases of the top-level port \p portIdx to the audio signal pool.
+   */
+  void release( std::size_t portIdx );
+
+  struct ChannelAlias
+  {
+    impl::AudioPortBaseImplementation * port;
+    std::size_t channel;
+    std::size_t offset; ///< Channel offset relative to the top-level port.
+  };
+
+  struct PortEntry
+  {
+    std::size_t externalChannelOffset;
+    std::size_t width;
+    bool bindable;
+    bool bound;
+    /**
+     * The external memory region of the port if bound.
+     */
+    char const * boundBegin;
+    char const * boundEnd;
+    /**
+     * The base pointer of the top-level port in the audio signal pool.
+     */
+    char * poolBase;
+    std::size_t poolChannelStrideSamples;
+    /**
+     * All ports sharing the memory region of the top-level port (including this port), together with their
+     * channel offset relative to the top-level port.
+     */
+    std::vector<std::pair<impl::AudioPortBaseImplementation *, std::size_t> > aliases;
+    /**
+     * Single channels of gathered ports located within the region of the top-level port.
+     */
+    std::vector<ChannelAlias> channelAliases;
+  };
+
+  std::vector<PortEntry> mPorts;
+
+  std::size_t const mPeriod;
+};
+
+} // namespace rrl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRRL_EXTERNAL_BUFFER_BINDING_HPP_INCLUDED
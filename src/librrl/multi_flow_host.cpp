@@ -0,0 +1,356 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "multi_flow_host.hpp"
+
+#include "audio_signal_flow.hpp"
+#include "thread_configuration.hpp"
+
+#include <libefl/basic_matrix.hpp>
+#include <libefl/vector_functions.hpp>
+
+#include <libvisr/channel_list.hpp>
+#include <libvisr/component.hpp>
+#include <libvisr/detail/compose_message_string.hpp>
+
+#include <chrono>
+#include <ciso646>
+#include <exception>
+#include <stdexcept>
+
+namespace visr
+{
+namespace rrl
+{
+
+struct MultiFlowHost::Flow
+{
+  explicit Flow( Component & component, std::size_t period )
+   : signalFlow( component )
+   , capturePointers( signalFlow.numberOfCaptureChannels(), nullptr )
+   , playbackBuffer( signalFlow.numberOfPlaybackChannels(), period, cVectorAlignmentSamples )
+   , load( 0.0 )
+   , peakLoad( 0.0 )
+   , status( true )
+  {
+    for( std::size_t chIdx( 0 ); chIdx < playbackBuffer.numberOfRows(); ++chIdx )
+    {
+      playbackPointers.push_back( playbackBuffer.row( chIdx ) );
+    }
+  }
+
+  AudioSignalFlow signalFlow;
+  std::vector<std::size_t> captureChannels;
+  std::vector<SampleType const *> capturePointers;
+  efl::BasicMatrix<SampleType> playbackBuffer;
+  std::vector<SampleType *> playbackPointers;
+  std::atomic<double> load;
+  std::atomic<double> peakLoad;
+  /**
+   * Result of the most recent execution, written by the executing thread and read by the calling thread
+   * after all threads have completed the block.
+   */
+  //@{
+  bool status;
+  std::exception_ptr error;
+  //@}
+};
+
+MultiFlowHost::MultiFlowHost( std::size_t numberOfCaptureChannels,
+                              std::size_t numberOfPlaybackChannels,
+                              std::size_t period,
+                              SamplingFrequencyType samplingFrequency,
+                              std::size_t numberOfThreads,
+                              int realtimePriority /*= 0*/ )
+ : cNumberOfCaptureChannels( numberOfCaptureChannels )
+ , cNumberOfPlaybackChannels( numberOfPlaybackChannels )
+ , cPeriod( period )
+ , cSamplingFrequency( samplingFrequency )
+ , mPlaybackSources( numberOfPlaybackChannels )
+ , mQueues( numberOfThreads + 1 )
+ , mQueueHeads( new std::atomic<std::uint64_t>[numberOfThreads + 1] )
+ , mPendingFlows( 0 )
+ , mCycle( 0 )
+#ifndef VISR_DISABLE_THREADS
+ , mRunning( true )
+#endif
+{
+  for( std::size_t threadIdx( 0 ); threadIdx <= numberOfThreads; ++threadIdx )
+  {
+    mQueueHeads[threadIdx].store( 0 );
+  }
+#ifdef VISR_DISABLE_THREADS
+  if( numberOfThreads != 0 )
+  {
+    throw std::invalid_argument( "MultiFlowHost: Worker threads are not supported because threads are disabled." );
+  }
+#else
+  for( std::size_t threadIdx( 1 ); threadIdx <= numberOfThreads; ++threadIdx )
+  {
+    mWorkers.emplace_back( &MultiFlowHost::runWorker, this, threadIdx );
+    setRealtimePriority( mWorkers.back(), realtimePriority, "MultiFlowHost" );
+  }
+#endif
+}
+
+MultiFlowHost::~MultiFlowHost()
+{
+#ifndef VISR_DISABLE_THREADS
+  {
+    std::lock_guard<std::mutex> lock( mMutex );
+    mRunning = false;
+  }
+  mStart.notify_all();
+  for( std::thread & worker : mWorkers )
+  {
+    worker.join();
+  }
+#endif
+}
+
+std::size_t MultiFlowHost::addFlow( Component & component,
+                                    ChannelList const & captureChannels,
+                                    ChannelList const & playbackChannels )
+{
+  if( component.period() != cPeriod )
+  {
+    throw std::invalid_argument( "MultiFlowHost::addFlow(): The period of the component differs from that of the host." );
+  }
+  if( component.samplingFrequency() != cSamplingFrequency )
+  {
+    throw std::invalid_argument( "MultiFlowHost::addFlow(): The sampling frequency of the component differs from that of the host." );
+  }
+  std::unique_ptr<Flow> newFlow( new Flow( component, cPeriod ) );
+  if( captureChannels.size() != newFlow->signalFlow.numberOfCaptureChannels() )
+  {
+    throw std::invalid_argument( detail::composeMessageString( "MultiFlowHost::addFlow(): The number of capture channels (",
+      captureChannels.size(), ") does not match the number of inputs of the flow (",
+      newFlow->signalFlow.numberOfCaptureChannels(), ")." ) );
+  }
+  if( playbackChannels.size() != newFlow->signalFlow.numberOfPlaybackChannels() )
+  {
+    throw std::invalid_argument( detail::composeMessageString( "MultiFlowHost::addFlow(): The number of playback channels (",
+      playbackChannels.size(), ") does not match the number of outputs of the flow (",
+      newFlow->signalFlow.numberOfPlaybackChannels(), ")." ) );
+  }
+  for( std::size_t chIdx( 0 ); chIdx < captureChannels.size(); ++chIdx )
+  {
+    if( captureChannels[chIdx] >= cNumberOfCaptureChannels )
+    {
+      throw std::invalid_argument( "MultiFlowHost::addFlow(): Capture channel index exceeds the number of capture channels." );
+    }
+    newFlow->captureChannels.push_back( captureChannels[chIdx] );
+  }
+  for( std::size_t chIdx( 0 ); chIdx < playbackChannels.size(); ++chIdx )
+  {
+    if( playbackChannels[chIdx] >= cNumberOfPlaybackChannels )
+    {
+      throw std::invalid_argument( "MultiFlowHost::addFlow(): Playback channel index exceeds the number of playback channels." );
+    }
+  }
+  // All checks passed, the remaining operations modify the state of the host.
+  for( std::size_t chIdx( 0 ); chIdx < playbackChannels.size(); ++chIdx )
+  {
+    mPlaybackSources[playbackChannels[chIdx]].push_back( newFlow->playbackPointers[chIdx] );
+  }
+  std::size_t const flowIdx = mFlows.size();
+  mFlows.push_back( std::move( newFlow ) );
+  mQueues[flowIdx % mQueues.size()].push_back( flowIdx );
+  return flowIdx;
+}
+
+std::size_t MultiFlowHost::numberOfFlows() const
+{
+  return mFlows.size();
+}
+
+AudioSignalFlow & MultiFlowHost::flow( std::size_t flowIdx )
+{
+  return mFlows.at( flowIdx )->signalFlow;
+}
+
+std::size_t MultiFlowHost::numberOfThreads() const
+{
+  return mQueues.size() - 1;
+}
+
+bool MultiFlowHost::process( SampleType const * const * captureSamples,
+                             SampleType * const * playbackSamples )
+{
+  for( std::unique_ptr<Flow> const & flow : mFlows )
+  {
+    for( std::size_t chIdx( 0 ); chIdx < flow->captureChannels.size(); ++chIdx )
+    {
+      flow->capturePointers[chIdx] = captureSamples[flow->captureChannels[chIdx]];
+    }
+  }
+  std::uint32_t const cycle = mCycle + 1;
+  mPendingFlows.store( mFlows.size(), std::memory_order_relaxed );
+  // Publishing the tagged queue heads makes the flow configuration visible to the claiming threads.
+  for( std::size_t threadIdx( 0 ); threadIdx < mQueues.size(); ++threadIdx )
+  {
+    mQueueHeads[threadIdx].store( static_cast<std::uint64_t>(cycle) << 32, std::memory_order_release );
+  }
+#ifndef VISR_DISABLE_THREADS
+  if( not mWorkers.empty() )
+  {
+    {
+      std::lock_guard<std::mutex> lock( mMutex );
+      mCycle = cycle;
+    }
+    mStart.notify_all();
+  }
+  else
+#endif
+  {
+    mCycle = cycle;
+  }
+  executeQueues( 0, cycle );
+#ifndef VISR_DISABLE_THREADS
+  // All flows have been claimed at this point. Instead of sleeping until the workers signal their completion,
+  // which would make the calling (audio) thread depend on the scheduling of the workers, wait only for the flows
+  // that are still being executed.
+  while( mPendingFlows.load( std::memory_order_acquire ) != 0 )
+  {
+    std::this_thread::yield();
+  }
+#endif
+  bool status = true;
+  std::exception_ptr error;
+  for( std::unique_ptr<Flow> const & flow : mFlows )
+  {
+    status = status and flow->status;
+    if( flow->error and not error )
+    {
+      error = flow->error;
+    }
+    flow->error = nullptr;
+  }
+  if( error )
+  {
+    std::rethrow_exception( error );
+  }
+  for( std::size_t chIdx( 0 ); chIdx < cNumberOfPlaybackChannels; ++chIdx )
+  {
+    std::vector<SampleType const *> const & sources = mPlaybackSources[chIdx];
+    efl::ErrorCode res = sources.empty()
+      ? efl::vectorZero( playbackSamples[chIdx], cPeriod )
+      : efl::vectorCopy( sources[0], playbackSamples[chIdx], cPeriod );
+    for( std::size_t srcIdx( 1 ); (srcIdx < sources.size()) and (res == efl::noError); ++srcIdx )
+    {
+      res = efl::vectorAddInplace( sources[srcIdx], playbackSamples[chIdx], cPeriod );
+    }
+    if( res != efl::noError )
+    {
+      throw std::runtime_error( detail::composeMessageString( "MultiFlowHost::process(): Error while mixing the playback signals: ",
+        efl::errorMessage( res ) ) );
+    }
+  }
+  return status;
+}
+
+/*static*/ void MultiFlowHost::processFunction( void * userData,
+                                                SampleType const * const * captureSamples,
+                                                SampleType * const * playbackSamples,
+                                                bool & status )
+{
+  MultiFlowHost * host = reinterpret_cast<MultiFlowHost *>( userData );
+  status = host->process( captureSamples, playbackSamples );
+}
+
+double MultiFlowHost::flowLoad( std::size_t flowIdx ) const
+{
+  return mFlows.at( flowIdx )->load.load( std::memory_order_relaxed );
+}
+
+double MultiFlowHost::flowPeakLoad( std::size_t flowIdx ) const
+{
+  return mFlows.at( flowIdx )->peakLoad.load( std::memory_order_relaxed );
+}
+
+void MultiFlowHost::resetPeakLoads()
+{
+  for( std::unique_ptr<Flow> const & flow : mFlows )
+  {
+    flow->peakLoad.store( 0.0, std::memory_order_relaxed );
+  }
+}
+
+void MultiFlowHost::executeFlow( std::size_t flowIdx )
+{
+  Flow & flow = *(mFlows[flowIdx]);
+  using Clock = std::chrono::steady_clock;
+  Clock::time_point const startTime = Clock::now();
+  try
+  {
+    flow.status = flow.signalFlow.process( flow.capturePointers.data(), flow.playbackPointers.data() );
+  }
+  catch( ... )
+  {
+    flow.status = false;
+    flow.error = std::current_exception();
+  }
+  double const duration = std::chrono::duration<double>( Clock::now() - startTime ).count();
+  double const load = duration * static_cast<double>(cSamplingFrequency) / static_cast<double>(cPeriod);
+  flow.load.store( load, std::memory_order_relaxed );
+  double peak = flow.peakLoad.load( std::memory_order_relaxed );
+  while( (load > peak) and not flow.peakLoad.compare_exchange_weak( peak, load, std::memory_order_relaxed ) )
+  {
+  }
+  // Releases the results of the flow to the thread calling process().
+  mPendingFlows.fetch_sub( 1, std::memory_order_acq_rel );
+}
+
+void MultiFlowHost::executeQueues( std::size_t threadIdx, std::uint32_t cycle )
+{
+  std::uint64_t const tag = static_cast<std::uint64_t>(cycle) << 32;
+  std::uint64_t const positionMask = 0xFFFFFFFFu;
+  std::size_t const numQueues = mQueues.size();
+  // Start with the own queue, then visit the other queues in a thread-specific order to reduce contention.
+  for( std::size_t offset( 0 ); offset < numQueues; ++offset )
+  {
+    std::size_t const queueIdx = (threadIdx + offset) % numQueues;
+    std::atomic<std::uint64_t> & head = mQueueHeads[queueIdx];
+    std::uint64_t current = head.load( std::memory_order_acquire );
+    for( ;; )
+    {
+      if( (current & ~positionMask) != tag )
+      {
+        break; // The heads belong to a different process() call.
+      }
+      std::size_t const pos = static_cast<std::size_t>( current & positionMask );
+      if( pos >= mQueues[queueIdx].size() )
+      {
+        break;
+      }
+      if( head.compare_exchange_weak( current, current + 1, std::memory_order_acq_rel, std::memory_order_acquire ) )
+      {
+        executeFlow( mQueues[queueIdx][pos] );
+        current = head.load( std::memory_order_acquire );
+      }
+    }
+  }
+}
+
+#ifndef VISR_DISABLE_THREADS
+void MultiFlowHost::runWorker( std::size_t threadIdx )
+{
+  std::uint32_t cycle = 0;
+  for( ;; )
+  {
+    {
+      std::unique_lock<std::mutex> lock( mMutex );
+      mStart.wait( lock, [this, cycle] { return (mCycle != cycle) or not mRunning; } );
+      if( not mRunning )
+      {
+        return;
+      }
+      cycle = mCycle;
+    }
+    // The completion is signalled per flow in executeFlow().
+    executeQueues( threadIdx, cycle );
+  }
+}
+#endif
+
+} // namespace rrl
+} // namespace visr
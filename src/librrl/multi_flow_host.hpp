@@ -0,0 +1,224 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRRL_MULTI_FLOW_HOST_HPP_INCLUDED
+#define VISR_LIBRRL_MULTI_FLOW_HOST_HPP_INCLUDED
+
+#include "export_symbols.hpp"
+
+#include <libvisr/constants.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#ifndef VISR_DISABLE_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace visr
+{
+// Forward declarations
+class ChannelList;
+class Component;
+
+namespace rrl
+{
+// Forward declarations
+class AudioSignalFlow;
+
+/**
+ * Host for a number of independent signal flows that are driven by a single audio callback.
+ * Each flow reads an arbitrary subset of the capture channels of the host, and the outputs of all flows are
+ * mixed into the playback channels of the host. In each process() call, the flows are executed concurrently by
+ * the calling thread and a pool of worker threads. The flows are distributed over the threads in a fixed
+ * round-robin order, and threads that have finished their own flows take pending flows from the other threads.
+ * The calling thread does not block on the workers: after all flows have been claimed, it waits for the flows
+ * still executing in worker threads by polling a counter.
+ * The CPU load of each flow, i.e., the ratio between its execution time and the duration of a block, is measured
+ * in every process() call.
+ * The methods to add flows must not be called concurrently with process().
+ */
+class VISR_RRL_LIBRARY_SYMBOL MultiFlowHost
+{
+public:
+  /**
+   * Constructor.
+   * @param numberOfCaptureChannels The number of input channels passed to process().
+   * @param numberOfPlaybackChannels The number of output channels filled by process().
+   * @param period The number of samples per block. All flows must use this period.
+   * @param samplingFrequency The sampling frequency in Hz, used to compute the CPU load.
+   * @param numberOfThreads The number of worker threads in addition to the thread calling process(). A value of 0
+   * executes all flows sequentially in the calling thread.
+   * @param realtimePriority If nonzero, the worker threads are run with the SCHED_FIFO policy and this priority,
+   * which should match the priority of the audio callback thread. If the priority cannot be set, e.g., due to
+   * missing privileges, a warning is printed and the workers run with the default priority.
+   * @throw std::invalid_argument If \p numberOfThreads is nonzero and VISR is built without thread support.
+   */
+  explicit MultiFlowHost( std::size_t numberOfCaptureChannels,
+                          std::size_t numberOfPlaybackChannels,
+                          std::size_t period,
+                          SamplingFrequencyType samplingFrequency,
+                          std::size_t numberOfThreads,
+                          int realtimePriority = 0 );
+
+  /**
+   * Destructor, stops and joins the worker threads.
+   */
+  ~MultiFlowHost();
+
+  MultiFlowHost( MultiFlowHost const & ) = delete;
+
+  MultiFlowHost & operator=( MultiFlowHost const & ) = delete;
+
+  /**
+   * Create a signal flow for a top-level component and add it to the host.
+   * @param component The top-level component. It is not owned by the host and must outlive it.
+   * @param captureChannels The capture channels of the host connected to the inputs of the flow. The size must match
+   * the number of capture channels of the flow.
+   * @param playbackChannels The playback channels of the host the outputs of the flow are mixed into. The size must
+   * match the number of playback channels of the flow.
+   * @return The index of the new flow.
+   * @throw std::invalid_argument If the period or the sampling frequency of \p component differ from those of the
+   * host, or if the channel lists do not match the flow or contain invalid channel indices.
+   */
+  std::size_t addFlow( Component & component,
+                       ChannelList const & captureChannels,
+                       ChannelList const & playbackChannels );
+
+  /**
+   * Return the number of flows.
+   */
+  std::size_t numberOfFlows() const;
+
+  /**
+   * Access the signal flow with index \p flowIdx, e.g., to inject parameters or to configure it.
+   * @throw std::out_of_range If \p flowIdx is not a valid flow index.
+   */
+  AudioSignalFlow & flow( std::size_t flowIdx );
+
+  std::size_t numberOfCaptureChannels() const { return cNumberOfCaptureChannels; }
+
+  std::size_t numberOfPlaybackChannels() const { return cNumberOfPlaybackChannels; }
+
+  std::size_t period() const { return cPeriod; }
+
+  std::size_t numberOfThreads() const;
+
+  /**
+   * Execute all flows for one block.
+   * @param captureSamples Array of numberOfCaptureChannels() pointers to the input channels, each holding period()
+   * contiguous samples.
+   * @param playbackSamples Array of numberOfPlaybackChannels() pointers to the output channels, each holding
+   * period() contiguous samples.
+   * @return False if any of the flows reported an error.
+   * @throw std::exception If a flow throws an exception. All other flows are completed before that, and the
+   * first exception is passed on.
+   */
+  bool process( SampleType const * const * captureSamples,
+                SampleType * const * playbackSamples );
+
+  /**
+   * Callback function compatible with audiointerfaces::AudioInterface::registerCallback().
+   * @param userData Pointer to the MultiFlowHost object.
+   * @param captureSamples Array of pointers to the input channels.
+   * @param playbackSamples Array of pointers to the output channels.
+   * @param status Set to the return value of process().
+   */
+  static void processFunction( void * userData,
+                               SampleType const * const * captureSamples,
+                               SampleType * const * playbackSamples,
+                               bool & status );
+
+  /**
+   * Return the CPU load of flow \p flowIdx in the most recent process() call, i.e., its execution time divided by
+   * the duration of a block. Can be called from any thread.
+   */
+  double flowLoad( std::size_t flowIdx ) const;
+
+  /**
+   * Return the maximum CPU load of flow \p flowIdx since the last call to resetPeakLoads().
+   * Can be called from any thread.
+   */
+  double flowPeakLoad( std::size_t flowIdx ) const;
+
+  /**
+   * Reset the peak load values of all flows. Can be called from any thread.
+   */
+  void resetPeakLoads();
+
+private:
+  struct Flow;
+
+  /**
+   * Run the flow with the given index, measure its load, and mark it as completed.
+   */
+  void executeFlow( std::size_t flowIdx );
+
+  /**
+   * Execute the flows assigned to thread \p threadIdx and then the pending flows of the other threads.
+   * @param cycle The process() call the thread has been started for. Flows of other calls are not claimed.
+   */
+  void executeQueues( std::size_t threadIdx, std::uint32_t cycle );
+
+  std::size_t const cNumberOfCaptureChannels;
+
+  std::size_t const cNumberOfPlaybackChannels;
+
+  std::size_t const cPeriod;
+
+  SamplingFrequencyType const cSamplingFrequency;
+
+  std::vector<std::unique_ptr<Flow> > mFlows;
+
+  /**
+   * Flow output channels mixed into each playback channel of the host.
+   */
+  std::vector<std::vector<SampleType const *> > mPlaybackSources;
+
+  /**
+   * Flow indices assigned to each thread, index 0 denotes the calling thread.
+   */
+  std::vector<std::vector<std::size_t> > mQueues;
+
+  /**
+   * Position of the next unclaimed flow in each queue (lower 32 bits), tagged with the current cycle (upper 32 bits).
+   * Claimed by compare-and-swap both by the owning thread and by stealing threads. The tag prevents a worker that
+   * wakes up late from claiming flows of a later process() call.
+   */
+  std::unique_ptr<std::atomic<std::uint64_t>[]> mQueueHeads;
+
+  /**
+   * Number of flows of the current process() call that have not completed yet.
+   */
+  std::atomic<std::size_t> mPendingFlows;
+
+  /**
+   * Counter of process() calls. When using worker threads, it is protected by mMutex and signals the start of a
+   * block to the workers.
+   */
+  std::uint32_t mCycle;
+
+#ifndef VISR_DISABLE_THREADS
+  /**
+   * Main loop of a worker thread.
+   */
+  void runWorker( std::size_t threadIdx );
+
+  std::vector<std::thread> mWorkers;
+
+  std::mutex mMutex;
+
+  std::condition_variable mStart;
+
+  bool mRunning;
+#endif
+};
+
+} // namespace rrl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRRL_MULTI_FLOW_HOST_HPP_INCLUDED
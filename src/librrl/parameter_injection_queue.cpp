@@ -0,0 +1,72 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "parameter_injection_queue.hpp"
+
+#include <libvisr/parameter_base.hpp>
+
+#include <ciso646>
+
+namespace visr
+{
+namespace rrl
+{
+
+ParameterInjectionQueue::ParameterInjectionQueue( CommunicationProtocolBase::Output & endpoint,
+                                                  std::size_t capacity )
+ : mEndpoint( endpoint )
+ , mPending( capacity )
+ // Every object in the recycle queue has passed the pending queue, so twice the capacity makes an overflow unlikely.
+ , mRecycled( 2 * capacity )
+{
+}
+
+ParameterInjectionQueue::~ParameterInjectionQueue()
+{
+  ParameterBase * param;
+  while( mPending.pop( param ) )
+  {
+    delete param;
+  }
+  collectGarbage();
+}
+
+bool ParameterInjectionQueue::push( std::unique_ptr<ParameterBase> & value )
+{
+  collectGarbage();
+  if( not mPending.push( value.get() ) )
+  {
+    return false;
+  }
+  value.release();
+  return true;
+}
+
+void ParameterInjectionQueue::deliver()
+{
+  ParameterBase * param;
+  while( mPending.pop( param ) )
+  {
+    std::unique_ptr<ParameterBase> value( param );
+    mEndpoint.injectParameter( value );
+    if( value )
+    {
+      // Hand the object back to the producers for deletion. Deallocate here only if the recycle queue is full.
+      if( mRecycled.push( value.get() ) )
+      {
+        value.release();
+      }
+    }
+  }
+}
+
+void ParameterInjectionQueue::collectGarbage()
+{
+  ParameterBase * param;
+  while( mRecycled.pop( param ) )
+  {
+    delete param;
+  }
+}
+
+} // namespace rrl
+} // namespace visr
@@ -0,0 +1,79 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRRL_PARAMETER_INJECTION_QUEUE_HPP_INCLUDED
+#define VISR_LIBRRL_PARAMETER_INJECTION_QUEUE_HPP_INCLUDED
+
+#include <libvisr/communication_protocol_base.hpp>
+
+#include <librbbl/lock_free_queue.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace visr
+{
+// Forward declarations
+class ParameterBase;
+
+namespace rrl
+{
+
+/**
+ * Internal helper class to pass parameter values from arbitrary threads to a top-level parameter input of a signal
+ * flow without locking.
+ * Producers hand over heap-allocated parameter objects through a lock-free queue. The audio thread forwards them to
+ * the communication protocol of the port (see CommunicationProtocolBase::Output::injectParameter()).
+ * Objects that are not taken over by the protocol are returned through a second lock-free queue and deleted by the
+ * next producer call, so the audio thread neither blocks nor deallocates memory in the regular case.
+ */
+class ParameterInjectionQueue
+{
+public:
+  /**
+   * Constructor.
+   * @param endpoint The protocol output of the top-level parameter port. Must support parameter injection.
+   * @param capacity The maximum number of pending parameters, must be a power of two.
+   */
+  explicit ParameterInjectionQueue( CommunicationProtocolBase::Output & endpoint,
+                                    std::size_t capacity );
+
+  /**
+   * Destructor, deletes all parameter objects that have not been delivered or collected.
+   */
+  ~ParameterInjectionQueue();
+
+  ParameterInjectionQueue( ParameterInjectionQueue const & ) = delete;
+
+  ParameterInjectionQueue & operator=( ParameterInjectionQueue const & ) = delete;
+
+  /**
+   * Producer side: Enqueue a parameter value. Can be called from any thread.
+   * @param value The parameter value. Ownership is transferred if the call succeeds.
+   * @return true if the value has been enqueued, false if the queue is full. In the latter case, \p value is
+   * unchanged.
+   */
+  bool push( std::unique_ptr<ParameterBase> & value );
+
+  /**
+   * Consumer side: Forward all pending parameters to the protocol endpoint.
+   * Must be called from the audio thread only.
+   */
+  void deliver();
+
+private:
+  /**
+   * Delete the parameter objects returned by the consumer.
+   */
+  void collectGarbage();
+
+  CommunicationProtocolBase::Output & mEndpoint;
+
+  rbbl::LockFreeQueue< ParameterBase * > mPending;
+
+  rbbl::LockFreeQueue< ParameterBase * > mRecycled;
+};
+
+} // namespace rrl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRRL_PARAMETER_INJECTION_QUEUE_HPP_INCLUDED
@@ -0,0 +1,205 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "performance_counters.hpp"
+
+#include <libvisr/detail/compose_message_string.hpp>
+
+#include <atomic>
+#include <ciso646>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+namespace visr
+{
+namespace rrl
+{
+
+#ifdef __linux__
+
+namespace // unnamed
+{
+
+std::uint64_t const cCounterEvents[PerformanceCounters::cNumberOfCounters] =
+{
+  PERF_COUNT_HW_CPU_CYCLES,
+  PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CACHE_MISSES,
+  PERF_COUNT_HW_BRANCH_MISSES
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+inline std::uint64_t readPmc( std::uint32_t counter )
+{
+  std::uint32_t low;
+  std::uint32_t high;
+  __asm__ volatile( "rdpmc" : "=a"( low ), "=d"( high ) : "c"( counter ) );
+  return (static_cast<std::uint64_t>( high ) << 32) | low;
+}
+#endif
+
+} // unnamed namespace
+
+PerformanceCounters::PerformanceCounters()
+ : mPageSize( static_cast<std::size_t>( sysconf( _SC_PAGESIZE ) ) )
+ , mUserSpaceRead( false )
+{
+  mFileDescriptors.fill( -1 );
+  mPages.fill( nullptr );
+  for( std::size_t counterIdx( 0 ); counterIdx < cNumberOfCounters; ++counterIdx )
+  {
+    perf_event_attr attr;
+    std::memset( &attr, 0, sizeof( attr ) );
+    attr.size = sizeof( attr );
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = cCounterEvents[counterIdx];
+    attr.read_format = PERF_FORMAT_GROUP;
+    // The group is enabled as a whole after all counters have been created.
+    attr.disabled = (counterIdx == 0) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    int const groupFd = (counterIdx == 0) ? -1 : mFileDescriptors[0];
+    int const fd = static_cast<int>( syscall( SYS_perf_event_open, &attr, 0 /*calling thread*/, -1 /*any cpu*/,
+                                              groupFd, PERF_FLAG_FD_CLOEXEC ) );
+    if( fd < 0 )
+    {
+      int const errorCode = errno;
+      release();
+      throw std::runtime_error( detail::composeMessageString( "PerformanceCounters: Cannot open hardware counter: ",
+        std::strerror( errorCode ) ) );
+    }
+    mFileDescriptors[counterIdx] = fd;
+    void * page = mmap( nullptr, mPageSize, PROT_READ, MAP_SHARED, fd, 0 );
+    mPages[counterIdx] = (page == MAP_FAILED) ? nullptr : page;
+  }
+#if defined(__x86_64__) || defined(__i386__)
+  mUserSpaceRead = true;
+  for( void * page : mPages )
+  {
+    mUserSpaceRead = mUserSpaceRead and (page != nullptr)
+      and (static_cast<perf_event_mmap_page const *>( page )->cap_user_rdpmc != 0);
+  }
+#endif
+  ioctl( mFileDescriptors[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP );
+  ioctl( mFileDescriptors[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+}
+
+PerformanceCounters::~PerformanceCounters()
+{
+  release();
+}
+
+void PerformanceCounters::release()
+{
+  for( std::size_t counterIdx( 0 ); counterIdx < cNumberOfCounters; ++counterIdx )
+  {
+    if( mPages[counterIdx] )
+    {
+      munmap( mPages[counterIdx], mPageSize );
+      mPages[counterIdx] = nullptr;
+    }
+  }
+  // Close the group members before the leader.
+  for( std::size_t counterIdx( cNumberOfCounters ); counterIdx > 0; --counterIdx )
+  {
+    if( mFileDescriptors[counterIdx - 1] >= 0 )
+    {
+      close( mFileDescriptors[counterIdx - 1] );
+      mFileDescriptors[counterIdx - 1] = -1;
+    }
+  }
+}
+
+void PerformanceCounters::read( ValueArray & values ) const
+{
+#if defined(__x86_64__) || defined(__i386__)
+  if( mUserSpaceRead )
+  {
+    for( std::size_t counterIdx( 0 ); counterIdx < cNumberOfCounters; ++counterIdx )
+    {
+      perf_event_mmap_page const volatile * page = static_cast<perf_event_mmap_page const volatile *>( mPages[counterIdx] );
+      std::uint32_t sequence;
+      std::uint64_t value;
+      // Sequence lock protocol described in linux/perf_event.h.
+      do
+      {
+        sequence = page->lock;
+        std::atomic_signal_fence( std::memory_order_seq_cst );
+        std::uint32_t const index = page->index;
+        if( index == 0 )
+        {
+          // The counter is currently not active on the CPU.
+          readGroup( values );
+          return;
+        }
+        std::uint16_t const width = page->pmc_width;
+        std::int64_t pmc = static_cast<std::int64_t>( readPmc( index - 1 ) );
+        // Sign-extend the raw counter value of width pmc_width.
+        pmc = static_cast<std::int64_t>( static_cast<std::uint64_t>( pmc ) << (64 - width) ) >> (64 - width);
+        value = static_cast<std::uint64_t>( page->offset + pmc );
+        std::atomic_signal_fence( std::memory_order_seq_cst );
+      }
+      while( page->lock != sequence );
+      values[counterIdx] = value;
+    }
+    return;
+  }
+#endif
+  readGroup( values );
+}
+
+void PerformanceCounters::readGroup( ValueArray & values ) const
+{
+  // Layout for PERF_FORMAT_GROUP: number of counters, followed by the values.
+  std::uint64_t buffer[cNumberOfCounters + 1];
+  ssize_t const res = ::read( mFileDescriptors[0], buffer, sizeof( buffer ) );
+  if( (res != static_cast<ssize_t>( sizeof( buffer ) )) or (buffer[0] != cNumberOfCounters) )
+  {
+    throw std::runtime_error( "PerformanceCounters: Error while reading the counter group." );
+  }
+  for( std::size_t counterIdx( 0 ); counterIdx < cNumberOfCounters; ++counterIdx )
+  {
+    values[counterIdx] = buffer[counterIdx + 1];
+  }
+}
+
+#else // __linux__
+
+PerformanceCounters::PerformanceCounters()
+ : mPageSize( 0 )
+ , mUserSpaceRead( false )
+{
+  mFileDescriptors.fill( -1 );
+  mPages.fill( nullptr );
+  throw std::runtime_error( "PerformanceCounters: Hardware performance counters are supported on Linux only." );
+}
+
+PerformanceCounters::~PerformanceCounters() = default;
+
+void PerformanceCounters::release()
+{
+}
+
+void PerformanceCounters::read( ValueArray & values ) const
+{
+  values.fill( 0 );
+}
+
+void PerformanceCounters::readGroup( ValueArray & values ) const
+{
+  values.fill( 0 );
+}
+
+#endif // __linux__
+
+} // namespace rrl
+} // namespace visr
@@ -0,0 +1,83 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRRL_PERFORMANCE_COUNTERS_HPP_INCLUDED
+#define VISR_LIBRRL_PERFORMANCE_COUNTERS_HPP_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace visr
+{
+namespace rrl
+{
+
+/**
+ * Internal class to access the hardware performance counters of the CPU for the calling thread.
+ * The counters for CPU cycles, retired instructions, cache misses, and branch misses are opened as a group using
+ * the Linux perf_event_open() interface, such that they are scheduled onto the CPU together. Only events in user
+ * space are counted.
+ * If supported by the kernel and the CPU, the counters are read in user space by the rdpmc instruction, otherwise a
+ * single read() system call is used for the whole group.
+ * The counters only count the events of the thread that created the object, so they must be read in that thread.
+ * On other platforms than Linux, the constructor throws an exception.
+ */
+class PerformanceCounters
+{
+public:
+  static constexpr std::size_t cNumberOfCounters = 4;
+
+  using ValueArray = std::array<std::uint64_t, cNumberOfCounters>;
+
+  /**
+   * Constructor, opens and enables the counters for the calling thread.
+   * @throw std::runtime_error If the counters cannot be opened, e.g., because the platform does not provide hardware
+   * counters or the access is restricted by the system configuration (see /proc/sys/kernel/perf_event_paranoid).
+   */
+  PerformanceCounters();
+
+  ~PerformanceCounters();
+
+  PerformanceCounters( PerformanceCounters const & ) = delete;
+
+  PerformanceCounters & operator=( PerformanceCounters const & ) = delete;
+
+  /**
+   * Read the current values of all counters, in the order cycles, instructions, cache misses, branch misses.
+   * The values are monotonously increasing, so the number of events of a code section is the difference of two
+   * readings.
+   */
+  void read( ValueArray & values ) const;
+
+  /**
+   * Whether the counters are read in user space by the rdpmc instruction.
+   */
+  bool userSpaceRead() const { return mUserSpaceRead; }
+
+private:
+  /**
+   * Unmap and close all counters that have been opened.
+   */
+  void release();
+
+  /**
+   * Read all counters by a read() call on the group leader.
+   */
+  void readGroup( ValueArray & values ) const;
+
+  std::array<int, cNumberOfCounters> mFileDescriptors;
+
+  /**
+   * Memory-mapped perf_event_mmap_page structures of the counters, or nullptr if not mapped.
+   */
+  std::array<void *, cNumberOfCounters> mPages;
+
+  std::size_t mPageSize;
+
+  bool mUserSpaceRead;
+};
+
+} // namespace rrl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRRL_PERFORMANCE_COUNTERS_HPP_INCLUDED
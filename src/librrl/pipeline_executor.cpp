@@ -0,0 +1,350 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "pipeline_executor.hpp"
+
+#include "audio_connection_map.hpp"
+#include "communication_area.hpp"
+#include "port_utilities.hpp"
+#include "thread_configuration.hpp"
+
+#include <libefl/alignment.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/constants.hpp>
+#include <libvisr/detail/compose_message_string.hpp>
+
+#include <libvisr/impl/audio_port_base_implementation.hpp>
+#include <libvisr/impl/component_implementation.hpp>
+
+#include <algorithm>
+#include <ciso646>
+#include <map>
+#include <stdexcept>
+
+namespace visr
+{
+namespace rrl
+{
+
+PipelineExecutor::PipelineExecutor( std::vector<AtomicComponent *> const & schedule,
+                                    std::vector<std::size_t> const & componentStages,
+                                    AudioConnectionMap const & audioConnections,
+                                    std::size_t period,
+                                    StageFunction const & stageFunction,
+                                    int realtimePriority /*= 0*/,
+                                    bool cpuAffinity /*= false*/ )
+ : mStageFunction( stageFunction )
+ , mImmediateTransfers( schedule.size() )
+#ifndef VISR_DISABLE_THREADS
+ , mRunning( false )
+#endif
+{
+#ifdef VISR_DISABLE_THREADS
+  throw std::invalid_argument( "PipelineExecutor: Pipelined execution is not supported because threads are disabled." );
+#else
+  if( componentStages.size() != schedule.size() )
+  {
+    throw std::invalid_argument( "PipelineExecutor: The number of stage indices does not match the schedule length." );
+  }
+  std::size_t const numStages = schedule.empty() ? 1
+    : *std::max_element( componentStages.begin(), componentStages.end() ) + 1;
+  mStageSchedules.resize( numStages );
+  std::map<impl::ComponentImplementation const *, std::size_t> scheduleIndices;
+  for( std::size_t compIdx( 0 ); compIdx < schedule.size(); ++compIdx )
+  {
+    mStageSchedules[componentStages[compIdx]].push_back( compIdx );
+    scheduleIndices[&(schedule[compIdx]->implementation())] = compIdx;
+  }
+
+  // Collect the incoming channels of all receive ports.
+  using IncomingChannels = std::vector<AudioChannel>;
+  std::map<impl::AudioPortBaseImplementation *, IncomingChannels> receivePorts;
+  for( AudioConnectionMap::value_type const & connection : audioConnections )
+  {
+    impl::AudioPortBaseImplementation * receivePort = connection.second.port();
+    IncomingChannels & incoming = receivePorts[receivePort];
+    incoming.resize( receivePort->width(), AudioChannel( nullptr, 0 ) );
+    incoming[connection.second.channel()] = connection.first;
+  }
+
+  // Top-level inputs are filled before stage 0 is executed, and the top-level outputs are read after the last
+  // stage. The latter is considered by assigning them to the (virtual) stage numStages, where a delay of one block
+  // corresponds to reading the signal directly.
+  auto const stageIndex = [&]( impl::AudioPortBaseImplementation const * port, bool receive ) -> std::size_t
+  {
+    if( isToplevelPort( port ) )
+    {
+      return receive ? numStages : 0;
+    }
+    return componentStages[scheduleIndices.at( &(port->parent()) )];
+  };
+
+  // First pass: Determine the delays of the channels and the sizes of the delay buffers.
+  struct PortDelays
+  {
+    impl::AudioPortBaseImplementation * port;
+    std::vector<std::size_t> delays;
+    std::size_t numberOfLayers;
+    std::size_t channelSizeBytes;
+  };
+  std::vector<PortDelays> delayedPorts;
+  std::size_t memorySize = 0;
+  std::size_t numFlags = 0;
+  for( auto const & entry : receivePorts )
+  {
+    impl::AudioPortBaseImplementation * receivePort = entry.first;
+    bool const topLevel = isToplevelPort( receivePort );
+    std::size_t const receiveStage = stageIndex( receivePort, true );
+    std::vector<std::size_t> delays( receivePort->width() );
+    for( std::size_t chIdx( 0 ); chIdx < receivePort->width(); ++chIdx )
+    {
+      AudioChannel const & sendChannel = entry.second[chIdx];
+      // Input routing components may contain unused, unconnected channels.
+      if( sendChannel.port() == nullptr )
+      {
+        delays[chIdx] = 0;
+        continue;
+      }
+      std::size_t const sendStage = stageIndex( sendChannel.port(), false );
+      if( sendStage > receiveStage )
+      {
+        throw std::invalid_argument( detail::composeMessageString( "PipelineExecutor: Receive port \"",
+          fullyQualifiedName( *receivePort ), "\" is assigned to an earlier stage than its input signals." ) );
+      }
+      delays[chIdx] = receiveStage - sendStage;
+    }
+    std::size_t const maxDelay = delays.empty() ? 0 : *std::max_element( delays.begin(), delays.end() );
+    // Top-level outputs fed exclusively by the last stage are read directly.
+    if( (maxDelay == 0) or (topLevel and (maxDelay == 1)) )
+    {
+      continue;
+    }
+    std::size_t const channelSizeBytes = efl::nextAlignedSize( period * receivePort->sampleSize(), cVectorAlignmentBytes );
+    delayedPorts.push_back( PortDelays{ receivePort, std::move( delays ), maxDelay, channelSizeBytes } );
+    memorySize += maxDelay * receivePort->width() * channelSizeBytes;
+    numFlags += maxDelay * receivePort->width();
+  }
+
+  // Second pass: Allocate the delay buffers and redirect the receive ports.
+  mDelayMemory.reset( new AudioSignalPool( memorySize, cVectorAlignmentBytes ) );
+  std::fill( mDelayMemory->basePointer(), mDelayMemory->basePointer() + memorySize, static_cast<char>(0) );
+  // The flags are allocated before their addresses are taken.
+  mDelayFlags.assign( numFlags, 0 );
+  std::size_t memoryOffset = 0;
+  std::size_t flagOffset = 0;
+  for( PortDelays const & portDelays : delayedPorts )
+  {
+    impl::AudioPortBaseImplementation * port = portDelays.port;
+    std::size_t const width = port->width();
+    std::size_t const numLayers = portDelays.numberOfLayers;
+    DelayedPort delayed;
+    delayed.port = port;
+    delayed.numberOfLayers = numLayers;
+    delayed.layerSizeBytes = width * portDelays.channelSizeBytes;
+    delayed.buffer = mDelayMemory->basePointer() + memoryOffset;
+    delayed.flags = mDelayFlags.data() + flagOffset;
+    delayed.gathered = port->gathered();
+    delayed.basePointer = port->basePointer();
+    delayed.channelStrideSamples = port->channelStrideSamples();
+    IncomingChannels const & incoming = receivePorts.at( port );
+    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
+    {
+      delayed.channelPointers.push_back( port->channelPointer( chIdx ) );
+      delayed.flagSources.push_back( incoming[chIdx].port() ? incoming[chIdx].port()->silentFlag( incoming[chIdx].channel() )
+                                                            : port->silentFlag( chIdx ) );
+    }
+    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
+    {
+      if( incoming[chIdx].port() == nullptr )
+      {
+        continue;
+      }
+      std::size_t const delay = portDelays.delays[chIdx];
+      // Undelayed channels are copied directly into the last layer immediately before the component is executed.
+      std::size_t const layer = (delay == 0) ? numLayers - 1 : numLayers - delay;
+      impl::AudioPortBaseImplementation * sendPort = incoming[chIdx].port();
+      ChannelTransfer const transfer{ static_cast<char const *>(sendPort->channelPointer( incoming[chIdx].channel() )),
+        delayed.buffer + layer * delayed.layerSizeBytes + chIdx * portDelays.channelSizeBytes,
+        period * port->sampleSize(),
+        delayed.flagSources[chIdx],
+        delayed.flags + layer * width + chIdx };
+      if( delay == 0 )
+      {
+        mImmediateTransfers[scheduleIndices.at( &(port->parent()) )].push_back( transfer );
+      }
+      else
+      {
+        mBlockTransfers.push_back( transfer );
+      }
+    }
+    port->setBufferConfig( delayed.buffer + (numLayers - 1) * delayed.layerSizeBytes,
+                           portDelays.channelSizeBytes / port->sampleSize() );
+    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
+    {
+      port->setSilentFlagSource( chIdx, delayed.flags + (numLayers - 1) * width + chIdx );
+    }
+    memoryOffset += numLayers * delayed.layerSizeBytes;
+    flagOffset += numLayers * width;
+    mDelayedPorts.push_back( std::move( delayed ) );
+  }
+
+  // All worker objects are created before the threads are started, because the threads access mWorkers.
+  for( std::size_t stageIdx( 1 ); stageIdx < numStages; ++stageIdx )
+  {
+    mWorkers.emplace_back( new Worker() );
+  }
+  mRunning.store( true );
+  for( std::size_t stageIdx( 1 ); stageIdx < numStages; ++stageIdx )
+  {
+    std::thread & thread = mWorkers[stageIdx - 1]->thread;
+    thread = std::thread( &PipelineExecutor::runWorker, this, stageIdx );
+    setRealtimePriority( thread, realtimePriority, "PipelineExecutor" );
+    if( cpuAffinity )
+    {
+      setCpuAffinity( thread, stageIdx, "PipelineExecutor" );
+    }
+  }
+#endif // VISR_DISABLE_THREADS
+}
+
+PipelineExecutor::~PipelineExecutor()
+{
+#ifndef VISR_DISABLE_THREADS
+  mRunning.store( false );
+  for( auto & worker : mWorkers )
+  {
+    {
+      std::lock_guard<std::mutex> lock( worker->mutex );
+      worker->start.notify_one();
+    }
+    worker->thread.join();
+  }
+#endif
+}
+
+void PipelineExecutor::execute()
+{
+#ifndef VISR_DISABLE_THREADS
+  for( auto & worker : mWorkers )
+  {
+    std::lock_guard<std::mutex> lock( worker->mutex );
+    ++(worker->requestedBlocks);
+    worker->start.notify_one();
+  }
+  std::exception_ptr error;
+  try
+  {
+    mStageFunction( 0 );
+  }
+  catch( ... )
+  {
+    error = std::current_exception();
+  }
+  // Wait for the other stages without blocking on a lock or condition variable, such that the calling (audio) thread
+  // does not depend on the scheduling of the code signalling the completion. requestedBlocks is only written by this
+  // thread.
+  for( auto & worker : mWorkers )
+  {
+    while( worker->completedBlocks.load( std::memory_order_acquire ) != worker->requestedBlocks )
+    {
+      std::this_thread::yield();
+    }
+    if( worker->error )
+    {
+      if( not error )
+      {
+        error = worker->error;
+      }
+      worker->error = nullptr;
+    }
+  }
+  if( error )
+  {
+    std::rethrow_exception( error );
+  }
+  advance();
+#endif
+}
+
+void PipelineExecutor::restorePorts()
+{
+  for( DelayedPort const & delayed : mDelayedPorts )
+  {
+    if( delayed.gathered )
+    {
+      delayed.port->setGatherConfig( delayed.channelPointers, delayed.channelStrideSamples );
+    }
+    else
+    {
+      delayed.port->setBufferConfig( delayed.basePointer, delayed.channelStrideSamples );
+    }
+    for( std::size_t chIdx( 0 ); chIdx < delayed.flagSources.size(); ++chIdx )
+    {
+      delayed.port->setSilentFlagSource( chIdx, delayed.flagSources[chIdx] );
+    }
+  }
+  mDelayedPorts.clear();
+  mBlockTransfers.clear();
+  for( auto & transfers : mImmediateTransfers )
+  {
+    transfers.clear();
+  }
+}
+
+std::size_t PipelineExecutor::delayBufferSize() const
+{
+  return mDelayMemory ? mDelayMemory->size() : 0;
+}
+
+void PipelineExecutor::advance()
+{
+  for( DelayedPort const & delayed : mDelayedPorts )
+  {
+    if( delayed.numberOfLayers > 1 )
+    {
+      std::size_t const width = delayed.port->width();
+      std::memmove( delayed.buffer + delayed.layerSizeBytes, delayed.buffer,
+                    (delayed.numberOfLayers - 1) * delayed.layerSizeBytes );
+      std::memmove( delayed.flags + width, delayed.flags, (delayed.numberOfLayers - 1) * width );
+    }
+  }
+  for( ChannelTransfer const & transfer : mBlockTransfers )
+  {
+    transfer.execute();
+  }
+}
+
+#ifndef VISR_DISABLE_THREADS
+void PipelineExecutor::runWorker( std::size_t stageIdx )
+{
+  Worker & worker = *(mWorkers[stageIdx - 1]);
+  std::size_t processedBlocks = 0;
+  for( ;; )
+  {
+    {
+      std::unique_lock<std::mutex> lock( worker.mutex );
+      worker.start.wait( lock, [this, &worker, processedBlocks]
+        { return (worker.requestedBlocks != processedBlocks) or not mRunning.load(); } );
+      if( not mRunning.load() )
+      {
+        return;
+      }
+    }
+    std::exception_ptr error;
+    try
+    {
+      mStageFunction( stageIdx );
+    }
+    catch( ... )
+    {
+      error = std::current_exception();
+    }
+    ++processedBlocks;
+    worker.error = error;
+    worker.completedBlocks.store( processedBlocks, std::memory_order_release );
+  }
+}
+#endif
+
+} // namespace rrl
+} // namespace visr
@@ -0,0 +1,233 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRRL_PIPELINE_EXECUTOR_HPP_INCLUDED
+#define VISR_LIBRRL_PIPELINE_EXECUTOR_HPP_INCLUDED
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#ifndef VISR_DISABLE_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace visr
+{
+// Forward declarations
+class AtomicComponent;
+
+namespace impl
+{
+class AudioPortBaseImplementation;
+}
+
+namespace rrl
+{
+// Forward declarations
+class AudioConnectionMap;
+class AudioSignalPool;
+
+/**
+ * Internal helper class for the pipelined execution of a signal flow.
+ * The atomic components of the processing schedule are assigned to stages, and in each block, the stages are
+ * executed concurrently, stage \p k processing the data of the block that entered the flow \p k blocks earlier.
+ * Stage 0 runs in the calling thread, all other stages run in dedicated worker threads. The calling thread does not
+ * sleep until the workers signal their completion, but polls their block counters.
+ * Receive ports connected to send ports of earlier stages are re-pointed to delay buffers, which are filled from the
+ * send ports after all stages have completed a block. In this way, producer and consumer never access the same
+ * memory concurrently, and the signals arrive with the delay corresponding to the stage difference.
+ * The top-level outputs are delayed such that all output signals are delayed by the same number of blocks,
+ * i.e., the number of stages minus one.
+ * @pre All audio ports use dedicated buffers in the audio signal pool, i.e., receive ports only alias the buffers of
+ * their send ports.
+ */
+class PipelineExecutor
+{
+public:
+  /**
+   * Function type to execute the components of a stage, called with the stage index.
+   */
+  using StageFunction = std::function<void( std::size_t )>;
+
+  /**
+   * Constructor. Creates the delay buffers, re-points the affected receive ports and starts the worker threads.
+   * @param schedule The sequential processing schedule of the signal flow.
+   * @param componentStages The stage of each component in \p schedule. All stages between zero and the maximum value
+   * must be used. Components must not be assigned to earlier stages than the send ports they are connected to.
+   * @param audioConnections The final audio connections of the flattened signal flow.
+   * @param period The number of samples per block.
+   * @param stageFunction Function to execute a stage, called concurrently for different stages.
+   * @param realtimePriority If nonzero, the worker threads are run with the SCHED_FIFO policy and this priority.
+   * @param cpuAffinity If true, the worker thread of stage \p k is bound to the CPU core \p k (modulo the number of
+   * cores), where supported.
+   * @throw std::invalid_argument If VISR is built without thread support.
+   */
+  explicit PipelineExecutor( std::vector<AtomicComponent *> const & schedule,
+                             std::vector<std::size_t> const & componentStages,
+                             AudioConnectionMap const & audioConnections,
+                             std::size_t period,
+                             StageFunction const & stageFunction,
+                             int realtimePriority = 0,
+                             bool cpuAffinity = false );
+
+  /**
+   * Destructor, stops and joins the worker threads.
+   * The receive ports are not reset, use restorePorts() for that.
+   */
+  ~PipelineExecutor();
+
+  PipelineExecutor( PipelineExecutor const & ) = delete;
+
+  PipelineExecutor & operator=( PipelineExecutor const & ) = delete;
+
+  std::size_t numberOfStages() const { return mStageSchedules.size(); }
+
+  /**
+   * Return the indices of the components of stage \p stageIdx within the processing schedule, in execution order.
+   */
+  std::vector<std::size_t> const & stageSchedule( std::size_t stageIdx ) const { return mStageSchedules[stageIdx]; }
+
+  /**
+   * Copy the current signals to the delay buffers of the component at position \p scheduleIdx of the schedule.
+   * This is needed for receive ports that combine delayed and undelayed channels, and must be called in the
+   * respective stage immediately before the component is executed.
+   */
+  void prepareComponent( std::size_t scheduleIdx )
+  {
+    for( ChannelTransfer const & transfer : mImmediateTransfers[scheduleIdx] )
+    {
+      transfer.execute();
+    }
+  }
+
+  /**
+   * Execute all stages for one block and advance the delay buffers afterwards.
+   * Returns after all stages have completed.
+   * If a stage throws an exception, it is passed on after all stages have finished.
+   */
+  void execute();
+
+  /**
+   * Point all receive ports that have been redirected to delay buffers back to their original buffers.
+   */
+  void restorePorts();
+
+  /**
+   * Return the size of the memory allocated for the delay buffers, in bytes.
+   */
+  std::size_t delayBufferSize() const;
+
+private:
+  /**
+   * Copy operation of the samples and the silence flag of a single channel.
+   */
+  struct ChannelTransfer
+  {
+    void execute() const
+    {
+      std::memcpy( destination, source, size );
+      *destinationFlag = *sourceFlag;
+    }
+
+    char const * source;
+    char * destination;
+    std::size_t size;
+    std::uint8_t const * sourceFlag;
+    std::uint8_t * destinationFlag;
+  };
+
+  /**
+   * A receive port redirected to a delay buffer.
+   * The buffer consists of contiguous layers of port width channels each, the port references the last layer.
+   * A signal entering layer \p k reaches the port after <tt>numberOfLayers-k</tt> blocks.
+   */
+  struct DelayedPort
+  {
+    impl::AudioPortBaseImplementation * port;
+    std::size_t numberOfLayers;
+    std::size_t layerSizeBytes;
+    char * buffer;
+    std::uint8_t * flags;
+    /**
+     * Original configuration of the port, used by restorePorts().
+     */
+    //@{
+    bool gathered;
+    void * basePointer;
+    std::size_t channelStrideSamples;
+    std::vector<void *> channelPointers;
+    std::vector<std::uint8_t const *> flagSources;
+    //@}
+  };
+
+  /**
+   * Shift the contents of all delay buffers by one layer and insert the signals produced in the current block.
+   */
+  void advance();
+
+  StageFunction const mStageFunction;
+
+  std::vector<std::vector<std::size_t> > mStageSchedules;
+
+  std::unique_ptr<AudioSignalPool> mDelayMemory;
+
+  std::vector<std::uint8_t> mDelayFlags;
+
+  std::vector<DelayedPort> mDelayedPorts;
+
+  /**
+   * Transfers executed after each block.
+   */
+  std::vector<ChannelTransfer> mBlockTransfers;
+
+  /**
+   * Transfers executed before individual components, indexed by the schedule position.
+   */
+  std::vector<std::vector<ChannelTransfer> > mImmediateTransfers;
+
+#ifndef VISR_DISABLE_THREADS
+  /**
+   * State of the worker thread executing a stage.
+   */
+  struct Worker
+  {
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable start;
+    /**
+     * Number of blocks requested by execute(), protected by \p mutex.
+     */
+    std::size_t requestedBlocks = 0;
+    /**
+     * Number of blocks completed by the worker, polled by execute().
+     * The store releases \p error to the calling thread.
+     */
+    std::atomic<std::size_t> completedBlocks{ 0 };
+    std::exception_ptr error;
+  };
+
+  /**
+   * Main loop of a worker thread.
+   */
+  void runWorker( std::size_t stageIdx );
+
+  std::atomic<bool> mRunning;
+
+  /**
+   * Workers for the stages 1...numberOfStages()-1.
+   */
+  std::vector<std::unique_ptr<Worker> > mWorkers;
+#endif
+};
+
+} // namespace rrl
+} // namespace visr
+
+#endif // #ifndef VISR_LIBRRL_PIPELINE_EXECUTOR_HPP_INCLUDED
@@ -3,6 +3,7 @@
 #include "runtime_profiler.hpp"
 
 #include "audio_signal_flow.hpp"
+#include "performance_counters.hpp"
 
 #include <libefl/basic_matrix.hpp>
 #include <libefl/basic_vector.hpp>
@@ -25,7 +26,8 @@ namespace rrl
 {
 
 RuntimeProfiler::RuntimeProfiler( AudioSignalFlow const & flow,
-                                  std::size_t measureBufferSize )
+                                  std::size_t measureBufferSize,
+                                  bool hardwareCounters /*= false*/ )
 : mFlow{ flow }
 , cNumberOfAtomicComponents{ flow.mProcessingSchedule.size() }
 , mMeasurementSampleCounter{ 0 }
@@ -39,7 +41,21 @@ RuntimeProfiler::RuntimeProfiler( AudioSignalFlow const & flow,
 , mRunningM2( cNumberOfAtomicComponents, visr::cVectorAlignmentSamples )
 , mTmpBuffer( cNumberOfAtomicComponents, visr::cVectorAlignmentSamples )
 , mTmpBuffer2( cNumberOfAtomicComponents, visr::cVectorAlignmentSamples )
+, cHardwareCounters( hardwareCounters )
+, mCountersMeasured( true )
+, mCounterSampleCounter{ 0 }
+, mCurrentCounterData( hardwareCounters ? cNumberOfHardwareCounters : 0,
+   cNumberOfAtomicComponents, visr::cVectorAlignmentSamples )
+, mCounterMean( hardwareCounters ? cNumberOfHardwareCounters : 0,
+   cNumberOfAtomicComponents, visr::cVectorAlignmentSamples )
+, mCounterM2( hardwareCounters ? cNumberOfHardwareCounters : 0,
+   cNumberOfAtomicComponents, visr::cVectorAlignmentSamples )
 {
+  if( cHardwareCounters )
+  {
+    // Also checks the availability of the counters.
+    attachToCurrentThread();
+  }
 }
 
 RuntimeProfiler::~RuntimeProfiler() = default;
@@ -61,12 +77,43 @@ void RuntimeProfiler::setTime( std::size_t componentIdx, TimeType timing )
 void RuntimeProfiler::finishIteration()
 {
   // Statistics that do not involve saving raw timings.
-  if( mStatisticsSampleCounter == 0 )
+  updateStatistics( mCurrentData.data(), mRunningMean.data(), mRunningM2.data(),
+    mStatisticsSampleCounter );
+  if( cHardwareCounters and mCountersMeasured )
   {
+    for( std::size_t counterIdx{ 0 }; counterIdx < cNumberOfHardwareCounters; ++counterIdx )
+    {
+      updateStatistics( mCurrentCounterData.row( counterIdx ),
+        mCounterMean.row( counterIdx ), mCounterM2.row( counterIdx ), mCounterSampleCounter );
+    }
+    ++mCounterSampleCounter;
+  }
+  mCountersMeasured = true;
+  
+  if( measurementBufferSize() )
+  {
+    std::size_t const currentRowIdx = mMeasurementSampleCounter % measurementBufferSize();
     efl::ErrorCode res;
-    // Only mean can be computed in the first iteration.
     if( (res = efl::vectorCopy( mCurrentData.data(),
-      mRunningMean.data(), numberOfComponents(),
+      mCurrentMeasurementBuffer.row(currentRowIdx), numberOfComponents(),
+      visr::cVectorAlignmentSamples )) != efl::noError )
+    {
+      throw std::runtime_error( "Error updating profiling data: raw timings." );
+    }
+  }
+  ++mStatisticsSampleCounter;
+  ++mMeasurementSampleCounter;
+}
+  
+void RuntimeProfiler::updateStatistics( TimeType const * current, TimeType * mean, TimeType * m2,
+                                        std::size_t sampleCount )
+{
+  if( sampleCount == 0 )
+  {
+    efl::ErrorCode res;
+    // Only mean can be computed in the first iteration.
+    if( (res = efl::vectorCopy( current,
+      mean, numberOfComponents(),
       visr::cVectorAlignmentSamples )) != efl::noError )
     {
       throw std::runtime_error( "Error updating profiling data: raw timings." );
@@ -77,10 +124,10 @@ void RuntimeProfiler::finishIteration()
     // Welberg's algorithm assumes that the count is already
     // incremented.
     TimeType const invCount = static_cast<TimeType>(1.0)
-      / static_cast<TimeType>( mStatisticsSampleCounter + 1 );
+      / static_cast<TimeType>( sampleCount + 1 );
     //  delta = newValue - mean
     efl::ErrorCode res;
-    if( (res = efl::vectorSubtract( mCurrentData.data(), mRunningMean.data(),
+    if( (res = efl::vectorSubtract( current, mean,
       mTmpBuffer.data(), numberOfComponents(),
       visr::cVectorAlignmentSamples )) != efl::noError )
     {
@@ -94,13 +141,13 @@ void RuntimeProfiler::finishIteration()
       throw std::runtime_error( "Error updating profiling data: mean." );
     }
     // Compute the updated mean.
-    if( (res = efl::vectorAddInplace( mTmpBuffer2.data(), mRunningMean.data(),
+    if( (res = efl::vectorAddInplace( mTmpBuffer2.data(), mean,
       numberOfComponents(), visr::cVectorAlignmentSamples )) != efl::noError )
     {
       throw std::runtime_error( "Error updating profiling data: mean." );
     }
     //  delta2 = newValue - mean
-    if( (res = efl::vectorSubtract( mCurrentData.data(), mRunningMean.data(),
+    if( (res = efl::vectorSubtract( current, mean,
       mTmpBuffer2.data(), numberOfComponents(),
       visr::cVectorAlignmentSamples )) != efl::noError )
     {
@@ -108,28 +155,14 @@ void RuntimeProfiler::finishIteration()
     }
     //  M2 += delta * delta2
     if( (res = efl::vectorMultiplyAddInplace( mTmpBuffer.data(),
-      mTmpBuffer2.data(), mRunningM2.data(), numberOfComponents(),
+      mTmpBuffer2.data(), m2, numberOfComponents(),
       visr::cVectorAlignmentSamples )) != efl::noError )
     {
       throw std::runtime_error( "Error updating profiling data: variance." );
     }
   }
-  
-  if( measurementBufferSize() )
-  {
-    std::size_t const currentRowIdx = mMeasurementSampleCounter % measurementBufferSize();
-    efl::ErrorCode res;
-    if( (res = efl::vectorCopy( mCurrentData.data(),
-      mCurrentMeasurementBuffer.row(currentRowIdx), numberOfComponents(),
-      visr::cVectorAlignmentSamples )) != efl::noError )
-    {
-      throw std::runtime_error( "Error updating profiling data: raw timings." );
-    }
-  }
-  ++mStatisticsSampleCounter;
-  ++mMeasurementSampleCounter;
 }
-  
+
 void RuntimeProfiler::resetMeasurements()
 {
   std::lock_guard< AudioSignalFlow::ParameterExchangeMutexType > guard{
@@ -177,8 +210,11 @@ getAndResetStatistics( MeasurementVector & mean,
     mean.copy( mRunningMean );
     calculateVariance( variance );
     mStatisticsSampleCounter = 0;
+    mCounterSampleCounter = 0;
     mRunningMean.zeroFill();
     mRunningM2.zeroFill();
+    mCounterMean.zeroFill();
+    mCounterM2.zeroFill();
     return numCycles;
   }
 }
@@ -188,8 +224,112 @@ void RuntimeProfiler::resetStatistics()
   std::lock_guard< AudioSignalFlow::ParameterExchangeMutexType > guard{
     mFlow.parameterExchangeMutex() };
   mStatisticsSampleCounter = 0;
+  mCounterSampleCounter = 0;
   mRunningMean.zeroFill();
   mRunningM2.zeroFill();  
+  mCounterMean.zeroFill();
+  mCounterM2.zeroFill();
+}
+
+bool RuntimeProfiler::hardwareCountersEnabled() const
+{
+  return cHardwareCounters;
+}
+
+std::size_t RuntimeProfiler::
+getHardwareCounterStatistics( HardwareCounter counter,
+  MeasurementVector & mean,
+  MeasurementVector & variance ) const
+{
+  if( not cHardwareCounters )
+  {
+    throw std::logic_error( "Hardware performance counters are not enabled." );
+  }
+  std::size_t const counterIdx = static_cast<std::size_t>( counter );
+  if( counterIdx >= cNumberOfHardwareCounters )
+  {
+    throw std::invalid_argument( "Invalid hardware counter." );
+  }
+  if( mean.size() != numberOfComponents() )
+  {
+    throw std::invalid_argument( "Size of \"mean\" buffer does not match number of profiled components." );
+  }
+  if( variance.size() != numberOfComponents() )
+  {
+    throw std::invalid_argument( "Size of \"variance\" buffer does not match number of profiled components." );
+  }
+  {
+    std::lock_guard< AudioSignalFlow::ParameterExchangeMutexType > guard{
+      mFlow.parameterExchangeMutex() };
+    if( efl::vectorCopy( mCounterMean.row( counterIdx ), mean.data(),
+      numberOfComponents(), 0 /*we don't know the alignment of mean */ ) != efl::noError )
+    {
+      throw std::runtime_error( "Error copying hardware counter statistics." );
+    }
+    calculateVariance( mCounterM2.row( counterIdx ), mCounterSampleCounter, variance );
+    return mCounterSampleCounter;
+  }
+}
+
+void RuntimeProfiler::attachToCurrentThread()
+{
+  if( not cHardwareCounters )
+  {
+    throw std::logic_error( "Hardware performance counters are not enabled." );
+  }
+  // Open the counters before taking the lock, this involves system calls.
+  std::unique_ptr<PerformanceCounters> counters( new PerformanceCounters() );
+  std::lock_guard< AudioSignalFlow::ParameterExchangeMutexType > guard{
+    mFlow.parameterExchangeMutex() };
+  mCounters.swap( counters );
+  mCounterThread = std::this_thread::get_id();
+}
+
+void RuntimeProfiler::startHardwareCounters()
+{
+  if( not cHardwareCounters )
+  {
+    return;
+  }
+  // The counters only count the events of the thread they have been opened for.
+  if( std::this_thread::get_id() != mCounterThread )
+  {
+    mCountersMeasured = false;
+    return;
+  }
+  mCounters->read( mCounterStart );
+}
+
+void RuntimeProfiler::stopHardwareCounters( std::size_t componentIdx )
+{
+  if( not cHardwareCounters )
+  {
+    return;
+  }
+  if( not mCountersMeasured )
+  {
+    return;
+  }
+  std::array<std::uint64_t, cNumberOfHardwareCounters> counterEnd;
+  mCounters->read( counterEnd );
+  for( std::size_t counterIdx{ 0 }; counterIdx < cNumberOfHardwareCounters; ++counterIdx )
+  {
+    mCurrentCounterData( counterIdx, componentIdx )
+      = static_cast<TimeType>( counterEnd[counterIdx] - mCounterStart[counterIdx] );
+  }
+}
+
+void RuntimeProfiler::skipHardwareCounters()
+{
+  mCountersMeasured = false;
+}
+
+void RuntimeProfiler::setHardwareCounters( std::size_t componentIdx, TimeType value )
+{
+  for( std::size_t counterIdx{ 0 }; counterIdx < mCurrentCounterData.numberOfRows(); ++counterIdx )
+  {
+    mCurrentCounterData( counterIdx, componentIdx ) = value;
+  }
 }
 
 std::size_t RuntimeProfiler::measurementBufferSize() const
@@ -284,7 +424,13 @@ void RuntimeProfiler::getVariance( efl::BasicVector<TimeType> & val ) const
 
 void RuntimeProfiler::calculateVariance( MeasurementVector & ret ) const
 {
-  if( mStatisticsSampleCounter < 2 )
+  calculateVariance( mRunningM2.data(), mStatisticsSampleCounter, ret );
+}
+
+void RuntimeProfiler::calculateVariance( TimeType const * m2, std::size_t sampleCount,
+                                         MeasurementVector & ret ) const
+{
+  if( sampleCount < 2 )
   {
     ret.fillValue( std::numeric_limits<TimeType>::quiet_NaN() );
   }
@@ -293,9 +439,9 @@ void RuntimeProfiler::calculateVariance( MeasurementVector & ret ) const
     // TODO: decide whether we need a lock guard here.  
     // M2 / (count - 1)
     TimeType const scaleFactor = 1.0f / static_cast<TimeType>(
-      mStatisticsSampleCounter - 1 );
+      sampleCount - 1 );
     efl::ErrorCode const res = efl::vectorMultiplyConstant( scaleFactor,
-      mRunningM2.data(), ret.data(), numberOfComponents(),
+      m2, ret.data(), numberOfComponents(),
       0 /*we don't know the alignment of val */ );
     if( res != efl::noError )
     {
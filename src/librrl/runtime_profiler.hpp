@@ -8,11 +8,14 @@
 #include <libefl/basic_matrix.hpp>
 #include <libefl/basic_vector.hpp>
 
+#include <array>
+#include <cstdint>
 #include <iosfwd>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace visr
@@ -22,6 +25,7 @@ class Component;
 namespace rrl
 {
 class AudioSignalFlow;
+class PerformanceCounters;
 
 
 /**
@@ -33,6 +37,14 @@ class AudioSignalFlow;
  * Profiling data is either calculated in the form of running mean and variance,
  * or accessible as raw data, that is execution times for each
  * iteration.
+ * Optionally, the hardware performance counters of the CPU (see HardwareCounter) are
+ * recorded for each component and iteration, and their running mean and variance are
+ * provided by getHardwareCounterStatistics(). This is supported on Linux only.
+ * The counters count the events of a single thread. They are opened for the thread that
+ * enables the profiling, and attachToCurrentThread() opens them for another thread.
+ * Iterations executed in a different thread than the attached one, or in pipelined mode,
+ * are not included in the counter statistics. The counters are never opened during the
+ * processing.
  */
 class VISR_RRL_LIBRARY_SYMBOL RuntimeProfiler
 {
@@ -54,6 +66,19 @@ public:
    * Vector type to hold on value per measured atomic component.
    */
   using MeasurementVector = efl::BasicVector< TimeType >;
+
+  /**
+   * The hardware events that can be counted per component.
+   */
+  enum class HardwareCounter
+  {
+    Cycles = 0,       ///< CPU cycles
+    Instructions = 1, ///< Retired instructions
+    CacheMisses = 2,  ///< Last-level cache misses
+    BranchMisses = 3  ///< Mispredicted branches
+  };
+
+  static constexpr std::size_t cNumberOfHardwareCounters = 4;
   
   /**
    * Constructor.
@@ -62,9 +87,14 @@ public:
    * @param measureBufferSize The size of the sample buffer for measurements,
    * i.e., how many iterations are kept in memory. A value of zero disables 
    * iteration-based measurements.
+   * @param hardwareCounters Whether to record the hardware performance
+   * counters in addition to the execution times.
+   * @throw std::runtime_error If \p hardwareCounters is true, but the counters
+   * cannot be accessed on this system.
    */
   explicit RuntimeProfiler( AudioSignalFlow const & flow,
-                           std::size_t measureBufferSize );
+                           std::size_t measureBufferSize,
+                           bool hardwareCounters = false );
 
   /**
    * Destructor.
@@ -110,6 +140,35 @@ public:
   std::size_t getAndResetStatistics( MeasurementVector & mean,
     MeasurementVector & variance );
 
+  /**
+   * Return whether hardware performance counters are recorded.
+   */
+  bool hardwareCountersEnabled() const;
+
+  /**
+   * Open the hardware counters for the calling thread, replacing the counters
+   * of the previously attached thread.
+   * Call this from the thread that executes the signal flow before the processing
+   * starts, not from within the processing.
+   * @throw std::logic_error If hardware counters are not enabled.
+   * @throw std::runtime_error If the counters cannot be opened for this thread.
+   */
+  void attachToCurrentThread();
+
+  /**
+   * Return the mean and the variance of the number of events of a hardware
+   * counter per component and iteration since the last reset of the statistics.
+   * The statistics are reset together with those of the execution times.
+   * They include only the iterations executed sequentially by the attached thread.
+   * @return The number of iterations the statistics are based on, which can be
+   * less than statisticsSamples().
+   * @throw std::logic_error If hardware counters are not enabled.
+   * @throw std::invalid_argument If the return value buffers have the wrong size.
+   */
+  std::size_t getHardwareCounterStatistics( HardwareCounter counter,
+    MeasurementVector & mean,
+    MeasurementVector & variance ) const;
+
   /**
    * Resets the timinng statistivs, i.e., mean and variance of 
    * execution times. This also resets the statistics counter.
@@ -175,6 +234,39 @@ private:
    */
   void finishIteration();
 
+  /**
+   * Read the hardware counters before executing a component.
+   * Does nothing if hardware counters are disabled. If the calling thread is not
+   * the attached one, the current iteration is excluded from the counter statistics.
+   */
+  void startHardwareCounters();
+
+  /**
+   * Read the hardware counters after executing a component and store the
+   * differences to the values read in startHardwareCounters().
+   */
+  void stopHardwareCounters( std::size_t componentIdx );
+
+  /**
+   * Set the hardware counter values of a component to \p value for the current
+   * iteration, e.g., zero for components that are not executed.
+   */
+  void setHardwareCounters( std::size_t componentIdx, TimeType value );
+
+  /**
+   * Exclude the current iteration from the hardware counter statistics, e.g.,
+   * because the components are executed in the pipeline threads.
+   */
+  void skipHardwareCounters();
+
+  /**
+   * Update a running mean and the M2 quantity with the measurements \p current
+   * of the current iteration, using Welford's algorithm.
+   * @param sampleCount The number of iterations already contained in \p mean and \p m2.
+   */
+  void updateStatistics( TimeType const * current, TimeType * mean, TimeType * m2,
+                         std::size_t sampleCount );
+
   std::size_t measurementSamplesInternal() const
   {
     return mMeasurementSampleCounter;
@@ -199,6 +291,12 @@ private:
    * calling function.
    */
   void calculateVariance( MeasurementVector & ret ) const;
+
+  /**
+   * Calculate the variance from a M2 vector of Welford's algorithm.
+   * @param sampleCount The number of iterations contained in \p m2.
+   */
+  void calculateVariance( TimeType const * m2, std::size_t sampleCount, MeasurementVector & ret ) const;
   
   AudioSignalFlow const & mFlow;
   
@@ -223,6 +321,36 @@ private:
   
   efl::BasicVector<TimeType> mTmpBuffer;
   efl::BasicVector<TimeType> mTmpBuffer2;
+
+  bool const cHardwareCounters;
+
+  std::unique_ptr<PerformanceCounters> mCounters;
+
+  /**
+   * The thread the hardware counters have been opened for.
+   */
+  std::thread::id mCounterThread;
+
+  /**
+   * Whether the hardware counters of all components have been measured in the current iteration.
+   */
+  bool mCountersMeasured;
+
+  /**
+   * The number of iterations contained in the hardware counter statistics.
+   */
+  std::size_t mCounterSampleCounter;
+
+  std::array<std::uint64_t, cNumberOfHardwareCounters> mCounterStart;
+
+  /**
+   * Counter values, mean, and M2 values, one row per hardware counter.
+   */
+  //@{
+  efl::BasicMatrix<TimeType> mCurrentCounterData;
+  efl::BasicMatrix<TimeType> mCounterMean;
+  efl::BasicMatrix<TimeType> mCounterM2;
+  //@}
 };
 
 } // namespace rrl
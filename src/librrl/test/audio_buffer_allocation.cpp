@@ -0,0 +1,137 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved. */
+
+#include <librrl/audio_signal_flow.hpp>
+
+#include <libefl/basic_matrix.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/audio_input.hpp>
+#include <libvisr/audio_output.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ciso646>
+#include <cstddef>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+namespace visr
+{
+namespace rrl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+class Doubler: public AtomicComponent
+{
+public:
+  Doubler( SignalFlowContext const & context, char const * name, CompositeComponent * parent,
+           std::size_t width, bool inPlace )
+   : AtomicComponent( context, name, parent )
+   , mInput( "in", *this, width )
+   , mOutput( "out", *this, width )
+  {
+    if( inPlace )
+    {
+      declareInPlaceProcessing( mInput, mOutput );
+    }
+  }
+
+  void process() override
+  {
+    for( std::size_t chIdx( 0 ); chIdx < mInput.width(); ++chIdx )
+    {
+      SampleType const * in = mInput[chIdx];
+      SampleType * out = mOutput[chIdx];
+      for( std::size_t sIdx( 0 ); sIdx < period(); ++sIdx )
+      {
+        out[sIdx] = 2.0f * in[sIdx];
+      }
+    }
+  }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+/**
+ * A linear chain of Doubler components.
+ */
+class Chain: public CompositeComponent
+{
+public:
+  Chain( SignalFlowContext const & context, std::size_t width, std::size_t length, bool inPlace )
+   : CompositeComponent( context, "", nullptr )
+   , mInput( "in", *this, width )
+   , mOutput( "out", *this, width )
+  {
+    for( std::size_t idx( 0 ); idx < length; ++idx )
+    {
+      std::stringstream name;
+      name << "doubler" << idx;
+      mStages.push_back( std::unique_ptr<Doubler>( new Doubler( context, name.str().c_str(), this, width, inPlace ) ) );
+      audioConnection( idx == 0 ? static_cast<AudioPortBase&>(mInput) : mStages[idx-1]->audioPort( "out" ),
+                       mStages[idx]->audioPort( "in" ) );
+    }
+    audioConnection( mStages.back()->audioPort( "out" ), mOutput );
+  }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+  std::vector<std::unique_ptr<Doubler> > mStages;
+};
+
+std::size_t runChain( AudioSignalFlow::BufferAllocation allocation, bool inPlace )
+{
+  std::size_t const period = 32;
+  std::size_t const width = 4;
+  std::size_t const length = 4;
+  SignalFlowContext const ctxt{ period, 48000 };
+  Chain flow( ctxt, width, length, inPlace );
+  AudioSignalFlow flowWrapper( flow, allocation );
+
+  efl::BasicMatrix<SampleType> inputs( width, period, cVectorAlignmentSamples );
+  efl::BasicMatrix<SampleType> outputs( width, period, cVectorAlignmentSamples );
+  for( std::size_t blockIdx( 0 ); blockIdx < 3; ++blockIdx )
+  {
+    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
+    {
+      for( std::size_t sIdx( 0 ); sIdx < period; ++sIdx )
+      {
+        inputs( chIdx, sIdx ) = static_cast<SampleType>( blockIdx * 1000 + chIdx * 100 + sIdx );
+      }
+    }
+    flowWrapper.process( inputs.data(), inputs.stride(), 1, outputs.data(), outputs.stride(), 1 );
+    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
+    {
+      for( std::size_t sIdx( 0 ); sIdx < period; ++sIdx )
+      {
+        BOOST_CHECK_EQUAL( outputs( chIdx, sIdx ), 16.0f * inputs( chIdx, sIdx ) );
+      }
+    }
+  }
+  return flowWrapper.audioSignalPoolSize() / (period * sizeof(SampleType) * width );
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( livenessBufferAllocation )
+{
+  // External input plus four dedicated output buffers.
+  BOOST_CHECK_EQUAL( runChain( AudioSignalFlow::BufferAllocation::Dedicated, false ), 5u );
+  // The outputs of the first and the third stage share memory.
+  BOOST_CHECK_EQUAL( runChain( AudioSignalFlow::BufferAllocation::Liveness, false ), 4u );
+  // In-place processing: The second and third stage overwrite the output of the first stage.
+  BOOST_CHECK_EQUAL( runChain( AudioSignalFlow::BufferAllocation::Liveness, true ), 3u );
+  BOOST_CHECK_EQUAL( runChain( AudioSignalFlow::BufferAllocation::Dedicated, true ), 5u );
+}
+
+} // namespace test
+} // namespace rrl
+} // namespace visr
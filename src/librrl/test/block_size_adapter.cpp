@@ -0,0 +1,155 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librrl/audio_signal_flow.hpp>
+#include <librrl/block_size_adapter.hpp>
+
+#include <libefl/basic_matrix.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/audio_input.hpp>
+#include <libvisr/audio_output.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ciso646>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace visr
+{
+namespace rrl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+/**
+ * Delays two channels by one sample and scales the second channel, such that the output depends on the
+ * continuity of the signals across block boundaries.
+ */
+class UnitDelay: public AtomicComponent
+{
+public:
+  UnitDelay( SignalFlowContext const & context, char const * name, CompositeComponent * parent )
+   : AtomicComponent( context, name, parent )
+   , mInput( "in", *this, 2 )
+   , mOutput( "out", *this, 2 )
+   , mState{ 0.0f, 0.0f }
+  {
+  }
+
+  void process() override
+  {
+    for( std::size_t chIdx( 0 ); chIdx < 2; ++chIdx )
+    {
+      SampleType const gain = chIdx == 0 ? 1.0f : -2.0f;
+      for( std::size_t sIdx( 0 ); sIdx < period(); ++sIdx )
+      {
+        SampleType const val = mInput[chIdx][sIdx];
+        mOutput[chIdx][sIdx] = gain * mState[chIdx];
+        mState[chIdx] = val;
+      }
+    }
+  }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+  SampleType mState[2];
+};
+
+class DelayFlow: public CompositeComponent
+{
+public:
+  DelayFlow( SignalFlowContext const & context )
+   : CompositeComponent( context, "", nullptr )
+   , mDelay( context, "Delay", this )
+   , mInput( "in", *this, 2 )
+   , mOutput( "out", *this, 2 )
+  {
+    audioConnection( mInput, mDelay.audioPort( "in" ) );
+    audioConnection( mDelay.audioPort( "out" ), mOutput );
+  }
+private:
+  UnitDelay mDelay;
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+SampleType inputSignal( std::size_t chIdx, std::size_t sampleIdx )
+{
+  return static_cast<SampleType>( sampleIdx + 1 ) + (chIdx == 0 ? 0.0f : 0.5f);
+}
+
+void checkAdapter( std::size_t devicePeriod, std::size_t flowPeriod, std::size_t expectedLatency )
+{
+  BOOST_TEST_MESSAGE( "Device period " << devicePeriod << ", flow period " << flowPeriod );
+  SignalFlowContext const context( flowPeriod, 48000 );
+  DelayFlow comp( context );
+  AudioSignalFlow flow( comp );
+  BlockSizeAdapter adapter( flow, devicePeriod );
+  BOOST_CHECK_EQUAL( adapter.devicePeriod(), devicePeriod );
+  BOOST_CHECK_EQUAL( adapter.flowPeriod(), flowPeriod );
+  BOOST_CHECK_EQUAL( adapter.latency(), expectedLatency );
+
+  efl::BasicMatrix<SampleType> input( 2, devicePeriod );
+  efl::BasicMatrix<SampleType> output( 2, devicePeriod );
+  std::vector<SampleType const *> const inputPtrs{ input.row( 0 ), input.row( 1 ) };
+  std::vector<SampleType *> const outputPtrs{ output.row( 0 ), output.row( 1 ) };
+  std::size_t const numBlocks = 3 * flowPeriod / devicePeriod + 8;
+  // The total delay comprises the adapter latency and the delay of the flow.
+  std::size_t const totalDelay = expectedLatency + 1;
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    for( std::size_t chIdx( 0 ); chIdx < 2; ++chIdx )
+    {
+      for( std::size_t sIdx( 0 ); sIdx < devicePeriod; ++sIdx )
+      {
+        input( chIdx, sIdx ) = inputSignal( chIdx, blockIdx * devicePeriod + sIdx );
+      }
+    }
+    BOOST_CHECK( adapter.process( inputPtrs.data(), outputPtrs.data() ) );
+    for( std::size_t chIdx( 0 ); chIdx < 2; ++chIdx )
+    {
+      SampleType const gain = chIdx == 0 ? 1.0f : -2.0f;
+      for( std::size_t sIdx( 0 ); sIdx < devicePeriod; ++sIdx )
+      {
+        std::size_t const sampleIdx = blockIdx * devicePeriod + sIdx;
+        SampleType const expected = sampleIdx < totalDelay ? 0.0f : gain * inputSignal( chIdx, sampleIdx - totalDelay );
+        BOOST_CHECK_EQUAL( output( chIdx, sIdx ), expected );
+      }
+    }
+  }
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( BlockSizeAdapterSplitting )
+{
+  checkAdapter( 64, 16, 0 );
+  checkAdapter( 32, 32, 0 );
+}
+
+BOOST_AUTO_TEST_CASE( BlockSizeAdapterBuffering )
+{
+  checkAdapter( 16, 64, 48 );
+  checkAdapter( 48, 32, 16 );
+  checkAdapter( 32, 48, 32 );
+  checkAdapter( 7, 16, 15 );
+}
+
+BOOST_AUTO_TEST_CASE( BlockSizeAdapterInvalidPeriod )
+{
+  SignalFlowContext const context( 32, 48000 );
+  DelayFlow comp( context );
+  AudioSignalFlow flow( comp );
+  BOOST_CHECK_THROW( BlockSizeAdapter( flow, 0 ), std::invalid_argument );
+}
+
+} // namespace test
+} // namespace rrl
+} // namespace visr
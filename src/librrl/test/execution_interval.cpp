@@ -0,0 +1,242 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librrl/audio_signal_flow.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/audio_input.hpp>
+#include <libvisr/audio_output.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/parameter_input.hpp>
+#include <libvisr/signal_flow_context.hpp>
+#include <libvisr/time.hpp>
+
+#include <libpml/double_buffering_protocol.hpp>
+#include <libpml/empty_parameter_config.hpp>
+#include <libpml/initialise_parameter_library.hpp>
+#include <libpml/message_queue_protocol.hpp>
+#include <libpml/scalar_parameter.hpp>
+#include <libpml/string_parameter.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ciso646>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace visr
+{
+namespace rrl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+/**
+ * Parameter-only component that records the blocks in which it is executed and the parameters received.
+ */
+class ControlSink: public AtomicComponent
+{
+public:
+  ControlSink( SignalFlowContext const & context, char const * name, CompositeComponent * parent )
+   : AtomicComponent( context, name, parent )
+   , mMessageInput( "messageIn", *this, pml::EmptyParameterConfig() )
+   , mValueInput( "valueIn", *this, pml::EmptyParameterConfig() )
+   , mValue( 0.0f )
+  {
+  }
+
+  void process() override
+  {
+    mBlocks.push_back( static_cast<std::size_t>(time().blockCount()) );
+    while( not mMessageInput.empty() )
+    {
+      mMessages.push_back( mMessageInput.front().str() );
+      mMessageInput.pop();
+    }
+    if( mValueInput.changed() )
+    {
+      mValue = mValueInput.data().value();
+      mValueInput.resetChanged();
+    }
+  }
+
+  std::vector<std::size_t> const & blocks() const { return mBlocks; }
+
+  std::vector<std::string> const & messages() const { return mMessages; }
+
+  float value() const { return mValue; }
+private:
+  ParameterInput<pml::MessageQueueProtocol, pml::StringParameter > mMessageInput;
+  ParameterInput<pml::DoubleBufferingProtocol, pml::ScalarParameter<float> > mValueInput;
+  std::vector<std::size_t> mBlocks;
+  std::vector<std::string> mMessages;
+  float mValue;
+};
+
+/**
+ * Component without ports that only records the blocks in which it is executed.
+ */
+class BlockRecorder: public AtomicComponent
+{
+public:
+  BlockRecorder( SignalFlowContext const & context, char const * name, CompositeComponent * parent )
+   : AtomicComponent( context, name, parent )
+  {
+  }
+
+  void process() override
+  {
+    mBlocks.push_back( static_cast<std::size_t>(time().blockCount()) );
+  }
+
+  std::vector<std::size_t> const & blocks() const { return mBlocks; }
+private:
+  std::vector<std::size_t> mBlocks;
+};
+
+class MultiRateFlow: public CompositeComponent
+{
+public:
+  MultiRateFlow( SignalFlowContext const & context )
+   : CompositeComponent( context, "", nullptr )
+   , mSink1( context, "Sink1", this )
+   , mSink2( context, "Sink2", this )
+   , mSink3( context, "Sink3", this )
+   , mMessageInput( "messageIn", *this, pml::EmptyParameterConfig() )
+   , mValueInput( "valueIn", *this, pml::EmptyParameterConfig() )
+  {
+    parameterConnection( mMessageInput, mSink1.parameterPort( "messageIn" ) );
+    parameterConnection( mValueInput, mSink1.parameterPort( "valueIn" ) );
+  }
+
+  ControlSink & sink1() { return mSink1; }
+  BlockRecorder & sink2() { return mSink2; }
+  BlockRecorder & sink3() { return mSink3; }
+private:
+  ControlSink mSink1;
+  BlockRecorder mSink2;
+  BlockRecorder mSink3;
+  ParameterInput<pml::MessageQueueProtocol, pml::StringParameter > mMessageInput;
+  ParameterInput<pml::DoubleBufferingProtocol, pml::ScalarParameter<float> > mValueInput;
+};
+
+class AudioPassThrough: public AtomicComponent
+{
+public:
+  AudioPassThrough( SignalFlowContext const & context, char const * name, CompositeComponent * parent )
+   : AtomicComponent( context, name, parent )
+   , mInput( "in", *this, 1 )
+   , mOutput( "out", *this, 1 )
+  {
+  }
+
+  void process() override
+  {
+  }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+class AudioFlow: public CompositeComponent
+{
+public:
+  AudioFlow( SignalFlowContext const & context, std::size_t interval )
+   : CompositeComponent( context, "", nullptr )
+   , mPassThrough( context, "PassThrough", this )
+   , mInput( "in", *this, 1 )
+   , mOutput( "out", *this, 1 )
+  {
+    mPassThrough.setExecutionInterval( interval );
+    audioConnection( mInput, mPassThrough.audioPort( "in" ) );
+    audioConnection( mPassThrough.audioPort( "out" ), mOutput );
+  }
+private:
+  AudioPassThrough mPassThrough;
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( ExecutionIntervalArguments )
+{
+  SignalFlowContext const context( 32, 48000 );
+  MultiRateFlow comp( context );
+  BOOST_CHECK_EQUAL( comp.sink1().executionInterval(), 1 );
+  BOOST_CHECK_THROW( comp.sink1().setExecutionInterval( 0 ), std::invalid_argument );
+  BOOST_CHECK_THROW( comp.sink1().setExecutionInterval( 4, 4 ), std::invalid_argument );
+  comp.sink1().setExecutionInterval( 4, 3 );
+  BOOST_CHECK_EQUAL( comp.sink1().executionInterval(), 4 );
+  BOOST_CHECK_EQUAL( comp.sink1().executionPhase(), 3 );
+}
+
+BOOST_AUTO_TEST_CASE( ExecutionIntervalSchedule )
+{
+  pml::initialiseParameterLibrary();
+  SignalFlowContext const context( 32, 48000 );
+  MultiRateFlow comp( context );
+  comp.sink1().setExecutionInterval( 4, 1 );
+  comp.sink2().setExecutionInterval( 2 );
+  comp.sink3().setExecutionInterval( 2 );
+  AudioSignalFlow flow( comp );
+  flow.setParameterExchangeLocking( false );
+
+  std::size_t const numBlocks = 12;
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    flow.process( nullptr, nullptr );
+  }
+  std::vector<std::size_t> const expected1{ 1, 5, 9 };
+  BOOST_CHECK_EQUAL_COLLECTIONS( comp.sink1().blocks().begin(), comp.sink1().blocks().end(),
+                                 expected1.begin(), expected1.end() );
+  // The two components with automatic phases are executed in alternating blocks.
+  BOOST_CHECK_EQUAL( comp.sink2().blocks().size(), numBlocks / 2 );
+  BOOST_CHECK_EQUAL( comp.sink3().blocks().size(), numBlocks / 2 );
+  BOOST_CHECK( comp.sink2().blocks().front() != comp.sink3().blocks().front() );
+  for( std::size_t idx( 1 ); idx < comp.sink2().blocks().size(); ++idx )
+  {
+    BOOST_CHECK_EQUAL( comp.sink2().blocks()[idx] - comp.sink2().blocks()[idx-1], 2 );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( ExecutionIntervalParametersAcrossSkippedBlocks )
+{
+  pml::initialiseParameterLibrary();
+  SignalFlowContext const context( 32, 48000 );
+  MultiRateFlow comp( context );
+  comp.sink1().setExecutionInterval( 3, 2 );
+  AudioSignalFlow flow( comp );
+  flow.setParameterExchangeLocking( false );
+
+  // Parameters injected before skipped blocks are delivered in the next block in which the component runs.
+  BOOST_CHECK( flow.injectParameter( "messageIn", pml::StringParameter( "first" ) ) );
+  BOOST_CHECK( flow.injectParameter( "valueIn", pml::ScalarParameter<float>( 0.25f ) ) );
+  flow.process( nullptr, nullptr );
+  BOOST_CHECK( flow.injectParameter( "messageIn", pml::StringParameter( "second" ) ) );
+  BOOST_CHECK( flow.injectParameter( "valueIn", pml::ScalarParameter<float>( 0.5f ) ) );
+  flow.process( nullptr, nullptr );
+  BOOST_CHECK( comp.sink1().messages().empty() );
+  flow.process( nullptr, nullptr );
+  BOOST_REQUIRE_EQUAL( comp.sink1().messages().size(), 2 );
+  BOOST_CHECK_EQUAL( comp.sink1().messages()[0], "first" );
+  BOOST_CHECK_EQUAL( comp.sink1().messages()[1], "second" );
+  BOOST_CHECK_EQUAL( comp.sink1().value(), 0.5f );
+}
+
+BOOST_AUTO_TEST_CASE( ExecutionIntervalRejectedForAudioComponents )
+{
+  SignalFlowContext const context( 32, 48000 );
+  AudioFlow valid( context, 1 );
+  BOOST_CHECK_NO_THROW( AudioSignalFlow flow( valid ) );
+  AudioFlow invalid( context, 2 );
+  BOOST_CHECK_THROW( AudioSignalFlow flow( invalid ), std::exception );
+}
+
+} // namespace test
+} // namespace rrl
+} // namespace visr
@@ -0,0 +1,141 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved. */
+
+#include <librrl/audio_signal_flow.hpp>
+
+#include <libefl/basic_matrix.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/audio_input.hpp>
+#include <libvisr/audio_output.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ciso646>
+#include <cstddef>
+#include <vector>
+
+namespace visr
+{
+namespace rrl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+class Scaler: public AtomicComponent
+{
+public:
+  Scaler( SignalFlowContext const & context, char const * name, CompositeComponent * parent, std::size_t width )
+   : AtomicComponent( context, name, parent )
+   , mInput( "in", *this, width )
+   , mOutput( "out", *this, width )
+  {
+  }
+
+  void process() override
+  {
+    for( std::size_t chIdx( 0 ); chIdx < mInput.width(); ++chIdx )
+    {
+      SampleType const * in = mInput[chIdx];
+      SampleType * out = mOutput[chIdx];
+      for( std::size_t sIdx( 0 ); sIdx < period(); ++sIdx )
+      {
+        out[sIdx] = 2.0f * in[sIdx];
+      }
+    }
+  }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+class ScalerComposite: public CompositeComponent
+{
+public:
+  ScalerComposite( SignalFlowContext const & context, std::size_t width )
+   : CompositeComponent( context, "", nullptr )
+   , mScaler( context, "scaler", this, width )
+   , mInput( "in", *this, width )
+   , mOutput( "out", *this, width )
+  {
+    audioConnection( mInput, mScaler.audioPort( "in" ) );
+    audioConnection( mScaler.audioPort( "out" ), mOutput );
+  }
+private:
+  Scaler mScaler;
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+void runFlow( std::size_t sampleOffset, bool enableBinding, std::size_t expectedBoundPorts )
+{
+  std::size_t const period = 32;
+  std::size_t const width = 3;
+  std::size_t const numBlocks = 4;
+  std::size_t const channelStride = 64;
+  SignalFlowContext const ctxt{ period, 48000 };
+  ScalerComposite flow( ctxt, width );
+  AudioSignalFlow flowWrapper( flow );
+  flowWrapper.setExternalBufferBinding( enableBinding );
+
+  efl::BasicMatrix<SampleType> inputs( width, channelStride, cVectorAlignmentSamples );
+  efl::BasicMatrix<SampleType> outputs( width, channelStride, cVectorAlignmentSamples );
+  std::vector<SampleType const *> inPtrs( width );
+  std::vector<SampleType *> outPtrs( width );
+  for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
+  {
+    inPtrs[chIdx] = inputs.row( chIdx ) + sampleOffset;
+    outPtrs[chIdx] = outputs.row( chIdx ) + sampleOffset;
+  }
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
+    {
+      for( std::size_t sIdx( 0 ); sIdx < period; ++sIdx )
+      {
+        inputs( chIdx, sIdx + sampleOffset ) = static_cast<SampleType>( blockIdx * 1000 + chIdx * 100 + sIdx );
+      }
+    }
+    flowWrapper.process( &inPtrs[0], &outPtrs[0] );
+    BOOST_CHECK_EQUAL( flowWrapper.numberOfBoundExternalPorts(), expectedBoundPorts );
+    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
+    {
+      for( std::size_t sIdx( 0 ); sIdx < period; ++sIdx )
+      {
+        BOOST_CHECK_EQUAL( outputs( chIdx, sIdx + sampleOffset ), 2.0f * inputs( chIdx, sIdx + sampleOffset ) );
+      }
+    }
+  }
+  // After disabling, the flow must operate on its internal buffers again.
+  flowWrapper.setExternalBufferBinding( false );
+  BOOST_CHECK_EQUAL( flowWrapper.numberOfBoundExternalPorts(), 0u );
+  outputs.zeroFill();
+  flowWrapper.process( &inPtrs[0], &outPtrs[0] );
+  BOOST_CHECK_EQUAL( outputs( width-1, period-1+sampleOffset ), 2.0f * inputs( width-1, period-1+sampleOffset ) );
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( externalBufferBindingAligned )
+{
+  runFlow( 0, true, 2 );
+}
+
+BOOST_AUTO_TEST_CASE( externalBufferBindingDisabled )
+{
+  runFlow( 0, false, 0 );
+}
+
+BOOST_AUTO_TEST_CASE( externalBufferBindingUnaligned )
+{
+  // Buffers that do not meet the alignment requirement must fall back to copying.
+  runFlow( 1, true, 0 );
+}
+
+} // namespace test
+} // namespace rrl
+} // namespace visr
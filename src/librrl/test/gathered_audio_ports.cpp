@@ -0,0 +1,142 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved. */
+
+#include <librrl/audio_signal_flow.hpp>
+
+#include <libefl/basic_matrix.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/audio_input.hpp>
+#include <libvisr/audio_output.hpp>
+#include <libvisr/channel_list.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ciso646>
+#include <cstddef>
+#include <vector>
+
+namespace visr
+{
+namespace rrl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+class Doubler: public AtomicComponent
+{
+public:
+  Doubler( SignalFlowContext const & context, char const * name, CompositeComponent * parent,
+           std::size_t width, bool channelPointerAccess )
+   : AtomicComponent( context, name, parent )
+   , mInput( "in", *this, width )
+   , mOutput( "out", *this, width )
+  {
+    mInput.setChannelPointerAccess( channelPointerAccess );
+  }
+
+  void process() override
+  {
+    for( std::size_t chIdx( 0 ); chIdx < mInput.width(); ++chIdx )
+    {
+      SampleType const * in = mInput[chIdx];
+      SampleType * out = mOutput[chIdx];
+      for( std::size_t sIdx( 0 ); sIdx < period(); ++sIdx )
+      {
+        out[sIdx] = 2.0f * in[sIdx];
+      }
+    }
+  }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+/**
+ * Feeds the external inputs in reversed channel order into a Doubler.
+ */
+class ReversedRouting: public CompositeComponent
+{
+public:
+  ReversedRouting( SignalFlowContext const & context, std::size_t width, bool channelPointerAccess )
+   : CompositeComponent( context, "", nullptr )
+   , mDoubler( context, "doubler", this, width, channelPointerAccess )
+   , mInput( "in", *this, width )
+   , mOutput( "out", *this, width )
+  {
+    std::vector<ChannelList::IndexType> sendIndices( width );
+    std::vector<ChannelList::IndexType> receiveIndices( width );
+    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
+    {
+      sendIndices[chIdx] = width - 1 - chIdx;
+      receiveIndices[chIdx] = chIdx;
+    }
+    audioConnection( mInput, ChannelList( sendIndices ), mDoubler.audioPort( "in" ), ChannelList( receiveIndices ) );
+    audioConnection( mDoubler.audioPort( "out" ), mOutput );
+  }
+private:
+  Doubler mDoubler;
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+std::size_t runReversedRouting( bool channelPointerAccess, AudioSignalFlow::BufferAllocation allocation,
+                                bool externalBinding )
+{
+  std::size_t const period = 32;
+  std::size_t const width = 4;
+  SignalFlowContext const ctxt{ period, 48000 };
+  ReversedRouting flow( ctxt, width, channelPointerAccess );
+  AudioSignalFlow flowWrapper( flow, allocation );
+  flowWrapper.setExternalBufferBinding( externalBinding );
+
+  efl::BasicMatrix<SampleType> inputs( width, period, cVectorAlignmentSamples );
+  efl::BasicMatrix<SampleType> outputs( width, period, cVectorAlignmentSamples );
+  for( std::size_t blockIdx( 0 ); blockIdx < 3; ++blockIdx )
+  {
+    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
+    {
+      for( std::size_t sIdx( 0 ); sIdx < period; ++sIdx )
+      {
+        inputs( chIdx, sIdx ) = static_cast<SampleType>( blockIdx * 1000 + chIdx * 100 + sIdx );
+      }
+    }
+    flowWrapper.process( inputs.data(), inputs.stride(), 1, outputs.data(), outputs.stride(), 1 );
+    for( std::size_t chIdx( 0 ); chIdx < width; ++chIdx )
+    {
+      for( std::size_t sIdx( 0 ); sIdx < period; ++sIdx )
+      {
+        BOOST_CHECK_EQUAL( outputs( chIdx, sIdx ), 2.0f * inputs( width - 1 - chIdx, sIdx ) );
+      }
+    }
+  }
+  return flowWrapper.audioSignalPoolSize() / (period * sizeof(SampleType) * width );
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( gatheredPortWithoutRoutingComponent )
+{
+  // Without channel-pointer access, a routing component and its output buffer are inserted.
+  BOOST_CHECK_EQUAL( runReversedRouting( false, AudioSignalFlow::BufferAllocation::Dedicated, false ), 3u );
+  BOOST_CHECK_EQUAL( runReversedRouting( true, AudioSignalFlow::BufferAllocation::Dedicated, false ), 2u );
+}
+
+BOOST_AUTO_TEST_CASE( gatheredPortLivenessAllocation )
+{
+  BOOST_CHECK_EQUAL( runReversedRouting( true, AudioSignalFlow::BufferAllocation::Liveness, false ), 2u );
+}
+
+BOOST_AUTO_TEST_CASE( gatheredPortExternalBinding )
+{
+  runReversedRouting( true, AudioSignalFlow::BufferAllocation::Dedicated, true );
+  runReversedRouting( true, AudioSignalFlow::BufferAllocation::Liveness, true );
+}
+
+} // namespace test
+} // namespace rrl
+} // namespace visr
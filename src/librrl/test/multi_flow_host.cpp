@@ -0,0 +1,210 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librrl/audio_signal_flow.hpp>
+#include <librrl/multi_flow_host.hpp>
+
+#include <libefl/basic_matrix.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/audio_input.hpp>
+#include <libvisr/audio_output.hpp>
+#include <libvisr/channel_list.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ciso646>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace visr
+{
+namespace rrl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+class Gain: public AtomicComponent
+{
+public:
+  Gain( SignalFlowContext const & context, char const * name, CompositeComponent * parent,
+        std::size_t width, SampleType factor )
+   : AtomicComponent( context, name, parent )
+   , mInput( "in", *this, width )
+   , mOutput( "out", *this, width )
+   , mFactor( factor )
+  {
+  }
+
+  void process() override
+  {
+    if( mFactor < 0.0f )
+    {
+      throw std::runtime_error( "Gain: negative gain." );
+    }
+    for( std::size_t chIdx( 0 ); chIdx < mInput.width(); ++chIdx )
+    {
+      for( std::size_t sIdx( 0 ); sIdx < period(); ++sIdx )
+      {
+        mOutput[chIdx][sIdx] = mFactor * mInput[chIdx][sIdx];
+      }
+    }
+  }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+  SampleType const mFactor;
+};
+
+class GainFlow: public CompositeComponent
+{
+public:
+  GainFlow( SignalFlowContext const & context, std::size_t width, SampleType factor )
+   : CompositeComponent( context, "", nullptr )
+   , mGain( context, "Gain", this, width, factor )
+   , mInput( "in", *this, width )
+   , mOutput( "out", *this, width )
+  {
+    audioConnection( mInput, mGain.audioPort( "in" ) );
+    audioConnection( mGain.audioPort( "out" ), mOutput );
+  }
+private:
+  Gain mGain;
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( MultiFlowHostMixing )
+{
+  std::size_t const period = 32;
+  SamplingFrequencyType const fs = 48000;
+  SignalFlowContext const context( period, fs );
+  std::size_t const numFlows = 8;
+  std::vector<std::unique_ptr<GainFlow> > components;
+  for( std::size_t flowIdx( 0 ); flowIdx < numFlows; ++flowIdx )
+  {
+    components.emplace_back( new GainFlow( context, 1, static_cast<SampleType>(flowIdx + 1) ) );
+  }
+  efl::BasicMatrix<SampleType> input( 2, period, cVectorAlignmentSamples );
+  efl::BasicMatrix<SampleType> output( 3, period, cVectorAlignmentSamples );
+  for( std::size_t sIdx( 0 ); sIdx < period; ++sIdx )
+  {
+    input( 0, sIdx ) = static_cast<SampleType>( sIdx );
+    input( 1, sIdx ) = 100.0f;
+  }
+  std::vector<SampleType const *> const inputPtrs{ input.row( 0 ), input.row( 1 ) };
+  std::vector<SampleType *> const outputPtrs{ output.row( 0 ), output.row( 1 ), output.row( 2 ) };
+
+  for( std::size_t numThreads( 0 ); numThreads <= 3; ++numThreads )
+  {
+    MultiFlowHost host( 2, 3, period, fs, numThreads );
+    BOOST_CHECK_EQUAL( host.numberOfThreads(), numThreads );
+    // Even flows read capture channel 0, odd flows read capture channel 1. The first half of the flows is mixed
+    // into playback channel 0, the second half into playback channel 1, and playback channel 2 is unused.
+    for( std::size_t flowIdx( 0 ); flowIdx < numFlows; ++flowIdx )
+    {
+      BOOST_CHECK_EQUAL( host.addFlow( *components[flowIdx], { flowIdx % 2 }, { 2 * flowIdx / numFlows } ), flowIdx );
+    }
+    BOOST_CHECK_EQUAL( host.numberOfFlows(), numFlows );
+    for( std::size_t blockIdx( 0 ); blockIdx < 4; ++blockIdx )
+    {
+      output( 2, 0 ) = 1.0f;
+      BOOST_CHECK( host.process( inputPtrs.data(), outputPtrs.data() ) );
+      for( std::size_t sIdx( 0 ); sIdx < period; ++sIdx )
+      {
+        // The flows with odd gains read capture channel 0, those with even gains capture channel 1.
+        BOOST_CHECK_EQUAL( output( 0, sIdx ), (1.0f + 3.0f) * input( 0, sIdx ) + (2.0f + 4.0f) * input( 1, sIdx ) );
+        BOOST_CHECK_EQUAL( output( 1, sIdx ), (5.0f + 7.0f) * input( 0, sIdx ) + (6.0f + 8.0f) * input( 1, sIdx ) );
+        BOOST_CHECK_EQUAL( output( 2, sIdx ), 0.0f );
+      }
+    }
+    for( std::size_t flowIdx( 0 ); flowIdx < numFlows; ++flowIdx )
+    {
+      BOOST_CHECK( host.flowLoad( flowIdx ) > 0.0 );
+      BOOST_CHECK( host.flowPeakLoad( flowIdx ) >= host.flowLoad( flowIdx ) );
+    }
+    host.resetPeakLoads();
+    BOOST_CHECK_EQUAL( host.flowPeakLoad( 0 ), 0.0 );
+  }
+}
+
+/**
+ * Run many blocks with changing input signals, such that workers that wake up late would pick up flows of the wrong
+ * block. The workers request realtime priority, which falls back to the default priority without the privileges.
+ */
+BOOST_AUTO_TEST_CASE( MultiFlowHostRealtimeWorkers )
+{
+  std::size_t const period = 16;
+  SamplingFrequencyType const fs = 48000;
+  SignalFlowContext const context( period, fs );
+  std::size_t const numFlows = 12;
+  std::size_t const numThreads = 3;
+  std::vector<std::unique_ptr<GainFlow> > components;
+  MultiFlowHost host( 1, numFlows, period, fs, numThreads, 1 );
+  for( std::size_t flowIdx( 0 ); flowIdx < numFlows; ++flowIdx )
+  {
+    components.emplace_back( new GainFlow( context, 1, static_cast<SampleType>(flowIdx + 1) ) );
+    host.addFlow( *components[flowIdx], { 0 }, { flowIdx } );
+  }
+  efl::BasicMatrix<SampleType> input( 1, period, cVectorAlignmentSamples );
+  efl::BasicMatrix<SampleType> output( numFlows, period, cVectorAlignmentSamples );
+  std::vector<SampleType const *> const inputPtrs{ input.row( 0 ) };
+  std::vector<SampleType *> outputPtrs;
+  for( std::size_t flowIdx( 0 ); flowIdx < numFlows; ++flowIdx )
+  {
+    outputPtrs.push_back( output.row( flowIdx ) );
+  }
+  std::size_t numErrors = 0;
+  for( std::size_t blockIdx( 0 ); blockIdx < 2000; ++blockIdx )
+  {
+    input.fillValue( static_cast<SampleType>( blockIdx % 64 ) );
+    BOOST_CHECK( host.process( inputPtrs.data(), outputPtrs.data() ) );
+    for( std::size_t flowIdx( 0 ); flowIdx < numFlows; ++flowIdx )
+    {
+      if( output( flowIdx, period - 1 ) != static_cast<SampleType>( (flowIdx + 1) * (blockIdx % 64) ) )
+      {
+        ++numErrors;
+      }
+    }
+  }
+  BOOST_CHECK_EQUAL( numErrors, 0 );
+}
+
+BOOST_AUTO_TEST_CASE( MultiFlowHostErrors )
+{
+  std::size_t const period = 32;
+  SamplingFrequencyType const fs = 48000;
+  SignalFlowContext const context( period, fs );
+  GainFlow stereo( context, 2, 1.0f );
+  GainFlow otherPeriod( SignalFlowContext( 64, fs ), 1, 1.0f );
+  GainFlow failing( context, 1, -1.0f );
+  MultiFlowHost host( 2, 2, period, fs, 2 );
+  BOOST_CHECK_THROW( host.addFlow( otherPeriod, { 0 }, { 0 } ), std::invalid_argument );
+  BOOST_CHECK_THROW( host.addFlow( stereo, { 0 }, { 0, 1 } ), std::invalid_argument );
+  BOOST_CHECK_THROW( host.addFlow( stereo, { 0, 2 }, { 0, 1 } ), std::invalid_argument );
+  BOOST_CHECK_THROW( host.addFlow( stereo, { 0, 1 }, { 0, 2 } ), std::invalid_argument );
+  BOOST_CHECK_EQUAL( host.numberOfFlows(), 0 );
+  BOOST_CHECK_THROW( host.flow( 0 ), std::out_of_range );
+
+  host.addFlow( stereo, { 1, 0 }, { 0, 1 } );
+  host.addFlow( failing, { 0 }, { 1 } );
+  efl::BasicMatrix<SampleType> input( 2, period, cVectorAlignmentSamples );
+  efl::BasicMatrix<SampleType> output( 2, period, cVectorAlignmentSamples );
+  std::vector<SampleType const *> const inputPtrs{ input.row( 0 ), input.row( 1 ) };
+  std::vector<SampleType *> const outputPtrs{ output.row( 0 ), output.row( 1 ) };
+  BOOST_CHECK_THROW( host.process( inputPtrs.data(), outputPtrs.data() ), std::exception );
+  // The host remains usable after an error.
+  BOOST_CHECK_THROW( host.process( inputPtrs.data(), outputPtrs.data() ), std::exception );
+}
+
+} // namespace test
+} // namespace rrl
+} // namespace visr
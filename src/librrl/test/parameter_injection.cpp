@@ -0,0 +1,167 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librrl/audio_signal_flow.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/parameter_input.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <libpml/double_buffering_protocol.hpp>
+#include <libpml/empty_parameter_config.hpp>
+#include <libpml/initialise_parameter_library.hpp>
+#include <libpml/message_queue_protocol.hpp>
+#include <libpml/scalar_parameter.hpp>
+#include <libpml/string_parameter.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ciso646>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef VISR_DISABLE_THREADS
+#include <thread>
+#endif
+
+namespace visr
+{
+namespace rrl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+class ParameterSink: public AtomicComponent
+{
+public:
+  ParameterSink( SignalFlowContext const & context, char const * name, CompositeComponent * parent )
+   : AtomicComponent( context, name, parent )
+   , mMessageInput( "messageIn", *this, pml::EmptyParameterConfig() )
+   , mValueInput( "valueIn", *this, pml::EmptyParameterConfig() )
+   , mValue( 0.0f )
+  {
+  }
+
+  void process() override
+  {
+    while( not mMessageInput.empty() )
+    {
+      mMessages.push_back( mMessageInput.front().str() );
+      mMessageInput.pop();
+    }
+    if( mValueInput.changed() )
+    {
+      mValue = mValueInput.data().value();
+      mValueInput.resetChanged();
+    }
+  }
+
+  std::vector<std::string> const & messages() const { return mMessages; }
+
+  float value() const { return mValue; }
+private:
+  ParameterInput<pml::MessageQueueProtocol, pml::StringParameter > mMessageInput;
+  ParameterInput<pml::DoubleBufferingProtocol, pml::ScalarParameter<float> > mValueInput;
+  std::vector<std::string> mMessages;
+  float mValue;
+};
+
+class InjectionTestFlow: public CompositeComponent
+{
+public:
+  InjectionTestFlow( SignalFlowContext const & context )
+   : CompositeComponent( context, "", nullptr )
+   , mSink( context, "Sink", this )
+   , mMessageInput( "messageIn", *this, pml::EmptyParameterConfig() )
+   , mValueInput( "valueIn", *this, pml::EmptyParameterConfig() )
+  {
+    parameterConnection( mMessageInput, mSink.parameterPort( "messageIn" ) );
+    parameterConnection( mValueInput, mSink.parameterPort( "valueIn" ) );
+  }
+
+  ParameterSink const & sink() const { return mSink; }
+private:
+  ParameterSink mSink;
+  ParameterInput<pml::MessageQueueProtocol, pml::StringParameter > mMessageInput;
+  ParameterInput<pml::DoubleBufferingProtocol, pml::ScalarParameter<float> > mValueInput;
+};
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( ParameterInjectionBasic )
+{
+  pml::initialiseParameterLibrary();
+  SignalFlowContext const context( 32, 48000 );
+  InjectionTestFlow comp( context );
+  AudioSignalFlow flow( comp );
+  flow.setParameterExchangeLocking( false );
+
+  BOOST_CHECK( flow.injectParameter( "messageIn", pml::StringParameter( "first" ) ) );
+  BOOST_CHECK( flow.injectParameter( "messageIn", pml::StringParameter( "second" ) ) );
+  BOOST_CHECK( flow.injectParameter( "valueIn", pml::ScalarParameter<float>( 0.5f ) ) );
+  // Parameters are delivered only in the next process() call.
+  BOOST_CHECK( comp.sink().messages().empty() );
+  flow.process( nullptr, nullptr );
+  BOOST_CHECK_EQUAL( comp.sink().messages().size(), 2 );
+  BOOST_CHECK_EQUAL( comp.sink().messages().front(), "first" );
+  BOOST_CHECK_EQUAL( comp.sink().value(), 0.5f );
+
+  // A full queue is signalled by the return value.
+  std::size_t numQueued = 0;
+  while( flow.injectParameter( "messageIn", pml::StringParameter( "x" ) ) )
+  {
+    ++numQueued;
+  }
+  BOOST_CHECK_EQUAL( numQueued, AudioSignalFlow::cParameterInjectionQueueLength );
+  flow.process( nullptr, nullptr );
+  BOOST_CHECK_EQUAL( comp.sink().messages().size(), 2 + numQueued );
+
+  BOOST_CHECK_THROW( flow.injectParameter( "nonexistentPort", pml::StringParameter( "x" ) ), std::out_of_range );
+  BOOST_CHECK_THROW( flow.injectParameter( "valueIn", pml::StringParameter( "x" ) ), std::invalid_argument );
+}
+
+#ifndef VISR_DISABLE_THREADS
+BOOST_AUTO_TEST_CASE( ParameterInjectionConcurrent )
+{
+  pml::initialiseParameterLibrary();
+  SignalFlowContext const context( 32, 48000 );
+  InjectionTestFlow comp( context );
+  AudioSignalFlow flow( comp );
+  flow.setParameterExchangeLocking( false );
+
+  std::size_t const numMessages = 2000;
+  std::thread producer( [&flow, numMessages]()
+  {
+    for( std::size_t msgIdx( 0 ); msgIdx < numMessages; ++msgIdx )
+    {
+      std::unique_ptr<ParameterBase> msg( new pml::StringParameter( std::to_string( msgIdx ) ) );
+      while( not flow.injectParameter( "messageIn", std::move( msg ) ) )
+      {
+        std::this_thread::yield();
+      }
+    }
+  } );
+  while( comp.sink().messages().size() < numMessages )
+  {
+    flow.process( nullptr, nullptr );
+  }
+  producer.join();
+
+  bool inOrder = true;
+  for( std::size_t msgIdx( 0 ); msgIdx < numMessages; ++msgIdx )
+  {
+    inOrder = inOrder and (comp.sink().messages()[msgIdx] == std::to_string( msgIdx ));
+  }
+  BOOST_CHECK( inOrder );
+}
+#endif // #ifndef VISR_DISABLE_THREADS
+
+} // namespace test
+} // namespace rrl
+} // namespace visr
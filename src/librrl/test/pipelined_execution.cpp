@@ -0,0 +1,359 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librrl/audio_signal_flow.hpp>
+#ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
+#include <librrl/runtime_profiler.hpp>
+#endif
+
+#include <libefl/basic_matrix.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/audio_input.hpp>
+#include <libvisr/audio_output.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/parameter_input.hpp>
+#include <libvisr/parameter_output.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <libpml/double_buffering_protocol.hpp>
+#include <libpml/empty_parameter_config.hpp>
+#include <libpml/initialise_parameter_library.hpp>
+#include <libpml/scalar_parameter.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ciso646>
+#include <cstddef>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace visr
+{
+namespace rrl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+class Scale: public AtomicComponent
+{
+public:
+  Scale( SignalFlowContext const & context, char const * name, CompositeComponent * parent, SampleType factor )
+   : AtomicComponent( context, name, parent )
+   , mInput( "in", *this, 1 )
+   , mOutput( "out", *this, 1 )
+   , mFactor( factor )
+  {
+  }
+
+  void process() override
+  {
+    for( std::size_t sIdx( 0 ); sIdx < period(); ++sIdx )
+    {
+      mOutput[0][sIdx] = mFactor * mInput[0][sIdx];
+    }
+  }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+  SampleType const mFactor;
+};
+
+class Sum: public AtomicComponent
+{
+public:
+  Sum( SignalFlowContext const & context, char const * name, CompositeComponent * parent )
+   : AtomicComponent( context, name, parent )
+   , mInput( "in", *this, 2 )
+   , mOutput( "out", *this, 1 )
+  {
+  }
+
+  void process() override
+  {
+    for( std::size_t sIdx( 0 ); sIdx < period(); ++sIdx )
+    {
+      mOutput[0][sIdx] = mInput[0][sIdx] + mInput[1][sIdx];
+    }
+  }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+/**
+ * Flow with branches of different lengths, such that signals from different stages meet in a component and at
+ * the top-level outputs.
+ */
+class BranchedFlow: public CompositeComponent
+{
+public:
+  BranchedFlow( SignalFlowContext const & context )
+   : CompositeComponent( context, "", nullptr )
+   , mA( context, "A", this, 2.0f )
+   , mB( context, "B", this, 3.0f )
+   , mC( context, "C", this, 5.0f )
+   , mSum( context, "Sum", this )
+   , mInput( "in", *this, 2 )
+   , mOutput( "out", *this, 3 )
+  {
+    audioConnection( mInput, { 0 }, mA.audioPort( "in" ), { 0 } );
+    audioConnection( mA.audioPort( "out" ), mB.audioPort( "in" ) );
+    audioConnection( mB.audioPort( "out" ), { 0 }, mSum.audioPort( "in" ), { 0 } );
+    audioConnection( mInput, { 1 }, mSum.audioPort( "in" ), { 1 } );
+    audioConnection( mSum.audioPort( "out" ), { 0 }, mOutput, { 0 } );
+    audioConnection( mInput, { 1 }, mC.audioPort( "in" ), { 0 } );
+    audioConnection( mC.audioPort( "out" ), { 0 }, mOutput, { 1 } );
+    audioConnection( mA.audioPort( "out" ), { 0 }, mOutput, { 2 } );
+  }
+private:
+  Scale mA;
+  Scale mB;
+  Scale mC;
+  Sum mSum;
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+class GainController: public AtomicComponent
+{
+public:
+  GainController( SignalFlowContext const & context, char const * name, CompositeComponent * parent )
+   : AtomicComponent( context, name, parent )
+   , mOutput( "gain", *this, pml::EmptyParameterConfig() )
+  {
+  }
+
+  void process() override
+  {
+    mOutput.data() = 0.5f;
+    mOutput.swapBuffers();
+  }
+private:
+  ParameterOutput<pml::DoubleBufferingProtocol, pml::ScalarParameter<float> > mOutput;
+};
+
+class ControlledGain: public AtomicComponent
+{
+public:
+  ControlledGain( SignalFlowContext const & context, char const * name, CompositeComponent * parent )
+   : AtomicComponent( context, name, parent )
+   , mInput( "in", *this, 1 )
+   , mOutput( "out", *this, 1 )
+   , mGain( "gain", *this, pml::EmptyParameterConfig() )
+  {
+  }
+
+  void process() override
+  {
+    SampleType const gain = mGain.data().value();
+    for( std::size_t sIdx( 0 ); sIdx < period(); ++sIdx )
+    {
+      mOutput[0][sIdx] = gain * mInput[0][sIdx];
+    }
+  }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+  ParameterInput<pml::DoubleBufferingProtocol, pml::ScalarParameter<float> > mGain;
+};
+
+class ControlledFlow: public CompositeComponent
+{
+public:
+  ControlledFlow( SignalFlowContext const & context )
+   : CompositeComponent( context, "", nullptr )
+   , mController( context, "Controller", this )
+   , mGain( context, "Gain", this )
+   , mInput( "in", *this, 1 )
+   , mOutput( "out", *this, 1 )
+  {
+    audioConnection( mInput, mGain.audioPort( "in" ) );
+    audioConnection( mGain.audioPort( "out" ), mOutput );
+    parameterConnection( mController.parameterPort( "gain" ), mGain.parameterPort( "gain" ) );
+  }
+private:
+  GainController mController;
+  ControlledGain mGain;
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+/**
+ * Run a flow for a number of blocks and return the output blocks.
+ */
+std::vector<efl::BasicMatrix<SampleType> > runFlow( AudioSignalFlow & flow, std::size_t numBlocks )
+{
+  std::size_t const period = flow.period();
+  std::size_t const numInputs = flow.numberOfCaptureChannels();
+  std::size_t const numOutputs = flow.numberOfPlaybackChannels();
+  efl::BasicMatrix<SampleType> input( numInputs, period, cVectorAlignmentSamples );
+  std::vector<efl::BasicMatrix<SampleType> > outputs;
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    for( std::size_t chIdx( 0 ); chIdx < numInputs; ++chIdx )
+    {
+      for( std::size_t sIdx( 0 ); sIdx < period; ++sIdx )
+      {
+        input( chIdx, sIdx ) = static_cast<SampleType>( (blockIdx + 1) * 100 + chIdx * 10 ) + 0.01f * sIdx;
+      }
+    }
+    outputs.emplace_back( numOutputs, period, cVectorAlignmentSamples );
+    flow.process( input.data(), input.stride(), 1, outputs.back().data(), outputs.back().stride(), 1 );
+  }
+  return outputs;
+}
+
+/**
+ * Check that \p pipelined equals \p reference delayed by \p latency blocks, with zero output in the first blocks.
+ */
+void checkDelayed( std::vector<efl::BasicMatrix<SampleType> > const & reference,
+                   std::vector<efl::BasicMatrix<SampleType> > const & pipelined,
+                   std::size_t latency )
+{
+  BOOST_REQUIRE_EQUAL( reference.size(), pipelined.size() );
+  for( std::size_t blockIdx( 0 ); blockIdx < pipelined.size(); ++blockIdx )
+  {
+    efl::BasicMatrix<SampleType> const & result = pipelined[blockIdx];
+    for( std::size_t chIdx( 0 ); chIdx < result.numberOfRows(); ++chIdx )
+    {
+      for( std::size_t sIdx( 0 ); sIdx < result.numberOfColumns(); ++sIdx )
+      {
+        SampleType const expected = blockIdx < latency ? 0.0f : reference[blockIdx - latency]( chIdx, sIdx );
+        BOOST_CHECK_EQUAL( result( chIdx, sIdx ), expected );
+      }
+    }
+  }
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( PipelinedExecutionExplicitStages )
+{
+  SignalFlowContext const context( 16, 48000 );
+  std::size_t const numBlocks = 8;
+  BranchedFlow referenceComp( context );
+  AudioSignalFlow referenceFlow( referenceComp );
+  std::vector<efl::BasicMatrix<SampleType> > const reference = runFlow( referenceFlow, numBlocks );
+
+  // Components receiving signals from different stages, with and without delay.
+  std::vector<std::map<std::string, std::size_t> > const assignments{ { { "B", 1 } }, { { "B", 1 }, { "Sum", 2 } },
+                                                                      { { "C", 1 }, { "Sum", 2 } } };
+  for( auto const & assignment : assignments )
+  {
+    BranchedFlow comp( context );
+    AudioSignalFlow flow( comp );
+    flow.enablePipeline( assignment );
+    std::size_t const numStages = flow.numberOfPipelineStages();
+    std::map<std::string, std::size_t> const stages = flow.pipelineStageAssignment();
+    for( auto const & entry : assignment )
+    {
+      BOOST_CHECK_EQUAL( stages.at( entry.first ), entry.second );
+    }
+    BOOST_CHECK_EQUAL( stages.at( "A" ), 0 );
+    checkDelayed( reference, runFlow( flow, numBlocks ), numStages - 1 );
+
+    // Sequential execution is restored without delay.
+    flow.disablePipeline();
+    BOOST_CHECK_EQUAL( flow.numberOfPipelineStages(), 1 );
+    std::vector<efl::BasicMatrix<SampleType> > const sequential = runFlow( flow, numBlocks );
+    checkDelayed( reference, sequential, 0 );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( PipelinedExecutionAutomaticStages )
+{
+  SignalFlowContext const context( 16, 48000 );
+  std::size_t const numBlocks = 8;
+  BranchedFlow referenceComp( context );
+  AudioSignalFlow referenceFlow( referenceComp );
+  std::vector<efl::BasicMatrix<SampleType> > const reference = runFlow( referenceFlow, numBlocks );
+  for( std::size_t numStages( 2 ); numStages <= 4; ++numStages )
+  {
+    BranchedFlow comp( context );
+    AudioSignalFlow flow( comp );
+    flow.enablePipeline( numStages );
+    BOOST_CHECK_EQUAL( flow.numberOfPipelineStages(), numStages );
+    checkDelayed( reference, runFlow( flow, numBlocks ), numStages - 1 );
+  }
+}
+
+/**
+ * The worker threads request realtime priority and fixed CPU cores, which falls back to the default scheduling
+ * without the privileges. Many blocks are run to exercise the synchronisation between the stages.
+ */
+BOOST_AUTO_TEST_CASE( PipelinedExecutionRealtimeWorkers )
+{
+  SignalFlowContext const context( 16, 48000 );
+  std::size_t const numBlocks = 500;
+  BranchedFlow referenceComp( context );
+  AudioSignalFlow referenceFlow( referenceComp );
+  std::vector<efl::BasicMatrix<SampleType> > const reference = runFlow( referenceFlow, numBlocks );
+
+  BranchedFlow comp( context );
+  AudioSignalFlow flow( comp );
+  flow.enablePipeline( 3, 1, true );
+  BOOST_CHECK_EQUAL( flow.numberOfPipelineStages(), 3 );
+  checkDelayed( reference, runFlow( flow, numBlocks ), 2 );
+}
+
+#ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
+BOOST_AUTO_TEST_CASE( PipelinedExecutionProfiledStages )
+{
+  SignalFlowContext const context( 16, 48000 );
+  std::size_t const numBlocks = 8;
+  BranchedFlow referenceComp( context );
+  AudioSignalFlow referenceFlow( referenceComp );
+  std::vector<efl::BasicMatrix<SampleType> > const reference = runFlow( referenceFlow, numBlocks );
+
+  BranchedFlow comp( context );
+  AudioSignalFlow flow( comp );
+  flow.enableRuntimeProfiling( numBlocks );
+  checkDelayed( reference, runFlow( flow, numBlocks ), 0 );
+  BOOST_CHECK_EQUAL( flow.runtimeProfiler().statisticsSamples(), numBlocks );
+  // The stages are balanced using the measured execution times.
+  flow.enablePipeline( 3 );
+  BOOST_CHECK_EQUAL( flow.numberOfPipelineStages(), 3 );
+  checkDelayed( reference, runFlow( flow, numBlocks ), 2 );
+}
+#endif
+
+BOOST_AUTO_TEST_CASE( PipelinedExecutionInvalidConfiguration )
+{
+  pml::initialiseParameterLibrary();
+  SignalFlowContext const context( 16, 48000 );
+  {
+    BranchedFlow comp( context );
+    AudioSignalFlow flow( comp );
+    BOOST_CHECK_THROW( flow.enablePipeline( 0 ), std::invalid_argument );
+    BOOST_CHECK_THROW( flow.enablePipeline( std::map<std::string, std::size_t>{ { "D", 1 } } ), std::invalid_argument );
+    // Stage 1 would be empty.
+    BOOST_CHECK_THROW( flow.enablePipeline( std::map<std::string, std::size_t>{ { "B", 2 } } ), std::invalid_argument );
+    // B receives its input from A.
+    BOOST_CHECK_THROW( flow.enablePipeline( std::map<std::string, std::size_t>{ { "A", 1 }, { "B", 0 } } ),
+                       std::invalid_argument );
+    BOOST_CHECK_EQUAL( flow.numberOfPipelineStages(), 1 );
+    flow.enablePipeline( 2 );
+    BOOST_CHECK_THROW( flow.setExternalBufferBinding( true ), std::logic_error );
+  }
+  {
+    BranchedFlow comp( context );
+    AudioSignalFlow flow( comp, AudioSignalFlow::BufferAllocation::Liveness );
+    BOOST_CHECK_THROW( flow.enablePipeline( 2 ), std::logic_error );
+  }
+  {
+    ControlledFlow comp( context );
+    AudioSignalFlow flow( comp );
+    // The parameter connection must not be cut.
+    BOOST_CHECK_THROW( flow.enablePipeline( std::map<std::string, std::size_t>{ { "Gain", 1 } } ), std::invalid_argument );
+    BOOST_CHECK_THROW( flow.enablePipeline( 2 ), std::invalid_argument );
+  }
+}
+
+} // namespace test
+} // namespace rrl
+} // namespace visr
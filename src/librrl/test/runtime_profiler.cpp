@@ -0,0 +1,236 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librrl/audio_signal_flow.hpp>
+#include <librrl/runtime_profiler.hpp>
+
+#include <libefl/basic_matrix.hpp>
+#include <libefl/basic_vector.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/audio_input.hpp>
+#include <libvisr/audio_output.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/constants.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ciso646>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace visr
+{
+namespace rrl
+{
+namespace test
+{
+
+namespace // unnamed
+{
+
+class Gain: public AtomicComponent
+{
+public:
+  Gain( SignalFlowContext const & context, char const * name, CompositeComponent * parent )
+   : AtomicComponent( context, name, parent )
+   , mInput( "in", *this, 1 )
+   , mOutput( "out", *this, 1 )
+  {
+  }
+
+  void process() override
+  {
+    for( std::size_t sIdx( 0 ); sIdx < period(); ++sIdx )
+    {
+      mOutput[0][sIdx] = 0.5f * mInput[0][sIdx];
+    }
+  }
+private:
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+class GainChain: public CompositeComponent
+{
+public:
+  GainChain( SignalFlowContext const & context )
+   : CompositeComponent( context, "", nullptr )
+   , mFirst( context, "First", this )
+   , mSecond( context, "Second", this )
+   , mInput( "in", *this, 1 )
+   , mOutput( "out", *this, 1 )
+  {
+    audioConnection( mInput, mFirst.audioPort( "in" ) );
+    audioConnection( mFirst.audioPort( "out" ), mSecond.audioPort( "in" ) );
+    audioConnection( mSecond.audioPort( "out" ), mOutput );
+  }
+private:
+  Gain mFirst;
+  Gain mSecond;
+  AudioInput mInput;
+  AudioOutput mOutput;
+};
+
+void runFlow( AudioSignalFlow & flow, std::size_t numIterations )
+{
+  efl::BasicMatrix<SampleType> input( 1, flow.period() );
+  efl::BasicMatrix<SampleType> output( 1, flow.period() );
+  std::vector<SampleType const *> const inputPtrs{ input.row( 0 ) };
+  std::vector<SampleType *> const outputPtrs{ output.row( 0 ) };
+  for( std::size_t iteration( 0 ); iteration < numIterations; ++iteration )
+  {
+    BOOST_CHECK( flow.process( inputPtrs.data(), outputPtrs.data() ) );
+  }
+}
+
+} // unnamed namespace
+
+BOOST_AUTO_TEST_CASE( RuntimeProfilerTimingStatistics )
+{
+  SignalFlowContext const context( 64, 48000 );
+  GainChain comp( context );
+  AudioSignalFlow flow( comp );
+  flow.enableRuntimeProfiling( 8 );
+  RuntimeProfiler & profiler = flow.runtimeProfiler();
+  BOOST_CHECK_EQUAL( profiler.numberOfComponents(), 2 );
+  BOOST_CHECK( not profiler.hardwareCountersEnabled() );
+
+  runFlow( flow, 10 );
+  RuntimeProfiler::MeasurementVector mean( profiler.numberOfComponents(), cVectorAlignmentSamples );
+  RuntimeProfiler::MeasurementVector variance( profiler.numberOfComponents(), cVectorAlignmentSamples );
+  BOOST_CHECK_EQUAL( profiler.getStatistics( mean, variance ), 10 );
+  for( std::size_t compIdx( 0 ); compIdx < profiler.numberOfComponents(); ++compIdx )
+  {
+    BOOST_CHECK( mean[compIdx] >= 0.0 );
+    BOOST_CHECK( variance[compIdx] >= 0.0 );
+  }
+  BOOST_CHECK_THROW( profiler.getHardwareCounterStatistics( RuntimeProfiler::HardwareCounter::Cycles,
+    mean, variance ), std::logic_error );
+}
+
+BOOST_AUTO_TEST_CASE( RuntimeProfilerHardwareCounters )
+{
+  SignalFlowContext const context( 64, 48000 );
+  GainChain comp( context );
+  AudioSignalFlow flow( comp );
+  try
+  {
+    flow.enableRuntimeProfiling( 8, true );
+  }
+  catch( std::runtime_error const & ex )
+  {
+    BOOST_TEST_MESSAGE( "Hardware performance counters not available, skipping test: " << ex.what() );
+    return;
+  }
+  RuntimeProfiler & profiler = flow.runtimeProfiler();
+  BOOST_CHECK( profiler.hardwareCountersEnabled() );
+
+  runFlow( flow, 10 );
+  RuntimeProfiler::MeasurementVector mean( profiler.numberOfComponents(), cVectorAlignmentSamples );
+  RuntimeProfiler::MeasurementVector variance( profiler.numberOfComponents(), cVectorAlignmentSamples );
+  BOOST_CHECK_EQUAL( profiler.getHardwareCounterStatistics( RuntimeProfiler::HardwareCounter::Instructions,
+    mean, variance ), 10 );
+  for( std::size_t compIdx( 0 ); compIdx < profiler.numberOfComponents(); ++compIdx )
+  {
+    BOOST_CHECK( mean[compIdx] > 0.0 );
+    BOOST_CHECK( not std::isnan( variance[compIdx] ) );
+  }
+
+  RuntimeProfiler::MeasurementVector wrongSize( profiler.numberOfComponents() + 1, cVectorAlignmentSamples );
+  BOOST_CHECK_THROW( profiler.getHardwareCounterStatistics( RuntimeProfiler::HardwareCounter::Cycles,
+    wrongSize, variance ), std::invalid_argument );
+
+  profiler.resetStatistics();
+  runFlow( flow, 3 );
+  BOOST_CHECK_EQUAL( profiler.getHardwareCounterStatistics( RuntimeProfiler::HardwareCounter::Cycles,
+    mean, variance ), 3 );
+}
+
+#ifndef VISR_DISABLE_THREADS
+BOOST_AUTO_TEST_CASE( RuntimeProfilerHardwareCountersOtherThread )
+{
+  SignalFlowContext const context( 64, 48000 );
+  GainChain comp( context );
+  AudioSignalFlow flow( comp );
+  try
+  {
+    flow.enableRuntimeProfiling( 8, true );
+  }
+  catch( std::runtime_error const & ex )
+  {
+    BOOST_TEST_MESSAGE( "Hardware performance counters not available, skipping test: " << ex.what() );
+    return;
+  }
+  RuntimeProfiler & profiler = flow.runtimeProfiler();
+  RuntimeProfiler::MeasurementVector mean( profiler.numberOfComponents(), cVectorAlignmentSamples );
+  RuntimeProfiler::MeasurementVector variance( profiler.numberOfComponents(), cVectorAlignmentSamples );
+
+  // Iterations in a thread the counters are not attached to are timed, but not counted.
+  std::thread audioThread( [&flow](){ runFlow( flow, 4 ); } );
+  audioThread.join();
+  BOOST_CHECK_EQUAL( profiler.statisticsSamples(), 4 );
+  BOOST_CHECK_EQUAL( profiler.getHardwareCounterStatistics( RuntimeProfiler::HardwareCounter::Instructions,
+    mean, variance ), 0 );
+
+  runFlow( flow, 3 );
+  BOOST_CHECK_EQUAL( profiler.statisticsSamples(), 7 );
+  BOOST_CHECK_EQUAL( profiler.getHardwareCounterStatistics( RuntimeProfiler::HardwareCounter::Instructions,
+    mean, variance ), 3 );
+  for( std::size_t compIdx( 0 ); compIdx < profiler.numberOfComponents(); ++compIdx )
+  {
+    BOOST_CHECK( mean[compIdx] > 0.0 );
+    BOOST_CHECK( not std::isnan( variance[compIdx] ) );
+  }
+
+  std::thread attachedThread( [&flow, &profiler]()
+  {
+    profiler.attachToCurrentThread();
+    runFlow( flow, 2 );
+  } );
+  attachedThread.join();
+  BOOST_CHECK_EQUAL( profiler.getHardwareCounterStatistics( RuntimeProfiler::HardwareCounter::Instructions,
+    mean, variance ), 5 );
+}
+
+BOOST_AUTO_TEST_CASE( RuntimeProfilerHardwareCountersPipelined )
+{
+  SignalFlowContext const context( 64, 48000 );
+  GainChain comp( context );
+  AudioSignalFlow flow( comp );
+  try
+  {
+    flow.enableRuntimeProfiling( 8, true );
+  }
+  catch( std::runtime_error const & ex )
+  {
+    BOOST_TEST_MESSAGE( "Hardware performance counters not available, skipping test: " << ex.what() );
+    return;
+  }
+  RuntimeProfiler & profiler = flow.runtimeProfiler();
+  RuntimeProfiler::MeasurementVector mean( profiler.numberOfComponents(), cVectorAlignmentSamples );
+  RuntimeProfiler::MeasurementVector variance( profiler.numberOfComponents(), cVectorAlignmentSamples );
+
+  runFlow( flow, 3 );
+  // Pipelined iterations are timed, but excluded from the counter statistics.
+  flow.enablePipeline( 2 );
+  runFlow( flow, 4 );
+  flow.disablePipeline();
+  runFlow( flow, 2 );
+  BOOST_CHECK_EQUAL( profiler.statisticsSamples(), 9 );
+  BOOST_CHECK_EQUAL( profiler.getHardwareCounterStatistics( RuntimeProfiler::HardwareCounter::Cycles,
+    mean, variance ), 5 );
+  for( std::size_t compIdx( 0 ); compIdx < profiler.numberOfComponents(); ++compIdx )
+  {
+    BOOST_CHECK( mean[compIdx] > 0.0 );
+    BOOST_CHECK( not std::isnan( variance[compIdx] ) );
+  }
+}
+#endif // #ifndef VISR_DISABLE_THREADS
+
+} // namespace test
+} // namespace rrl
+} // namespace visr
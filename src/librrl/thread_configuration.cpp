@@ -0,0 +1,61 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "thread_configuration.hpp"
+
+#ifndef VISR_DISABLE_THREADS
+
+#include <algorithm>
+#include <iostream>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <sched.h>
+
+#include <cstring>
+#endif
+
+namespace visr
+{
+namespace rrl
+{
+
+void setRealtimePriority( std::thread & thread, int priority, char const * owner )
+{
+  if( priority == 0 )
+  {
+    return;
+  }
+#ifdef _WIN32
+  std::cerr << owner << ": Realtime priorities are not supported on this platform." << std::endl;
+#else
+  struct sched_param param;
+  param.sched_priority = priority;
+  int const res = pthread_setschedparam( thread.native_handle(), SCHED_FIFO, &param );
+  if( res != 0 )
+  {
+    std::cerr << owner << ": Setting the realtime priority failed: " << std::strerror( res ) << std::endl;
+  }
+#endif
+}
+
+void setCpuAffinity( std::thread & thread, std::size_t cpuIndex, char const * owner )
+{
+#ifdef __linux__
+  unsigned int const numCores = std::max( std::thread::hardware_concurrency(), 1u );
+  cpu_set_t cpuSet;
+  CPU_ZERO( &cpuSet );
+  CPU_SET( static_cast<int>( cpuIndex % numCores ), &cpuSet );
+  int const res = pthread_setaffinity_np( thread.native_handle(), sizeof(cpu_set_t), &cpuSet );
+  if( res != 0 )
+  {
+    std::cerr << owner << ": Setting the CPU affinity failed: " << std::strerror( res ) << std::endl;
+  }
+#else
+  std::cerr << owner << ": Setting the CPU affinity is not supported on this platform." << std::endl;
+#endif
+}
+
+} // namespace rrl
+} // namespace visr
+
+#endif // #ifndef VISR_DISABLE_THREADS
@@ -0,0 +1,39 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_LIBRRL_THREAD_CONFIGURATION_HPP_INCLUDED
+#define VISR_LIBRRL_THREAD_CONFIGURATION_HPP_INCLUDED
+
+#ifndef VISR_DISABLE_THREADS
+
+#include <cstddef>
+#include <thread>
+
+namespace visr
+{
+namespace rrl
+{
+
+/**
+ * Run a thread with the SCHED_FIFO scheduling policy and the given priority.
+ * A failure, e.g., due to missing privileges, is reported on std::cerr, and the thread keeps its previous scheduling.
+ * @param thread The thread to be configured.
+ * @param priority The realtime priority, a value of 0 leaves the thread unchanged.
+ * @param owner Name of the calling class, used in the error message.
+ */
+void setRealtimePriority( std::thread & thread, int priority, char const * owner );
+
+/**
+ * Bind a thread to a single CPU core.
+ * Supported on Linux only. On other platforms or if the call fails, a warning is printed on std::cerr.
+ * @param thread The thread to be configured.
+ * @param cpuIndex The index of the core. Values beyond the number of cores wrap around.
+ * @param owner Name of the calling class, used in the error message.
+ */
+void setCpuAffinity( std::thread & thread, std::size_t cpuIndex, char const * owner );
+
+} // namespace rrl
+} // namespace visr
+
+#endif // #ifndef VISR_DISABLE_THREADS
+
+#endif // #ifndef VISR_LIBRRL_THREAD_CONFIGURATION_HPP_INCLUDED
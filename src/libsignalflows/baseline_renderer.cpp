@@ -43,8 +43,7 @@ BaselineRenderer::BaselineRenderer( SignalFlowContext const & context,
                                     std::string const & reverbConfig,
                                     bool frequencyDependentPanning )
  : CompositeComponent( context, name, parent )
- , mSceneReceiver( context, "SceneReceiver", this, sceneReceiverPort, rcl::UdpReceiver::Mode::Asynchronous )
- , mSceneDecoder( context, "SceneDecoder", this )
+ , mSceneReceiver( context, "SceneReceiver", this, sceneReceiverPort )
  , mCoreRenderer( context, "CoreRenderer", this, loudspeakerConfiguration, numberOfInputs, numberOfOutputs,
                   interpolationPeriod, diffusionFilters, trackingConfiguration, numberOfObjectEqSections,
                   reverbConfig, frequencyDependentPanning )
@@ -54,8 +53,7 @@ BaselineRenderer::BaselineRenderer( SignalFlowContext const & context,
 {
   audioConnection( mInput, mCoreRenderer.audioPort( "audioIn") );
   audioConnection( mCoreRenderer.audioPort( "audioOut"), mOutput );
-  parameterConnection( mSceneReceiver.parameterPort("messageOutput"), mSceneDecoder.parameterPort("datagramInput") );
-  parameterConnection( mSceneDecoder.parameterPort("objectVectorOutput"), mCoreRenderer.parameterPort("objectDataInput") );
+  parameterConnection( mSceneReceiver.parameterPort("objectVectorOutput"), mCoreRenderer.parameterPort("objectDataInput") );
 
   if( not trackingConfiguration.empty() )
   {
@@ -11,8 +11,8 @@
 #include <libvisr/audio_output.hpp>
 
 #include <librcl/position_decoder.hpp>
-#include <librcl/scene_decoder.hpp>
 #include <librcl/udp_receiver.hpp>
+#include <librcl/udp_scene_receiver.hpp>
 
 #include <libpml/listener_position.hpp>
 #include <libpml/object_vector.hpp>
@@ -85,9 +85,10 @@ public:
 
 private:
 
-  rcl::UdpReceiver mSceneReceiver;
-
-  rcl::SceneDecoder mSceneDecoder;
+  /**
+   * Receives and decodes the scene metadata in a separate thread.
+   */
+  rcl::UdpSceneReceiver mSceneReceiver;
 
   /**
    * Tracking-related members
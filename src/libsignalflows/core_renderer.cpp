@@ -49,6 +49,68 @@ rbbl::FilterRoutingList oneToOneRouting( std::size_t numChannels )
   return res;
 }
 
+/**
+ * Create a routing that routes each of the input signals to the corresponding output,
+ * using the filter of the rendered loudspeaker.
+ * @param loudspeakers The indices of the rendered loudspeakers, which are used as filter indices.
+ */
+rbbl::FilterRoutingList loudspeakerRouting( std::vector<std::size_t> const & loudspeakers )
+{
+  rbbl::FilterRoutingList res;
+  for( std::size_t chIdx( 0 ); chIdx < loudspeakers.size(); ++chIdx )
+  {
+    res.addRouting( chIdx, chIdx, loudspeakers[chIdx], 1.0f );
+  }
+  return res;
+}
+
+/**
+ * Determine the regular loudspeakers whose output channels are contained in an output channel group.
+ * @param loudspeakerConfiguration The loudspeaker array.
+ * @param outputChannelGroup Zero-offset output channel indices, an empty list selects all loudspeakers.
+ * @throw std::invalid_argument If the group does not contain any regular loudspeaker.
+ */
+std::vector<std::size_t> groupLoudspeakers( panning::LoudspeakerArray const & loudspeakerConfiguration,
+                                            std::vector<std::size_t> const & outputChannelGroup )
+{
+  std::vector<std::size_t> res;
+  for( std::size_t idx( 0 ); idx < loudspeakerConfiguration.getNumRegularSpeakers(); ++idx )
+  {
+    std::size_t const chIdx = loudspeakerConfiguration.channelIndex( idx ) - 1;
+    if( outputChannelGroup.empty()
+      or (std::find( outputChannelGroup.begin(), outputChannelGroup.end(), chIdx ) != outputChannelGroup.end()) )
+    {
+      res.push_back( idx );
+    }
+  }
+  if( res.empty() )
+  {
+    throw std::invalid_argument( "CoreRenderer: The output channel group does not contain a regular loudspeaker." );
+  }
+  return res;
+}
+
+/**
+ * Determine the subwoofers whose output channels are contained in an output channel group.
+ * @param loudspeakerConfiguration The loudspeaker array.
+ * @param outputChannelGroup Zero-offset output channel indices, an empty list selects all subwoofers.
+ */
+std::vector<std::size_t> groupSubwoofers( panning::LoudspeakerArray const & loudspeakerConfiguration,
+                                          std::vector<std::size_t> const & outputChannelGroup )
+{
+  std::vector<std::size_t> res;
+  for( std::size_t idx( 0 ); idx < loudspeakerConfiguration.getNumSubwoofers(); ++idx )
+  {
+    std::size_t const chIdx = loudspeakerConfiguration.getSubwooferChannel( idx ) - 1;
+    if( outputChannelGroup.empty()
+      or (std::find( outputChannelGroup.begin(), outputChannelGroup.end(), chIdx ) != outputChannelGroup.end()) )
+    {
+      res.push_back( idx );
+    }
+  }
+  return res;
+}
+
 // Static crossover pair (2nd-order Linkwitz-Riley with cutoff 700 Hz @ fs=48
 // kHz)
 static rbbl::BiquadCoefficient< SampleType > const lowpass{
@@ -75,41 +137,72 @@ CoreRenderer::CoreRenderer( SignalFlowContext const & context,
                             std::string const & trackingConfiguration,
                             std::size_t numberOfObjectEqSections,
                             std::string const & reverbConfig,
-                            bool frequencyDependentPanning )
+                            bool frequencyDependentPanning,
+                            std::vector<std::size_t> const & outputChannelGroup /*= std::vector<std::size_t>()*/ )
  : CompositeComponent( context, name, parent )
+ , mRenderedLoudspeakers( groupLoudspeakers( loudspeakerConfiguration, outputChannelGroup ) )
+ , mRenderedSubwoofers( groupSubwoofers( loudspeakerConfiguration, outputChannelGroup ) )
  , mObjectSignalInput( "audioIn", *this, numberOfInputs )
  , mLoudspeakerOutput( "audioOut", *this, numberOfOutputs )
  , mObjectVectorInput( "objectDataInput", *this, pml::EmptyParameterConfig() )
  , mObjectInputGainEqCalculator( context, "ObjectGainEqCalculator", this, numberOfInputs, numberOfObjectEqSections )
+ // Keep unused channels active until the gain fade-out is complete, plus one period for the decay of the object EQ.
+ , mChannelActivityCalculator( context, "ChannelActivityCalculator", this, numberOfInputs,
+                               (interpolationPeriod + period() - 1) / period() + 1 )
  , mObjectGain( context, "ObjectGain", this )
  , mObjectEq( context,
               "ObjectEq",
               this,
               numberOfInputs,
               numberOfObjectEqSections,
-              true /* Enable control input */ )
+              true /* Enable control input */,
+              true /* Enable activity input */ )
  , mOutputAdjustment( context, "OutputAdjustment", this )
  , mGainCalculator( context, "VbapGainCalculator", this, numberOfInputs, loudspeakerConfiguration, not trackingConfiguration.empty(),
                     frequencyDependentPanning ? rcl::PanningCalculator::PanningMode::All : (rcl::PanningCalculator::PanningMode::LF | rcl::PanningCalculator::PanningMode::Diffuse) )
  , mVbapMatrix( context, "VbapGainMatrix", this )
  , mVbipMatrix( frequencyDependentPanning ? new rcl::GainMatrix( context, "VbipMatrix", this ) : nullptr)
  , mDiffuseMatrix( context, "DiffuseMatrix", this )
- , mDecorrelator( context, "DiffusePartDecorrelator", this, loudspeakerConfiguration.getNumRegularSpeakers(),
-                  loudspeakerConfiguration.getNumRegularSpeakers(), diffusionFilters.numberOfColumns(),
-                  diffusionFilters.numberOfRows(), diffusionFilters.numberOfRows(), diffusionFilters,
-                  oneToOneRouting(loudspeakerConfiguration.getNumRegularSpeakers()) )
+ , mDecorrelator( context, "DiffusePartDecorrelator", this, mRenderedLoudspeakers.size(),
+                  mRenderedLoudspeakers.size(), diffusionFilters.numberOfColumns(),
+                  diffusionFilters.numberOfRows(), mRenderedLoudspeakers.size(), diffusionFilters,
+                  outputChannelGroup.empty() ? oneToOneRouting( mRenderedLoudspeakers.size() )
+                                             : loudspeakerRouting( mRenderedLoudspeakers ) )
  , mDirectDiffuseMix( context, "DirectDiffuseMixer", this,
-                      loudspeakerConfiguration.getNumRegularSpeakers(),
+                      mRenderedLoudspeakers.size(),
                       2 + (frequencyDependentPanning ?1:0) + (reverbConfig.empty() ? 0 : 1) )
  , mSubwooferMix( context, "SubwooferMixer", this )
  , mNullSource( context, "NullSource", this,
-              (numberOfOutputs == loudspeakerConfiguration.getNumRegularSpeakers() + loudspeakerConfiguration.getNumSubwoofers()) ? 0 : 1 )
+              (numberOfOutputs == mRenderedLoudspeakers.size() + mRenderedSubwoofers.size()) ? 0 : 1 )
 {
   std::size_t const numberOfLoudspeakers = loudspeakerConfiguration.getNumRegularSpeakers();
   std::size_t const numberOfSubwoofers = loudspeakerConfiguration.getNumSubwoofers();
   std::size_t const numberOfOutputSignals = numberOfLoudspeakers + numberOfSubwoofers;
 
+  // Numbers of loudspeakers and subwoofers rendered by this instance, which differ from the numbers above only
+  // if the rendering is restricted to an output channel group.
+  std::size_t const numberOfRenderedLoudspeakers = mRenderedLoudspeakers.size();
+  std::size_t const numberOfRenderedSubwoofers = mRenderedSubwoofers.size();
+  std::size_t const numberOfRenderedSignals = numberOfRenderedLoudspeakers + numberOfRenderedSubwoofers;
+  bool const partitioned = not outputChannelGroup.empty();
+  if( std::any_of( outputChannelGroup.begin(), outputChannelGroup.end(),
+                   [numberOfOutputs]( std::size_t chIdx ){ return chIdx >= numberOfOutputs; } ) )
+  {
+    throw std::invalid_argument( "CoreRenderer: An index of the output channel group exceeds the number of output channels." );
+  }
+  // Indices of the rendered signals within the loudspeaker and subwoofer signals, i.e., in the range
+  // 0..numberOfOutputSignals-1, which are used to select the respective entries of the array configuration.
+  std::vector<std::size_t> renderedSignals( mRenderedLoudspeakers );
+  for( std::size_t subIdx : mRenderedSubwoofers )
+  {
+    renderedSignals.push_back( numberOfLoudspeakers + subIdx );
+  }
+
   bool const trackingEnabled = not trackingConfiguration.empty( );
+  if( trackingEnabled and partitioned )
+  {
+    throw std::invalid_argument( "CoreRenderer: Listener tracking is not supported if the rendering is restricted to an output channel group." );
+  }
 
   parameterConnection( mObjectVectorInput, mGainCalculator.parameterPort( "objectVectorInput" ) );
 
@@ -144,20 +237,49 @@ CoreRenderer::CoreRenderer( SignalFlowContext const & context,
       throw std::invalid_argument( "BaselineRenderer: Size of the output EQ configuration config differs from "
                                    "the number of output signals (regular loudspeakers + subwoofers).");
     }
+    rbbl::BiquadCoefficientMatrix<Afloat> renderedEqConfig( numberOfRenderedSignals, outputEqSections );
+    for( std::size_t idx( 0 ); idx < numberOfRenderedSignals; ++idx )
+    {
+      for( std::size_t sectionIdx( 0 ); sectionIdx < outputEqSections; ++sectionIdx )
+      {
+        renderedEqConfig( idx, sectionIdx ) = eqConfig( renderedSignals[idx], sectionIdx );
+      }
+    }
     mOutputEqualisationFilter.reset( new rcl::BiquadIirFilter(
-        context, "OutputEqualisationFilter", this, numberOfOutputSignals,
-        outputEqSections, eqConfig ) );
+        context, "OutputEqualisationFilter", this, numberOfRenderedSignals,
+        outputEqSections, renderedEqConfig ) );
   }
 
+  // Connect a gain matrix computed for all regular loudspeakers to a gain matrix component. If the rendering is
+  // restricted to an output channel group, only the gains of the rendered loudspeakers are passed.
+  auto connectLoudspeakerGains = [&]( ParameterPortBase & gainOutput, rcl::GainMatrix & matrix, char const * selectorName )
+  {
+    if( partitioned )
+    {
+      mLoudspeakerGainSelectors.emplace_back( new rcl::MatrixRowSelector( context, selectorName, this,
+        numberOfLoudspeakers, numberOfInputs, mRenderedLoudspeakers ) );
+      parameterConnection( gainOutput, mLoudspeakerGainSelectors.back()->parameterPort( "in" ) );
+      parameterConnection( mLoudspeakerGainSelectors.back()->parameterPort( "out" ), matrix.parameterPort( "gainInput" ) );
+    }
+    else
+    {
+      parameterConnection( gainOutput, matrix.parameterPort( "gainInput" ) );
+    }
+  };
+
   parameterConnection(mObjectVectorInput, mObjectInputGainEqCalculator.parameterPort("objectIn") );
-  mObjectGain.setup( numberOfInputs, interpolationPeriod, true /* controlInputs */ );
+  parameterConnection( mObjectVectorInput, mChannelActivityCalculator.parameterPort("objectIn") );
+  mObjectGain.setup( numberOfInputs, interpolationPeriod, true /* controlInputs */, 1.0f, true /* activityInput */ );
+  parameterConnection( mChannelActivityCalculator.parameterPort("activityOut"), mObjectGain.parameterPort("activityInput") );
+  parameterConnection( mChannelActivityCalculator.parameterPort("activityOut"), mObjectEq.parameterPort("activityInput") );
   audioConnection( mObjectSignalInput, mObjectGain.audioPort("in") );
   parameterConnection( mObjectInputGainEqCalculator.parameterPort("gainOut"), mObjectGain.parameterPort("gainInput"));
 
   audioConnection( mObjectGain.audioPort("out"), mObjectEq.audioPort("in") );
   parameterConnection( mObjectInputGainEqCalculator.parameterPort("eqOut"), mObjectEq.parameterPort("eqInput"));
 
-  mVbapMatrix.setup( numberOfInputs, numberOfLoudspeakers, interpolationPeriod, 0.0f );
+  mVbapMatrix.setup( numberOfInputs, numberOfRenderedLoudspeakers, interpolationPeriod, 0.0f, true /* controlInput */, true /* activityInput */ );
+  parameterConnection( mChannelActivityCalculator.parameterPort("activityOut"), mVbapMatrix.parameterPort("activityInput") );
   audioConnection( mVbapMatrix.audioPort("out"), mDirectDiffuseMix.audioPort("in0") );
   if( frequencyDependentPanning )
   {
@@ -170,8 +292,9 @@ CoreRenderer::CoreRenderer( SignalFlowContext const & context,
     }
     mPanningFilterbank.reset( new rcl::BiquadIirFilter(context, "PanningFilterbank", this,
        2*numberOfInputs, 1, coeffMatrix ) );
-    mVbipMatrix->setup( numberOfInputs, numberOfLoudspeakers, interpolationPeriod, 0.0f );
-    parameterConnection( mGainCalculator.parameterPort("vbipGains"), mVbipMatrix->parameterPort( "gainInput") );
+    mVbipMatrix->setup( numberOfInputs, numberOfRenderedLoudspeakers, interpolationPeriod, 0.0f, true /* controlInput */, true /* activityInput */ );
+    parameterConnection( mChannelActivityCalculator.parameterPort("activityOut"), mVbipMatrix->parameterPort("activityInput") );
+    connectLoudspeakerGains( mGainCalculator.parameterPort("vbipGains"), *mVbipMatrix, "VbipGainSelector" );
 
     audioConnection( mObjectEq.audioPort("out"), ChannelRange( 0, numberOfInputs ), mPanningFilterbank->audioPort("in"), ChannelRange( 0, numberOfInputs ) );
     audioConnection( mObjectEq.audioPort("out"), ChannelRange( 0, numberOfInputs ), mPanningFilterbank->audioPort("in"), ChannelRange( numberOfInputs, 2*numberOfInputs ) );
@@ -216,24 +339,32 @@ CoreRenderer::CoreRenderer( SignalFlowContext const & context,
 
   parameterConnection( mObjectVectorInput, mAllradGainCalculator->parameterPort("objectInput") );
   parameterConnection( mGainCalculator.parameterPort( "vbapGains" ), mAllradGainCalculator->parameterPort( "gainInput" ) );
-  parameterConnection( mAllradGainCalculator->parameterPort( "gainOutput" ), mVbapMatrix.parameterPort( "gainInput" ) );
+  connectLoudspeakerGains( mAllradGainCalculator->parameterPort( "gainOutput" ), mVbapMatrix, "VbapGainSelector" );
 
   //////////////////////////////////////////////////////////////////////////////////////
 
-  mDiffuseMatrix.setup( numberOfInputs, numberOfLoudspeakers, interpolationPeriod, 0.0f );
+  mDiffuseMatrix.setup( numberOfInputs, numberOfRenderedLoudspeakers, interpolationPeriod, 0.0f, true /* controlInput */, true /* activityInput */ );
+  parameterConnection( mChannelActivityCalculator.parameterPort("activityOut"), mDiffuseMatrix.parameterPort("activityInput") );
 //  parameterConnection( mObjectVectorInput,  mDiffusionGainCalculator.parameterPort("objectInput") );
 //  parameterConnection( "DiffusionCalculator", "gainOutput", "DiffusePartMatrix", "gainInput" );
-  parameterConnection( mGainCalculator.parameterPort("diffuseGains"), mDiffuseMatrix.parameterPort("gainInput") );
+  connectLoudspeakerGains( mGainCalculator.parameterPort("diffuseGains"), mDiffuseMatrix, "DiffuseGainSelector" );
   audioConnection( mObjectEq.audioPort("out"), mDiffuseMatrix.audioPort("in") );
 
-  efl::BasicVector<SampleType> const & outputGains =loudspeakerConfiguration.getGainAdjustment();
-  efl::BasicVector<SampleType> const & outputDelays = loudspeakerConfiguration.getDelayAdjustment();
+  efl::BasicVector<SampleType> const & allOutputGains =loudspeakerConfiguration.getGainAdjustment();
+  efl::BasicVector<SampleType> const & allOutputDelays = loudspeakerConfiguration.getDelayAdjustment();
+  efl::BasicVector<SampleType> outputGains( numberOfRenderedSignals, cVectorAlignmentSamples );
+  efl::BasicVector<SampleType> outputDelays( numberOfRenderedSignals, cVectorAlignmentSamples );
+  for( std::size_t idx( 0 ); idx < numberOfRenderedSignals; ++idx )
+  {
+    outputGains[idx] = allOutputGains[renderedSignals[idx]];
+    outputDelays[idx] = allOutputDelays[renderedSignals[idx]];
+  }
 
   Afloat const * const maxEl = std::max_element( outputDelays.data(),
                                                  outputDelays.data()+outputDelays.size() );
   Afloat const maxDelay = std::ceil( *maxEl ); // Sufficient for nearestSample even if there is no particular compensation for the interpolation method's delay inside.
 
-  mOutputAdjustment.setup( numberOfOutputSignals, period(), maxDelay,
+  mOutputAdjustment.setup( numberOfRenderedSignals, period(), maxDelay,
                            "lagrangeOrder0",
                            rcl::DelayVector::MethodDelayPolicy::Limit,
                            rcl::DelayVector::ControlPortConfig::None,
@@ -241,8 +372,18 @@ CoreRenderer::CoreRenderer( SignalFlowContext const & context,
 
   // Note: This assumes that the type 'Afloat' used in libpanning is
   // identical to SampleType (at the moment, both are floats).
-  efl::BasicMatrix<SampleType> const & subwooferMixGains = loudspeakerConfiguration.getSubwooferGains();
-  mSubwooferMix.setup( numberOfLoudspeakers, numberOfSubwoofers, 0/*interpolation steps*/, subwooferMixGains, false/*controlInput*/ );
+  // If the rendering is restricted to an output channel group, the rendered subwoofers receive only the
+  // contributions of the rendered loudspeakers.
+  efl::BasicMatrix<SampleType> const & allSubwooferMixGains = loudspeakerConfiguration.getSubwooferGains();
+  efl::BasicMatrix<SampleType> subwooferMixGains( numberOfRenderedSubwoofers, numberOfRenderedLoudspeakers, cVectorAlignmentSamples );
+  for( std::size_t subIdx( 0 ); subIdx < numberOfRenderedSubwoofers; ++subIdx )
+  {
+    for( std::size_t lspIdx( 0 ); lspIdx < numberOfRenderedLoudspeakers; ++lspIdx )
+    {
+      subwooferMixGains( subIdx, lspIdx ) = allSubwooferMixGains( mRenderedSubwoofers[subIdx], mRenderedLoudspeakers[lspIdx] );
+    }
+  }
+  mSubwooferMix.setup( numberOfRenderedLoudspeakers, numberOfRenderedSubwoofers, 0/*interpolation steps*/, subwooferMixGains, false/*controlInput*/ );
 
   if( not reverbConfig.empty() )
   {
@@ -252,7 +393,16 @@ CoreRenderer::CoreRenderer( SignalFlowContext const & context,
 
     audioConnection( mObjectEq.audioPort("out"), mReverbRenderer->audioPort("in") );
     char const * diffuseInPort = frequencyDependentPanning ? "in3" : "in2";
-    audioConnection( mReverbRenderer->audioPort("out"), mDirectDiffuseMix.audioPort( diffuseInPort) );
+    if( partitioned )
+    {
+      // The reverb renderer creates the signals for all loudspeakers, of which only the rendered ones are used.
+      audioConnection( mReverbRenderer->audioPort("out"), ChannelList( mRenderedLoudspeakers ),
+                       mDirectDiffuseMix.audioPort( diffuseInPort ), ChannelRange( 0, numberOfRenderedLoudspeakers ) );
+    }
+    else
+    {
+      audioConnection( mReverbRenderer->audioPort("out"), mDirectDiffuseMix.audioPort( diffuseInPort) );
+    }
 
     parameterConnection( mObjectVectorInput, mReverbRenderer->parameterPort("objectIn") );
   }
@@ -282,21 +432,21 @@ CoreRenderer::CoreRenderer( SignalFlowContext const & context,
     if( outputEqSupport )
     {
       audioConnection( mDirectDiffuseMix.audioPort("out"),
-                      ChannelRange( 0, numberOfLoudspeakers ),
+                      ChannelRange( 0, numberOfRenderedLoudspeakers ),
                       mOutputEqualisationFilter->audioPort("in"),
-                      ChannelRange( 0, numberOfLoudspeakers ) );
+                      ChannelRange( 0, numberOfRenderedLoudspeakers ) );
       audioConnection( mSubwooferMix.audioPort("out"),
-                      ChannelRange( 0, numberOfSubwoofers ),
+                      ChannelRange( 0, numberOfRenderedSubwoofers ),
                       mOutputEqualisationFilter->audioPort("in"),
-                      ChannelRange( numberOfLoudspeakers, numberOfLoudspeakers + numberOfSubwoofers ) );
+                      ChannelRange( numberOfRenderedLoudspeakers, numberOfRenderedSignals ) );
       audioConnection( mOutputEqualisationFilter->audioPort("out"), mOutputAdjustment.audioPort("in") );
     }
     else
     {
-      audioConnection( mDirectDiffuseMix.audioPort("out"), ChannelRange( 0, numberOfLoudspeakers ),
-                       mOutputAdjustment.audioPort("in"), ChannelRange( 0, numberOfLoudspeakers ) );
-      audioConnection( mSubwooferMix.audioPort("out"), ChannelRange( 0, numberOfSubwoofers ),
-                       mOutputAdjustment.audioPort("in"), ChannelRange( numberOfLoudspeakers, numberOfLoudspeakers + numberOfSubwoofers ) );
+      audioConnection( mDirectDiffuseMix.audioPort("out"), ChannelRange( 0, numberOfRenderedLoudspeakers ),
+                       mOutputAdjustment.audioPort("in"), ChannelRange( 0, numberOfRenderedLoudspeakers ) );
+      audioConnection( mSubwooferMix.audioPort("out"), ChannelRange( 0, numberOfRenderedSubwoofers ),
+                       mOutputAdjustment.audioPort("in"), ChannelRange( numberOfRenderedLoudspeakers, numberOfRenderedSignals ) );
     }
   }
 
@@ -337,10 +487,18 @@ CoreRenderer::CoreRenderer( SignalFlowContext const & context,
   {
     throw std::invalid_argument( "The loudspeaker array contains a duplicated output channel index." );
   }
-  audioConnection( mOutputAdjustment.audioPort("out"), ChannelRange(0, numberOfLoudspeakers + numberOfSubwoofers ),
-                   mLoudspeakerOutput, ChannelList( activePlaybackChannels ) );
+  std::vector<ChannelList::IndexType> renderedPlaybackChannels( numberOfRenderedSignals );
+  for( std::size_t idx( 0 ); idx < numberOfRenderedSignals; ++idx )
+  {
+    renderedPlaybackChannels[idx] = activePlaybackChannels[renderedSignals[idx]];
+  }
+  audioConnection( mOutputAdjustment.audioPort("out"), ChannelRange(0, numberOfRenderedSignals ),
+                   mLoudspeakerOutput, ChannelList( renderedPlaybackChannels ) );
+  // All output channels not rendered by this instance are silenced.
+  sortedPlaybackChannels = renderedPlaybackChannels;
+  std::sort( sortedPlaybackChannels.begin(), sortedPlaybackChannels.end() );
 
-  std::size_t const numSilentOutputs = numberOfOutputs - (numberOfLoudspeakers + numberOfSubwoofers);
+  std::size_t const numSilentOutputs = numberOfOutputs - numberOfRenderedSignals;
   if( numSilentOutputs > 0 )
   {
     std::vector<ChannelList::IndexType> nullOutput( numSilentOutputs, 0 );
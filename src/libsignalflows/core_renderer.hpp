@@ -12,12 +12,14 @@
 
 #include <librcl/add.hpp>
 #include <librcl/biquad_iir_filter.hpp>
+#include <librcl/channel_activity_calculator.hpp>
 #include <librcl/delay_vector.hpp>
 #include <librcl/fir_filter_matrix.hpp>
 #include <librcl/gain_matrix.hpp>
 #include <librcl/gain_vector.hpp>
 #include <librcl/hoa_allrad_gain_calculator.hpp>
 #include <librcl/listener_compensation.hpp>
+#include <librcl/matrix_row_selector.hpp>
 #include <librcl/object_gain_eq_calculator.hpp>
 #include <librcl/null_source.hpp>
 #include <librcl/panning_calculator.hpp>
@@ -27,8 +29,10 @@
 #include <libpml/double_buffering_protocol.hpp>
 #include <libpml/object_vector.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace visr
 {
@@ -70,6 +74,12 @@ public:
    *        - lateReverbDecorrelationFilters (string) Absolute or relative file path (relative to start directory of the renderer) to a multichannel audio file (typically WAV) 
    *          containing the filter coefficients for the decorrelation of the late part.
    * @param frequencyDependentPanning Flag specifiying whether the frequency-dependent VBAP algorithm shall be activated (true) or not (false)
+   * @param outputChannelGroup Restrict the rendering to the loudspeakers and subwoofers routed to these (zero-offset) output channels.
+   * All other output channels are silent. This allows to distribute the rendering for a large loudspeaker array over several
+   * renderer instances, because the panning gains are computed for the complete array, but the audio processing is performed
+   * only for the loudspeakers of the group. Subwoofers in the group receive only the contributions of the loudspeakers in the group.
+   * Listener tracking is not supported in this mode. An empty list (default) renders all loudspeakers.
+   * @throw std::invalid_argument If \p outputChannelGroup is not empty and contains no regular loudspeaker or an invalid channel index.
    */
   explicit CoreRenderer( SignalFlowContext const & context,
                          char const * name,
@@ -82,11 +92,22 @@ public:
                          std::string const & trackingConfiguration,
                          std::size_t numberOfObjectEqSections,
                          std::string const & reverbConfig,
-                         bool frequencyDependentPanning );
+                         bool frequencyDependentPanning,
+                         std::vector<std::size_t> const & outputChannelGroup = std::vector<std::size_t>() );
 
   ~CoreRenderer();
 
 private:
+  /**
+   * Indices of the regular loudspeakers rendered by this instance, sorted in ascending order.
+   */
+  std::vector<std::size_t> const mRenderedLoudspeakers;
+
+  /**
+   * Indices of the subwoofers rendered by this instance, sorted in ascending order.
+   */
+  std::vector<std::size_t> const mRenderedSubwoofers;
+
   AudioInput mObjectSignalInput;
 
   AudioOutput mLoudspeakerOutput;
@@ -102,6 +123,11 @@ private:
 
   rcl::ObjectGainEqCalculator mObjectInputGainEqCalculator;
 
+  /**
+   * Determine the object channels used in the scene, such that the object-domain components skip unused channels.
+   */
+  rcl::ChannelActivityCalculator mChannelActivityCalculator;
+
   /**
    * Apply the 'level' setting of the object.
    * @note This signal flow assumes that each signal input is used only by a single object. Otherwise the settings would
@@ -119,6 +145,12 @@ private:
 
   rcl::GainMatrix mVbapMatrix;
 
+  /**
+   * Components to select the gains of the rendered loudspeakers from the panning gains for all loudspeakers.
+   * Instantiated only if the rendering is restricted to an output channel group.
+   */
+  std::vector<std::unique_ptr<rcl::MatrixRowSelector> > mLoudspeakerGainSelectors;
+
   /**
    * AUdio signal matrix to handle the high-frequency portion of panned objects.
    */
@@ -0,0 +1,97 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include "distributed_renderer.hpp"
+
+#include <libpanning/LoudspeakerArray.h>
+
+#include <sstream>
+#include <stdexcept>
+
+namespace visr
+{
+namespace signalflows
+{
+
+DistributedRenderer::DistributedRenderer( SignalFlowContext const & context,
+                                          char const * name,
+                                          CompositeComponent * parent,
+                                          panning::LoudspeakerArray const & loudspeakerConfiguration,
+                                          std::size_t numberOfInputs,
+                                          std::size_t numberOfOutputs,
+                                          std::vector<std::size_t> const & outputChannelGroup,
+                                          std::size_t interpolationPeriod,
+                                          efl::BasicMatrix<SampleType> const & diffusionFilters,
+                                          std::size_t sceneReceiverPort,
+                                          std::vector<std::string> const & sceneForwardAddresses,
+                                          std::size_t schedulingLatency,
+                                          std::size_t numberOfObjectEqSections,
+                                          std::string const & reverbConfig,
+                                          bool frequencyDependentPanning )
+ : CompositeComponent( context, name, parent )
+ , mSceneReceiver( context, "SceneReceiver", this, sceneReceiverPort, rcl::UdpReceiver::Mode::Asynchronous )
+ , mSceneStampDecoder( context, "SceneStampDecoder", this )
+ , mSceneDecoder( context, "SceneDecoder", this )
+ , mCoreRenderer( context, "CoreRenderer", this, loudspeakerConfiguration, numberOfInputs, numberOfOutputs,
+                  interpolationPeriod, diffusionFilters, std::string() /*no tracking*/, numberOfObjectEqSections,
+                  reverbConfig, frequencyDependentPanning, outputChannelGroup )
+ , mInput( "input", *this, numberOfInputs )
+ , mOutput( "output", *this, numberOfOutputs )
+{
+  audioConnection( mInput, mCoreRenderer.audioPort( "audioIn" ) );
+  audioConnection( mCoreRenderer.audioPort( "audioOut" ), mOutput );
+
+  if( sceneForwardAddresses.empty() )
+  {
+    parameterConnection( mSceneReceiver.parameterPort( "messageOutput" ), mSceneStampDecoder.parameterPort( "in" ) );
+  }
+  else
+  {
+    // The first output of the stamp encoder feeds the local rendering, the remaining outputs the other nodes.
+    mSceneStampEncoder.reset( new rcl::BlockStampEncoder( context, "SceneStampEncoder", this, schedulingLatency,
+                                                          sceneForwardAddresses.size() + 1 ) );
+    parameterConnection( mSceneReceiver.parameterPort( "messageOutput" ), mSceneStampEncoder->parameterPort( "in" ) );
+    parameterConnection( mSceneStampEncoder->parameterPort( "out0" ), mSceneStampDecoder.parameterPort( "in" ) );
+    for( std::size_t nodeIdx( 0 ); nodeIdx < sceneForwardAddresses.size(); ++nodeIdx )
+    {
+      std::string const & address = sceneForwardAddresses[nodeIdx];
+      std::string::size_type const sepPos = address.rfind( ':' );
+      if( (sepPos == std::string::npos) or (sepPos == 0) or (sepPos + 1 == address.size())
+        or (address.find_first_not_of( "0123456789", sepPos + 1 ) != std::string::npos) )
+      {
+        throw std::invalid_argument( "DistributedRenderer: Scene forwarding address \"" + address
+                                     + "\" is not of the form \"host:port\"." );
+      }
+      std::size_t const port = std::stoul( address.substr( sepPos + 1 ) );
+      std::stringstream senderName;
+      senderName << "SceneSender" << nodeIdx;
+      mSceneSenders.emplace_back( new rcl::UdpSender( context, senderName.str().c_str(), this, 0 /* arbitrary local port */,
+                                                      address.substr( 0, sepPos ), port, rcl::UdpSender::Mode::Asynchronous ) );
+      std::stringstream outName;
+      outName << "out" << nodeIdx + 1;
+      parameterConnection( mSceneStampEncoder->parameterPort( outName.str().c_str() ),
+                           mSceneSenders.back()->parameterPort( "messageInput" ) );
+    }
+  }
+  parameterConnection( mSceneStampDecoder.parameterPort( "out" ), mSceneDecoder.parameterPort( "datagramInput" ) );
+  parameterConnection( mSceneDecoder.parameterPort( "objectVectorOutput" ), mCoreRenderer.parameterPort( "objectDataInput" ) );
+}
+
+DistributedRenderer::~DistributedRenderer() = default;
+
+std::size_t DistributedRenderer::numberOfLateSceneMessages() const
+{
+  return mSceneStampDecoder.numberOfLateMessages();
+}
+
+std::size_t DistributedRenderer::sceneReceiverPort() const
+{
+  return mSceneReceiver.port();
+}
+
+std::size_t DistributedRenderer::numberOfReceivedSceneMessages() const
+{
+  return mSceneReceiver.numberOfReceivedMessages();
+}
+
+} // namespace signalflows
+} // namespace visr
@@ -0,0 +1,130 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#ifndef VISR_SIGNALFLOWS_DISTRIBUTED_RENDERER_HPP_INCLUDED
+#define VISR_SIGNALFLOWS_DISTRIBUTED_RENDERER_HPP_INCLUDED
+
+#include "core_renderer.hpp"
+#include "export_symbols.hpp"
+
+#include <libvisr/composite_component.hpp>
+#include <libvisr/audio_input.hpp>
+#include <libvisr/audio_output.hpp>
+
+#include <librcl/block_stamp_decoder.hpp>
+#include <librcl/block_stamp_encoder.hpp>
+#include <librcl/scene_decoder.hpp>
+#include <librcl/udp_receiver.hpp>
+#include <librcl/udp_sender.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace visr
+{
+namespace signalflows
+{
+
+/**
+ * Audio signal graph object for one node of a renderer that is distributed over several processes or hosts.
+ * Each node renders the loudspeakers of one output channel group of a large loudspeaker array (see the
+ * \p outputChannelGroup parameter of CoreRenderer), while the panning gains are computed for the complete array
+ * on every node. All nodes receive the same object signals.
+ * The scene metadata is received by a single node, the scene master, which stamps each message with the block at which
+ * it takes effect (rcl::BlockStampEncoder) and forwards it via UDP to all other nodes. Each node, including the master,
+ * applies the messages exactly at the stamped block (rcl::BlockStampDecoder), so all nodes render the scene changes
+ * sample-synchronously.
+ * @note The block counters (Time::blockCount()) of all nodes must be identical, i.e., the nodes must be driven by a
+ * common clock and start processing at the same block. The scheduling latency must exceed the transmission time of the
+ * scene messages to the nodes. Because the nodes are addressed by host name and port, all nodes can run as separate
+ * processes on the same host (e.g., using the loopback interface) for testing.
+ */
+class VISR_SIGNALFLOWS_LIBRARY_SYMBOL DistributedRenderer: public CompositeComponent
+{
+public:
+  /**
+   * Constructor to create, initialise and interconnect all processing components.
+   * @param context The signal flow context object containing information such as sampling frequency and period (block) size.
+   * @param name The name of the component, used for identification and error reporting.
+   * @param parent The containing component, if there is one. Use nullptr to mark this as the toplevel component.
+   * @param loudspeakerConfiguration The configuration of the complete reproduction array.
+   * @param numberOfInputs The number of inputs, i.e., the number of audio object signals
+   * @param numberOfOutputs The number of output channels.
+   * @param outputChannelGroup The (zero-offset) output channels rendered by this node, an empty list renders all channels.
+   * @param interpolationPeriod The interpolation period used in the VBAP gain matrix. Must be multiple of \p period.
+   * @param diffusionFilters A matrix containing the the FIR coefficients of the decorrelation filters, one row for each
+   * regular loudspeaker of the complete array.
+   * @param sceneReceiverPort The UDP port for receiving the scene data messages. For the scene master, these are the plain
+   * scene messages (as received by BaselineRenderer), for all other nodes the stamped messages forwarded by the master.
+   * If 0, an unused port is chosen by the operating system, see sceneReceiverPort().
+   * @param sceneForwardAddresses The addresses of the other nodes in the form "host:port". If not empty, this node is the
+   * scene master and forwards the stamped scene messages to these addresses.
+   * @param schedulingLatency The number of blocks between the reception of a scene message by the master and the block at
+   * which it takes effect. Used only by the scene master.
+   * @param numberOfObjectEqSections The number of biquad sections alocated to each object signal.
+   * @param reverbConfig A JSON message containing configuration options for the late reverberation part, see BaselineRenderer.
+   * @param frequencyDependentPanning Flag specifiying whether the frequency-dependent VBAP algorithm shall be activated (true) or not (false)
+   * @throw std::invalid_argument If an entry of \p sceneForwardAddresses is not of the form "host:port".
+   */
+  explicit DistributedRenderer( SignalFlowContext const & context,
+                                char const * name,
+                                CompositeComponent * parent,
+                                panning::LoudspeakerArray const & loudspeakerConfiguration,
+                                std::size_t numberOfInputs,
+                                std::size_t numberOfOutputs,
+                                std::vector<std::size_t> const & outputChannelGroup,
+                                std::size_t interpolationPeriod,
+                                efl::BasicMatrix<SampleType> const & diffusionFilters,
+                                std::size_t sceneReceiverPort,
+                                std::vector<std::string> const & sceneForwardAddresses,
+                                std::size_t schedulingLatency,
+                                std::size_t numberOfObjectEqSections,
+                                std::string const & reverbConfig,
+                                bool frequencyDependentPanning );
+
+  ~DistributedRenderer();
+
+  /**
+   * Return the number of scene messages that arrived at this node after their stamped block.
+   */
+  std::size_t numberOfLateSceneMessages() const;
+
+  /**
+   * Return the UDP port on which this node receives the scene messages.
+   */
+  std::size_t sceneReceiverPort() const;
+
+  /**
+   * Return the number of scene messages received by this node so far.
+   * A message counted here is processed in the next block. This function can be called from any thread.
+   */
+  std::size_t numberOfReceivedSceneMessages() const;
+
+private:
+  rcl::UdpReceiver mSceneReceiver;
+
+  /**
+   * Scene distribution, instantiated only on the scene master.
+   */
+  //@{
+  std::unique_ptr<rcl::BlockStampEncoder> mSceneStampEncoder;
+
+  std::vector<std::unique_ptr<rcl::UdpSender> > mSceneSenders;
+  //@}
+
+  rcl::BlockStampDecoder mSceneStampDecoder;
+
+  rcl::SceneDecoder mSceneDecoder;
+
+  CoreRenderer mCoreRenderer;
+
+  AudioInput mInput;
+
+  AudioOutput mOutput;
+};
+
+} // namespace signalflows
+} // namespace visr
+
+#endif // VISR_SIGNALFLOWS_DISTRIBUTED_RENDERER_HPP_INCLUDED
@@ -0,0 +1,253 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <libsignalflows/distributed_renderer.hpp>
+
+#include <libefl/basic_matrix.hpp>
+
+#include <libobjectmodel/object_vector.hpp>
+#include <libobjectmodel/object_vector_parser.hpp>
+#include <libobjectmodel/point_source_with_diffuseness.hpp>
+
+#include <libpanning/LoudspeakerArray.h>
+
+#include <libpml/initialise_parameter_library.hpp>
+
+#include <librrl/audio_signal_flow.hpp>
+
+#include <libvisr/signal_flow_context.hpp>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <ciso646>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace visr
+{
+namespace signalflows
+{
+namespace test
+{
+
+#ifndef VISR_DISABLE_THREADS
+
+namespace // unnamed
+{
+
+/**
+ * Upper limit for the delivery of a scene message through the loopback interface.
+ */
+std::chrono::seconds const cMessageTimeout( 5 );
+
+std::string encodeScene( objectmodel::Object::Coordinate x, objectmodel::Object::Coordinate y, objectmodel::Object::Coordinate diffuseness )
+{
+  objectmodel::ObjectVector scene;
+  for( objectmodel::ObjectId id( 0 ); id < 2; ++id )
+  {
+    objectmodel::PointSourceWithDiffuseness src( id );
+    src.resetNumberOfChannels( 1 );
+    src.setChannelIndex( 0, id );
+    src.setX( id == 0 ? x : -x );
+    src.setY( y );
+    src.setZ( 0.0f );
+    src.setDiffuseness( diffuseness );
+    src.setLevel( 0.5f );
+    src.setPriority( 0 );
+    scene.insert( src );
+  }
+  std::stringstream msg;
+  objectmodel::ObjectVectorParser::encodeObjectVector( scene, msg );
+  return msg.str();
+}
+
+/**
+ * Wait until \p renderer has received \p numMessages scene messages in total.
+ * @return True if the messages arrived within cMessageTimeout, false otherwise.
+ */
+bool waitForSceneMessages( DistributedRenderer const & renderer, std::size_t numMessages )
+{
+  std::chrono::steady_clock::time_point const deadline = std::chrono::steady_clock::now() + cMessageTimeout;
+  while( renderer.numberOfReceivedSceneMessages() < numMessages )
+  {
+    if( std::chrono::steady_clock::now() > deadline )
+    {
+      return false;
+    }
+    std::this_thread::sleep_for( std::chrono::microseconds( 100 ) );
+  }
+  return true;
+}
+
+/**
+ * Return the index of the first block in which one of the \p channels of \p output is nonzero,
+ * or \p numBlocks if all blocks are silent.
+ * @param output The output signals of all blocks, stored block by block, each block containing \p numberOfOutputs
+ * channels of \p period samples.
+ */
+std::size_t firstAudibleBlock( std::vector<SampleType> const & output, std::vector<std::size_t> const & channels,
+                               std::size_t numberOfOutputs, std::size_t period )
+{
+  std::size_t const numBlocks = output.size() / (numberOfOutputs * period);
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    for( std::size_t chIdx : channels )
+    {
+      SampleType const * const channel = output.data() + (blockIdx * numberOfOutputs + chIdx) * period;
+      if( std::any_of( channel, channel + period, []( SampleType val ){ return val != 0.0f; } ) )
+      {
+        return blockIdx;
+      }
+    }
+  }
+  return numBlocks;
+}
+
+} // unnamed namespace
+
+/**
+ * Render a scene with two nodes, each rendering a part of the array, and compare the result with a node
+ * rendering the complete array. All three flows run in the same process, but communicate through the loopback
+ * interface exactly as separate processes or hosts would.
+ */
+BOOST_AUTO_TEST_CASE( DistributedRendererMatchesCompleteRenderer )
+{
+  pml::initialiseParameterLibrary();
+
+  panning::LoudspeakerArray arrayConfig;
+  arrayConfig.loadXmlFile( CMAKE_SOURCE_DIR "/config/generic/bs2051-4+5+0-no-subwoofer.xml" );
+
+  std::size_t const numberOfInputs = 2;
+  std::size_t const numberOfOutputs = 10; // Channel 4 (one-offset) is not used by the array.
+  std::size_t const period = 64;
+  std::size_t const interpolationPeriod = 4 * period;
+  std::size_t const schedulingLatency = 8;
+  std::size_t const numLoudspeakers = arrayConfig.getNumRegularSpeakers();
+
+  std::mt19937 gen( 7 );
+  std::uniform_real_distribution<SampleType> dist( -1.0f, 1.0f );
+  std::size_t const diffusionFilterLength = 32;
+  efl::BasicMatrix<SampleType> diffusionFilters( numLoudspeakers, diffusionFilterLength, cVectorAlignmentSamples );
+  for( std::size_t rowIdx( 0 ); rowIdx < numLoudspeakers; ++rowIdx )
+  {
+    for( std::size_t colIdx( 0 ); colIdx < diffusionFilterLength; ++colIdx )
+    {
+      diffusionFilters( rowIdx, colIdx ) = 0.2f * dist( gen );
+    }
+  }
+
+  std::vector<std::size_t> const masterGroup{ 0, 1, 2, 3 };
+  std::vector<std::size_t> const nodeGroup{ 4, 5, 6, 7, 8, 9 };
+
+  SignalFlowContext const context( period, 48000 );
+  // All nodes receive on ports chosen by the operating system, so the test does not depend on free fixed ports.
+  DistributedRenderer node( context, "", nullptr, arrayConfig, numberOfInputs, numberOfOutputs, nodeGroup,
+    interpolationPeriod, diffusionFilters, 0, {}, 0, 0, std::string(), false );
+  DistributedRenderer reference( context, "", nullptr, arrayConfig, numberOfInputs, numberOfOutputs, {},
+    interpolationPeriod, diffusionFilters, 0, {}, 0, 0, std::string(), false );
+  DistributedRenderer master( context, "", nullptr, arrayConfig, numberOfInputs, numberOfOutputs, masterGroup,
+    interpolationPeriod, diffusionFilters, 0,
+    { "localhost:" + std::to_string( node.sceneReceiverPort() ),
+      "127.0.0.1:" + std::to_string( reference.sceneReceiverPort() ) },
+    schedulingLatency, 0, std::string(), false );
+  BOOST_CHECK_NE( master.sceneReceiverPort(), 0 );
+  rrl::AudioSignalFlow masterFlow( master );
+  rrl::AudioSignalFlow nodeFlow( node );
+  rrl::AudioSignalFlow referenceFlow( reference );
+
+  boost::asio::io_service ioService;
+  boost::asio::ip::udp::socket socket( ioService, boost::asio::ip::udp::v4() );
+  boost::asio::ip::udp::endpoint const target( boost::asio::ip::address_v4::loopback(),
+                                               static_cast<unsigned short>(master.sceneReceiverPort()) );
+
+  std::size_t const numBlocks = 80;
+  std::size_t const firstSceneBlock = 2;
+  std::size_t const secondSceneBlock = 40;
+  std::vector<SampleType> input( numberOfInputs * period );
+  std::vector<SampleType> masterOutput( numBlocks * numberOfOutputs * period );
+  std::vector<SampleType> nodeOutput( numBlocks * numberOfOutputs * period );
+  std::vector<SampleType> referenceOutput( numBlocks * numberOfOutputs * period );
+  std::size_t numSceneMessages = 0;
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    if( (blockIdx == firstSceneBlock) or (blockIdx == secondSceneBlock) )
+    {
+      std::string const msg = blockIdx == firstSceneBlock ? encodeScene( 1.0f, 1.0f, 0.3f ) : encodeScene( 0.2f, -1.0f, 0.0f );
+      socket.send_to( boost::asio::buffer( msg ), target );
+      ++numSceneMessages;
+      // Make the master stamp the message in this block.
+      BOOST_REQUIRE( waitForSceneMessages( master, numSceneMessages ) );
+    }
+    std::size_t const blockOffset = blockIdx * numberOfOutputs * period;
+    std::generate( input.begin(), input.end(), [&](){ return dist( gen ); } );
+    masterFlow.process( input.data(), period, 1, masterOutput.data() + blockOffset, period, 1 );
+    // The stamped messages forwarded by the master must have arrived before the nodes process the same block,
+    // as they would if the nodes ran in parallel with a scheduling latency exceeding the transmission time.
+    BOOST_REQUIRE( waitForSceneMessages( node, numSceneMessages ) );
+    BOOST_REQUIRE( waitForSceneMessages( reference, numSceneMessages ) );
+    nodeFlow.process( input.data(), period, 1, nodeOutput.data() + blockOffset, period, 1 );
+    referenceFlow.process( input.data(), period, 1, referenceOutput.data() + blockOffset, period, 1 );
+  }
+
+  SampleType maxDiff = 0.0f;
+  SampleType maxOutsideGroup = 0.0f;
+  for( std::size_t blockIdx( 0 ); blockIdx < numBlocks; ++blockIdx )
+  {
+    for( std::size_t chIdx( 0 ); chIdx < numberOfOutputs; ++chIdx )
+    {
+      bool const inMasterGroup = std::find( masterGroup.begin(), masterGroup.end(), chIdx ) != masterGroup.end();
+      std::vector<SampleType> const & rendered = inMasterGroup ? masterOutput : nodeOutput;
+      std::vector<SampleType> const & other = inMasterGroup ? nodeOutput : masterOutput;
+      std::size_t const channelOffset = (blockIdx * numberOfOutputs + chIdx) * period;
+      for( std::size_t sampleIdx( channelOffset ); sampleIdx < channelOffset + period; ++sampleIdx )
+      {
+        maxDiff = std::max( maxDiff, std::abs( rendered[sampleIdx] - referenceOutput[sampleIdx] ) );
+        maxOutsideGroup = std::max( maxOutsideGroup, std::abs( other[sampleIdx] ) );
+      }
+    }
+  }
+  // The initial scene is empty. The first scene places the sources between the front and surround loudspeakers on both
+  // sides and adds diffuse components, so every node must start rendering exactly at the block stamped by the master.
+  std::vector<std::size_t> allChannels( numberOfOutputs );
+  std::iota( allChannels.begin(), allChannels.end(), 0 );
+  std::size_t const stampedBlock = firstSceneBlock + schedulingLatency;
+  BOOST_CHECK_EQUAL( firstAudibleBlock( referenceOutput, allChannels, numberOfOutputs, period ), stampedBlock );
+  BOOST_CHECK_EQUAL( firstAudibleBlock( masterOutput, masterGroup, numberOfOutputs, period ), stampedBlock );
+  BOOST_CHECK_EQUAL( firstAudibleBlock( nodeOutput, nodeGroup, numberOfOutputs, period ), stampedBlock );
+  BOOST_CHECK_LE( maxDiff, 1.0e-5f );
+  BOOST_CHECK_EQUAL( maxOutsideGroup, 0.0f );
+  BOOST_CHECK_EQUAL( master.numberOfLateSceneMessages(), 0 );
+  BOOST_CHECK_EQUAL( node.numberOfLateSceneMessages(), 0 );
+  BOOST_CHECK_EQUAL( reference.numberOfLateSceneMessages(), 0 );
+}
+
+BOOST_AUTO_TEST_CASE( DistributedRendererRejectsInvalidConfiguration )
+{
+  pml::initialiseParameterLibrary();
+  panning::LoudspeakerArray arrayConfig;
+  arrayConfig.loadXmlFile( CMAKE_SOURCE_DIR "/config/generic/bs2051-4+5+0-no-subwoofer.xml" );
+  efl::BasicMatrix<SampleType> const diffusionFilters( arrayConfig.getNumRegularSpeakers(), 16, cVectorAlignmentSamples );
+  SignalFlowContext const context( 64, 48000 );
+  // Channel 3 (zero-offset) is not assigned to a loudspeaker.
+  BOOST_CHECK_THROW( DistributedRenderer( context, "", nullptr, arrayConfig, 2, 10, { 3 }, 256, diffusionFilters,
+                                          0, {}, 0, 0, std::string(), false ), std::invalid_argument );
+  BOOST_CHECK_THROW( DistributedRenderer( context, "", nullptr, arrayConfig, 2, 10, { 0, 10 }, 256, diffusionFilters,
+                                          0, {}, 0, 0, std::string(), false ), std::invalid_argument );
+  BOOST_CHECK_THROW( DistributedRenderer( context, "", nullptr, arrayConfig, 2, 10, { 0 }, 256, diffusionFilters,
+                                          0, { "localhost" }, 4, 0, std::string(), false ), std::invalid_argument );
+}
+
+#endif // #ifndef VISR_DISABLE_THREADS
+
+} // namespace test
+} // namespace signalflows
+} // namespace visr
@@ -53,12 +53,15 @@ VisrRenderer::VisrRenderer( SignalFlowContext const & context,
     std::string const formatString = "{'processorConfig': '%s', 'objectVectorInput': False, 'objectVectorOutput': True, 'oscControlPort': False, 'jsonControlPort': False }";
     std::string const kwArgs = str( boost::format( formatString ) % metadapterConfig );
 
+    // The metadapter runs on a separate thread to keep the Python interpreter out of the audio thread.
     mSceneDecoder.reset( new pythoncomponents::Wrapper( context, "Metadapter", this,
       "metadapter.visrintegration", //  char const * moduleName,
       "Component",                  //  char const * componentClassName,
       "",                           //  char const * positionalArguments = "",
       kwArgs.c_str(),               //  char const * keywordArguments = "",
-      ""                            //  No module search path
+      "",                           //  No module search path
+      pythoncomponents::Wrapper::ExecutionMode::Decoupled,
+      1                             //  Latency in blocks
       ) );
     parameterConnection( mSceneReceiver.parameterPort( "messageOutput" ), mSceneDecoder->parameterPort( "objectIn" ) );
     parameterConnection( mSceneDecoder->parameterPort( "objectOut" ), mCoreRenderer.parameterPort( "objectDataInput" ) );
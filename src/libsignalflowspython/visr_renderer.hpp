@@ -59,6 +59,7 @@ public:
    * @param frequencyDependentPanning Flag specifiying whether the frequency-dependent VBAP algorithm shall be activated (true) or not (false)
    * @param metadapterConfig A filter path to a Metadapter configuration file (XML) that describes metadata transformations to the incoming object metadata.
    * An empty string (default value) means that no metadapter is used. This can be used only if the code has been compiled with Python support.
+   * The metadapter is executed on a separate thread, which delays the object metadata by one block.
    */
   explicit VisrRenderer( SignalFlowContext const & context,
                         char const * name,
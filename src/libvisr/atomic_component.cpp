@@ -2,6 +2,15 @@
 
 #include "atomic_component.hpp"
 
+#include "audio_input.hpp"
+#include "audio_output.hpp"
+
+#include "impl/audio_port_base_implementation.hpp"
+#include "impl/component_implementation.hpp"
+
+#include <ciso646>
+#include <stdexcept>
+
 namespace visr
 {
 
@@ -9,9 +18,56 @@ AtomicComponent::AtomicComponent( SignalFlowContext const & context,
                                   char const * name,
                                   CompositeComponent * parent /*= nullptr */ )
  : Component( context, name, parent )
+ , mExecutionInterval( 1 )
+ , mExecutionPhase( cAutomaticPhase )
 {
 }
 
 AtomicComponent::~AtomicComponent() = default;
 
+AtomicComponent::InPlacePortList const & AtomicComponent::inPlacePorts() const
+{
+  return mInPlacePorts;
+}
+
+constexpr std::size_t AtomicComponent::cAutomaticPhase;
+
+void AtomicComponent::setExecutionInterval( std::size_t interval, std::size_t phase /*= cAutomaticPhase*/ )
+{
+  if( interval == 0 )
+  {
+    throw std::invalid_argument( "AtomicComponent::setExecutionInterval(): The interval must be at least one." );
+  }
+  if( (phase != cAutomaticPhase) and (phase >= interval) )
+  {
+    throw std::invalid_argument( "AtomicComponent::setExecutionInterval(): The phase must be less than the interval." );
+  }
+  mExecutionInterval = interval;
+  mExecutionPhase = phase;
+}
+
+std::size_t AtomicComponent::executionInterval() const
+{
+  return mExecutionInterval;
+}
+
+std::size_t AtomicComponent::executionPhase() const
+{
+  return mExecutionPhase;
+}
+
+void AtomicComponent::declareInPlaceProcessing( AudioInputBase const & input, AudioOutputBase const & output )
+{
+  if( (&(input.implementation().parent()) != &implementation())
+   or (&(output.implementation().parent()) != &implementation()) )
+  {
+    throw std::invalid_argument( "AtomicComponent::declareInPlaceProcessing(): Ports must belong to this component." );
+  }
+  if( input.sampleType() != output.sampleType() )
+  {
+    throw std::invalid_argument( "AtomicComponent::declareInPlaceProcessing(): Ports must have the same sample type." );
+  }
+  mInPlacePorts.push_back( std::make_pair( &input, &output ) );
+}
+
 } // namespace visr
@@ -8,9 +8,15 @@
 #include "export_symbols.hpp"
 
 #include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
 
 namespace visr
 {
+// Forward declarations
+class AudioInputBase;
+class AudioOutputBase;
 
 /**
  * Base class for atomic components.
@@ -54,6 +60,72 @@ public:
    */
   virtual void process() = 0;
 
+  /**
+   * Type for a list of audio input/output port pairs that can be processed in-place.
+   */
+  using InPlacePortList = std::vector<std::pair<AudioInputBase const *, AudioOutputBase const *> >;
+
+  /**
+   * Return the list of input/output port pairs declared as suitable for in-place processing.
+   * This information can be used by the runtime system to let these ports share the same sample buffers.
+   */
+  /*VISR_CORE_LIBRARY_SYMBOL*/ InPlacePortList const & inPlacePorts() const;
+
+  /**
+   * Special value for the \p phase argument of setExecutionInterval() to let the runtime system choose the phase.
+   */
+  static constexpr std::size_t cAutomaticPhase = std::numeric_limits<std::size_t>::max();
+
+  /**
+   * Let the runtime system call process() only every \p interval blocks instead of in every block.
+   * This is intended for components that compute control parameters, e.g., panning gains, which do not need to be
+   * updated at the audio block rate. Therefore it is permitted only for components without audio ports, and an
+   * AudioSignalFlow containing an atomic component with audio ports and an interval larger than one cannot be
+   * constructed. As a consequence, skipping the execution does not affect the audio buffer allocation (including
+   * BufferAllocation::Liveness).
+   * Parameter ports retain their semantics across skipped blocks: Messages queue up until the component runs,
+   * double-buffered and shared data inputs hold the latest value, and the outputs keep the last values written.
+   * Thus parameter changes are delayed by up to \p interval - 1 blocks.
+   * Must be called before the runtime structure (e.g., rrl::AudioSignalFlow) is created for the containing signal flow.
+   * @param interval The execution interval in blocks. The default value 1 executes the component in every block.
+   * @param phase The index of the block within each interval in which the component is executed, i.e., it runs
+   * in the blocks with an index \p n such that \p n % \p interval == \p phase. The default cAutomaticPhase lets the
+   * runtime system stagger the phases of the components with an interval larger than one to distribute the load
+   * evenly over the blocks.
+   * @throw std::invalid_argument If \p interval is zero or \p phase is neither cAutomaticPhase nor less than \p interval.
+   */
+  /*VISR_CORE_LIBRARY_SYMBOL*/ void setExecutionInterval( std::size_t interval, std::size_t phase = cAutomaticPhase );
+
+  /**
+   * Return the execution interval in blocks.
+   * @see setExecutionInterval()
+   */
+  /*VISR_CORE_LIBRARY_SYMBOL*/ std::size_t executionInterval() const;
+
+  /**
+   * Return the execution phase, or cAutomaticPhase if the phase is chosen by the runtime system.
+   * @see setExecutionInterval()
+   */
+  /*VISR_CORE_LIBRARY_SYMBOL*/ std::size_t executionPhase() const;
+
+protected:
+  /**
+   * Declare that the audio output \p output can be computed in-place from the audio input \p input.
+   * That is, the process() method yields correct results if channel i of \p output shares its sample buffer
+   * with channel i of \p input. This holds, for instance, if each output channel depends only on the
+   * corresponding input channel, and if each sample is read before the output sample at the same position is written.
+   * This is a hint to the runtime system, which may or may not choose to perform the processing in-place.
+   * Both ports must belong to this component and must have the same width and sample type.
+   * @throw std::invalid_argument If the ports do not belong to this component.
+   */
+  /*VISR_CORE_LIBRARY_SYMBOL*/ void declareInPlaceProcessing( AudioInputBase const & input, AudioOutputBase const & output );
+
+private:
+  InPlacePortList mInPlacePorts;
+
+  std::size_t mExecutionInterval;
+
+  std::size_t mExecutionPhase;
 };
 
 } // namespace visr
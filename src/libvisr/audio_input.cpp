@@ -2,6 +2,8 @@
 
 #include "audio_input.hpp"
 
+#include "impl/audio_port_base_implementation.hpp"
+
 namespace visr
 {
 
@@ -12,4 +14,14 @@ AudioInputBase::AudioInputBase( char const * name, Component & container, AudioS
 
 AudioInputBase::~AudioInputBase() = default;
 
+void AudioInputBase::setChannelPointerAccess( bool enable )
+{
+  implementation().setChannelPointerAccess( enable );
+}
+
+bool AudioInputBase::channelPointerAccess() const noexcept
+{
+  return implementation().channelPointerAccess();
+}
+
 } // namespace visr
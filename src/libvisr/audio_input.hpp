@@ -35,6 +35,21 @@ public:
    * @note Reconsider whether audio ports shall be instantiated polymorphically. Otherwise, the destructor would not need to  be virtual.
    */
   /*VISR_CORE_LIBRARY_SYMBOL*/ virtual ~AudioInputBase() override;
+
+  /**
+   * Declare that the containing component accesses the channels of this port exclusively through
+   * per-channel pointers, i.e., operator[](), at() or getChannelPointers(), but not through data() and channelStrideSamples().
+   * This enables the runtime system to connect arbitrary, non-contiguous channels to this port without
+   * inserting copying components.
+   * Must be called before the signal flow is initialised, typically in the constructor of the component.
+   * @param enable Whether channel-pointer access is used.
+   */
+  /*VISR_CORE_LIBRARY_SYMBOL*/ void setChannelPointerAccess( bool enable );
+
+  /**
+   * Query whether the port has been declared to be accessed by channel pointers only.
+   */
+  /*VISR_CORE_LIBRARY_SYMBOL*/ bool channelPointerAccess() const noexcept;
 };
 
 /**
@@ -64,6 +79,8 @@ public:
   /**
    * Return the base pointer of the input sample.
    * This is the pointer to the first (index 0) channel signal.
+   * @note Together with channelStrideSamples(), this pointer must not be used to access further channels if
+   * channel-pointer access has been enabled (setChannelPointerAccess()).
    */
   DataType const * data() const { return static_cast<DataType const * >(AudioPortBase::basePointer()); }
 
@@ -88,7 +105,7 @@ public:
   */
   DataType const * operator[]( std::size_t idx ) const
   {
-    return data() + idx * channelStrideSamples();
+    return static_cast<DataType const *>(channelPointer( idx ));
   }
 
   /**
@@ -102,11 +119,9 @@ public:
   OutputIterator getChannelPointers( OutputIterator outIt )
   {
     std::size_t const wd( width() );
-    std::size_t const stride( channelStrideSamples() );
-    DataType const * ptr( data() );
-    for( std::size_t chIdx(0); chIdx < wd; ++chIdx, ptr += stride, ++outIt )
+    for( std::size_t chIdx(0); chIdx < wd; ++chIdx, ++outIt )
     {
-      *outIt = ptr;
+      *outIt = operator[]( chIdx );
     }
     return outIt;
   }
@@ -66,6 +66,16 @@ void const * AudioPortBase::basePointer() const
   return mImpl->basePointer();
 }
 
+void * AudioPortBase::channelPointer( std::size_t idx )
+{
+  return mImpl->channelPointer( idx );
+}
+
+void const * AudioPortBase::channelPointer( std::size_t idx ) const
+{
+  return static_cast<impl::AudioPortBaseImplementation const *>(mImpl)->channelPointer( idx );
+}
+
 AudioSampleType::Id AudioPortBase::sampleType() const noexcept
 {
   return mImpl->sampleType();
@@ -76,6 +86,16 @@ std::size_t AudioPortBase::sampleSize() const noexcept
   return mImpl->sampleSize();
 }
 
+bool AudioPortBase::silent( std::size_t channelIdx ) const
+{
+  return mImpl->silent( channelIdx );
+}
+
+void AudioPortBase::setSilent( std::size_t channelIdx, bool silent )
+{
+  mImpl->setSilent( channelIdx, silent );
+}
+
 impl::AudioPortBaseImplementation & AudioPortBase::implementation()
 {
   return *mImpl;
@@ -120,6 +120,24 @@ public:
    */
   /*VISR_CORE_LIBRARY_SYMBOL*/ std::size_t sampleSize() const noexcept;
 
+  /**
+   * Query whether the signal of channel \p channelIdx is marked as silent in the current block.
+   * For input ports, this returns the flag set by the producer of the connected signal. Producers that do not support
+   * silence flags leave them unset, so a false result does not imply that the signal is nonzero.
+   * @param channelIdx Channel index, not checked for validity.
+   */
+  /*VISR_CORE_LIBRARY_SYMBOL*/ bool silent( std::size_t channelIdx ) const;
+
+  /**
+   * Mark the signal of channel \p channelIdx as silent, i.e., all samples of the current block are zero or below
+   * the silence threshold, or non-silent.
+   * To be called by the component holding an output port after writing the channel. A component that sets a flag
+   * must reset it as soon as the channel contains a non-silent signal.
+   * @param channelIdx Channel index, not checked for validity.
+   * @param silent The new state of the flag.
+   */
+  /*VISR_CORE_LIBRARY_SYMBOL*/ void setSilent( std::size_t channelIdx, bool silent );
+
   /**
    * Return  apointer to the opaque implemenentation object.
    * This method is not to be used by implementation code.
@@ -145,6 +163,17 @@ protected:
   */
   /*VISR_CORE_LIBRARY_SYMBOL*/ void const * basePointer() const;
 
+  /**
+   * Return the data pointer to the channel \p idx, unchecked.
+   * In contrast to basePointer(), this is also valid for ports referencing non-uniformly spaced channels.
+   */
+  /*VISR_CORE_LIBRARY_SYMBOL*/ void * channelPointer( std::size_t idx );
+
+  /**
+   * Return the data pointer to the channel \p idx, unchecked, constant version.
+   */
+  /*VISR_CORE_LIBRARY_SYMBOL*/ void const * channelPointer( std::size_t idx ) const;
+
 private:
   /**
    * Pointer to the private, opaque implementation object.
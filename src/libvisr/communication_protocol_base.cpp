@@ -2,6 +2,10 @@
 
 #include "communication_protocol_base.hpp"
 
+#include "parameter_base.hpp"
+
+#include <stdexcept>
+
 namespace visr
 {
 
@@ -24,6 +28,16 @@ CommunicationProtocolBase::Input::Input() = default;
  */
 /*virtual*/ CommunicationProtocolBase::Input::~Input() = default;
 
+/*virtual*/ bool CommunicationProtocolBase::Input::supportsParameterExtraction() const
+{
+  return false;
+}
+
+/*virtual*/ bool CommunicationProtocolBase::Input::extractParameter( ParameterBase & /*value*/ )
+{
+  throw std::logic_error( "CommunicationProtocolBase::Input::extractParameter(): The protocol does not support parameter extraction." );
+}
+
 /**
  * @relates CommunicationProtocolBase::Output
  * Default constructor for CommunicationProtocolBase::Output
@@ -35,6 +49,16 @@ CommunicationProtocolBase::Output::Output() = default;
  * Default constructor for CommunicationProtocolBase::Output
  */
 /*virtual*/ CommunicationProtocolBase::Output::~Output() = default;
+
+/*virtual*/ bool CommunicationProtocolBase::Output::supportsParameterInjection() const
+{
+  return false;
+}
+
+/*virtual*/ void CommunicationProtocolBase::Output::injectParameter( std::unique_ptr<ParameterBase> & /*value*/ )
+{
+  throw std::logic_error( "CommunicationProtocolBase::Output::injectParameter(): The protocol does not support parameter injection." );
+}
 /// @endcond NEVER
 
 } // namespace visr
@@ -8,10 +8,13 @@
 #include "communication_protocol_type.hpp"
 #include "parameter_type.hpp"
 
+#include <memory>
+
 namespace visr
 {
 
 // Forward declarations
+class ParameterBase;
 class ParameterPortBase;
 
 /**
@@ -121,6 +124,24 @@ public:
   * Return a pointer to the connected protocol, const version. If the input is not connected, return \p nullptr.
   */
   virtual CommunicationProtocolBase const * getProtocol() const = 0;
+
+  /**
+   * Whether this protocol input supports retrieving parameter values with extractParameter().
+   * The default implementation returns false.
+   */
+  virtual bool supportsParameterExtraction() const;
+
+  /**
+   * Retrieve the next parameter value received by this input, with the same effect on the state of the input
+   * (e.g., removing a message from a queue or resetting a 'changed' flag) as reading it through the protocol-specific
+   * interface.
+   * This is the counterpart to Output::injectParameter() and is used to forward parameters to consumers outside the
+   * signal flow. It does not allocate the parameter object, so it can be called from the audio processing thread.
+   * @param [out] value Parameter object of the transmitted parameter type, the received value is assigned to it.
+   * @return true if a value has been assigned to \p value, false if no new parameter value was available.
+   * @throw std::logic_error If the protocol does not support parameter extraction (default implementation).
+   */
+  virtual bool extractParameter( ParameterBase & value );
 };
 
 /**
@@ -159,6 +180,23 @@ public:
   * or \p nullptr if it is not connected.
   */
   virtual CommunicationProtocolBase const * getProtocol() const = 0;
+
+  /**
+   * Whether this protocol output supports passing parameter values from external sources with injectParameter().
+   * The default implementation returns false.
+   */
+  virtual bool supportsParameterInjection() const;
+
+  /**
+   * Pass a parameter value from an external source to the protocol, with the same effect as a parameter set through
+   * the protocol-specific interface of the output.
+   * This is used by the runtime system to forward parameters to top-level parameter inputs, and is called from the
+   * audio processing thread. Implementations should therefore avoid blocking operations.
+   * @param [in,out] value The parameter value. Implementations may either take over the object, in which case
+   * \p value is reset to \p nullptr, or copy its content and leave \p value untouched.
+   * @throw std::logic_error If the protocol does not support parameter injection (default implementation).
+   */
+  virtual void injectParameter( std::unique_ptr<ParameterBase> & value );
 };
 
 } // namespace visr
@@ -6,6 +6,7 @@
 
 #include <cassert>
 #include <ciso646>
+#include <stdexcept>
 
 namespace visr
 {
@@ -25,10 +26,13 @@ AudioPortBaseImplementation::AudioPortBaseImplementation( char const * name, Aud
  , mWidth( width )
  , mBasePointer( nullptr )
  , mChannelStrideSamples( 0 )
+ , mChannelPointerAccess( false )
+ , mGathered( false )
 {
   // last line of defense if the assumption that the elements size fits into the chosen alignment.
   // TODO: Turn this into an exception if this error is likely to happen apart from a total  internal screwup of the runtime system.
   assert( alignmentBytes() % cSampleSize == 0 ); 
+  resetSilentFlags();
   if( container )
   {
     container->registerAudioPort( this );
@@ -62,6 +66,9 @@ void AudioPortBaseImplementation::reset() noexcept
 {
   mBasePointer = nullptr;
   mChannelStrideSamples = 0;
+  mGathered = false;
+  mChannelPointers.clear();
+  resetSilentFlags();
 }
 
 void AudioPortBaseImplementation::setWidth( std::size_t newWidth )
@@ -71,6 +78,7 @@ void AudioPortBaseImplementation::setWidth( std::size_t newWidth )
     throw std::logic_error( "Audio port: Attempt to set the width of an initialised port." );
   }
   mWidth = newWidth;
+  resetSilentFlags();
 }
 
 std::size_t AudioPortBaseImplementation::width() const noexcept
@@ -105,17 +113,88 @@ std::size_t AudioPortBaseImplementation::channelStrideBytes() const noexcept
 void AudioPortBaseImplementation::setChannelStrideSamples( std::size_t stride )
 {
   mChannelStrideSamples = stride;
+  updateChannelPointers();
 }
 
 void AudioPortBaseImplementation::setBasePointer( void * base )
 {
   mBasePointer = base;
+  updateChannelPointers();
 }
 
 void AudioPortBaseImplementation::setBufferConfig( void * base, std::size_t channelStrideSamples )
 {
   mBasePointer = base;
   mChannelStrideSamples = channelStrideSamples;
+  updateChannelPointers();
+}
+
+void AudioPortBaseImplementation::setChannelPointerAccess( bool enable )
+{
+  mChannelPointerAccess = enable;
+}
+
+bool AudioPortBaseImplementation::channelPointerAccess() const noexcept
+{
+  return mChannelPointerAccess;
+}
+
+void AudioPortBaseImplementation::setGatherConfig( std::vector<void*> const & channelPointers, std::size_t channelStrideSamples )
+{
+  if( channelPointers.size() != mWidth )
+  {
+    throw std::invalid_argument( "AudioPortBaseImplementation::setGatherConfig(): Number of channel pointers does not match the port width." );
+  }
+  mChannelPointers = channelPointers;
+  mBasePointer = mWidth > 0 ? channelPointers[0] : nullptr;
+  mChannelStrideSamples = channelStrideSamples;
+  mGathered = true;
+}
+
+bool AudioPortBaseImplementation::gathered() const noexcept
+{
+  return mGathered;
+}
+
+void AudioPortBaseImplementation::setChannelPointer( std::size_t idx, void * ptr )
+{
+  mChannelPointers[idx] = ptr;
+  if( idx == 0 )
+  {
+    mBasePointer = ptr;
+  }
+}
+
+void AudioPortBaseImplementation::setSilentFlagSource( std::size_t idx, std::uint8_t const * flag )
+{
+  if( idx >= mWidth )
+  {
+    throw std::out_of_range( "AudioPortBaseImplementation::setSilentFlagSource(): Channel index exceeds the port width." );
+  }
+  mSilentFlagSources[idx] = flag;
+}
+
+void AudioPortBaseImplementation::resetSilentFlags()
+{
+  // Note: Reallocates the flag storage only if the width has changed, i.e., not at runtime.
+  mSilentFlags.assign( mWidth, 0 );
+  mSilentFlagSources.resize( mWidth );
+  for( std::size_t chIdx( 0 ); chIdx < mWidth; ++chIdx )
+  {
+    mSilentFlagSources[chIdx] = &mSilentFlags[chIdx];
+  }
+}
+
+void AudioPortBaseImplementation::updateChannelPointers()
+{
+  // Note: Resizing allocates memory only if the width has changed, i.e., not at runtime.
+  mGathered = false;
+  mChannelPointers.resize( mWidth );
+  std::size_t const strideBytes = channelStrideBytes();
+  for( std::size_t chIdx( 0 ); chIdx < mWidth; ++chIdx )
+  {
+    mChannelPointers[chIdx] = mBasePointer ? static_cast<char*>(mBasePointer) + chIdx * strideBytes : nullptr;
+  }
 }
 
 void const * AudioPortBaseImplementation::basePointer() const
@@ -12,8 +12,9 @@
 //#include <exception>
 //#include <iterator>
 //#include <limits>
+#include <cstdint>
 #include <string>
-//#include <vector>
+#include <vector>
 
 #include <valarray>
 
@@ -94,7 +95,76 @@ public:
   VISR_CORE_LIBRARY_SYMBOL void const * basePointer() const;
 
   VISR_CORE_LIBRARY_SYMBOL void * basePointer();
+
+  /**
+   * Declare whether the component holding this port accesses the channels only through per-channel pointers,
+   * i.e., not through the base pointer and the channel stride.
+   * Such ports can be connected to non-contiguous channels without inserting copying components.
+   */
+  VISR_CORE_LIBRARY_SYMBOL void setChannelPointerAccess( bool enable );
+
+  VISR_CORE_LIBRARY_SYMBOL bool channelPointerAccess() const noexcept;
+
+  /**
+   * Configure the port to reference arbitrarily located channels.
+   * Afterwards, basePointer() refers to the first channel, but the channel stride does not describe the port layout anymore.
+   * @param channelPointers Pointers to the channel vectors, the number of elements must match the width.
+   * @param channelStrideSamples The size of the channel buffers (in samples).
+   * @throw std::invalid_argument If the number of pointers does not match the width.
+   */
+  VISR_CORE_LIBRARY_SYMBOL void setGatherConfig( std::vector<void*> const & channelPointers, std::size_t channelStrideSamples );
+
+  /**
+   * Whether the port references non-uniformly spaced channels, i.e., whether it has been configured by setGatherConfig().
+   */
+  VISR_CORE_LIBRARY_SYMBOL bool gathered() const noexcept;
+
+  /**
+   * Return the pointer to the channel vector of channel \p idx, unchecked.
+   */
+  VISR_CORE_LIBRARY_SYMBOL void * channelPointer( std::size_t idx ) { return mChannelPointers[idx]; }
+
+  VISR_CORE_LIBRARY_SYMBOL void const * channelPointer( std::size_t idx ) const { return mChannelPointers[idx]; }
+
+  /**
+   * Change the location of a single channel of a gathered port.
+   * This method can be called at runtime.
+   */
+  VISR_CORE_LIBRARY_SYMBOL void setChannelPointer( std::size_t idx, void * ptr );
+
+  /**
+   * Query whether the signal in channel \p idx is marked as silent in the current block, unchecked.
+   * For ports that are connected to a send port through setSilentFlagSource(), the flag of that port is returned.
+   */
+  VISR_CORE_LIBRARY_SYMBOL bool silent( std::size_t idx ) const { return *(mSilentFlagSources[idx]) != 0; }
+
+  /**
+   * Mark the signal in channel \p idx as silent or non-silent, unchecked.
+   * This sets the port's own flag, which might be referenced by connected receive ports.
+   */
+  VISR_CORE_LIBRARY_SYMBOL void setSilent( std::size_t idx, bool silent ) { mSilentFlags[idx] = silent ? 1 : 0; }
+
+  /**
+   * Return the location of the port's own silence flag for channel \p idx.
+   */
+  VISR_CORE_LIBRARY_SYMBOL std::uint8_t * silentFlag( std::size_t idx ) { return &mSilentFlags[idx]; }
+
+  /**
+   * Let channel \p idx report the silence flag stored at \p flag, i.e., the flag of the connected send port.
+   * To be called by the runtime system during initialisation.
+   */
+  VISR_CORE_LIBRARY_SYMBOL void setSilentFlagSource( std::size_t idx, std::uint8_t const * flag );
+
+  /**
+   * Reset all channels to their own, non-silent silence flags.
+   */
+  VISR_CORE_LIBRARY_SYMBOL void resetSilentFlags();
 protected:
+  /**
+   * Recompute the channel pointer table from the base pointer and the channel stride.
+   */
+  void updateChannelPointers();
+
   AudioPortBase & mContainingPort;
 
   AudioSampleType::Id const cSampleType;
@@ -106,6 +176,22 @@ protected:
   void * mBasePointer;
 
   std::size_t mChannelStrideSamples;
+
+  bool mChannelPointerAccess;
+
+  bool mGathered;
+
+  std::vector<void*> mChannelPointers;
+
+  /**
+   * The silence flags set by the component holding the port, one per channel.
+   */
+  std::vector<std::uint8_t> mSilentFlags;
+
+  /**
+   * The flags queried by silent(), either referencing mSilentFlags or the flags of a connected port.
+   */
+  std::vector<std::uint8_t const *> mSilentFlagSources;
 };
 
 } // namespace impl
@@ -17,6 +17,9 @@ void exportAudioInterfaceFactory( pybind11::module & m );
 #ifdef VISR_AUDIOINTERFACES_PORTAUDIO_SUPPORT
 void exportPortaudioInterface( pybind11::module & m );
 #endif
+#ifdef VISR_AUDIOINTERFACES_SHARED_MEMORY_SUPPORT
+void exportSharedMemoryInterface( pybind11::module & m );
+#endif
 }
 }
 }
@@ -35,4 +38,7 @@ PYBIND11_MODULE( audiointerfaces, m )
 #ifdef VISR_AUDIOINTERFACES_PORTAUDIO_SUPPORT
   exportPortaudioInterface( m );
 #endif
+#ifdef VISR_AUDIOINTERFACES_SHARED_MEMORY_SUPPORT
+  exportSharedMemoryInterface( m );
+#endif
 }
@@ -0,0 +1,26 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <libaudiointerfaces/audio_interface.hpp>
+#include <libaudiointerfaces/shared_memory_interface.hpp>
+
+#include <pybind11/pybind11.h>
+
+namespace visr
+{
+namespace python
+{
+namespace audiointerfaces
+{
+
+void exportSharedMemoryInterface( pybind11::module & m )
+{
+  pybind11::class_<visr::audiointerfaces::SharedMemoryInterface, visr::audiointerfaces::AudioInterface>( m, "SharedMemoryInterface" )
+   .def( pybind11::init<visr::audiointerfaces::AudioInterface::Configuration const &, std::string const & >(), pybind11::arg("config"), pybind11::arg("optionalConfig") )
+   .def_property_readonly( "numberOfOverruns", &visr::audiointerfaces::SharedMemoryInterface::numberOfOverruns )
+   .def_property_readonly( "numberOfUnderruns", &visr::audiointerfaces::SharedMemoryInterface::numberOfUnderruns )
+    ;
+}
+
+} // namespace audiointerfaces
+} // namespace python
+} // namespace visr
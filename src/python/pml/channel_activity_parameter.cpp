@@ -0,0 +1,36 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <libpml/channel_activity_parameter.hpp>
+#include <libpml/vector_parameter_config.hpp>
+
+#include <pybind11/pybind11.h>
+
+namespace visr
+{
+
+using pml::ChannelActivityParameter;
+using pml::VectorParameterConfig;
+
+namespace python
+{
+namespace pml
+{
+
+void exportChannelActivityParameter( pybind11::module & m )
+{
+  pybind11::class_<ChannelActivityParameter, ParameterBase>( m, "ChannelActivityParameter" )
+    .def_property_readonly_static( "staticType", []( pybind11::object /*self*/ ) { return ChannelActivityParameter::staticType(); } )
+    .def( pybind11::init<std::size_t, bool>(), pybind11::arg( "numberOfChannels" ) = 0, pybind11::arg( "initialState" ) = true )
+    .def( pybind11::init<ParameterConfigBase const &>(), pybind11::arg( "config" ) )
+    .def( pybind11::init<VectorParameterConfig const &>(), pybind11::arg( "config" ) )
+    .def_property_readonly( "size", &ChannelActivityParameter::size )
+    .def( "__len__", &ChannelActivityParameter::size )
+    .def( "active", &ChannelActivityParameter::active, pybind11::arg( "channelIndex" ) )
+    .def( "setActive", &ChannelActivityParameter::setActive, pybind11::arg( "channelIndex" ), pybind11::arg( "state" ) )
+    .def( "fill", &ChannelActivityParameter::fill, pybind11::arg( "state" ) )
+    .def_property_readonly( "numberOfActiveChannels", &ChannelActivityParameter::numberOfActiveChannels );
+}
+
+} // namepace pml
+} // namespace python
+} // namespace visr
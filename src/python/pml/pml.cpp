@@ -15,6 +15,7 @@ void exportMessageQueueProtocol( pybind11::module & m );
 void exportSharedDataProtocol( pybind11::module & m );
 
 void exportBiquadCoefficientParameter( pybind11::module & m );
+void exportChannelActivityParameter( pybind11::module & m );
 void exportEmptyParameterConfig( pybind11::module & m );
 void exportFilterRoutingParameter( pybind11::module & m );
 void exportIndexedValueParameters( pybind11::module & m );
@@ -48,6 +49,7 @@ PYBIND11_MODULE( pml, m )
   exportSharedDataProtocol( m );
 
   exportBiquadCoefficientParameter( m );
+  exportChannelActivityParameter( m );
   exportEmptyParameterConfig( m );
   exportFilterRoutingParameter( m );
   exportIndexedValueParameters( m );
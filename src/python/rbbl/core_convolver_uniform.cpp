@@ -45,7 +45,7 @@ void exportCoreConvolverUniform( pybind11::module & m, char const * name )
     .def_property_readonly_static( "maxNumberOfFilterEntries", &CoreConvolverUniform<ElementType>::maxNumberOfFilterEntries )
     .def_property_readonly_static( "maxFilterLength", &CoreConvolverUniform<ElementType>::maxFilterLength )
     .def( "clearFilters", &CoreConvolverUniform<ElementType>::clearFilters )
-    .def( "initFilters", &CoreConvolverUniform<ElementType>::initFilters, pybind11::arg( "newFilters" ) )
+    .def( "initFilters", static_cast<void(CoreConvolverUniform<ElementType>::*)(efl::BasicMatrix<ElementType> const &)>(&CoreConvolverUniform<ElementType>::initFilters), pybind11::arg( "newFilters" ) )
     .def( "setImpulseResponse", &CoreConvolverUniform<ElementType>::setImpulseResponse,
       pybind11::arg("ir"), pybind11::arg( "filterLength"), pybind11::arg( "filterIdx" ), pybind11::arg( "alignment" ) = 0 )
   ;
@@ -40,6 +40,32 @@ public:
   {
     PYBIND11_OVERLOAD_PURE( void, FractionalDelayBase< SampleType >, interpolate, basePointer, result, numSamples, startDelay, endDelay, startGain, endGain );
   }
+
+  virtual void interpolateAccumulate( SampleType const * basePointer,
+                                      SampleType * const * results,
+                                      std::size_t numOutputs,
+                                      std::size_t numSamples,
+                                      SampleType const * startDelays, SampleType const * endDelays,
+                                      SampleType const * startGains, SampleType const * endGains ) override
+  {
+    // Forward the raw buffers as NumPy views in the argument layout of the Python binding of interpolateAccumulate().
+    // The views are Python objects, therefore the GIL is acquired before creating them.
+    py::gil_scoped_acquire gil;
+    py::array_t< SampleType > base( numSamples, basePointer, py::none() );
+    py::list resultViews;
+    for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+    {
+      resultViews.append( py::array_t< SampleType >( numSamples, results[outIdx], py::none() ) );
+    }
+    std::vector< SampleType > const startDelayList( startDelays, startDelays + numOutputs );
+    std::vector< SampleType > const endDelayList( endDelays, endDelays + numOutputs );
+    std::vector< SampleType > const startGainList( startGains, startGains + numOutputs );
+    std::vector< SampleType > const endGainList( endGains, endGains + numOutputs );
+    PYBIND11_OVERLOAD_INT( void, FractionalDelayBase< SampleType >, "interpolateAccumulate", base, resultViews, numSamples,
+                           startDelayList, endDelayList, startGainList, endGainList );
+    FractionalDelayBase< SampleType >::interpolateAccumulate( basePointer, results, numOutputs, numSamples,
+                                                              startDelays, endDelays, startGains, endGains );
+  }
 };
 
 namespace // unnamed 
@@ -60,6 +86,36 @@ void interpolateWrapper( FractionalDelayBase< SampleType > & self,
   self.interpolate( basePtr, resultPtr, numSamples, startDelay, endDelay, startGain, endGain );
 }
 
+template< template<typename> class Container, typename SampleType >
+void interpolateAccumulateWrapper( FractionalDelayBase< SampleType > & self,
+                                   Container< SampleType > const & base,
+                                   std::vector< Container< SampleType > * > const & results,
+                                   std::size_t numSamples,
+                                   std::vector< SampleType > const & startDelays, std::vector< SampleType > const & endDelays,
+                                   std::vector< SampleType > const & startGains, std::vector< SampleType > const & endGains )
+{
+  std::size_t const numOutputs = results.size();
+  if( numOutputs > FractionalDelayBase< SampleType >::cMaxParallelOutputs )
+  {
+    throw std::invalid_argument( "FractionalDelayBase.interpolateAccumulate(): Number of outputs exceeds the maximum admissible number." );
+  }
+  if( (startDelays.size() != numOutputs) or (endDelays.size() != numOutputs)
+    or (startGains.size() != numOutputs) or (endGains.size() != numOutputs) )
+  {
+    throw std::invalid_argument( "FractionalDelayBase.interpolateAccumulate(): The delay and gain arguments must match the number of outputs." );
+  }
+  SampleType const * basePtr = visr::python::bindinghelpers::ContainerAccess<Container, SampleType >
+    ::constantPointer( base, numSamples, "base" );
+  std::array< SampleType *, FractionalDelayBase< SampleType >::cMaxParallelOutputs > resultPtrs;
+  for( std::size_t outIdx( 0 ); outIdx < numOutputs; ++outIdx )
+  {
+    resultPtrs[outIdx] = visr::python::bindinghelpers::ContainerAccess<Container, SampleType >
+      ::mutablePointer( *results[outIdx], numSamples, "results" );
+  }
+  self.interpolateAccumulate( basePtr, resultPtrs.data(), numOutputs, numSamples,
+                              startDelays.data(), endDelays.data(), startGains.data(), endGains.data() );
+}
+
 
 
 template< typename SampleType >
@@ -69,6 +125,13 @@ void exportFractionalDelayBase( pybind11::module & m, char const * className )
     .def( "methodDelay", &FractionalDelayBase< SampleType >::methodDelay )
     .def( "interpolate", &interpolateWrapper<visr::python::bindinghelpers::PyArray, SampleType > )
     .def( "interpolate", &interpolateWrapper<visr::efl::BasicVector, SampleType > )
+    .def( "interpolateAccumulate", &interpolateAccumulateWrapper<visr::python::bindinghelpers::PyArray, SampleType >,
+          py::arg( "base" ), py::arg( "results" ), py::arg( "numSamples" ),
+          py::arg( "startDelays" ), py::arg( "endDelays" ), py::arg( "startGains" ), py::arg( "endGains" ),
+          "Interpolate the base sequence with individual delay and gain ramps for each output and add the results to the output arrays." )
+    .def( "interpolateAccumulate", &interpolateAccumulateWrapper<visr::efl::BasicVector, SampleType >,
+          py::arg( "base" ), py::arg( "results" ), py::arg( "numSamples" ),
+          py::arg( "startDelays" ), py::arg( "endDelays" ), py::arg( "startGains" ), py::arg( "endGains" ) )
   ;
 }
 
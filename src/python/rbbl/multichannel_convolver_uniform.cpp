@@ -107,7 +107,7 @@ void exportMultichannelConvolverUniform( pybind11::module & m, char const * name
     .def( "removeRoutingEntry", static_cast<bool(MultichannelConvolverUniform<ElementType>::*)(std::size_t, std::size_t)>(&MultichannelConvolverUniform<ElementType>::removeRoutingEntry),
         pybind11::arg( "inputIndex" ), pybind11::arg( "outputIndex" ) )
     .def( "clearFilters", &MultichannelConvolverUniform<ElementType>::clearFilters )
-    .def( "initFilters", &MultichannelConvolverUniform<ElementType>::initFilters, pybind11::arg( "newFilters" ) )
+    .def( "initFilters", static_cast<void(MultichannelConvolverUniform<ElementType>::*)(efl::BasicMatrix<ElementType> const &)>(&MultichannelConvolverUniform<ElementType>::initFilters), pybind11::arg( "newFilters" ) )
     .def( "setImpulseResponse", &MultichannelConvolverUniform<ElementType>::setImpulseResponse,
       pybind11::arg("ir"), pybind11::arg( "filterLength"), pybind11::arg( "filterIdx" ), pybind11::arg( "alignment" ) = 0 )
   ;
@@ -36,13 +36,16 @@ Audio ports:
 Parameter ports:
   eqInput: Optional parameter input port for receiving updated EQ settings of type :obj:`pml.BiquadMatrixParameterFloat`.
            This port is activated by the constructor parameter `controlInputs` (default: :code:`True`)
+  activityInput: Optional parameter input port of type :obj:`pml.ChannelActivityParameter`. Inactive channels are
+           not processed and output silence. This port is activated by the constructor parameter `activityInput`
+           (default: :code:`False`)
 )" )
       .def(
           py::init< SignalFlowContext const &, char const *,
-                    CompositeComponent *, std::size_t, std::size_t, bool >(),
+                    CompositeComponent *, std::size_t, std::size_t, bool, bool >(),
           py::arg( "context" ), py::arg( "name" ), py::arg( "parent" ),
           py::arg( "numberOfChannels" ), py::arg( "numberOfBiquads" ),
-          py::arg( "controlInput" ) = true,
+          py::arg( "controlInput" ) = true, py::arg( "activityInput" ) = false,
           R"(Constructor that initialises all biquad IIR sections the default value (flat EQ).
 
 Args:
@@ -57,28 +60,31 @@ Args:
       .def( py::init< SignalFlowContext const &, char const *,
                       CompositeComponent *, std::size_t, std::size_t,
                       rbbl::BiquadCoefficient< SampleType > const &,
-                      bool >(),
+                      bool, bool >(),
             py::arg( "context" ), py::arg( "name" ), py::arg( "parent" ),
             py::arg( "numberOfChannels" ), py::arg( "numberOfBiquads" ),
             py::arg( "initialBiquad" ), py::arg( "controlInput" ) = true,
+            py::arg( "activityInput" ) = false,
             "Constructor initialising all biquad IIR sections to the same "
             "given value." )
       .def( py::init< SignalFlowContext const &, char const *,
                       CompositeComponent *, std::size_t, std::size_t,
                       rbbl::BiquadCoefficientList< SampleType > const &,
-                      bool >(),
+                      bool, bool >(),
             py::arg( "context" ), py::arg( "name" ), py::arg( "parent" ),
             py::arg( "numberOfChannels" ), py::arg( "numberOfBiquads" ),
             py::arg( "initialBiquads" ), py::arg( "controlInput" ) = true,
+            py::arg( "activityInput" ) = false,
             "Constructor initialising all channels to the same sequence of "
             "biquad IIR sections" )
       .def( py::init< SignalFlowContext const &, char const *,
                       CompositeComponent *, std::size_t, std::size_t,
                       rbbl::BiquadCoefficientMatrix< SampleType > const &,
-                      bool >(),
+                      bool, bool >(),
             py::arg( "context" ), py::arg( "name" ), py::arg( "parent" ),
             py::arg( "numberOfChannels" ), py::arg( "numberOfBiquads" ),
             py::arg( "initialBiquads" ), py::arg( "controlInput" ) = true,
+            py::arg( "activityInput" ) = false,
             "Constructor initialising the biquad IIR sections to individual "
             "values." );
 }
@@ -39,12 +39,17 @@ void exportDelayMatrix( pybind11::module & m )
     .def( pybind11::self & pybind11::self )
     ;
 
+  pybind11::enum_<DelayMatrix::ProcessingMode>( dVec, "ProcessingMode" )
+    .value( "Pairwise", DelayMatrix::ProcessingMode::Pairwise )
+    .value( "SharedInput", DelayMatrix::ProcessingMode::SharedInput )
+    ;
+
   dVec
     .def( pybind11::init<visr::SignalFlowContext const&, char const *, visr::CompositeComponent*>(),
       pybind11::arg("context"), pybind11::arg("name"), pybind11::arg("parent") = static_cast<visr::CompositeComponent*>(nullptr) )
     .def( pybind11::init<visr::SignalFlowContext const&, char const *, visr::CompositeComponent*, std::size_t,
                          std::size_t, std::size_t, SampleType, const char *, DelayMatrix::MethodDelayPolicy, DelayMatrix::ControlPortConfig,
-      SampleType, SampleType>(),
+      SampleType, SampleType, DelayMatrix::ProcessingMode>(),
        pybind11::arg( "context" ), pybind11::arg( "name" ), pybind11::arg( "parent" ) = static_cast<visr::CompositeComponent*>(nullptr),
        pybind11::arg( "numberOfInputs" ),
        pybind11::arg( "numberOfOutputs" ),
@@ -53,10 +58,11 @@ void exportDelayMatrix( pybind11::module & m )
        pybind11::arg( "methodDelayPolicy" ) = DelayMatrix::MethodDelayPolicy::Add,
        pybind11::arg( "controlInputs" ) = DelayMatrix::ControlPortConfig::None,
        pybind11::arg( "initialDelay" ) = 0.0f,
-       pybind11::arg( "initialGain" ) = 1.0f )
+       pybind11::arg( "initialGain" ) = 1.0f,
+      pybind11::arg( "processingMode" ) = DelayMatrix::ProcessingMode::Pairwise )
     .def( pybind11::init<visr::SignalFlowContext const&, char const *, visr::CompositeComponent*, std::size_t,
                          std::size_t, std::size_t, SampleType, const char *, DelayMatrix::MethodDelayPolicy, DelayMatrix::ControlPortConfig,
-                         efl::BasicMatrix< SampleType > const &, efl::BasicMatrix< SampleType > const &>(),
+                         efl::BasicMatrix< SampleType > const &, efl::BasicMatrix< SampleType > const &, DelayMatrix::ProcessingMode>(),
       pybind11::arg( "context" ), pybind11::arg( "name" ), pybind11::arg( "parent" ) = static_cast<visr::CompositeComponent*>(nullptr),
       pybind11::arg( "numberOfInputs" ),
       pybind11::arg( "numberOfOutputs" ),
@@ -65,9 +71,10 @@ void exportDelayMatrix( pybind11::module & m )
       pybind11::arg( "methodDelayPolicy" ) = DelayMatrix::MethodDelayPolicy::Add,
       pybind11::arg( "controlInputs" ) = DelayMatrix::ControlPortConfig::None,
       pybind11::arg( "initialDelay" ) = 0.0f,
-      pybind11::arg( "initialGain" ) = 1.0f )
+      pybind11::arg( "initialGain" ) = 1.0f,
+      pybind11::arg( "processingMode" ) = DelayMatrix::ProcessingMode::Pairwise )
     .def( "setup", static_cast<void(DelayMatrix::*)( std::size_t, std::size_t, std::size_t, SampleType,
-      const char *, DelayMatrix::MethodDelayPolicy, DelayMatrix::ControlPortConfig, SampleType, SampleType)>(&DelayMatrix::setup),
+      const char *, DelayMatrix::MethodDelayPolicy, DelayMatrix::ControlPortConfig, SampleType, SampleType, DelayMatrix::ProcessingMode)>(&DelayMatrix::setup),
       pybind11::arg( "numberOfInputs" ),
       pybind11::arg( "numberOfOutputs"),
       pybind11::arg( "interpolationSteps" ) = 1024, pybind11::arg( "maxDelay" ) = 3.0f,
@@ -75,9 +82,10 @@ void exportDelayMatrix( pybind11::module & m )
       pybind11::arg( "methodDelayPolicy") = DelayMatrix::MethodDelayPolicy::Add,
       pybind11::arg( "controlInputs") = DelayMatrix::ControlPortConfig::None,
       pybind11::arg( "initialDelay" ) = static_cast<SampleType>(0.0),
-      pybind11::arg( "initialGain" ) = static_cast<SampleType>(1.0) )
+      pybind11::arg( "initialGain" ) = static_cast<SampleType>(1.0),
+      pybind11::arg( "processingMode" ) = DelayMatrix::ProcessingMode::Pairwise )
     .def( "setup", static_cast<void(DelayMatrix::*)( std::size_t, std::size_t, std::size_t, SampleType,
-        const char *, DelayMatrix::MethodDelayPolicy, DelayMatrix::ControlPortConfig, efl::BasicMatrix<SampleType> const &, efl::BasicMatrix<SampleType>  const &)>(&DelayMatrix::setup),
+        const char *, DelayMatrix::MethodDelayPolicy, DelayMatrix::ControlPortConfig, efl::BasicMatrix<SampleType> const &, efl::BasicMatrix<SampleType>  const &, DelayMatrix::ProcessingMode)>(&DelayMatrix::setup),
         pybind11::arg( "numberOfInputs" ),
         pybind11::arg( "numberOfOutputs"),
         pybind11::arg( "interpolationSteps" ) = 1024,
@@ -86,7 +94,8 @@ void exportDelayMatrix( pybind11::module & m )
         pybind11::arg( "methodDelayPolicy") = DelayMatrix::MethodDelayPolicy::Add,
         pybind11::arg( "controlInputs") = DelayMatrix::ControlPortConfig::None,
         pybind11::arg( "initialDelays" ) /*= efl::BasicMatrix<SampleType>()*/,
-        pybind11::arg( "initialGains" ) /*= efl::BasicMatrix<SampleType>()*/ )
+        pybind11::arg( "initialGains" ) /*= efl::BasicMatrix<SampleType>()*/,
+        pybind11::arg( "processingMode" ) = DelayMatrix::ProcessingMode::Pairwise )
     ;
 }
 
@@ -63,6 +63,7 @@ void exportDelayVector( py::module & m )
     .value( "Delay", DelayVector::ControlPortConfig::Delay )
     .value( "Gain", DelayVector::ControlPortConfig::Gain )
     .value( "All", DelayVector::ControlPortConfig::All )
+    .value( "ChannelActivity", DelayVector::ControlPortConfig::ChannelActivity )
     .def( pybind11::self | py::self )
     .def( pybind11::self & py::self )
     ;
@@ -41,6 +41,12 @@ void exportFirFilterMatrix( py::module & m )
     .def( py::self & py::self )
    ;
 
+  py::enum_<FirFilterMatrix::ConvolutionMethod>( ffm, "ConvolutionMethod" )
+    .value( "Automatic", FirFilterMatrix::ConvolutionMethod::Automatic )
+    .value( "TimeDomain", FirFilterMatrix::ConvolutionMethod::TimeDomain )
+    .value( "Partitioned", FirFilterMatrix::ConvolutionMethod::Partitioned )
+   ;
+
   ffm
    //.def( py::init<visr::SignalFlowContext const&, char const *, visr::CompositeComponent*>(),
    //   py::arg("context"), py::arg("name"), py::arg("parent") = static_cast<visr::CompositeComponent*>(nullptr) )
@@ -56,7 +62,7 @@ void exportFirFilterMatrix( py::module & m )
     .def( py::init< visr::SignalFlowContext const&, char const *, visr::CompositeComponent*,
                     std::size_t, std::size_t, std::size_t, std::size_t, std::size_t, 
                     efl::BasicMatrix<SampleType> const &, rbbl::FilterRoutingList const &,
-                    FirFilterMatrix::ControlPortConfig, char const *>(),
+                    FirFilterMatrix::ControlPortConfig, char const *, FirFilterMatrix::ConvolutionMethod>(),
       py::arg( "context" ), py::arg( "name" ), py::arg( "parent" ),
       py::arg( "numberOfInputs" ),
       py::arg( "numberOfOutputs" ),
@@ -66,11 +72,13 @@ void exportFirFilterMatrix( py::module & m )
       py::arg( "filters" ) = pml::MatrixParameter<SampleType>(),  // We use a MatrixParameter as default argument because the base efl::BasicMatrix<SampleType> deliberately has no copy ctor.
       py::arg( "routings" ) = rbbl::FilterRoutingList(),
       py::arg( "controlInputs" ) = FirFilterMatrix::ControlPortConfig::None,
-      py::arg( "fftImplementation" ) = "default" )
+      py::arg( "fftImplementation" ) = "default",
+      py::arg( "method" ) = FirFilterMatrix::ConvolutionMethod::Automatic )
     .def( py::init( []( visr::SignalFlowContext const& context, char const * name, visr::CompositeComponent* parent,
         std::size_t numberOfInputs, std::size_t numberOfOutputs, std::size_t filterLength, std::size_t maxFilters, std::size_t maxRoutings,
         py::array const & filters, rbbl::FilterRoutingList const & routings,
-        FirFilterMatrix::ControlPortConfig controlInputs, char const * fftImplementation )
+        FirFilterMatrix::ControlPortConfig controlInputs, char const * fftImplementation,
+        FirFilterMatrix::ConvolutionMethod method )
      {
        // Todo: Consider moving the matrix parameter creation from Numpy arrays to a library.
        if( filters.ndim() != 2 )
@@ -93,7 +101,7 @@ void exportFirFilterMatrix( py::module & m )
        }
        FirFilterMatrix * inst = new FirFilterMatrix(context, name, parent,
           numberOfInputs, numberOfOutputs, filterLength, maxFilters, maxRoutings,
-          filterMtxParam, routings, controlInputs, fftImplementation );
+          filterMtxParam, routings, controlInputs, fftImplementation, method );
        return inst;
      }),
       py::arg( "context" ), py::arg( "name" ), py::arg( "parent" ),
@@ -105,7 +113,8 @@ void exportFirFilterMatrix( py::module & m )
       py::arg( "filters" ),
       py::arg( "routings" ) = rbbl::FilterRoutingList(),
       py::arg( "controlInputs" ) =  FirFilterMatrix::ControlPortConfig::None,
-      py::arg( "fftImplementation" ) = "default" )
+      py::arg( "fftImplementation" ) = "default",
+      py::arg( "method" ) = FirFilterMatrix::ConvolutionMethod::Automatic )
   ;
 }
 
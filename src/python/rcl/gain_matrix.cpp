@@ -34,34 +34,39 @@ void exportGainMatrix( pybind11::module & m )
                           std::size_t numberOfOutputs,
                           std::size_t interpolationSteps,
                           SampleType initialGain,
-                          bool controlInput )
+                          bool controlInput,
+                          bool activityInput )
       {
         GainMatrix * inst = new GainMatrix( context, name, parent );
-        inst->setup( numberOfInputs, numberOfOutputs, interpolationSteps, initialGain, controlInput );
+        inst->setup( numberOfInputs, numberOfOutputs, interpolationSteps, initialGain, controlInput, activityInput );
         return inst;
       }),  py::arg("context"), py::arg("name"), py::arg("parent"), py::arg("numberOfInputs"),
         py::arg( "numberOfOutputs" ), py::arg( "interpolationSteps" ) = 0,
         py::arg( "initialGains" ) = static_cast<SampleType>(1.0),
-        py::arg( "controlInput" ) = true )
+        py::arg( "controlInput" ) = true,
+        py::arg( "activityInput" ) = false )
       .def( py::init( []( SignalFlowContext const & context, char const * name,
                        CompositeComponent * parent, std::size_t numberOfInputs,
                        std::size_t numberOfOutputs,
                        std::size_t interpolationSteps,
                        efl::BasicMatrix< SampleType > const & initialGains,
-                       bool controlInput )
+                       bool controlInput,
+                       bool activityInput )
        {
          GainMatrix * inst = new GainMatrix( context, name, parent );
-         inst->setup( numberOfInputs, numberOfOutputs, interpolationSteps, initialGains, controlInput );
+         inst->setup( numberOfInputs, numberOfOutputs, interpolationSteps, initialGains, controlInput, activityInput );
          return inst;
        }),  py::arg("context"), py::arg("name"), py::arg("parent"), py::arg("numberOfInputs"),
        py::arg("numberOfOutputs"), py::arg("interpolationSteps"), py::arg("initialGains"),
-       py::arg("controlInput") = true )
+       py::arg("controlInput") = true,
+       py::arg("activityInput") = false )
        .def( py::init( []( SignalFlowContext const & context, char const * name,
                         CompositeComponent * parent, std::size_t numberOfInputs,
                         std::size_t numberOfOutputs,
                         std::size_t interpolationSteps,
                         py::array_t<SampleType> const & initialGains,
-                        bool controlInput )
+                        bool controlInput,
+                        bool activityInput )
         {
           efl::BasicMatrix<SampleType> const gains( bindinghelpers::matrixFromNdArray<SampleType>( initialGains, 0 ) );
           if( gains.numberOfRows() != numberOfOutputs or gains.numberOfColumns() != numberOfInputs )
@@ -69,11 +74,12 @@ void exportGainMatrix( pybind11::module & m )
             throw std::invalid_argument( "Size of the initial gains matrix does not match the expected shape" );
           }
           GainMatrix * inst = new GainMatrix( context, name, parent );
-          inst->setup( numberOfInputs, numberOfOutputs, interpolationSteps, gains, controlInput );
+          inst->setup( numberOfInputs, numberOfOutputs, interpolationSteps, gains, controlInput, activityInput );
           return inst;
         }),  py::arg("context"), py::arg("name"), py::arg("parent"), py::arg("numberOfInputs"),
         py::arg("numberOfOutputs"), py::arg("interpolationSteps"), py::arg("initialGains"),
-        py::arg("controlInput") = true )
+        py::arg("controlInput") = true,
+       py::arg("activityInput") = false )
 
     ;
 }
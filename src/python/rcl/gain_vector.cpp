@@ -22,16 +22,18 @@ void exportGainVector( pybind11::module & m )
   pybind11::class_<GainVector, visr::AtomicComponent>( m, "GainVector" )
    .def( pybind11::init<visr::SignalFlowContext const&, char const *, visr::CompositeComponent*>(),
       pybind11::arg("context"), pybind11::arg("name"), pybind11::arg("parent") = static_cast<visr::CompositeComponent*>(nullptr) )
-    .def( "setup", static_cast<void(GainVector::*)( std::size_t, std::size_t, bool, SampleType)>(&GainVector::setup), 
+    .def( "setup", static_cast<void(GainVector::*)( std::size_t, std::size_t, bool, SampleType, bool)>(&GainVector::setup), 
       pybind11::arg("numberOfChannels"),
       pybind11::arg( "interpolationSteps" ) = 1024,
       pybind11::arg("controlInputs") = false,
-      pybind11::arg( "initialGain" ) = 1.0f )
-    .def( "setup", static_cast<void(GainVector::*)(std::size_t, std::size_t, bool, efl::BasicVector<SampleType> const &)>(&GainVector::setup),
+      pybind11::arg( "initialGain" ) = 1.0f,
+      pybind11::arg( "activityInput" ) = false )
+    .def( "setup", static_cast<void(GainVector::*)(std::size_t, std::size_t, bool, efl::BasicVector<SampleType> const &, bool)>(&GainVector::setup),
       pybind11::arg( "numberOfChannels" ),
       pybind11::arg( "interpolationSteps" ) = 1024,
       pybind11::arg( "controlInputs" ) = false,
-      pybind11::arg( "initialGainsLinear" ) )
+      pybind11::arg( "initialGainsLinear" ),
+      pybind11::arg( "activityInput" ) = false )
     ;
 }
 
@@ -51,13 +51,15 @@ void exportInterpolatingFirFilterMatrix( py::module & m )
         efl::BasicMatrix<SampleType> const & filters,
         rbbl::InterpolationParameterSet const & interpolants,
         rbbl::FilterRoutingList const & routings,
-        InterpolatingFirFilterMatrix::ControlPortConfig controlInputs, char const * fftImplementation )
+        InterpolatingFirFilterMatrix::ControlPortConfig controlInputs, char const * fftImplementation,
+        std::size_t maxRank, SampleType rankTolerance )
      {
        InterpolatingFirFilterMatrix * inst
          = new InterpolatingFirFilterMatrix( context, name, parent,
                                            numberOfInputs, numberOfOutputs, filterLength, maxFilters, maxRoutings,
                                            numberOfInterpolants, transitionSamples,
-                                           filters, interpolants, routings, controlInputs, fftImplementation );
+                                           filters, interpolants, routings, controlInputs, fftImplementation,
+                                           maxRank, rankTolerance );
        return inst;
      }),
       py::arg( "context" ), py::arg( "name" ), py::arg( "parent" ),
@@ -72,7 +74,9 @@ void exportInterpolatingFirFilterMatrix( py::module & m )
       py::arg( "interpolants" ) = rbbl::InterpolationParameterSet(),
       py::arg( "routings" ) = rbbl::FilterRoutingList(),
       py::arg( "controlInputs" ) =  InterpolatingFirFilterMatrix::ControlPortConfig::None,
-      py::arg( "fftImplementation" ) = "default"
+      py::arg( "fftImplementation" ) = "default",
+      py::arg( "maxRank" ) = 0,
+      py::arg( "rankTolerance" ) = 0.0f
        )
     .def( py::init( []( visr::SignalFlowContext const& context, char const * name, visr::CompositeComponent* parent,
         std::size_t numberOfInputs, std::size_t numberOfOutputs, std::size_t filterLength, std::size_t maxFilters, std::size_t maxRoutings,
@@ -81,7 +85,8 @@ void exportInterpolatingFirFilterMatrix( py::module & m )
         py::array const & filters,
         rbbl::InterpolationParameterSet const & interpolants,
         rbbl::FilterRoutingList const & routings,
-        InterpolatingFirFilterMatrix::ControlPortConfig controlInputs, char const * fftImplementation )
+        InterpolatingFirFilterMatrix::ControlPortConfig controlInputs, char const * fftImplementation,
+        std::size_t maxRank, SampleType rankTolerance )
      {
        // Todo: Consider moving the matrix parameter creation from Numpy arrays to a library.
        if( filters.ndim() != 2 )
@@ -106,7 +111,8 @@ void exportInterpolatingFirFilterMatrix( py::module & m )
          = new InterpolatingFirFilterMatrix( context, name, parent,
                                            numberOfInputs, numberOfOutputs, filterLength, maxFilters, maxRoutings,
                                            numberOfInterpolants, transitionSamples,
-                                           filterMtxParam, interpolants, routings, controlInputs, fftImplementation );
+                                           filterMtxParam, interpolants, routings, controlInputs, fftImplementation,
+                                           maxRank, rankTolerance );
        return inst;
      }),
       py::arg( "context" ), py::arg( "name" ), py::arg( "parent" ),
@@ -121,7 +127,9 @@ void exportInterpolatingFirFilterMatrix( py::module & m )
       py::arg( "interpolants" ) = rbbl::InterpolationParameterSet(),
       py::arg( "routings" ) = rbbl::FilterRoutingList(),
       py::arg( "controlInputs" ) =  InterpolatingFirFilterMatrix::ControlPortConfig::None,
-      py::arg( "fftImplementation" ) = "default" )
+      py::arg( "fftImplementation" ) = "default",
+      py::arg( "maxRank" ) = 0,
+      py::arg( "rankTolerance" ) = 0.0f )
   ;
 }
 
@@ -13,6 +13,7 @@ namespace rcl
   void exportAdd( pybind11::module & m );
   void exportBiquadIirFilter( pybind11::module & m );
   void exportCAPGainCalculator( pybind11::module & m );
+  void exportChannelActivityCalculator( pybind11::module & m );
   void exportChannelObjectRoutingCalculator( pybind11::module & m );
   void exportCrossfadingFirFilterMatrix( pybind11::module & m );
   void exportDelayVector( pybind11::module & m );
@@ -38,6 +39,7 @@ namespace rcl
   void exportTimeFrequencyTransform( pybind11::module & m );
   void exportTimeFrequencyInverseTransform( pybind11::module & m );
   void exportUdpReceiver( pybind11::module & m );
+  void exportUdpSceneReceiver( pybind11::module & m );
   void exportUdpSender( pybind11::module & m );
 }
 }
@@ -60,6 +62,7 @@ In the future, however, this will change do a topical orgainisation.
   exportAdd( m );
   exportBiquadIirFilter( m );
   exportCAPGainCalculator( m );
+  exportChannelActivityCalculator( m );
   exportChannelObjectRoutingCalculator( m );
   exportCrossfadingFirFilterMatrix( m );
   exportDelayMatrix( m );
@@ -85,5 +88,6 @@ In the future, however, this will change do a topical orgainisation.
   exportTimeFrequencyInverseTransform( m );
   exportTimeFrequencyTransform( m );
   exportUdpReceiver( m );
+  exportUdpSceneReceiver( m );
   exportUdpSender( m );
 }
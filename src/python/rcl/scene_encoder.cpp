@@ -17,10 +17,19 @@ namespace rcl
 
 void exportSceneEncoder( pybind11::module & m )
 {
-  pybind11::class_<visr::rcl::SceneEncoder, visr::AtomicComponent >( m, "SceneEncoder" )
-    .def( pybind11::init<visr::SignalFlowContext const &, char const *, visr::CompositeComponent*>(),
+  using visr::rcl::SceneEncoder;
+  pybind11::class_<SceneEncoder, visr::AtomicComponent > enc( m, "SceneEncoder" );
+
+  pybind11::enum_<SceneEncoder::Encoding>( enc, "Encoding" )
+    .value( "Json", SceneEncoder::Encoding::Json )
+    .value( "Binary", SceneEncoder::Encoding::Binary )
+    ;
+
+  enc
+    .def( pybind11::init<visr::SignalFlowContext const &, char const *, visr::CompositeComponent*, SceneEncoder::Encoding>(),
           pybind11::arg( "context" ), pybind11::arg( "name" ),
-          pybind11::arg("parent") = static_cast<visr::CompositeComponent*>(nullptr) )
+          pybind11::arg("parent") = static_cast<visr::CompositeComponent*>(nullptr),
+          pybind11::arg("encoding") = SceneEncoder::Encoding::Json )
   ;
 }
 
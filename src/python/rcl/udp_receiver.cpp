@@ -31,6 +31,8 @@ void exportUdpReceiver( py::module & m )
                         std::size_t, UdpReceiver::Mode>(),
   py::arg("context"), py::arg("name"), py::arg("parent") = static_cast<CompositeComponent*>(nullptr),
   py::arg("port"), py::arg("mode") = UdpReceiver::Mode::Asynchronous )
+  .def_property_readonly( "port", &UdpReceiver::port )
+  .def_property_readonly( "numberOfReceivedMessages", &UdpReceiver::numberOfReceivedMessages )
   ;
 }
 
@@ -0,0 +1,34 @@
+/* Copyright Institute of Sound and Vibration Research - All rights reserved */
+
+#include <librcl/udp_scene_receiver.hpp>
+
+#include <libvisr/atomic_component.hpp>
+#include <libvisr/composite_component.hpp>
+#include <libvisr/signal_flow_context.hpp>
+
+#include <pybind11/pybind11.h>
+
+namespace visr
+{
+namespace python
+{
+namespace rcl
+{
+
+namespace py = pybind11;
+
+void exportUdpSceneReceiver( py::module & m )
+{
+  using visr::rcl::UdpSceneReceiver;
+
+  py::class_<UdpSceneReceiver, visr::AtomicComponent >( m, "UdpSceneReceiver" )
+    .def( py::init<SignalFlowContext const &, char const *, CompositeComponent *, std::size_t>(),
+      py::arg("context"), py::arg("name"), py::arg("parent") = static_cast<CompositeComponent*>(nullptr),
+      py::arg("port") )
+    .def_property_readonly( "port", &UdpSceneReceiver::port )
+  ;
+}
+
+} // namepace rcl
+} // namespace python
+} // namespace visr
@@ -7,11 +7,14 @@
 #endif
 
 #include <libvisr/component.hpp>
+#include <libvisr/parameter_base.hpp>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 
 #include <ciso646>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace visr
@@ -173,9 +176,46 @@ R"(Implement the "__exit__" method of the ContextManager API. Called within the
      py::return_value_policy::take_ownership, "process() variant for flows with no audio inputs." )
    .def( "parameterExchangeMutex", &AudioSignalFlow::parameterExchangeMutex,
      py::return_value_policy::reference, R"(Obtain the mutex for guarding the parameter data exchange,)" )
+   .def_property( "parameterExchangeLocking", &AudioSignalFlow::parameterExchangeLocking, &AudioSignalFlow::setParameterExchangeLocking,
+     R"(Whether the audio processing locks the parameter exchange mutex in each process() call.)" )
+   .def( "injectParameter", static_cast<bool(AudioSignalFlow::*)(char const *, ParameterBase const &)>(&AudioSignalFlow::injectParameter),
+     py::arg( "portName" ), py::arg( "value" ),
+     R"(Pass a copy of a parameter to a top-level parameter input without locking. Returns False if the queue of the port is full.)" )
+   .def( "enablePipeline", static_cast<void(AudioSignalFlow::*)(std::size_t, int, bool)>(&AudioSignalFlow::enablePipeline),
+     py::arg( "numberOfStages" ), py::arg( "realtimePriority" ) = 0, py::arg( "cpuAffinity" ) = false,
+     R"(Execute the flow in a number of concurrent pipeline stages, dividing the components automatically.)" )
+   .def( "enablePipeline",
+     []( AudioSignalFlow & flow, py::dict const & stageAssignments, int realtimePriority, bool cpuAffinity )
+     {
+       std::map<std::string, std::size_t> assignments;
+       for( auto const & entry : stageAssignments )
+       {
+         assignments[ entry.first.cast<std::string>() ] = entry.second.cast<std::size_t>();
+       }
+       flow.enablePipeline( assignments, realtimePriority, cpuAffinity );
+     },
+     py::arg( "stageAssignments" ), py::arg( "realtimePriority" ) = 0, py::arg( "cpuAffinity" ) = false,
+     R"(Execute the flow in concurrent pipeline stages, using a dictionary from component names to stage indices.)" )
+   .def( "disablePipeline", &AudioSignalFlow::disablePipeline, R"(Return to sequential execution.)" )
+   .def_property_readonly( "numberOfPipelineStages", &AudioSignalFlow::numberOfPipelineStages )
+   .def( "pipelineStageAssignment",
+     []( AudioSignalFlow const & flow )
+     {
+       py::dict result;
+       for( auto const & entry : flow.pipelineStageAssignment() )
+       {
+         result[ py::str( entry.first ) ] = entry.second;
+       }
+       return result;
+     },
+     R"(Return a dictionary mapping the names of all atomic components to their pipeline stage.)" )
 #ifdef VISR_RRL_RUNTIME_SYSTEM_PROFILING
+   .def( "setSilenceDetection", &AudioSignalFlow::setSilenceDetection, py::arg( "enable" ), py::arg( "threshold" ) = static_cast<SampleType>(0.0),
+         "Enable or disable marking silent capture channels, such that components supporting silence flags can skip processing." )
+   .def_property_readonly( "silenceDetectionEnabled", &AudioSignalFlow::silenceDetectionEnabled )
    .def( "runtimeProfilingEnabled", &AudioSignalFlow::runtimeProfilingEnabled )
-   .def( "enableRuntimeProfiling", &AudioSignalFlow::enableRuntimeProfiling, py::arg( "measurementBufferSize" ) )
+   .def( "enableRuntimeProfiling", &AudioSignalFlow::enableRuntimeProfiling, py::arg( "measurementBufferSize" ),
+         py::arg( "hardwareCounters" ) = false )
    .def( "disableRuntimeProfiling", &AudioSignalFlow::disableRuntimeProfiling )
    .def( "runtimeProfiler", static_cast< visr::rrl::RuntimeProfiler &(AudioSignalFlow::*)()>(
       &AudioSignalFlow::runtimeProfiler ), py::return_value_policy::reference )
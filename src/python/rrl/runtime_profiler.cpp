@@ -27,7 +27,16 @@ namespace rrl
 
 void exportRuntimeProfiler( py::module & m )
 {
-  py::class_< RuntimeProfiler >( m, "RuntimeProfiler" )
+  py::class_< RuntimeProfiler > profiler( m, "RuntimeProfiler" );
+
+  py::enum_< RuntimeProfiler::HardwareCounter >( profiler, "HardwareCounter" )
+    .value( "Cycles", RuntimeProfiler::HardwareCounter::Cycles )
+    .value( "Instructions", RuntimeProfiler::HardwareCounter::Instructions )
+    .value( "CacheMisses", RuntimeProfiler::HardwareCounter::CacheMisses )
+    .value( "BranchMisses", RuntimeProfiler::HardwareCounter::BranchMisses )
+  ;
+
+  profiler
    // No constructoers are exported, as we will only use a reference returned
   // from the audio signal flow.
   .def_property_readonly( "numberOfComponents", &RuntimeProfiler::numberOfComponents )
@@ -122,6 +131,22 @@ void exportRuntimeProfiler( py::module & m )
     py::tuple ret = py::make_tuple( numCycles, meanArray, varianceArray );
     return ret;
    } )
+   .def_property_readonly( "hardwareCountersEnabled", &RuntimeProfiler::hardwareCountersEnabled )
+   .def( "attachToCurrentThread", &RuntimeProfiler::attachToCurrentThread )
+   .def( "getHardwareCounterStatistics", []( RuntimeProfiler const & self, RuntimeProfiler::HardwareCounter counter )
+   {
+    visr::efl::BasicVector<RuntimeProfiler::TimeType> mean( self.numberOfComponents(), 0/*alignment*/ );
+    visr::efl::BasicVector<RuntimeProfiler::TimeType> variance( self.numberOfComponents(), 0/*alignment*/ );
+    std::size_t numCycles;
+    {
+      py::gil_scoped_release guard;
+      numCycles = self.getHardwareCounterStatistics( counter, mean, variance );
+    }
+    py::array_t<RuntimeProfiler::TimeType> meanArray = ::visr::python::bindinghelpers::ndArrayFromBasicVector( mean );
+    py::array_t<RuntimeProfiler::TimeType> varianceArray = ::visr::python::bindinghelpers::ndArrayFromBasicVector( variance );
+    py::tuple ret = py::make_tuple( numCycles, meanArray, varianceArray );
+    return ret;
+   }, py::arg( "counter" ) )
   ;
 }
 
@@ -39,6 +39,11 @@ void exportAtomicComponent( pybind11::module& m )
     .def( pybind11::init<SignalFlowContext &, char const*, CompositeComponent *>(),
           pybind11::arg("context"), pybind11::arg("name"), pybind11::arg("parent")=static_cast<CompositeComponent *>(nullptr) )
     .def( "process", &AtomicComponent::process )
+    .def( "setExecutionInterval", &AtomicComponent::setExecutionInterval,
+          pybind11::arg( "interval" ), pybind11::arg( "phase" ) = static_cast<std::size_t>(AtomicComponent::cAutomaticPhase) )
+    .def_property_readonly( "executionInterval", &AtomicComponent::executionInterval )
+    .def_property_readonly( "executionPhase", &AtomicComponent::executionPhase )
+    .def_property_readonly_static( "automaticPhase", []( pybind11::object ){ return AtomicComponent::cAutomaticPhase; } )
     ;
 }
 
@@ -20,6 +20,7 @@
 
 #include <ciso646>
 #include <cstdint>
+#include <stdexcept>
 
 namespace visr
 {
@@ -180,6 +181,16 @@ void exportAudioPort( py::module & m)
     .def_property_readonly( "fullName", []( AudioPortBase const & port ) { return port.implementation().parent().name()
     + ":" +port.implementation().name(); }, "Return the port name as a component:port combination with a fully hierarchical component name." )
     .def_property_readonly( "direction", []( AudioPortBase const & port ) { return port.implementation().direction(); } )
+    .def( "silent", []( AudioPortBase const & port, std::size_t channel )
+      {
+        if( channel >= port.width() ) throw std::out_of_range( "AudioPortBase.silent(): Channel index exceeds the port width." );
+        return port.silent( channel );
+      }, py::arg( "channel" ), "Query whether the signal of a channel is marked as silent in the current block." )
+    .def( "setSilent", []( AudioPortBase & port, std::size_t channel, bool silent )
+      {
+        if( channel >= port.width() ) throw std::out_of_range( "AudioPortBase.setSilent(): Channel index exceeds the port width." );
+        port.setSilent( channel, silent );
+      }, py::arg( "channel" ), py::arg( "silent" ), "Mark the signal of a channel as silent or non-silent." )
     ;
 
   /**